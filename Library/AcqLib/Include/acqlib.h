@@ -0,0 +1,139 @@
+/**************************************************************************//**
+ * @file     acqlib.h
+ * @version  V1.00
+ * @brief    Timer-triggered auto-operation acquisition library header file
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __ACQLIB_H
+#define __ACQLIB_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "NuMicro.h"
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup ACQLIB Acquisition Library
+  @{
+*/
+
+/** @addtogroup ACQLIB_EXPORTED_CONSTANTS Acquisition Library Exported Constants
+  @{
+*/
+
+#define ACQLIB_STREAM_MAX       4UL     /*!< Maximum number of streams in a plan */
+#define ACQLIB_BATCH_MAX        8UL     /*!< Maximum number of batches in the ring of a stream */
+#define ACQLIB_CMD_MAX          4UL     /*!< Maximum command bytes sent on each trigger */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Stream sources                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+#define ACQLIB_SRC_I2C          0UL     /*!< I2C random read: SLA+W, command bytes, repeated START, SLA+R and record bytes */
+#define ACQLIB_SRC_ADC          1UL     /*!< ADC single cycle scan of a channel mask, one 16-bit sample per channel */
+#define ACQLIB_SRC_SPI          2UL     /*!< SPI master receives the record words in the RX phase */
+#define ACQLIB_SRC_UART         3UL     /*!< UART sends the command bytes and receives the record bytes */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Error codes                                                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+#define ACQLIB_ERR_PARAM        (-1L)   /*!< Invalid plan or parameter */
+#define ACQLIB_ERR_NO_CH        (-2L)   /*!< Not enough free PDMA channels */
+#define ACQLIB_ERR_SCATBA       (-3L)   /*!< Instance is out of the PDMA descriptor window addressed by SCATBA */
+#define ACQLIB_ERR_OVERRUN      (-4L)   /*!< Unread batches were overwritten, the oldest ones are dropped */
+
+/** @} end of group ACQLIB_EXPORTED_CONSTANTS */
+
+
+/** @addtogroup ACQLIB_EXPORTED_STRUCTS Acquisition Library Exported Structs
+  @{
+*/
+
+/**
+  * @details    One stream of a plan. The peripheral is opened by the application (clock, pins, bus speed),
+  *             the library programs its automatic operation, PDMA and the ring.
+  */
+typedef struct
+{
+    uint32_t u32Source;             /*!< \ref ACQLIB_SRC_I2C, \ref ACQLIB_SRC_ADC, \ref ACQLIB_SRC_SPI or \ref ACQLIB_SRC_UART */
+    void *pvPort;                   /*!< I2C_T, ADC_T, SPI_T or UART_T instance */
+    uint32_t u32Addr;               /*!< I2C: 7-bit slave address. ADC: channel mask. Unused for SPI and UART */
+    uint8_t au8Cmd[ACQLIB_CMD_MAX]; /*!< I2C: register address. UART: request. Sent on each trigger */
+    uint32_t u32CmdLen;             /*!< Bytes of au8Cmd. I2C needs at least 1, UART 0 means receive only */
+    uint32_t u32RecordLen;          /*!< Bytes (I2C, UART) or words (SPI) read on each trigger. Unused for ADC */
+    void *pvRing;                   /*!< Ring of u32BatchNum * u32BatchLen records, aligned to the transfer width */
+    uint32_t u32BatchLen;           /*!< Records per batch, the CPU is woken up once per batch */
+    uint32_t u32BatchNum;           /*!< Batches in the ring, 2 ~ \ref ACQLIB_BATCH_MAX */
+} ACQLIB_STREAM_T;
+
+/**
+  * @details    Acquisition plan: every trigger of the timer reads one record of each stream.
+  */
+typedef struct
+{
+    TIMER_T *timer;                 /*!< Trigger timer. Its clock must keep running in power-down (LIRC or LXT) */
+    uint32_t u32Freq;               /*!< Triggers per second */
+    const ACQLIB_STREAM_T *psStream; /*!< Streams of the plan */
+    uint32_t u32StreamNum;          /*!< Number of streams, 1 ~ \ref ACQLIB_STREAM_MAX */
+} ACQLIB_PLAN_T;
+
+/**
+  * @details    Ring state of one stream.
+  */
+typedef struct
+{
+    const ACQLIB_STREAM_T *psCfg;   /*!< Stream of the plan */
+    DSCT_T asDesc[ACQLIB_BATCH_MAX]; /*!< RX descriptors, one per batch, linked in a loop */
+    DSCT_T sCmdDesc;                /*!< TX descriptor of the command, linked to itself */
+    uint8_t au8Cmd[ACQLIB_CMD_MAX + 2UL]; /*!< Command bytes sent by PDMA on each trigger */
+    int32_t i32RxCh;                /*!< RX PDMA channel */
+    int32_t i32TxCh;                /*!< TX PDMA channel, -1 if none */
+    uint32_t u32RxReq;              /*!< PDMA request source of the RX channel */
+    uint32_t u32TxReq;              /*!< PDMA request source of the TX channel */
+    uint32_t u32BatchBytes;         /*!< Bytes of one batch */
+    volatile uint32_t u32Produced;  /*!< Batches completed by PDMA */
+    uint32_t u32Consumed;           /*!< Batches released by the application */
+} ACQLIB_RING_T;
+
+/**
+  * @details    Acquisition instance.
+  */
+typedef struct
+{
+    TIMER_T *timer;                 /*!< Trigger timer */
+    uint32_t u32StreamNum;          /*!< Number of streams */
+    uint32_t u32PDMode;             /*!< Deepest power-down mode all streams can run in */
+    ACQLIB_RING_T asRing[ACQLIB_STREAM_MAX]; /*!< Ring state of each stream */
+} ACQLIB_T;
+
+/** @} end of group ACQLIB_EXPORTED_STRUCTS */
+
+
+/** @addtogroup ACQLIB_EXPORTED_FUNCTIONS Acquisition Library Exported Functions
+  @{
+*/
+
+int32_t  ACQLIB_Open(ACQLIB_T *psAcq, const ACQLIB_PLAN_T *psPlan);
+void     ACQLIB_Close(ACQLIB_T *psAcq);
+void     ACQLIB_Start(ACQLIB_T *psAcq);
+void     ACQLIB_Stop(ACQLIB_T *psAcq);
+int32_t  ACQLIB_GetBatch(ACQLIB_T *psAcq, uint32_t u32Stream, void **ppvBatch);
+void     ACQLIB_ReleaseBatch(ACQLIB_T *psAcq, uint32_t u32Stream);
+void     ACQLIB_PowerDown(ACQLIB_T *psAcq);
+
+/** @} end of group ACQLIB_EXPORTED_FUNCTIONS */
+/** @} end of group ACQLIB */
+/** @} end of group Library */
+
+#ifdef __cplusplus
+}
+
+#endif
+
+#endif  /* __ACQLIB_H */
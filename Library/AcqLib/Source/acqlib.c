@@ -0,0 +1,710 @@
+/**************************************************************************//**
+ * @file     acqlib.c
+ * @version  V1.00
+ * @brief    Timer-triggered auto-operation acquisition library source file
+ *
+ * @details
+ *           A plan lists the streams read on each time-out of one timer, for
+ *           example "every 10 ms read 6 bytes from an I2C sensor, 4 ADC
+ *           channels and an SPI frame". The library programs the timer
+ *           auto-operation trigger, the AUTOCTL of each peripheral and one
+ *           PDMA channel per direction, so the transfers go on while the chip
+ *           is in power-down.
+ *
+ *           Each ring is split in batches. Every batch has its own descriptor
+ *           and the last one links back to the first, so PDMA never stops.
+ *           Only the end of a batch raises the PDMA interrupt, which is the
+ *           single wake-up source of the CPU. The command bytes of I2C and
+ *           UART streams are sent by a descriptor linked to itself.
+ *
+ *           The application must call PDMA_IRQHandler(PDMA0) from
+ *           PDMA0_IRQHandler.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include "acqlib.h"
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup ACQLIB Acquisition Library
+  @{
+*/
+
+/* PDMA request sources and data register of a stream */
+typedef struct
+{
+    uint32_t u32RxReq;
+    uint32_t u32TxReq;
+    uint32_t u32RxAddr;
+    uint32_t u32TxAddr;
+    uint32_t u32Width;
+    uint32_t u32PDMode;
+} ACQLIB_PORT_T;
+
+/* Index of the timer in the TRIGSEL fields of the peripherals */
+static uint32_t ACQLIB_TimerIndex(TIMER_T *timer)
+{
+    if(timer == TIMER0)
+        return 0UL;
+    else if(timer == TIMER1)
+        return 1UL;
+    else if(timer == TIMER2)
+        return 2UL;
+    else if(timer == TIMER3)
+        return 3UL;
+
+    return 0xFFFFFFFFUL;
+}
+
+static uint32_t ACQLIB_BitCount(uint32_t u32Mask)
+{
+    uint32_t u32Cnt = 0UL;
+
+    while(u32Mask)
+    {
+        u32Mask &= (u32Mask - 1UL);
+        u32Cnt++;
+    }
+
+    return u32Cnt;
+}
+
+/* Look up the PDMA connection of a stream and check its parameters */
+static int32_t ACQLIB_GetPort(const ACQLIB_STREAM_T *psCfg, ACQLIB_PORT_T *psPort, uint32_t *pu32Elems)
+{
+    uint32_t u32Idx, u32Width;
+
+    if(psCfg->u32CmdLen > ACQLIB_CMD_MAX)
+        return ACQLIB_ERR_PARAM;
+
+    psPort->u32TxReq = PDMA_MEM;
+    psPort->u32TxAddr = 0UL;
+    psPort->u32PDMode = CLK_PMUCTL_PDMSEL_NPD1;
+
+    switch(psCfg->u32Source)
+    {
+        case ACQLIB_SRC_I2C:
+        {
+            I2C_T *i2c = (I2C_T *)psCfg->pvPort;
+
+            if(i2c == I2C0)
+                u32Idx = 0UL;
+            else if(i2c == I2C1)
+                u32Idx = 1UL;
+            else if(i2c == I2C2)
+                u32Idx = 2UL;
+            else
+                return ACQLIB_ERR_PARAM;
+
+            /* RXCNT and TXCNT hold count - 1 in 8 bits */
+            if((psCfg->u32Addr > 0x7FUL) || (psCfg->u32CmdLen == 0UL) ||
+                    (psCfg->u32RecordLen == 0UL) || (psCfg->u32RecordLen > 256UL))
+                return ACQLIB_ERR_PARAM;
+
+            psPort->u32RxReq = PDMA_I2C0_RX + u32Idx * 2UL;
+            psPort->u32TxReq = PDMA_I2C0_TX + u32Idx * 2UL;
+            psPort->u32RxAddr = (uint32_t)&i2c->DAT;
+            psPort->u32TxAddr = (uint32_t)&i2c->DAT;
+            psPort->u32Width = PDMA_WIDTH_8;
+            *pu32Elems = psCfg->u32RecordLen;
+            break;
+        }
+
+        case ACQLIB_SRC_ADC:
+        {
+            ADC_T *adc = (ADC_T *)psCfg->pvPort;
+
+            if((adc != ADC0) || (psCfg->u32Addr == 0UL) || (psCfg->u32Addr & ~ADC_ADCHER_CHEN_Msk))
+                return ACQLIB_ERR_PARAM;
+
+            psPort->u32RxReq = PDMA_ADC0_RX;
+            psPort->u32RxAddr = (uint32_t)&adc->ADPDMA;
+            psPort->u32Width = PDMA_WIDTH_16;
+            *pu32Elems = ACQLIB_BitCount(psCfg->u32Addr);
+            break;
+        }
+
+        case ACQLIB_SRC_SPI:
+        {
+            SPI_T *spi = (SPI_T *)psCfg->pvPort;
+
+            if(spi == SPI0)
+                u32Idx = 0UL;
+            else if(spi == SPI1)
+                u32Idx = 1UL;
+            else if(spi == SPI2)
+                u32Idx = 2UL;
+            else
+                return ACQLIB_ERR_PARAM;
+
+            /* TCNT is 8 bits */
+            if((psCfg->u32RecordLen == 0UL) || (psCfg->u32RecordLen > 255UL))
+                return ACQLIB_ERR_PARAM;
+
+            /* DWIDTH 0 means 32 bits */
+            u32Width = (spi->CTL & SPI_CTL_DWIDTH_Msk) >> SPI_CTL_DWIDTH_Pos;
+
+            if((u32Width != 0UL) && (u32Width <= 8UL))
+                psPort->u32Width = PDMA_WIDTH_8;
+            else if((u32Width != 0UL) && (u32Width <= 16UL))
+                psPort->u32Width = PDMA_WIDTH_16;
+            else
+                psPort->u32Width = PDMA_WIDTH_32;
+
+            psPort->u32RxReq = PDMA_SPI0_RX + u32Idx * 2UL;
+            psPort->u32RxAddr = (uint32_t)&spi->RX;
+            psPort->u32PDMode = CLK_PMUCTL_PDMSEL_NPD2;
+            *pu32Elems = psCfg->u32RecordLen;
+            break;
+        }
+
+        case ACQLIB_SRC_UART:
+        {
+            UART_T *uart = (UART_T *)psCfg->pvPort;
+
+            if(uart == UART0)
+                u32Idx = 0UL;
+            else if(uart == UART1)
+                u32Idx = 1UL;
+            else if(uart == UART2)
+                u32Idx = 2UL;
+            else
+                return ACQLIB_ERR_PARAM;
+
+            if(psCfg->u32RecordLen == 0UL)
+                return ACQLIB_ERR_PARAM;
+
+            psPort->u32RxReq = PDMA_UART0_RX + u32Idx * 2UL;
+            psPort->u32RxAddr = (uint32_t)&uart->DAT;
+
+            if(psCfg->u32CmdLen != 0UL)
+            {
+                psPort->u32TxReq = PDMA_UART0_TX + u32Idx * 2UL;
+                psPort->u32TxAddr = (uint32_t)&uart->DAT;
+            }
+
+            psPort->u32Width = PDMA_WIDTH_8;
+            *pu32Elems = psCfg->u32RecordLen;
+            break;
+        }
+
+        default:
+            return ACQLIB_ERR_PARAM;
+    }
+
+    return 0;
+}
+
+/* Build the descriptor loop of the ring and the command descriptor */
+static int32_t ACQLIB_BuildRing(ACQLIB_RING_T *psRing, const ACQLIB_PORT_T *psPort, uint32_t u32Elems)
+{
+    const ACQLIB_STREAM_T *psCfg = psRing->psCfg;
+    uint32_t i, u32Next, u32BatchElems, u32CmdLen;
+
+    u32BatchElems = u32Elems * psCfg->u32BatchLen;
+
+    if((u32BatchElems == 0UL) || (u32BatchElems > PDMA_TXCNT_MAX) ||
+            ((u32BatchElems / psCfg->u32BatchLen) != u32Elems))
+        return ACQLIB_ERR_PARAM;
+
+    psRing->u32BatchBytes = u32BatchElems << (psPort->u32Width >> PDMA_DSCT_CTL_TXWIDTH_Pos);
+
+    for(i = 0UL; i < psCfg->u32BatchNum; i++)
+    {
+        if(PDMA_DescInit(&psRing->asDesc[i], psPort->u32Width, psPort->u32RxAddr, PDMA_SAR_FIX,
+                         (uint32_t)psCfg->pvRing + i * psRing->u32BatchBytes, PDMA_DAR_INC,
+                         u32BatchElems, PDMA_REQ_SINGLE) != 0)
+            return ACQLIB_ERR_PARAM;
+    }
+
+    /* The end of each batch raises the transfer done interrupt */
+    for(i = 0UL; i < psCfg->u32BatchNum; i++)
+    {
+        u32Next = (i + 1UL == psCfg->u32BatchNum) ? 0UL : (i + 1UL);
+
+        if(PDMA_DescLink(PDMA0, &psRing->asDesc[i], &psRing->asDesc[u32Next], TRUE) != 0)
+            return ACQLIB_ERR_SCATBA;
+    }
+
+    if(psPort->u32TxReq == PDMA_MEM)
+        return 0;
+
+    if(psCfg->u32Source == ACQLIB_SRC_I2C)
+    {
+        /* SLA+W, register address, SLA+R of the random read */
+        psRing->au8Cmd[0] = (uint8_t)(psCfg->u32Addr << 1);
+
+        for(i = 0UL; i < psCfg->u32CmdLen; i++)
+            psRing->au8Cmd[i + 1UL] = psCfg->au8Cmd[i];
+
+        psRing->au8Cmd[i + 1UL] = (uint8_t)((psCfg->u32Addr << 1) | 0x1UL);
+        u32CmdLen = psCfg->u32CmdLen + 2UL;
+    }
+    else
+    {
+        for(i = 0UL; i < psCfg->u32CmdLen; i++)
+            psRing->au8Cmd[i] = psCfg->au8Cmd[i];
+
+        u32CmdLen = psCfg->u32CmdLen;
+    }
+
+    if(PDMA_DescInit(&psRing->sCmdDesc, PDMA_WIDTH_8, (uint32_t)psRing->au8Cmd, PDMA_SAR_INC,
+                     psPort->u32TxAddr, PDMA_DAR_FIX, u32CmdLen, PDMA_REQ_SINGLE) != 0)
+        return ACQLIB_ERR_PARAM;
+
+    /* Sent again on every trigger without a table done interrupt */
+    if(PDMA_DescLink(PDMA0, &psRing->sCmdDesc, &psRing->sCmdDesc, FALSE) != 0)
+        return ACQLIB_ERR_SCATBA;
+
+    return 0;
+}
+
+/* Program the automatic operation of the peripheral, triggered by timer u32TmrIdx */
+static void ACQLIB_EnablePort(const ACQLIB_STREAM_T *psCfg, uint32_t u32TmrIdx)
+{
+    switch(psCfg->u32Source)
+    {
+        case ACQLIB_SRC_I2C:
+        {
+            I2C_T *i2c = (I2C_T *)psCfg->pvPort;
+
+            i2c->AUTOCTL = (i2c->AUTOCTL & ~(I2C_AUTOCTL_AUTOMODE_Msk | I2C_AUTOCTL_TGSRCSEL_Msk | I2C_AUTOCTL_TRGEN_Msk)) |
+                           I2C_RANDOM_REPEAT_STA | (u32TmrIdx << I2C_AUTOCTL_TGSRCSEL_Pos);
+            i2c->AUTOCNT = ((psCfg->u32RecordLen - 1UL) << I2C_AUTOCNT_RXCNT_Pos) |
+                           ((psCfg->u32CmdLen + 1UL) << I2C_AUTOCNT_TXCNT_Pos);
+            I2C_SET_CONTROL_REG(i2c, I2C_CTL_AA);
+            i2c->AUTOCTL |= I2C_AUTOCTL_TRGEN_Msk;
+            break;
+        }
+
+        case ACQLIB_SRC_ADC:
+        {
+            ADC_T *adc = (ADC_T *)psCfg->pvPort;
+
+            ADC_Open(adc, 0UL, ADC_ADCR_ADMD_SINGLE_CYCLE, psCfg->u32Addr);
+            ADC_ENABLE_PDMA(adc);
+            ADC_SelectAutoOperationMode(adc, u32TmrIdx << ADC_AUTOCTL_TRIGSEL_Pos);
+            break;
+        }
+
+        case ACQLIB_SRC_SPI:
+        {
+            SPI_T *spi = (SPI_T *)psCfg->pvPort;
+
+            /* Receive the frame in the RX phase only */
+            spi->AUTOCTL = (spi->AUTOCTL & ~(SPI_AUTOCTL_TRIGSEL_Msk | SPI_AUTOCTL_TCNT_Msk | SPI_AUTOCTL_FULLRXEN_Msk |
+                                             SPI_AUTOCTL_CNTIEN_Msk | SPI_AUTOCTL_CNTWKEN_Msk)) |
+                           (u32TmrIdx << SPI_AUTOCTL_TRIGSEL_Pos) | (psCfg->u32RecordLen << SPI_AUTOCTL_TCNT_Pos);
+            SPI_TRIGGER_RX_PDMA(spi);
+            spi->AUTOCTL |= (SPI_AUTOCTL_TRIGEN_Msk | SPI_AUTOCTL_AUTOEN_Msk);
+            break;
+        }
+
+        case ACQLIB_SRC_UART:
+        {
+            UART_T *uart = (UART_T *)psCfg->pvPort;
+
+            uart->AUTOCTL = (uart->AUTOCTL & ~(UART_AUTOCTL_TRIGSEL_Msk | UART_AUTOCTL_TRIGEN_Msk)) |
+                            (u32TmrIdx << UART_AUTOCTL_TRIGSEL_Pos) | UART_AUTOCTL_AOEN_Msk;
+            uart->INTEN |= UART_INTEN_RXPDMAEN_Msk;
+
+            if(psCfg->u32CmdLen != 0UL)
+            {
+                uart->INTEN |= UART_INTEN_TXPDMAEN_Msk;
+                uart->AUTOCTL |= UART_AUTOCTL_TRIGEN_Msk;
+            }
+
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+static void ACQLIB_DisablePort(const ACQLIB_STREAM_T *psCfg)
+{
+    switch(psCfg->u32Source)
+    {
+        case ACQLIB_SRC_I2C:
+            ((I2C_T *)psCfg->pvPort)->AUTOCTL &= ~(I2C_AUTOCTL_TRGEN_Msk | I2C_AUTOCTL_AUTOMODE_Msk);
+            break;
+
+        case ACQLIB_SRC_ADC:
+            ((ADC_T *)psCfg->pvPort)->AUTOCTL &= ~(ADC_AUTOCTL_TRIGEN_Msk | ADC_AUTOCTL_AUTOEN_Msk);
+            ADC_DISABLE_PDMA((ADC_T *)psCfg->pvPort);
+            break;
+
+        case ACQLIB_SRC_SPI:
+            ((SPI_T *)psCfg->pvPort)->AUTOCTL &= ~(SPI_AUTOCTL_TRIGEN_Msk | SPI_AUTOCTL_AUTOEN_Msk);
+            ((SPI_T *)psCfg->pvPort)->PDMACTL &= ~SPI_PDMACTL_RXPDMAEN_Msk;
+            break;
+
+        case ACQLIB_SRC_UART:
+            ((UART_T *)psCfg->pvPort)->AUTOCTL &= ~(UART_AUTOCTL_TRIGEN_Msk | UART_AUTOCTL_AOEN_Msk);
+            ((UART_T *)psCfg->pvPort)->INTEN &= ~(UART_INTEN_TXPDMAEN_Msk | UART_INTEN_RXPDMAEN_Msk);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* PDMA callback at the end of each batch, called by PDMA_IRQHandler */
+static void ACQLIB_BatchDone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    ACQLIB_RING_T *psRing = (ACQLIB_RING_T *)pvUserData;
+
+    (void)u32Ch;
+
+    if(u32Event & PDMA_EVT_TRANS_DONE)
+        psRing->u32Produced++;
+}
+
+static void ACQLIB_HaltChannel(int32_t i32Ch)
+{
+    if(i32Ch < 0)
+        return;
+
+    PDMA_SetCallback(PDMA0, (uint32_t)i32Ch, NULL, NULL);
+    PDMA0->CHCTL &= ~(1UL << (uint32_t)i32Ch);
+    PDMA_RESET(PDMA0, (uint32_t)i32Ch);
+}
+
+/** @addtogroup ACQLIB_EXPORTED_FUNCTIONS Acquisition Library Exported Functions
+  @{
+*/
+
+/**
+  * @brief      Program an acquisition plan
+  *
+  * @param[out] psAcq       Acquisition instance. It must stay in SRAM addressed by PDMA SCATBA while open.
+  * @param[in]  psPlan      Plan. The streams it points to must stay valid while open.
+  *
+  * @retval     0                   Success, call ACQLIB_Start to run the plan
+  * @retval     ACQLIB_ERR_PARAM    Invalid plan
+  * @retval     ACQLIB_ERR_NO_CH    Not enough free PDMA channels
+  * @retval     ACQLIB_ERR_SCATBA   psAcq is out of the PDMA descriptor window
+  *
+  * @details    The clocks of the timer, PDMA0 and the peripherals must be enabled, and the peripherals opened.
+  *             The ADC must be powered on. The timer is opened in periodic mode at psPlan->u32Freq with its
+  *             auto-operation trigger routed to the peripherals, but it is not started.
+  */
+int32_t ACQLIB_Open(ACQLIB_T *psAcq, const ACQLIB_PLAN_T *psPlan)
+{
+    const ACQLIB_STREAM_T *psCfg;
+    ACQLIB_RING_T *psRing;
+    ACQLIB_PORT_T sPort;
+    uint32_t i, u32TmrIdx, u32Elems;
+    int32_t i32Ret;
+
+    if((psAcq == NULL) || (psPlan == NULL) || (psPlan->psStream == NULL) ||
+            (psPlan->u32StreamNum == 0UL) || (psPlan->u32StreamNum > ACQLIB_STREAM_MAX) ||
+            (psPlan->u32Freq == 0UL))
+        return ACQLIB_ERR_PARAM;
+
+    u32TmrIdx = ACQLIB_TimerIndex(psPlan->timer);
+
+    if(u32TmrIdx == 0xFFFFFFFFUL)
+        return ACQLIB_ERR_PARAM;
+
+    psAcq->timer = psPlan->timer;
+    psAcq->u32StreamNum = psPlan->u32StreamNum;
+    psAcq->u32PDMode = CLK_PMUCTL_PDMSEL_NPD2;
+
+    for(i = 0UL; i < ACQLIB_STREAM_MAX; i++)
+    {
+        psAcq->asRing[i].psCfg = NULL;
+        psAcq->asRing[i].i32RxCh = -1;
+        psAcq->asRing[i].i32TxCh = -1;
+    }
+
+    for(i = 0UL; i < psPlan->u32StreamNum; i++)
+    {
+        psCfg = &psPlan->psStream[i];
+        psRing = &psAcq->asRing[i];
+        psRing->psCfg = psCfg;
+        psRing->u32Produced = 0UL;
+        psRing->u32Consumed = 0UL;
+
+        if((psCfg->pvRing == NULL) || (psCfg->u32BatchLen == 0UL) ||
+                (psCfg->u32BatchNum < 2UL) || (psCfg->u32BatchNum > ACQLIB_BATCH_MAX))
+        {
+            i32Ret = ACQLIB_ERR_PARAM;
+            goto lexit;
+        }
+
+        i32Ret = ACQLIB_GetPort(psCfg, &sPort, &u32Elems);
+
+        if(i32Ret != 0)
+            goto lexit;
+
+        i32Ret = ACQLIB_BuildRing(psRing, &sPort, u32Elems);
+
+        if(i32Ret != 0)
+            goto lexit;
+
+        /* The plan runs in the shallowest mode required by its streams */
+        if(sPort.u32PDMode < psAcq->u32PDMode)
+            psAcq->u32PDMode = sPort.u32PDMode;
+
+        psRing->i32RxCh = PDMA_RequestChannel(PDMA0, 0UL);
+
+        if(psRing->i32RxCh < 0)
+        {
+            i32Ret = ACQLIB_ERR_NO_CH;
+            goto lexit;
+        }
+
+        psRing->u32RxReq = sPort.u32RxReq;
+        psRing->u32TxReq = sPort.u32TxReq;
+
+        if(sPort.u32TxReq != PDMA_MEM)
+        {
+            psRing->i32TxCh = PDMA_RequestChannel(PDMA0, 0UL);
+
+            if(psRing->i32TxCh < 0)
+            {
+                i32Ret = ACQLIB_ERR_NO_CH;
+                goto lexit;
+            }
+        }
+    }
+
+    TIMER_Open(psPlan->timer, TIMER_PERIODIC_MODE, psPlan->u32Freq);
+
+    /* Keep counting in power-down and trigger the peripherals on each time-out */
+    psPlan->timer->CTL |= TIMER_CTL_PDCLKEN_Msk;
+    TIMER_SetATriggerSource(psPlan->timer, TIMER_ATRGSRC_TIMEOUT_EVENT);
+    TIMER_SetATriggerTarget(psPlan->timer, TIMER_ATRG_TO_IPS);
+
+    for(i = 0UL; i < psPlan->u32StreamNum; i++)
+        ACQLIB_EnablePort(psAcq->asRing[i].psCfg, u32TmrIdx);
+
+    return 0;
+
+lexit:
+    ACQLIB_Close(psAcq);
+    return i32Ret;
+}
+
+/**
+  * @brief      Stop the plan and release its PDMA channels
+  *
+  * @param[in]  psAcq       Acquisition instance
+  *
+  * @return     None
+  *
+  * @details    The automatic operation of every peripheral of the plan is disabled.
+  */
+void ACQLIB_Close(ACQLIB_T *psAcq)
+{
+    ACQLIB_RING_T *psRing;
+    uint32_t i;
+
+    if(psAcq == NULL)
+        return;
+
+    ACQLIB_Stop(psAcq);
+
+    for(i = 0UL; i < ACQLIB_STREAM_MAX; i++)
+    {
+        psRing = &psAcq->asRing[i];
+
+        if(psRing->i32RxCh >= 0)
+        {
+            ACQLIB_DisablePort(psRing->psCfg);
+            PDMA_ReleaseChannel(PDMA0, (uint32_t)psRing->i32RxCh);
+            psRing->i32RxCh = -1;
+        }
+
+        if(psRing->i32TxCh >= 0)
+        {
+            PDMA_ReleaseChannel(PDMA0, (uint32_t)psRing->i32TxCh);
+            psRing->i32TxCh = -1;
+        }
+    }
+
+    psAcq->u32StreamNum = 0UL;
+}
+
+/**
+  * @brief      Start the plan
+  *
+  * @param[in]  psAcq       Acquisition instance
+  *
+  * @return     None
+  *
+  * @details    All rings are emptied, PDMA is armed on the first batch and the timer is started.
+  *             PDMA0_IRQn is enabled.
+  */
+void ACQLIB_Start(ACQLIB_T *psAcq)
+{
+    ACQLIB_RING_T *psRing;
+    uint32_t i;
+
+    if((psAcq == NULL) || (psAcq->u32StreamNum == 0UL))
+        return;
+
+    for(i = 0UL; i < psAcq->u32StreamNum; i++)
+    {
+        psRing = &psAcq->asRing[i];
+        psRing->u32Produced = 0UL;
+        psRing->u32Consumed = 0UL;
+
+        PDMA_Open(PDMA0, 1UL << (uint32_t)psRing->i32RxCh);
+        PDMA_SetCallback(PDMA0, (uint32_t)psRing->i32RxCh, ACQLIB_BatchDone, psRing);
+        PDMA_StartChain(PDMA0, (uint32_t)psRing->i32RxCh, psRing->u32RxReq, &psRing->asDesc[0]);
+
+        if(psRing->i32TxCh >= 0)
+        {
+            PDMA_Open(PDMA0, 1UL << (uint32_t)psRing->i32TxCh);
+            PDMA_StartChain(PDMA0, (uint32_t)psRing->i32TxCh, psRing->u32TxReq, &psRing->sCmdDesc);
+        }
+    }
+
+    NVIC_EnableIRQ(PDMA0_IRQn);
+    TIMER_Start(psAcq->timer);
+}
+
+/**
+  * @brief      Stop the plan
+  *
+  * @param[in]  psAcq       Acquisition instance
+  *
+  * @return     None
+  *
+  * @details    The timer is stopped and the PDMA channels are reset. Batches not read yet are lost.
+  *             Stop between two triggers, a transfer cut in the middle is not completed.
+  */
+void ACQLIB_Stop(ACQLIB_T *psAcq)
+{
+    uint32_t i;
+
+    if(psAcq == NULL)
+        return;
+
+    if(psAcq->u32StreamNum != 0UL)
+        TIMER_Stop(psAcq->timer);
+
+    for(i = 0UL; i < psAcq->u32StreamNum; i++)
+    {
+        ACQLIB_HaltChannel(psAcq->asRing[i].i32RxCh);
+        ACQLIB_HaltChannel(psAcq->asRing[i].i32TxCh);
+    }
+}
+
+/**
+  * @brief      Get the oldest full batch of a stream
+  *
+  * @param[in]  psAcq       Acquisition instance
+  * @param[in]  u32Stream   Index of the stream in the plan
+  * @param[out] ppvBatch    Start of the oldest full batch. It is valid until ACQLIB_ReleaseBatch. It can be NULL.
+  *
+  * @return     Number of full batches, or
+  * @retval     ACQLIB_ERR_PARAM    Invalid parameter
+  * @retval     ACQLIB_ERR_OVERRUN  PDMA has wrapped onto the oldest batch. The overwritten batches are dropped,
+  *                                 call again to get the remaining ones.
+  */
+int32_t ACQLIB_GetBatch(ACQLIB_T *psAcq, uint32_t u32Stream, void **ppvBatch)
+{
+    ACQLIB_RING_T *psRing;
+    uint32_t u32Num, u32Full;
+
+    if((psAcq == NULL) || (u32Stream >= psAcq->u32StreamNum))
+        return ACQLIB_ERR_PARAM;
+
+    psRing = &psAcq->asRing[u32Stream];
+    u32Num = psRing->psCfg->u32BatchNum;
+    u32Full = psRing->u32Produced - psRing->u32Consumed;
+
+    /* PDMA fills batch u32Produced, so at most u32Num - 1 batches can be read safely */
+    if(u32Full >= u32Num)
+    {
+        psRing->u32Consumed = psRing->u32Produced - (u32Num - 1UL);
+        return ACQLIB_ERR_OVERRUN;
+    }
+
+    if((ppvBatch != NULL) && (u32Full != 0UL))
+        *ppvBatch = (uint8_t *)psRing->psCfg->pvRing + (psRing->u32Consumed % u32Num) * psRing->u32BatchBytes;
+
+    return (int32_t)u32Full;
+}
+
+/**
+  * @brief      Return the oldest full batch of a stream to PDMA
+  *
+  * @param[in]  psAcq       Acquisition instance
+  * @param[in]  u32Stream   Index of the stream in the plan
+  *
+  * @return     None
+  */
+void ACQLIB_ReleaseBatch(ACQLIB_T *psAcq, uint32_t u32Stream)
+{
+    ACQLIB_RING_T *psRing;
+
+    if((psAcq == NULL) || (u32Stream >= psAcq->u32StreamNum))
+        return;
+
+    psRing = &psAcq->asRing[u32Stream];
+
+    if(psRing->u32Produced != psRing->u32Consumed)
+        psRing->u32Consumed++;
+}
+
+/**
+  * @brief      Power down until a batch of any stream is full
+  *
+  * @param[in]  psAcq       Acquisition instance
+  *
+  * @return     None
+  *
+  * @details    The chip enters the deepest power-down mode all streams of the plan support, NPD2 if
+  *             there are only SPI streams and NPD1 otherwise. Other enabled interrupts also wake up the
+  *             chip, it goes back to power-down until a batch is full. Debug messages must be sent out
+  *             before calling this function.
+  */
+void ACQLIB_PowerDown(ACQLIB_T *psAcq)
+{
+    uint32_t i, u32Locked, u32Ready = 0UL;
+
+    if((psAcq == NULL) || (psAcq->u32StreamNum == 0UL))
+        return;
+
+    u32Locked = SYS_IsRegLocked();
+
+    if(u32Locked)
+        SYS_UnlockReg();
+
+    CLK_SetPowerDownMode(psAcq->u32PDMode);
+
+    while(u32Ready == 0UL)
+    {
+        /* A batch completed between the check and WFI still wakes up the chip */
+        __disable_irq();
+
+        for(i = 0UL; i < psAcq->u32StreamNum; i++)
+        {
+            if(psAcq->asRing[i].u32Produced != psAcq->asRing[i].u32Consumed)
+                u32Ready = 1UL;
+        }
+
+        if(u32Ready == 0UL)
+        {
+            CLK->PMUSTS = CLK_PMUSTS_CLRWK_Msk;
+            CLK_PowerDown();
+        }
+
+        __enable_irq();
+    }
+
+    if(u32Locked)
+        SYS_LockReg();
+}
+
+/** @} end of group ACQLIB_EXPORTED_FUNCTIONS */
+/** @} end of group ACQLIB */
+/** @} end of group Library */
@@ -0,0 +1,36 @@
+/**************************************************************************//**
+ * @file     aes_sim.h
+ * @version  V1.00
+ * @brief    Host-side software AES stand-in for the authenticated encryption library
+ *
+ * @details
+ *           Build authlib.c on the host with -DAUTHLIB_HOST and this directory
+ *           in the include path. The AES engine rounds of the library are
+ *           replaced by this FIPS-197 block encryption, so CMAC and CCM can be
+ *           checked against the NIST vectors without the target.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __AES_SIM_H
+#define __AES_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/* Same values as the CRYPTO driver constants */
+#define AES_KEY_SIZE_128        (0UL)           /*!< AES select 128-bit key length */
+#define AES_KEY_SIZE_192        (1UL)           /*!< AES select 192-bit key length */
+#define AES_KEY_SIZE_256        (2UL)           /*!< AES select 256-bit key length */
+
+void AesSim_Encrypt(const uint32_t au32Key[], uint32_t u32KeySize, const uint8_t au8In[16], uint8_t au8Out[16]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __AES_SIM_H */
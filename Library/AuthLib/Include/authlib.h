@@ -0,0 +1,120 @@
+/**************************************************************************//**
+ * @file     authlib.h
+ * @version  V1.00
+ * @brief    AES-CMAC and AES-CCM authenticated encryption library header file
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __AUTHLIB_H
+#define __AUTHLIB_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef AUTHLIB_HOST
+#include "aes_sim.h"
+#else
+#include "NuMicro.h"
+#endif
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup AUTHLIB Authenticated Encryption Library
+  @{
+*/
+
+/** @addtogroup AUTHLIB_EXPORTED_CONSTANTS Authenticated Encryption Library Exported Constants
+  @{
+*/
+
+#define AUTHLIB_ERR_PARAM       (-1L)   /*!< Invalid key size, nonce, tag length or call sequence */
+#define AUTHLIB_ERR_BUSY        (-2L)   /*!< AES engine owned by an AES_Update()/AES_Final() in progress */
+#define AUTHLIB_ERR_ENGINE      (-3L)   /*!< AES engine error or time-out */
+#define AUTHLIB_ERR_AUTH        (-4L)   /*!< CCM tag mismatch, the decrypted data must be discarded */
+
+/**
+  * @details    Bytes per DMA cascade round of the CBC-MAC, a multiple of 16. The CBC-MAC writes its
+  *             cipher blocks to a static scratch buffer of this size, unaligned input is copied to it.
+  */
+#ifndef AUTHLIB_DMA_CHUNK
+#define AUTHLIB_DMA_CHUNK       256
+#endif
+
+#if (AUTHLIB_DMA_CHUNK < 16) || ((AUTHLIB_DMA_CHUNK % 16) != 0)
+#error "AUTHLIB_DMA_CHUNK must be a multiple of 16"
+#endif
+
+/** @} end of group AUTHLIB_EXPORTED_CONSTANTS */
+
+
+/** @addtogroup AUTHLIB_EXPORTED_STRUCTS Authenticated Encryption Library Exported Structs
+  @{
+*/
+
+/**
+  * @details    CMAC stream (NIST SP 800-38B). The chaining value lags one block behind the input,
+  *             the last block waits in au32Blk for the K1 or K2 subkey.
+  */
+typedef struct
+{
+    uint32_t au32Key[8];        /*!< Key words, as AES_SetKey() */
+    uint32_t u32KeySize;        /*!< AES_KEY_SIZE_128, AES_KEY_SIZE_192 or AES_KEY_SIZE_256 */
+    uint32_t au32Mac[4];        /*!< CBC-MAC chaining value */
+    uint32_t au32Blk[4];        /*!< Input not absorbed yet */
+    uint32_t u32BlkLen;         /*!< Bytes in au32Blk, 0 ~ 16 */
+} AUTHLIB_CMAC_T;
+
+/**
+  * @details    CCM stream (NIST SP 800-38C). The CBC-MAC runs over B0, the encoded AAD and the payload,
+  *             each zero padded to a block, the payload is encrypted in CTR mode from counter block A1.
+  */
+typedef struct
+{
+    AUTHLIB_CMAC_T sMac;        /*!< CBC-MAC state, without subkeys */
+    uint32_t au32S0[4];         /*!< E(A0), the tag mask */
+    uint32_t u32Encrypt;        /*!< 1 to encrypt, 0 to decrypt */
+    uint32_t u32TagLen;         /*!< Tag length, 4, 6, 8, 10, 12, 14 or 16 */
+    uint32_t u32AadLeft;        /*!< AAD bytes still expected by AUTHLIB_CcmAad() */
+    uint32_t u32DataLeft;       /*!< Payload bytes still expected by AUTHLIB_CcmUpdate() */
+#ifdef AUTHLIB_HOST
+    uint32_t au32Ctr[4];        /*!< Next counter block */
+    uint32_t au32Ks[4];         /*!< Keystream of the current block */
+    uint32_t u32KsPos;          /*!< Used keystream bytes, 16 when a new block is needed */
+#else
+    AES_CONTEXT_T sCtr;         /*!< CTR stream of the CRYPTO driver */
+#endif
+} AUTHLIB_CCM_T;
+
+/** @} end of group AUTHLIB_EXPORTED_STRUCTS */
+
+
+/** @addtogroup AUTHLIB_EXPORTED_FUNCTIONS Authenticated Encryption Library Exported Functions
+  @{
+*/
+
+int32_t AUTHLIB_CmacInit(AUTHLIB_CMAC_T *psCmac, const uint32_t au32Key[], uint32_t u32KeySize);
+int32_t AUTHLIB_CmacUpdate(AUTHLIB_CMAC_T *psCmac, const void *pvData, uint32_t u32Len);
+int32_t AUTHLIB_CmacFinal(AUTHLIB_CMAC_T *psCmac, uint8_t au8Tag[16]);
+
+int32_t AUTHLIB_CcmInit(AUTHLIB_CCM_T *psCcm, uint32_t u32Encrypt, const uint32_t au32Key[], uint32_t u32KeySize,
+                        const uint8_t au8Nonce[], uint32_t u32NonceLen,
+                        uint32_t u32AadLen, uint32_t u32DataLen, uint32_t u32TagLen);
+int32_t AUTHLIB_CcmAad(AUTHLIB_CCM_T *psCcm, const void *pvAad, uint32_t u32Len);
+int32_t AUTHLIB_CcmUpdate(AUTHLIB_CCM_T *psCcm, const void *pvIn, void *pvOut, uint32_t u32Len);
+int32_t AUTHLIB_CcmFinal(AUTHLIB_CCM_T *psCcm, uint8_t au8Tag[]);
+
+/** @} end of group AUTHLIB_EXPORTED_FUNCTIONS */
+/** @} end of group AUTHLIB */
+/** @} end of group Library */
+
+#ifdef __cplusplus
+}
+
+#endif
+
+#endif  /* __AUTHLIB_H */
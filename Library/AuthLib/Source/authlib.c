@@ -0,0 +1,592 @@
+/**************************************************************************//**
+ * @file     authlib.c
+ * @version  V1.00
+ * @brief    AES-CMAC and AES-CCM authenticated encryption library source file
+ *
+ * @details
+ *           CMAC (NIST SP 800-38B) and CCM (NIST SP 800-38C) are built on two
+ *           AES engine primitives:
+ *
+ *             CBC-MAC : CBC encryption of whole blocks from the chaining value,
+ *                       only the last cipher block is kept. The data is fed by
+ *                       the engine DMA in cascade mode, AUTHLIB_DMA_CHUNK bytes
+ *                       per round, and every round writes its cipher blocks to
+ *                       the same scratch buffer. One key and IV load serves the
+ *                       whole call, so the MAC runs close to raw AES speed.
+ *             CTR     : the CCM payload, an AES_Update() stream of the CRYPTO
+ *                       driver started from counter block A1.
+ *
+ *           A single block encryption, e.g. the CMAC subkey source E(0) or the
+ *           CCM tag mask E(A0), is a one-block CBC-MAC from a zero chaining
+ *           value.
+ *
+ *           The CBC-MAC owns the AES engine for the duration of a call. It
+ *           returns AUTHLIB_ERR_BUSY while an asynchronous AES_Update() or
+ *           AES_Final() is in progress, and must not be preempted by an
+ *           interrupt handler that uses the AES engine.
+ *
+ *           With -DAUTHLIB_HOST both primitives use the software AES of
+ *           HostSim/aes_sim.c, so the library builds and checks on the host.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include <stdint.h>
+
+#include "authlib.h"
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup AUTHLIB Authenticated Encryption Library
+  @{
+*/
+
+#define AUTHLIB_KEY_WORDS(ks)   (4UL + 2UL * (ks))
+#define AUTHLIB_CMAC_RB         0x87    /* Reduction constant of the subkey doubling, 128-bit blocks */
+
+#ifndef AUTHLIB_HOST
+/* Cipher blocks of the CBC-MAC rounds, and the word aligned copy of unaligned input */
+static uint32_t s_au32Scratch[AUTHLIB_DMA_CHUNK / 4];
+
+static uint32_t AUTHLIB_GetBE32(const uint8_t *pu8Buf)
+{
+    return ((uint32_t)pu8Buf[0] << 24) | ((uint32_t)pu8Buf[1] << 16) | ((uint32_t)pu8Buf[2] << 8) | pu8Buf[3];
+}
+
+/* Wait for the end of a DMA round, as AES_Update() of the CRYPTO driver */
+static int32_t AUTHLIB_WaitDone(void)
+{
+    uint32_t u32TimeOutCnt = AES_TIMEOUT;
+    int32_t i32Ret;
+
+    while (((CRPT->INTSTS & CRPT_INTSTS_AESEIF_Msk) == 0UL) &&
+            (((CRPT->INTSTS & CRPT_INTSTS_AESIF_Msk) == 0UL) || (CRPT->AES_STS & CRPT_AES_STS_BUSY_Msk)))
+    {
+        if (--u32TimeOutCnt == 0UL)
+        {
+            CRPT->AES_CTL = CRPT_AES_CTL_STOP_Msk;
+            return AUTHLIB_ERR_ENGINE;
+        }
+    }
+
+    i32Ret = (CRPT->INTSTS & CRPT_INTSTS_AESEIF_Msk) ? AUTHLIB_ERR_ENGINE : 0;
+    AES_CLR_INT_FLAG(CRPT);
+
+    return i32Ret;
+}
+#endif
+
+/* CBC-MAC of u32Len bytes, a multiple of 16, from the chaining value au32State (bytes). */
+static int32_t AUTHLIB_CbcMac(const uint32_t au32Key[], uint32_t u32KeySize, uint32_t au32State[4],
+                              const uint8_t *pu8Data, uint32_t u32Len)
+{
+#ifdef AUTHLIB_HOST
+    uint8_t *pu8State = (uint8_t *)au32State;
+    uint32_t i;
+
+    for (; u32Len != 0; u32Len -= 16, pu8Data += 16)
+    {
+        for (i = 0; i < 16; i++)
+            pu8State[i] ^= pu8Data[i];
+
+        AesSim_Encrypt(au32Key, u32KeySize, pu8State, pu8State);
+    }
+
+    return 0;
+#else
+    uint32_t au32IV[4], u32Chunk = 0, u32Src, u32Mode, i;
+    int32_t i32Ret = 0;
+
+    if (u32Len == 0)
+        return 0;
+
+    if (AES_IsBusy())
+        return AUTHLIB_ERR_BUSY;
+
+    for (i = 0; i < 4; i++)
+        au32IV[i] = AUTHLIB_GetBE32((const uint8_t *)au32State + i * 4);
+
+    /* One key and IV load, the cascade rounds continue the chaining value of the previous round */
+    AES_DISABLE_INT(CRPT);
+    AES_Open(CRPT, 0, 1, AES_MODE_CBC, u32KeySize, AES_IN_OUT_SWAP);
+    AES_SetKey(CRPT, 0, (uint32_t *)au32Key, u32KeySize);
+    AES_SetInitVect(CRPT, 0, au32IV);
+    u32Mode = CRYPTO_DMA_FIRST;
+
+    while (u32Len != 0)
+    {
+        u32Chunk = (u32Len > AUTHLIB_DMA_CHUNK) ? AUTHLIB_DMA_CHUNK : u32Len;
+        u32Len -= u32Chunk;
+
+        /* The engine DMA reads words */
+        if ((uint32_t)pu8Data & 3UL)
+        {
+            memcpy(s_au32Scratch, pu8Data, u32Chunk);
+            u32Src = (uint32_t)s_au32Scratch;
+        }
+        else
+        {
+            u32Src = (uint32_t)pu8Data;
+        }
+
+        pu8Data += u32Chunk;
+
+        if (u32Len == 0)
+            u32Mode = (u32Mode == CRYPTO_DMA_FIRST) ? CRYPTO_DMA_ONE_SHOT : CRYPTO_DMA_LAST;
+
+        AES_SetDMATransfer(CRPT, 0, u32Src, (uint32_t)s_au32Scratch, u32Chunk);
+        AES_CLR_INT_FLAG(CRPT);
+        AES_Start(CRPT, 0, u32Mode);
+
+        i32Ret = AUTHLIB_WaitDone();
+
+        if (i32Ret != 0)
+            break;
+
+        u32Mode = CRYPTO_DMA_CONTINUE;
+    }
+
+    /* The new chaining value is the last cipher block */
+    if (i32Ret == 0)
+        memcpy(au32State, (const uint8_t *)s_au32Scratch + u32Chunk - 16, 16);
+
+    return i32Ret;
+#endif
+}
+
+/* Encrypt one block, a one-block CBC-MAC from a zero chaining value */
+static int32_t AUTHLIB_Encrypt(const uint32_t au32Key[], uint32_t u32KeySize, const uint32_t au32In[4], uint32_t au32Out[4])
+{
+    memset(au32Out, 0, 16);
+    return AUTHLIB_CbcMac(au32Key, u32KeySize, au32Out, (const uint8_t *)au32In, 16);
+}
+
+/*
+ * Feed bytes to the CBC-MAC. Whole blocks go to the engine in one call, the remainder waits in au32Blk.
+ * With u32KeepLast the last complete block also waits, the CMAC subkey is applied to it at the end.
+ */
+static int32_t AUTHLIB_Absorb(AUTHLIB_CMAC_T *psMac, const uint8_t *pu8Data, uint32_t u32Len, uint32_t u32KeepLast)
+{
+    uint8_t *pu8Blk = (uint8_t *)psMac->au32Blk;
+    uint32_t u32Fill;
+    int32_t i32Ret;
+
+    if (psMac->u32BlkLen != 0)
+    {
+        u32Fill = 16 - psMac->u32BlkLen;
+
+        if (u32Fill > u32Len)
+            u32Fill = u32Len;
+
+        memcpy(&pu8Blk[psMac->u32BlkLen], pu8Data, u32Fill);
+        psMac->u32BlkLen += u32Fill;
+        pu8Data += u32Fill;
+        u32Len -= u32Fill;
+
+        if ((psMac->u32BlkLen < 16) || ((u32Len == 0) && u32KeepLast))
+            return 0;
+
+        i32Ret = AUTHLIB_CbcMac(psMac->au32Key, psMac->u32KeySize, psMac->au32Mac, pu8Blk, 16);
+
+        if (i32Ret != 0)
+            return i32Ret;
+
+        psMac->u32BlkLen = 0;
+    }
+
+    u32Fill = u32Len & ~15UL;
+
+    if (u32KeepLast && (u32Fill == u32Len) && (u32Fill != 0))
+        u32Fill -= 16;
+
+    i32Ret = AUTHLIB_CbcMac(psMac->au32Key, psMac->u32KeySize, psMac->au32Mac, pu8Data, u32Fill);
+
+    if (i32Ret != 0)
+        return i32Ret;
+
+    memcpy(pu8Blk, &pu8Data[u32Fill], u32Len - u32Fill);
+    psMac->u32BlkLen = u32Len - u32Fill;
+
+    return 0;
+}
+
+/* Zero pad the waiting bytes to a block and feed it, the end of the CCM AAD and payload */
+static int32_t AUTHLIB_Pad(AUTHLIB_CMAC_T *psMac)
+{
+    int32_t i32Ret;
+
+    if (psMac->u32BlkLen == 0)
+        return 0;
+
+    memset((uint8_t *)psMac->au32Blk + psMac->u32BlkLen, 0, 16 - psMac->u32BlkLen);
+    i32Ret = AUTHLIB_CbcMac(psMac->au32Key, psMac->u32KeySize, psMac->au32Mac, (const uint8_t *)psMac->au32Blk, 16);
+    psMac->u32BlkLen = 0;
+
+    return i32Ret;
+}
+
+/* Multiply by x in GF(2^128), the CMAC subkey generation */
+static void AUTHLIB_Double(uint8_t au8Blk[16])
+{
+    uint8_t u8Msb = au8Blk[0] >> 7;
+    uint32_t i;
+
+    for (i = 0; i < 15; i++)
+        au8Blk[i] = (uint8_t)((au8Blk[i] << 1) | (au8Blk[i + 1] >> 7));
+
+    au8Blk[15] = (uint8_t)((au8Blk[15] << 1) ^ (u8Msb ? AUTHLIB_CMAC_RB : 0));
+}
+
+/* CCM payload in CTR mode */
+static int32_t AUTHLIB_Ctr(AUTHLIB_CCM_T *psCcm, const uint8_t *pu8In, uint8_t *pu8Out, uint32_t u32Len)
+{
+#ifdef AUTHLIB_HOST
+    uint8_t *pu8Ctr = (uint8_t *)psCcm->au32Ctr;
+    uint8_t *pu8Ks = (uint8_t *)psCcm->au32Ks;
+    uint32_t i;
+
+    while (u32Len--)
+    {
+        if (psCcm->u32KsPos == 16)
+        {
+            AesSim_Encrypt(psCcm->sMac.au32Key, psCcm->sMac.u32KeySize, pu8Ctr, pu8Ks);
+
+            for (i = 16; (i-- != 0) && (++pu8Ctr[i] == 0);)
+                ;
+
+            psCcm->u32KsPos = 0;
+        }
+
+        *pu8Out++ = *pu8In++ ^ pu8Ks[psCcm->u32KsPos++];
+    }
+
+    return 0;
+#else
+    int32_t i32Ret;
+
+    if (u32Len == 0)
+        return 0;
+
+    i32Ret = AES_Update(CRPT, &psCcm->sCtr, pu8In, pu8Out, u32Len, NULL, NULL);
+
+    if (i32Ret == AES_OK)
+        return 0;
+
+    return (i32Ret == AES_ERR_BUSY) ? AUTHLIB_ERR_BUSY : AUTHLIB_ERR_ENGINE;
+#endif
+}
+
+static int32_t AUTHLIB_MacInit(AUTHLIB_CMAC_T *psMac, const uint32_t au32Key[], uint32_t u32KeySize)
+{
+    if ((psMac == NULL) || (au32Key == NULL) || (u32KeySize > AES_KEY_SIZE_256))
+        return AUTHLIB_ERR_PARAM;
+
+    memset(psMac, 0, sizeof(AUTHLIB_CMAC_T));
+    memcpy(psMac->au32Key, au32Key, AUTHLIB_KEY_WORDS(u32KeySize) * 4);
+    psMac->u32KeySize = u32KeySize;
+
+    return 0;
+}
+
+/**
+ *  @brief      Start a CMAC
+ *
+ *  @param[out] psCmac      The CMAC stream
+ *  @param[in]  au32Key     Key words, as AES_SetKey()
+ *  @param[in]  u32KeySize  AES_KEY_SIZE_128, AES_KEY_SIZE_192 or AES_KEY_SIZE_256
+ *
+ *  @retval     0                   Success
+ *  @retval     AUTHLIB_ERR_PARAM   Invalid parameter
+ */
+int32_t AUTHLIB_CmacInit(AUTHLIB_CMAC_T *psCmac, const uint32_t au32Key[], uint32_t u32KeySize)
+{
+    return AUTHLIB_MacInit(psCmac, au32Key, u32KeySize);
+}
+
+/**
+ *  @brief      Feed message bytes to a CMAC
+ *
+ *  @param[in]  psCmac      The CMAC stream
+ *  @param[in]  pvData      Message bytes, any alignment
+ *  @param[in]  u32Len      Number of bytes, any length
+ *
+ *  @retval     0                   Success
+ *  @retval     AUTHLIB_ERR_BUSY    AES engine in use by an asynchronous AES_Update()
+ *  @retval     AUTHLIB_ERR_ENGINE  AES engine error or time-out
+ *
+ *  @details    The whole blocks of a call are one DMA cascade, so feed large pieces for throughput.
+ *              After an error the stream must be started again.
+ */
+int32_t AUTHLIB_CmacUpdate(AUTHLIB_CMAC_T *psCmac, const void *pvData, uint32_t u32Len)
+{
+    return AUTHLIB_Absorb(psCmac, (const uint8_t *)pvData, u32Len, 1);
+}
+
+/**
+ *  @brief      Finish a CMAC
+ *
+ *  @param[in]  psCmac      The CMAC stream, cleared on return
+ *  @param[out] au8Tag      16 bytes tag, truncate it as needed
+ *
+ *  @retval     0                   Success
+ *  @retval     AUTHLIB_ERR_BUSY    AES engine in use by an asynchronous AES_Update()
+ *  @retval     AUTHLIB_ERR_ENGINE  AES engine error or time-out
+ */
+int32_t AUTHLIB_CmacFinal(AUTHLIB_CMAC_T *psCmac, uint8_t au8Tag[16])
+{
+    uint32_t au32Zero[4] = {0}, au32K[4], i;
+    uint8_t *pu8Blk = (uint8_t *)psCmac->au32Blk;
+    uint8_t *pu8K = (uint8_t *)au32K;
+    int32_t i32Ret;
+
+    /* K1 = L.x, K2 = L.x^2, L = E(0) */
+    i32Ret = AUTHLIB_Encrypt(psCmac->au32Key, psCmac->u32KeySize, au32Zero, au32K);
+
+    if (i32Ret == 0)
+    {
+        AUTHLIB_Double(pu8K);
+
+        if (psCmac->u32BlkLen < 16)
+        {
+            AUTHLIB_Double(pu8K);
+            pu8Blk[psCmac->u32BlkLen] = 0x80;
+            memset(&pu8Blk[psCmac->u32BlkLen + 1], 0, 15 - psCmac->u32BlkLen);
+        }
+
+        for (i = 0; i < 16; i++)
+            pu8Blk[i] ^= pu8K[i];
+
+        i32Ret = AUTHLIB_CbcMac(psCmac->au32Key, psCmac->u32KeySize, psCmac->au32Mac, pu8Blk, 16);
+
+        if (i32Ret == 0)
+            memcpy(au8Tag, psCmac->au32Mac, 16);
+    }
+
+    memset(au32K, 0, sizeof(au32K));
+    memset(psCmac, 0, sizeof(AUTHLIB_CMAC_T));
+
+    return i32Ret;
+}
+
+/**
+ *  @brief      Start a CCM encryption or decryption
+ *
+ *  @param[out] psCcm       The CCM stream
+ *  @param[in]  u32Encrypt  1 to encrypt, 0 to decrypt
+ *  @param[in]  au32Key     Key words, as AES_SetKey()
+ *  @param[in]  u32KeySize  AES_KEY_SIZE_128, AES_KEY_SIZE_192 or AES_KEY_SIZE_256
+ *  @param[in]  au8Nonce    Nonce, never used twice with the same key
+ *  @param[in]  u32NonceLen Nonce length, 7 ~ 13
+ *  @param[in]  u32AadLen   Total length of the associated data, authenticated but not encrypted
+ *  @param[in]  u32DataLen  Total payload length, it must fit in 15 - u32NonceLen bytes
+ *  @param[in]  u32TagLen   Tag length, 4, 6, 8, 10, 12, 14 or 16
+ *
+ *  @retval     0                   Success
+ *  @retval     AUTHLIB_ERR_PARAM   Invalid parameter
+ *  @retval     AUTHLIB_ERR_BUSY    AES engine in use by an asynchronous AES_Update()
+ *  @retval     AUTHLIB_ERR_ENGINE  AES engine error or time-out
+ *
+ *  @details    CCM needs the lengths up front. Feed exactly u32AadLen bytes with AUTHLIB_CcmAad(), then
+ *              exactly u32DataLen bytes with AUTHLIB_CcmUpdate(), in pieces of any size.
+ */
+int32_t AUTHLIB_CcmInit(AUTHLIB_CCM_T *psCcm, uint32_t u32Encrypt, const uint32_t au32Key[], uint32_t u32KeySize,
+                        const uint8_t au8Nonce[], uint32_t u32NonceLen,
+                        uint32_t u32AadLen, uint32_t u32DataLen, uint32_t u32TagLen)
+{
+    uint32_t au32Blk[4], u32Q, i;
+    uint8_t *pu8Blk = (uint8_t *)au32Blk;
+    uint8_t au8Len[6];
+    int32_t i32Ret;
+
+    u32Q = 15 - u32NonceLen;
+
+    if ((psCcm == NULL) || (au8Nonce == NULL) || (u32NonceLen < 7) || (u32NonceLen > 13) ||
+            (u32TagLen < 4) || (u32TagLen > 16) || (u32TagLen & 1UL) ||
+            ((u32Q < 4) && ((u32DataLen >> (8 * u32Q)) != 0)))
+        return AUTHLIB_ERR_PARAM;
+
+    memset(psCcm, 0, sizeof(AUTHLIB_CCM_T));
+    i32Ret = AUTHLIB_MacInit(&psCcm->sMac, au32Key, u32KeySize);
+
+    if (i32Ret != 0)
+        return i32Ret;
+
+    psCcm->u32Encrypt = (u32Encrypt != 0);
+    psCcm->u32TagLen = u32TagLen;
+    psCcm->u32AadLeft = u32AadLen;
+    psCcm->u32DataLeft = u32DataLen;
+
+    /* B0 = flags | N | Q */
+    memset(au32Blk, 0, sizeof(au32Blk));
+    pu8Blk[0] = (uint8_t)(((u32AadLen != 0) ? 0x40 : 0) | (((u32TagLen - 2) / 2) << 3) | (u32Q - 1));
+    memcpy(&pu8Blk[1], au8Nonce, u32NonceLen);
+
+    for (i = 0; (i < u32Q) && (i < 4); i++)
+        pu8Blk[15 - i] = (uint8_t)(u32DataLen >> (8 * i));
+
+    i32Ret = AUTHLIB_CbcMac(psCcm->sMac.au32Key, u32KeySize, psCcm->sMac.au32Mac, pu8Blk, 16);
+
+    /* The AAD starts with its length, 2 bytes below 0xFF00, else 0xFF 0xFE and 4 bytes */
+    if ((i32Ret == 0) && (u32AadLen != 0))
+    {
+        i = 0;
+
+        if (u32AadLen >= 0xFF00UL)
+        {
+            au8Len[i++] = 0xFF;
+            au8Len[i++] = 0xFE;
+            au8Len[i++] = (uint8_t)(u32AadLen >> 24);
+            au8Len[i++] = (uint8_t)(u32AadLen >> 16);
+        }
+
+        au8Len[i++] = (uint8_t)(u32AadLen >> 8);
+        au8Len[i++] = (uint8_t)u32AadLen;
+        i32Ret = AUTHLIB_Absorb(&psCcm->sMac, au8Len, i, 0);
+    }
+
+    /* A0 = flags | N | 0, the tag mask is E(A0) and the payload starts at A1 */
+    memset(au32Blk, 0, sizeof(au32Blk));
+    pu8Blk[0] = (uint8_t)(u32Q - 1);
+    memcpy(&pu8Blk[1], au8Nonce, u32NonceLen);
+
+    if (i32Ret == 0)
+        i32Ret = AUTHLIB_Encrypt(psCcm->sMac.au32Key, u32KeySize, au32Blk, psCcm->au32S0);
+
+    pu8Blk[15] = 1;
+
+#ifdef AUTHLIB_HOST
+    memcpy(psCcm->au32Ctr, au32Blk, 16);
+    psCcm->u32KsPos = 16;
+#else
+    for (i = 0; i < 4; i++)
+        au32Blk[i] = AUTHLIB_GetBE32(&pu8Blk[i * 4]);
+
+    if ((i32Ret == 0) && (AES_Init(&psCcm->sCtr, 1, AES_MODE_CTR, u32KeySize, psCcm->sMac.au32Key, au32Blk) != AES_OK))
+        i32Ret = AUTHLIB_ERR_PARAM;
+#endif
+
+    if (i32Ret != 0)
+        memset(psCcm, 0, sizeof(AUTHLIB_CCM_T));
+
+    return i32Ret;
+}
+
+/**
+ *  @brief      Feed associated data to a CCM stream
+ *
+ *  @param[in]  psCcm       The CCM stream
+ *  @param[in]  pvAad       Associated data, any alignment
+ *  @param[in]  u32Len      Number of bytes, at most the AAD length left
+ *
+ *  @retval     0                   Success
+ *  @retval     AUTHLIB_ERR_PARAM   More data than the AAD length of AUTHLIB_CcmInit()
+ *  @retval     AUTHLIB_ERR_BUSY    AES engine in use by an asynchronous AES_Update()
+ *  @retval     AUTHLIB_ERR_ENGINE  AES engine error or time-out
+ */
+int32_t AUTHLIB_CcmAad(AUTHLIB_CCM_T *psCcm, const void *pvAad, uint32_t u32Len)
+{
+    int32_t i32Ret;
+
+    if (u32Len > psCcm->u32AadLeft)
+        return AUTHLIB_ERR_PARAM;
+
+    i32Ret = AUTHLIB_Absorb(&psCcm->sMac, (const uint8_t *)pvAad, u32Len, 0);
+
+    if (i32Ret != 0)
+        return i32Ret;
+
+    psCcm->u32AadLeft -= u32Len;
+
+    return (psCcm->u32AadLeft == 0) ? AUTHLIB_Pad(&psCcm->sMac) : 0;
+}
+
+/**
+ *  @brief      Encrypt or decrypt payload of a CCM stream
+ *
+ *  @param[in]  psCcm       The CCM stream
+ *  @param[in]  pvIn        Input bytes
+ *  @param[out] pvOut       Output bytes, it can be pvIn
+ *  @param[in]  u32Len      Number of bytes, at most the payload length left
+ *
+ *  @retval     0                   Success
+ *  @retval     AUTHLIB_ERR_PARAM   AAD not complete, or more data than the payload length of AUTHLIB_CcmInit()
+ *  @retval     AUTHLIB_ERR_BUSY    AES engine in use by an asynchronous AES_Update()
+ *  @retval     AUTHLIB_ERR_ENGINE  AES engine error or time-out
+ *
+ *  @details    Decrypted data is not authentic until AUTHLIB_CcmFinal() returns 0.
+ */
+int32_t AUTHLIB_CcmUpdate(AUTHLIB_CCM_T *psCcm, const void *pvIn, void *pvOut, uint32_t u32Len)
+{
+    int32_t i32Ret;
+
+    if ((psCcm->u32AadLeft != 0) || (u32Len > psCcm->u32DataLeft))
+        return AUTHLIB_ERR_PARAM;
+
+    /* The MAC covers the plaintext */
+    if (psCcm->u32Encrypt)
+    {
+        i32Ret = AUTHLIB_Absorb(&psCcm->sMac, (const uint8_t *)pvIn, u32Len, 0);
+
+        if (i32Ret == 0)
+            i32Ret = AUTHLIB_Ctr(psCcm, (const uint8_t *)pvIn, (uint8_t *)pvOut, u32Len);
+    }
+    else
+    {
+        i32Ret = AUTHLIB_Ctr(psCcm, (const uint8_t *)pvIn, (uint8_t *)pvOut, u32Len);
+
+        if (i32Ret == 0)
+            i32Ret = AUTHLIB_Absorb(&psCcm->sMac, (const uint8_t *)pvOut, u32Len, 0);
+    }
+
+    if (i32Ret != 0)
+        return i32Ret;
+
+    psCcm->u32DataLeft -= u32Len;
+
+    return (psCcm->u32DataLeft == 0) ? AUTHLIB_Pad(&psCcm->sMac) : 0;
+}
+
+/**
+ *  @brief      Finish a CCM stream
+ *
+ *  @param[in]      psCcm   The CCM stream, cleared on return
+ *  @param[in,out]  au8Tag  Tag of u32TagLen bytes, written when encrypting and verified when decrypting
+ *
+ *  @retval     0                   Success, the decrypted data is authentic
+ *  @retval     AUTHLIB_ERR_PARAM   AAD or payload not complete
+ *  @retval     AUTHLIB_ERR_AUTH    Tag mismatch
+ */
+int32_t AUTHLIB_CcmFinal(AUTHLIB_CCM_T *psCcm, uint8_t au8Tag[])
+{
+    const uint8_t *pu8Mac = (const uint8_t *)psCcm->sMac.au32Mac;
+    const uint8_t *pu8S0 = (const uint8_t *)psCcm->au32S0;
+    uint32_t i;
+    uint8_t u8Diff = 0;
+    int32_t i32Ret = 0;
+
+    if ((psCcm->u32AadLeft != 0) || (psCcm->u32DataLeft != 0))
+        i32Ret = AUTHLIB_ERR_PARAM;
+    else if (psCcm->u32Encrypt)
+    {
+        for (i = 0; i < psCcm->u32TagLen; i++)
+            au8Tag[i] = pu8Mac[i] ^ pu8S0[i];
+    }
+    else
+    {
+        /* Constant time compare */
+        for (i = 0; i < psCcm->u32TagLen; i++)
+            u8Diff |= au8Tag[i] ^ pu8Mac[i] ^ pu8S0[i];
+
+        i32Ret = (u8Diff == 0) ? 0 : AUTHLIB_ERR_AUTH;
+    }
+
+    memset(psCcm, 0, sizeof(AUTHLIB_CCM_T));
+
+    return i32Ret;
+}
+
+/** @} end of group AUTHLIB */
+/** @} end of group Library */
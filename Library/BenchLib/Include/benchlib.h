@@ -0,0 +1,110 @@
+/**************************************************************************//**
+ * @file     benchlib.h
+ * @version  V1.00
+ * @brief    Cycle count benchmark library header file
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __BENCHLIB_H
+#define __BENCHLIB_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef BENCH_HOST
+#include <stdint.h>
+#else
+#include "NuMicro.h"
+#endif
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup BENCHLIB Benchmark Library
+  @{
+*/
+
+/** @addtogroup BENCHLIB_EXPORTED_CONSTANTS Benchmark Library Exported Constants
+  @{
+*/
+
+#ifdef BENCH_HOST
+#define BENCH_TICK_MASK         0xFFFFFFFFUL    /*!< Host ticks are nanoseconds, 32-bit wrap */
+#else
+#define BENCH_TICK_MASK         0x00FFFFFFUL    /*!< SysTick is a 24-bit down counter clocked by HCLK */
+#endif
+
+#define BENCH_CALIBRATE_LOOP    16UL            /*!< Number of empty calls to measure the timing overhead */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Error codes                                                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+#define BENCH_ERR_PARAM         (-1L)           /*!< Invalid parameter */
+#define BENCH_ERR_CHECK         (-2L)           /*!< The result check of the case failed */
+
+/** @} end of group BENCHLIB_EXPORTED_CONSTANTS */
+
+
+/** @addtogroup BENCHLIB_EXPORTED_STRUCTS Benchmark Library Exported Structs
+  @{
+*/
+
+/**
+  * @details    Function under test or result check. Return 0 on success.
+  */
+typedef int32_t (*BENCH_FUNC_T)(void *pvArg);
+
+/**
+  * @details    Benchmark case.
+  */
+typedef struct
+{
+    const char *pcName;         /*!< Case name, printed in the CSV output */
+    BENCH_FUNC_T pfnRun;        /*!< Function under test, timed once per call */
+    BENCH_FUNC_T pfnCheck;      /*!< Result check after the last call, NULL if none */
+    void *pvArg;                /*!< Argument of pfnRun and pfnCheck */
+    uint32_t u32Bytes;          /*!< Bytes processed by one call, 0 if not applicable */
+    uint32_t u32Samples;        /*!< Samples processed by one call, 0 if not applicable */
+} BENCH_CASE_T;
+
+/**
+  * @details    Result of a benchmark case. Ticks are HCLK cycles on target and nanoseconds on host,
+  *             the timing overhead is removed.
+  */
+typedef struct
+{
+    uint32_t u32Calls;          /*!< Number of timed calls */
+    uint32_t u32Min;            /*!< Ticks of the fastest call */
+    uint32_t u32Max;            /*!< Ticks of the slowest call */
+    uint64_t u64Total;          /*!< Ticks of all calls */
+} BENCH_RESULT_T;
+
+/** @} end of group BENCHLIB_EXPORTED_STRUCTS */
+
+
+/** @addtogroup BENCHLIB_EXPORTED_FUNCTIONS Benchmark Library Exported Functions
+  @{
+*/
+
+void     BENCH_Init(void);
+uint32_t BENCH_GetTicks(void);
+uint32_t BENCH_GetTickFreq(void);
+int32_t  BENCH_Run(const BENCH_CASE_T *psCase, uint32_t u32Calls, BENCH_RESULT_T *psResult);
+void     BENCH_PrintHeader(void);
+void     BENCH_PrintResult(const char *pcSuite, const BENCH_CASE_T *psCase, const BENCH_RESULT_T *psResult, int32_t i32Status);
+uint32_t BENCH_RunSuite(const char *pcSuite, const BENCH_CASE_T asCase[], uint32_t u32CaseNum, uint32_t u32Calls);
+
+/** @} end of group BENCHLIB_EXPORTED_FUNCTIONS */
+/** @} end of group BENCHLIB */
+/** @} end of group Library */
+
+#ifdef __cplusplus
+}
+
+#endif
+
+#endif  /* __BENCHLIB_H */
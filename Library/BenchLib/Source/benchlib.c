@@ -0,0 +1,264 @@
+/**************************************************************************//**
+ * @file     benchlib.c
+ * @version  V1.00
+ * @brief    Cycle count benchmark library source file
+ *
+ * @details
+ *           Cortex-M23 has no DWT cycle counter, so SysTick clocked by HCLK
+ *           is used as a free-running 24-bit counter without interrupt. Each
+ *           call is timed on its own, so one call must finish within 2^24
+ *           HCLK cycles (419 ms at 40 MHz). The cost of an empty call is
+ *           measured once and removed from every result.
+ *
+ *           Built on the host with -DBENCH_HOST, the ticks are nanoseconds of
+ *           the monotonic clock, so the same suites run on Linux.
+ *
+ *           Results are printed as CSV:
+ *             suite,case,calls,avg,min,max,per_byte,per_sample,status
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef BENCH_HOST
+#include <time.h>
+#endif
+
+#include "benchlib.h"
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup BENCHLIB Benchmark Library
+  @{
+*/
+
+static uint32_t s_u32Overhead;
+
+static int32_t BENCH_Empty(void *pvArg)
+{
+    (void)pvArg;
+    return 0;
+}
+
+/* Ticks of one call of pfnRun, timing overhead included */
+static uint32_t BENCH_Time(BENCH_FUNC_T pfnRun, void *pvArg, int32_t *pi32Ret)
+{
+    uint32_t u32Start;
+
+    u32Start = BENCH_GetTicks();
+    *pi32Ret = pfnRun(pvArg);
+    return (BENCH_GetTicks() - u32Start) & BENCH_TICK_MASK;
+}
+
+/** @addtogroup BENCHLIB_EXPORTED_FUNCTIONS Benchmark Library Exported Functions
+  @{
+*/
+
+/**
+  * @brief      Start the tick counter and measure the timing overhead
+  *
+  * @param      None
+  *
+  * @return     None
+  *
+  * @details    SysTick is configured with HCLK source and no interrupt, it can not be used by the
+  *             application at the same time.
+  */
+void BENCH_Init(void)
+{
+    uint32_t i, u32Ticks;
+    int32_t i32Ret;
+
+#ifndef BENCH_HOST
+    SysTick->CTRL = 0UL;
+    SysTick->LOAD = BENCH_TICK_MASK;
+    SysTick->VAL = 0UL;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#endif
+
+    s_u32Overhead = BENCH_TICK_MASK;
+
+    for (i = 0; i < BENCH_CALIBRATE_LOOP; i++)
+    {
+        u32Ticks = BENCH_Time(BENCH_Empty, NULL, &i32Ret);
+
+        if (u32Ticks < s_u32Overhead)
+            s_u32Overhead = u32Ticks;
+    }
+}
+
+/**
+  * @brief      Read the tick counter
+  *
+  * @param      None
+  *
+  * @return     Up-counting ticks, wraps at BENCH_TICK_MASK
+  */
+uint32_t BENCH_GetTicks(void)
+{
+#ifdef BENCH_HOST
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return (uint32_t)((uint64_t)sTime.tv_sec * 1000000000ULL + (uint64_t)sTime.tv_nsec);
+#else
+    return BENCH_TICK_MASK - SysTick->VAL;
+#endif
+}
+
+/**
+  * @brief      Get the tick frequency
+  *
+  * @param      None
+  *
+  * @return     Ticks per second, HCLK on target
+  */
+uint32_t BENCH_GetTickFreq(void)
+{
+#ifdef BENCH_HOST
+    return 1000000000UL;
+#else
+    return SystemCoreClock;
+#endif
+}
+
+/**
+  * @brief      Time a benchmark case
+  *
+  * @param[in]  psCase      The benchmark case
+  * @param[in]  u32Calls    Number of timed calls
+  * @param[out] psResult    The timing result
+  *
+  * @retval     0                   Success
+  * @retval     BENCH_ERR_PARAM     Invalid parameter
+  * @retval     BENCH_ERR_CHECK     pfnRun or pfnCheck returned an error
+  *
+  * @details    Interrupts are not disabled. Keep the interrupt sources of the application quiet
+  *             while a case runs, or the maximum includes the interrupt service time.
+  */
+int32_t BENCH_Run(const BENCH_CASE_T *psCase, uint32_t u32Calls, BENCH_RESULT_T *psResult)
+{
+    uint32_t i, u32Ticks;
+    int32_t i32Ret, i32Err = 0;
+
+    if ((psCase == NULL) || (psCase->pfnRun == NULL) || (psResult == NULL) || (u32Calls == 0UL))
+        return BENCH_ERR_PARAM;
+
+    psResult->u32Calls = u32Calls;
+    psResult->u32Min = BENCH_TICK_MASK;
+    psResult->u32Max = 0UL;
+    psResult->u64Total = 0ULL;
+
+    for (i = 0; i < u32Calls; i++)
+    {
+        u32Ticks = BENCH_Time(psCase->pfnRun, psCase->pvArg, &i32Ret);
+        u32Ticks = (u32Ticks > s_u32Overhead) ? (u32Ticks - s_u32Overhead) : 0UL;
+
+        if (i32Ret != 0)
+            i32Err = BENCH_ERR_CHECK;
+
+        if (u32Ticks < psResult->u32Min)
+            psResult->u32Min = u32Ticks;
+
+        if (u32Ticks > psResult->u32Max)
+            psResult->u32Max = u32Ticks;
+
+        psResult->u64Total += u32Ticks;
+    }
+
+    if ((psCase->pfnCheck != NULL) && (psCase->pfnCheck(psCase->pvArg) != 0))
+        i32Err = BENCH_ERR_CHECK;
+
+    return i32Err;
+}
+
+/**
+  * @brief      Print the tick frequency and the CSV column names
+  *
+  * @param      None
+  *
+  * @return     None
+  */
+void BENCH_PrintHeader(void)
+{
+    printf("# tick_hz,%u\n", (unsigned int)BENCH_GetTickFreq());
+    printf("suite,case,calls,avg,min,max,per_byte,per_sample,status\n");
+}
+
+static void BENCH_PrintRatio(uint64_t u64Total, uint32_t u32Div)
+{
+    uint64_t u64Val;
+
+    if (u32Div == 0UL)
+    {
+        printf(",-");
+        return;
+    }
+
+    /* Two decimals without floating point printf */
+    u64Val = (u64Total * 100ULL + u32Div / 2UL) / u32Div;
+    printf(",%u.%02u", (unsigned int)(u64Val / 100ULL), (unsigned int)(u64Val % 100ULL));
+}
+
+/**
+  * @brief      Print one CSV line of result
+  *
+  * @param[in]  pcSuite     Suite name
+  * @param[in]  psCase      The benchmark case
+  * @param[in]  psResult    The timing result of BENCH_Run
+  * @param[in]  i32Status   The return value of BENCH_Run
+  *
+  * @return     None
+  */
+void BENCH_PrintResult(const char *pcSuite, const BENCH_CASE_T *psCase, const BENCH_RESULT_T *psResult, int32_t i32Status)
+{
+    printf("%s,%s,%u", pcSuite, psCase->pcName, (unsigned int)psResult->u32Calls);
+    BENCH_PrintRatio(psResult->u64Total, psResult->u32Calls);
+    printf(",%u,%u", (unsigned int)psResult->u32Min, (unsigned int)psResult->u32Max);
+    BENCH_PrintRatio(psResult->u64Total, psResult->u32Calls * psCase->u32Bytes);
+    BENCH_PrintRatio(psResult->u64Total, psResult->u32Calls * psCase->u32Samples);
+    printf(",%s\n", (i32Status == 0) ? "ok" : "fail");
+}
+
+/**
+  * @brief      Run and print a suite of benchmark cases
+  *
+  * @param[in]  pcSuite     Suite name
+  * @param[in]  asCase      The benchmark cases
+  * @param[in]  u32CaseNum  Number of cases
+  * @param[in]  u32Calls    Number of timed calls per case
+  *
+  * @return     Number of failed cases
+  */
+uint32_t BENCH_RunSuite(const char *pcSuite, const BENCH_CASE_T asCase[], uint32_t u32CaseNum, uint32_t u32Calls)
+{
+    BENCH_RESULT_T sResult;
+    uint32_t i, u32Fail = 0;
+    int32_t i32Ret;
+
+    for (i = 0; i < u32CaseNum; i++)
+    {
+        i32Ret = BENCH_Run(&asCase[i], u32Calls, &sResult);
+
+        if (i32Ret == BENCH_ERR_PARAM)
+        {
+            u32Fail++;
+            continue;
+        }
+
+        if (i32Ret != 0)
+            u32Fail++;
+
+        BENCH_PrintResult(pcSuite, &asCase[i], &sResult, i32Ret);
+    }
+
+    return u32Fail;
+}
+
+/** @} end of group BENCHLIB_EXPORTED_FUNCTIONS */
+/** @} end of group BENCHLIB */
+/** @} end of group Library */
@@ -235,6 +235,33 @@ extern "C"
     #define ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH ((uint16_t)4032)
     extern const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
 
+  /* Q15/Q31 CFFT for cores without DSP extension: one twiddle table for all lengths, swap pairs per length.
+     The twiddle tables have 1536 entries, or less when generated by Scripts/gen_fft_tables.py */
+    extern const q15_t twiddleCoefM23_q15[];
+
+    extern const q31_t twiddleCoefM23_q31[];
+
+    #define ARMBITREVPAIRSM23_16_TABLE_LENGTH ((uint16_t)12)
+    extern const uint16_t armBitRevPairsM23_16[ARMBITREVPAIRSM23_16_TABLE_LENGTH];
+
+    #define ARMBITREVPAIRSM23_32_TABLE_LENGTH ((uint16_t)24)
+    extern const uint16_t armBitRevPairsM23_32[ARMBITREVPAIRSM23_32_TABLE_LENGTH];
+
+    #define ARMBITREVPAIRSM23_64_TABLE_LENGTH ((uint16_t)56)
+    extern const uint16_t armBitRevPairsM23_64[ARMBITREVPAIRSM23_64_TABLE_LENGTH];
+
+    #define ARMBITREVPAIRSM23_128_TABLE_LENGTH ((uint16_t)112)
+    extern const uint16_t armBitRevPairsM23_128[ARMBITREVPAIRSM23_128_TABLE_LENGTH];
+
+    #define ARMBITREVPAIRSM23_256_TABLE_LENGTH ((uint16_t)240)
+    extern const uint16_t armBitRevPairsM23_256[ARMBITREVPAIRSM23_256_TABLE_LENGTH];
+
+    #define ARMBITREVPAIRSM23_512_TABLE_LENGTH ((uint16_t)480)
+    extern const uint16_t armBitRevPairsM23_512[ARMBITREVPAIRSM23_512_TABLE_LENGTH];
+
+    #define ARMBITREVPAIRSM23_1024_TABLE_LENGTH ((uint16_t)992)
+    extern const uint16_t armBitRevPairsM23_1024[ARMBITREVPAIRSM23_1024_TABLE_LENGTH];
+
     extern const float32_t realCoefA[8192];
     extern const float32_t realCoefB[8192];
 
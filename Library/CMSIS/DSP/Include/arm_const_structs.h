@@ -78,6 +78,36 @@ extern "C"
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048;
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096;
 
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len16;
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len32;
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len64;
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len128;
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len256;
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len512;
+   extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len1024;
+
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len16;
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len32;
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len64;
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len128;
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len256;
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len512;
+   extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len1024;
+
+   extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len32;
+   extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len64;
+   extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len128;
+   extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len256;
+   extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len512;
+   extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len1024;
+
+   extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len32;
+   extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len64;
+   extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len128;
+   extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len256;
+   extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len512;
+   extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len1024;
+
 #ifdef   __cplusplus
 }
 #endif
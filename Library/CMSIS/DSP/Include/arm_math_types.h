@@ -116,6 +116,11 @@ extern "C"
   #define ARM_MATH_DSP                   1
 #endif
 
+/* Thumb-1 only cores (ARMv6-M, ARMv8-M Baseline) have no 32 x 32 -> 64 multiply */
+#if (defined (__ARM_ARCH_ISA_THUMB) && (__ARM_ARCH_ISA_THUMB == 1))
+  #define ARM_MATH_NO_SMULL              1
+#endif
+
 #if defined(ARM_MATH_NEON)
   #if defined(_MSC_VER) && defined(_M_ARM64EC)
     #include <arm64_neon.h>
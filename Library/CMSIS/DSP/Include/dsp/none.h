@@ -205,6 +205,61 @@ __STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
 #define mult_32x32_keep32(a, x, y) \
     a = (q31_t) (((q63_t) x * y ) >> 32)
 
+  /**
+   * @brief High 32 bits of the signed 32 x 32 product (SMMUL).
+   *
+   * Without a long multiply, the 64-bit product would be a call to the
+   * compiler 64 x 64 multiply. Four 16 x 16 partial products give the
+   * same bits inline.
+   */
+  __STATIC_FORCEINLINE q31_t mult_32x32_hi(
+  q31_t x,
+  q31_t y)
+  {
+#if defined (ARM_MATH_NO_SMULL)
+    uint32_t xl = (uint32_t) x & 0xFFFFU;
+    uint32_t yl = (uint32_t) y & 0xFFFFU;
+    int32_t xh = x >> 16;
+    int32_t yh = y >> 16;
+    int32_t t, w;
+
+    t = xh * (int32_t) yl + (int32_t) ((xl * yl) >> 16);
+    w = (int32_t) xl * yh + (t & 0xFFFF);
+
+    return (xh * yh + (t >> 16) + (w >> 16));
+#else
+    return ((q31_t) (((q63_t) x * y) >> 32));
+#endif
+  }
+
+  /**
+   * @brief Signed 32 x 32 -> 64 multiply (SMULL).
+   */
+  __STATIC_FORCEINLINE q63_t mult_32x32_q63(
+  q31_t x,
+  q31_t y)
+  {
+#if defined (ARM_MATH_NO_SMULL)
+    return ((q63_t) (((uint64_t) (uint32_t) mult_32x32_hi(x, y) << 32) | ((uint32_t) x * (uint32_t) y)));
+#else
+    return ((q63_t) x * y);
+#endif
+  }
+
+  /**
+   * @brief Rounded high 32 bits of the signed 32 x 32 product (SMMULR).
+   */
+  __STATIC_FORCEINLINE q31_t mult_32x32_hi_R(
+  q31_t x,
+  q31_t y)
+  {
+#if defined (ARM_MATH_NO_SMULL)
+    return (mult_32x32_hi(x, y) + (q31_t) (((uint32_t) x * (uint32_t) y) >> 31));
+#else
+    return ((q31_t) (((q63_t) x * y + 0x80000000LL) >> 32));
+#endif
+  }
+
 #ifndef ARM_MATH_DSP
   /**
    * @brief definition to pack two 16 bit values.
@@ -981,6 +981,225 @@ const float64_t * pSrc,
       float64_t * pResult);
 
 
+  /**
+   * @brief Instance structure for the Q15 running statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;          /**< Number of samples accumulated since init */
+    q63_t sum;               /**< Running sum of the samples */
+    q63_t sumOfSquares;      /**< Running sum of the squared samples */
+  } arm_running_stats_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 running statistics.
+   * @param[out] S          points to an instance of the running statistics structure.
+   */
+  void arm_running_stats_init_q15(
+        arm_running_stats_instance_q15 * S);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the running statistics.
+   * @param[in,out] S          points to an instance of the running statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_stats_update_q15(
+        arm_running_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Mean value of all samples added to the running statistics.
+   * @param[in]  S          points to an instance of the running statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_running_stats_mean_q15(
+  const arm_running_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Variance of all samples added to the running statistics.
+   * @param[in]  S          points to an instance of the running statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_running_stats_var_q15(
+  const arm_running_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of all samples added to the running statistics.
+   * @param[in]  S          points to an instance of the running statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_running_stats_rms_q15(
+  const arm_running_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief Instance structure for the Q15 sliding window minimum and maximum.
+   */
+  typedef struct
+  {
+    uint32_t windowSize;     /**< Number of most recent samples covered by min/max */
+    uint32_t sampleCount;    /**< Free-running index of the next sample */
+    q15_t * pMaxVal;         /**< Max deque values, windowSize entries */
+    uint32_t * pMaxIdx;      /**< Max deque sample indexes, windowSize entries */
+    q15_t * pMinVal;         /**< Min deque values, windowSize entries */
+    uint32_t * pMinIdx;      /**< Min deque sample indexes, windowSize entries */
+    uint32_t maxHead;        /**< Ring position of the max deque front */
+    uint32_t maxCount;       /**< Entries in the max deque */
+    uint32_t minHead;        /**< Ring position of the min deque front */
+    uint32_t minCount;       /**< Entries in the min deque */
+  } arm_sliding_minmax_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 sliding window minimum and maximum.
+   * @param[out] S           points to an instance of the sliding min/max structure.
+   * @param[in]  windowSize  number of most recent samples covered by the result.
+   * @param[in]  pValState   points to the value state buffer of 2*windowSize entries.
+   * @param[in]  pIdxState   points to the index state buffer of 2*windowSize entries.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowSize is 0.
+   */
+  arm_status arm_sliding_minmax_init_q15(
+        arm_sliding_minmax_instance_q15 * S,
+        uint32_t windowSize,
+        q15_t * pValState,
+        uint32_t * pIdxState);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the sliding window.
+   * @param[in,out] S          points to an instance of the sliding min/max structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_minmax_update_q15(
+        arm_sliding_minmax_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Minimum and maximum of the most recent windowSize samples.
+   * @param[in]  S          points to an instance of the sliding min/max structure.
+   * @param[out] pMin       minimum value returned here.
+   * @param[out] pMax       maximum value returned here.
+   */
+  void arm_sliding_minmax_get_q15(
+  const arm_sliding_minmax_instance_q15 * S,
+        q15_t * pMin,
+        q15_t * pMax);
+
+  /**
+   * @brief Instance structure for the Q31 running statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;          /**< Number of samples accumulated since init */
+    q63_t sum;               /**< Running sum of the samples, used by mean */
+    q63_t sumShifted;        /**< Running sum of the samples shifted right by 8, used by variance */
+    q63_t sumOfSquares;      /**< Running sum of the squared shifted samples, used by variance */
+    uint64_t sumOfSquaresRms;/**< Running sum of the squared samples, used by RMS */
+  } arm_running_stats_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 running statistics.
+   * @param[out] S          points to an instance of the running statistics structure.
+   */
+  void arm_running_stats_init_q31(
+        arm_running_stats_instance_q31 * S);
+
+  /**
+   * @brief  Adds a block of Q31 samples to the running statistics.
+   * @param[in,out] S          points to an instance of the running statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_stats_update_q31(
+        arm_running_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Mean value of all samples added to the running statistics.
+   * @param[in]  S          points to an instance of the running statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_running_stats_mean_q31(
+  const arm_running_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Variance of all samples added to the running statistics.
+   * @param[in]  S          points to an instance of the running statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_running_stats_var_q31(
+  const arm_running_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of all samples added to the running statistics.
+   * @param[in]  S          points to an instance of the running statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_running_stats_rms_q31(
+  const arm_running_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief Instance structure for the Q31 sliding window minimum and maximum.
+   */
+  typedef struct
+  {
+    uint32_t windowSize;     /**< Number of most recent samples covered by min/max */
+    uint32_t sampleCount;    /**< Free-running index of the next sample */
+    q31_t * pMaxVal;         /**< Max deque values, windowSize entries */
+    uint32_t * pMaxIdx;      /**< Max deque sample indexes, windowSize entries */
+    q31_t * pMinVal;         /**< Min deque values, windowSize entries */
+    uint32_t * pMinIdx;      /**< Min deque sample indexes, windowSize entries */
+    uint32_t maxHead;        /**< Ring position of the max deque front */
+    uint32_t maxCount;       /**< Entries in the max deque */
+    uint32_t minHead;        /**< Ring position of the min deque front */
+    uint32_t minCount;       /**< Entries in the min deque */
+  } arm_sliding_minmax_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window minimum and maximum.
+   * @param[out] S           points to an instance of the sliding min/max structure.
+   * @param[in]  windowSize  number of most recent samples covered by the result.
+   * @param[in]  pValState   points to the value state buffer of 2*windowSize entries.
+   * @param[in]  pIdxState   points to the index state buffer of 2*windowSize entries.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowSize is 0.
+   */
+  arm_status arm_sliding_minmax_init_q31(
+        arm_sliding_minmax_instance_q31 * S,
+        uint32_t windowSize,
+        q31_t * pValState,
+        uint32_t * pIdxState);
+
+  /**
+   * @brief  Adds a block of Q31 samples to the sliding window.
+   * @param[in,out] S          points to an instance of the sliding min/max structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_minmax_update_q31(
+        arm_sliding_minmax_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Minimum and maximum of the most recent windowSize samples.
+   * @param[in]  S          points to an instance of the sliding min/max structure.
+   * @param[out] pMin       minimum value returned here.
+   * @param[out] pMax       maximum value returned here.
+   */
+  void arm_sliding_minmax_get_q31(
+  const arm_sliding_minmax_instance_q31 * S,
+        q31_t * pMin,
+        q31_t * pMax);
+
+
 #ifdef   __cplusplus
 }
 #endif
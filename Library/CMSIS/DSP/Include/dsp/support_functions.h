@@ -292,8 +292,10 @@ const q7_t * pSrc,
              /**< Insertion sort */
     ARM_SORT_QUICK     = 4,
              /**< Quick sort     */
-    ARM_SORT_SELECTION = 5
+    ARM_SORT_SELECTION = 5,
              /**< Selection sort */
+    ARM_SORT_RADIX     = 6
+             /**< Radix sort for q15, counting sort for q7 (fixed-point only) */
   } arm_sort_alg;
 
   /**
@@ -338,6 +340,99 @@ const q7_t * pSrc,
     arm_sort_alg alg, 
     arm_sort_dir dir); 
 
+  /**
+   * @brief Instance structure for the Q31 sorting algorithms.
+   */
+  typedef struct
+  {
+    arm_sort_alg alg;        /**< Sorting algorithm selected */
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+  } arm_sort_instance_q31;
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_sort_q31(
+    const arm_sort_instance_q31 * S,
+          q31_t * pSrc,
+          q31_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      alg          Selected algorithm.
+   * @param[in]      dir          Sorting order.
+   */
+  void arm_sort_init_q31(
+    arm_sort_instance_q31 * S,
+    arm_sort_alg alg,
+    arm_sort_dir dir);
+
+  /**
+   * @brief Instance structure for the Q15 sorting algorithms.
+   */
+  typedef struct
+  {
+    arm_sort_alg alg;        /**< Sorting algorithm selected */
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+  } arm_sort_instance_q15;
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_sort_q15(
+    const arm_sort_instance_q15 * S,
+          q15_t * pSrc,
+          q15_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      alg          Selected algorithm.
+   * @param[in]      dir          Sorting order.
+   */
+  void arm_sort_init_q15(
+    arm_sort_instance_q15 * S,
+    arm_sort_alg alg,
+    arm_sort_dir dir);
+
+  /**
+   * @brief Instance structure for the Q7 sorting algorithms.
+   */
+  typedef struct
+  {
+    arm_sort_alg alg;        /**< Sorting algorithm selected */
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+  } arm_sort_instance_q7;
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_sort_q7(
+    const arm_sort_instance_q7 * S,
+          q7_t * pSrc,
+          q7_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      alg          Selected algorithm.
+   * @param[in]      dir          Sorting order.
+   */
+  void arm_sort_init_q7(
+    arm_sort_instance_q7 * S,
+    arm_sort_alg alg,
+    arm_sort_dir dir);
+
   /**
    * @brief Instance structure for the sorting algorithms.
    */
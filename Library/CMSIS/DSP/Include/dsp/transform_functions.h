@@ -287,6 +287,212 @@ void arm_cfft_q31(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+  /**
+   * @brief Constant plan of the Q15 CFFT for cores without DSP extension (Cortex-M23).
+   *
+   * All lengths share one twiddle table, walked with a stride, and the plans
+   * are constant so no init function runs and nothing is copied to RAM.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                   /**< length of the FFT. */
+          uint16_t twidStride;               /**< step through the shared twiddle table for a stage of length fftLen. */
+    const q15_t *pTwiddle;             /**< points to the shared twiddle table. */
+    const uint16_t *pBitRevTable;      /**< points to the pairs of complex indexes swapped by the bit reversal. */
+          uint16_t bitRevLength;             /**< number of entries in the bit reversal table, twice the number of pairs. */
+  } arm_cfft_plan_q15;
+
+  /**
+   * @brief Constant plan of the Q31 CFFT for cores without DSP extension (Cortex-M23).
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                   /**< length of the FFT. */
+          uint16_t twidStride;               /**< step through the shared twiddle table for a stage of length fftLen. */
+    const q31_t *pTwiddle;             /**< points to the shared twiddle table. */
+    const uint16_t *pBitRevTable;      /**< points to the pairs of complex indexes swapped by the bit reversal. */
+          uint16_t bitRevLength;             /**< number of entries in the bit reversal table, twice the number of pairs. */
+  } arm_cfft_plan_q31;
+
+void arm_cfft_m23_q15(
+    const arm_cfft_plan_q15 * P,
+          q15_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag);
+
+void arm_cfft_m23_q31(
+    const arm_cfft_plan_q31 * P,
+          q31_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag);
+
+  /**
+   * @brief Constant plan of the in-place Q15 RFFT for cores without DSP extension (Cortex-M23).
+   *
+   * The real transform of length fftLenReal runs the complex plan of half the length
+   * and reads the twiddles of its split stage from the same shared table.
+   */
+  typedef struct
+  {
+    const arm_cfft_plan_q15 *pCfft;    /**< points to the complex plan of length fftLenReal/2. */
+          uint16_t fftLenReal;               /**< length of the real FFT. */
+          uint16_t twidStride;               /**< step through the shared twiddle table for an angle of 2*pi/fftLenReal. */
+    const q15_t *pTwiddle;             /**< points to the shared twiddle table. */
+  } arm_rfft_plan_q15;
+
+  /**
+   * @brief Constant plan of the in-place Q31 RFFT for cores without DSP extension (Cortex-M23).
+   */
+  typedef struct
+  {
+    const arm_cfft_plan_q31 *pCfft;    /**< points to the complex plan of length fftLenReal/2. */
+          uint16_t fftLenReal;               /**< length of the real FFT. */
+          uint16_t twidStride;               /**< step through the shared twiddle table for an angle of 2*pi/fftLenReal. */
+    const q31_t *pTwiddle;             /**< points to the shared twiddle table. */
+  } arm_rfft_plan_q31;
+
+void arm_rfft_m23_q15(
+    const arm_rfft_plan_q15 * P,
+          q15_t * pData,
+          uint8_t ifftFlag);
+
+void arm_rfft_m23_mag_squared_q15(
+    const arm_rfft_plan_q15 * P,
+          q15_t * pData,
+          q15_t * pMag);
+
+void arm_rfft_m23_q31(
+    const arm_rfft_plan_q31 * P,
+          q31_t * pData,
+          uint8_t ifftFlag);
+
+void arm_rfft_m23_mag_squared_q31(
+    const arm_rfft_plan_q31 * P,
+          q31_t * pData,
+          q31_t * pMag);
+
+  /**
+   * @brief Instance structure for the Q15 multi-bin Goertzel detector.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                  /**< number of tracked bins. */
+          uint16_t frameLen;                 /**< number of samples per result, N. */
+          uint16_t count;                    /**< number of samples of the current frame already processed. */
+          uint8_t shift;                     /**< input scaling 2^-shift, keeps the resonators below 2^29. */
+    const q15_t *pCoeffs;              /**< points to the {cos, sin} pairs of the bin frequencies, 2*numBins values. */
+          q31_t *pState;                     /**< points to the resonator states, 2*numBins values. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multi-bin Goertzel detector.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                  /**< number of tracked bins. */
+          uint16_t frameLen;                 /**< number of samples per result, N. */
+          uint16_t count;                    /**< number of samples of the current frame already processed. */
+          uint8_t shift;                     /**< input scaling 2^-(shift+2), keeps the resonators below 2^29. */
+    const q31_t *pCoeffs;              /**< points to the {cos, sin} pairs of the bin frequencies, 2*numBins values. */
+          q31_t *pState;                     /**< points to the resonator states, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+arm_status arm_goertzel_init_q15(
+          arm_goertzel_instance_q15 * S,
+          uint16_t numBins,
+          uint16_t frameLen,
+    const q15_t * pCoeffs,
+          q31_t * pState);
+
+uint32_t arm_goertzel_q15(
+          arm_goertzel_instance_q15 * S,
+    const q15_t * pSrc,
+          q15_t * pPower,
+          uint32_t blockSize);
+
+arm_status arm_goertzel_init_q31(
+          arm_goertzel_instance_q31 * S,
+          uint16_t numBins,
+          uint16_t frameLen,
+    const q31_t * pCoeffs,
+          q31_t * pState);
+
+uint32_t arm_goertzel_q31(
+          arm_goertzel_instance_q31 * S,
+    const q31_t * pSrc,
+          q31_t * pPower,
+          uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 multi-bin sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                  /**< number of tracked bins. */
+          uint16_t frameLen;                 /**< length of the sliding window, N, a power of 2. */
+          uint16_t index;                    /**< position of the next sample in the window, n mod N. */
+          uint16_t twidStride;               /**< step through the twiddle table for an angle of 2*pi/frameLen. */
+          uint8_t log2Len;                   /**< log2 of frameLen. */
+    const uint16_t *pBins;             /**< points to the bin indexes, 0 < k < frameLen. */
+    const q15_t *pTwiddle;             /**< points to a twiddle table covering the angles 0 to pi. */
+          q15_t *pDelay;                     /**< points to the window of the last frameLen samples. */
+          q31_t *pState;                     /**< points to the bin accumulators, 2*numBins values. */
+  } arm_sdft_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multi-bin sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                  /**< number of tracked bins. */
+          uint16_t frameLen;                 /**< length of the sliding window, N, a power of 2. */
+          uint16_t index;                    /**< position of the next sample in the window, n mod N. */
+          uint16_t twidStride;               /**< step through the twiddle table for an angle of 2*pi/frameLen. */
+          uint8_t log2Len;                   /**< log2 of frameLen. */
+    const uint16_t *pBins;             /**< points to the bin indexes, 0 < k < frameLen. */
+    const q31_t *pTwiddle;             /**< points to a twiddle table covering the angles 0 to pi. */
+          q31_t *pDelay;                     /**< points to the window of the last frameLen samples. */
+          q63_t *pState;                     /**< points to the bin accumulators, 2*numBins values. */
+  } arm_sdft_instance_q31;
+
+arm_status arm_sdft_init_q15(
+          arm_sdft_instance_q15 * S,
+          uint16_t numBins,
+          uint16_t frameLen,
+    const uint16_t * pBins,
+    const q15_t * pTwiddle,
+          uint16_t twidStride,
+          q15_t * pDelay,
+          q31_t * pState);
+
+void arm_sdft_q15(
+          arm_sdft_instance_q15 * S,
+    const q15_t * pSrc,
+          uint32_t blockSize);
+
+void arm_sdft_power_q15(
+    const arm_sdft_instance_q15 * S,
+          q15_t * pPower);
+
+arm_status arm_sdft_init_q31(
+          arm_sdft_instance_q31 * S,
+          uint16_t numBins,
+          uint16_t frameLen,
+    const uint16_t * pBins,
+    const q31_t * pTwiddle,
+          uint16_t twidStride,
+          q31_t * pDelay,
+          q63_t * pState);
+
+void arm_sdft_q31(
+          arm_sdft_instance_q31 * S,
+    const q31_t * pSrc,
+          uint32_t blockSize);
+
+void arm_sdft_power_q31(
+    const arm_sdft_instance_q31 * S,
+          q31_t * pPower);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * @file     arm_m23_fft.h
+ * @brief    Private header file of the FFT for cores without DSP extension
+ * @version  V1.0.0
+ * @date     17 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_M23_FFT_H_
+#define ARM_M23_FFT_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/* Rounded high word of the product of a sample and a twiddle, x * w >> 32.
+   The low x low partial product is dropped and the cross products are rounded,
+   which leaves an error of less than 2 LSB */
+__STATIC_FORCEINLINE q31_t arm_cfft_m23_mul_q31(
+  q31_t x,
+  q31_t w)
+{
+#if defined (ARM_MATH_NO_SMULL)
+  int32_t xh = x >> 16;
+  int32_t wh = w >> 16;
+  int32_t xl = (int32_t) ((uint32_t) x & 0xFFFFU);
+  int32_t wl = (int32_t) ((uint32_t) w & 0xFFFFU);
+
+  return (xh * wh + ((xh * wl + 0x8000) >> 16) + ((xl * wh + 0x8000) >> 16));
+#else
+  return ((q31_t) (((q63_t) x * w + 0x80000000LL) >> 32));
+#endif
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_M23_FFT_H_ */
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Project:      CMSIS DSP Library
+# Title:        gen_fft_tables.py
+# Description:  Generate only the FFT and window tables an application uses
+#
+# Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+# -----------------------------------------------------------------------------
+"""Generate the FFT and window tables of one application.
+
+The stock CommonTables sources hold the tables of every transform length and
+the linker can only drop a table that no instance references. This script
+reads the list of transforms the application really runs and writes a .c/.h
+pair with those tables and nothing else.
+
+usage: gen_fft_tables.py CONFIG OUTPUT_BASE
+
+CONFIG has one entry per line, '#' starts a comment:
+
+    <kind> <type> <length> [<length> ...]
+
+    kind                  type           emits
+    cfft                  q15, q31       twiddleCoef_N_<type>, armBitRevIndexTable_fixed_N,
+                                         arm_cfft_sR_<type>_lenN for arm_cfft_q15/q31
+    cfft_m23              q15, q31       twiddleCoefM23_<type>, armBitRevPairsM23_N,
+                                         arm_cfft_plan_<type>_lenN for arm_cfft_m23_q15/q31
+    rfft_m23              q15, q31       the cfft_m23 tables of length N/2 and
+                                         arm_rfft_plan_<type>_lenN for arm_rfft_m23_q15/q31
+    goertzel              q15, q31       goertzelCoef_<type>_N for arm_goertzel_init_q15/q31,
+                                         written as: goertzel <type> N <bin> [<bin> ...]
+    window_hanning        q15, q31, f32  windowHanning_<type>_N
+    window_hamming        q15, q31, f32  windowHamming_<type>_N
+    window_blackman_harris_92db
+                          q15, q31, f32  windowBlackmanHarris92db_<type>_N
+
+The cfft_m23 and rfft_m23 plans of one type share a single twiddle table
+sized for the longest length of that type, shorter plans stride through it.
+A goertzel entry holds the {cos, sin} pairs of the bins k listed, in order,
+at the angles 2*pi*k/N. k need not be an integer, e.g. f * N / fs.
+arm_sdft_init_q15/q31 reads the twiddles of a cfft_m23 entry of its length.
+The windows are the periodic ones of arm_hanning_f32() and friends.
+
+OUTPUT_BASE.c and OUTPUT_BASE.h are written. Build OUTPUT_BASE.c instead of
+CommonTables/arm_cfft_m23_tables.c, or define ARM_DSP_APP_FFT_TABLES when
+the library is built from CommonTables.c. This tree has no
+arm_common_tables.c: if it is added, drop the cfft entries from CONFIG.
+"""
+import math
+import os
+import sys
+
+MIN_LEN, MAX_LEN = 16, 4096
+FIXED = {'q15': 15, 'q31': 31}
+WINDOWS = {
+    'window_hanning': ('Hanning', [0.5, -0.5]),
+    'window_hamming': ('Hamming', [0.54, -0.46]),
+    'window_blackman_harris_92db': ('BlackmanHarris92db', [0.35875, -0.48829, 0.14128, -0.01168]),
+}
+
+
+def quant(x, bits):
+    """Round to Q<bits> and saturate, +1.0 becomes the largest positive value"""
+    v = int(round(x * (1 << bits)))
+    return max(-(1 << bits), min((1 << bits) - 1, v))
+
+
+def twiddles(n, typ):
+    """{cos, sin} of 2*pi*k/n for k < 3n/4, the layout of both FFT kernels"""
+    out = []
+    for k in range(3 * n // 4):
+        a = 2.0 * math.pi * k / n
+        out += [quant(math.cos(a), FIXED[typ]), quant(math.sin(a), FIXED[typ])]
+    return out
+
+
+def bitrev_pairs(n):
+    """Complex indexes i < j with j the bit reversal of i"""
+    bits = n.bit_length() - 1
+    out = []
+    for i in range(n):
+        j = int(format(i, '0%db' % bits)[::-1], 2)
+        if i < j:
+            out += [i, j]
+    return out
+
+
+def window(coefs, n, typ):
+    vals = [sum(c * math.cos(2.0 * math.pi * m * i / n) for m, c in enumerate(coefs)) for i in range(n)]
+    if typ == 'f32':
+        return vals
+    return [quant(v, FIXED[typ]) for v in vals]
+
+
+def fmt(vals, typ):
+    if typ == 'q15':
+        items, per = ['(q15_t)0x%04X' % (v & 0xFFFF) for v in vals], 8
+    elif typ == 'q31':
+        items, per = ['0x%08X' % (v & 0xFFFFFFFF) for v in vals], 8
+    elif typ == 'f32':
+        items, per = ['%.9ef' % v for v in vals], 6
+    else:
+        items, per = ['%4d' % v for v in vals], 16
+    lines = ['    ' + ', '.join(items[i:i + per]) + ',' for i in range(0, len(items), per)]
+    lines[-1] = lines[-1][:-1]
+    return '\n'.join(lines)
+
+
+def ctype(typ):
+    return {'q15': 'q15_t', 'q31': 'q31_t', 'f32': 'float32_t', 'u16': 'uint16_t'}[typ]
+
+
+def parse(path):
+    entries = {}
+    with open(path) as f:
+        for num, line in enumerate(f, 1):
+            words = line.split('#', 1)[0].split()
+            if not words:
+                continue
+            where = '%s:%d: ' % (path, num)
+            if len(words) < 3:
+                raise SystemExit(where + 'expected <kind> <type> <length> ...')
+            kind, typ = words[0], words[1]
+            if kind == 'goertzel':
+                if typ not in FIXED or len(words) < 4:
+                    raise SystemExit(where + 'expected goertzel q15|q31 <length> <bin> ...')
+                n = int(words[2], 0)
+                if n < 2 or n > MAX_LEN:
+                    raise SystemExit(where + 'Goertzel length %d is not in 2..%d' % (n, MAX_LEN))
+                bins = entries.setdefault((kind, typ), {})
+                if n in bins:
+                    raise SystemExit(where + 'goertzel %s %d is listed twice' % (typ, n))
+                bins[n] = [float(w) for w in words[3:]]
+                continue
+            if kind in ('cfft', 'cfft_m23', 'rfft_m23'):
+                if typ not in FIXED:
+                    raise SystemExit(where + '%s supports q15 and q31' % kind)
+            elif kind in WINDOWS:
+                if typ not in ('q15', 'q31', 'f32'):
+                    raise SystemExit(where + 'windows support q15, q31 and f32')
+            else:
+                raise SystemExit(where + 'unknown kind ' + kind)
+            for w in words[2:]:
+                n = int(w, 0)
+                if kind in WINDOWS:
+                    if n < 2:
+                        raise SystemExit(where + 'bad window length %d' % n)
+                elif kind == 'rfft_m23':
+                    if n < 2 * MIN_LEN or n > MAX_LEN or n & (n - 1):
+                        raise SystemExit(where + 'RFFT length %d is not a power of 2 in %d..%d' % (n, 2 * MIN_LEN, MAX_LEN))
+                    entries.setdefault(('cfft_m23', typ), set()).add(n // 2)
+                elif n < MIN_LEN or n > MAX_LEN or n & (n - 1):
+                    raise SystemExit(where + 'FFT length %d is not a power of 2 in %d..%d' % (n, MIN_LEN, MAX_LEN))
+                entries.setdefault((kind, typ), set()).add(n)
+    if not entries:
+        raise SystemExit(path + ': no entries')
+    return entries
+
+
+def generate(entries, cfg_name, base):
+    name = os.path.basename(base)
+    guard = '__' + name.upper() + '_H'
+    tables = []     # (C type, symbol, values, value type)
+    structs = []    # (C type, symbol, initializer)
+
+    for typ in ('q15', 'q31'):
+        for n in sorted(entries.get(('cfft', typ), ())):
+            tables.append((ctype(typ), 'twiddleCoef_%d_%s' % (n, typ), twiddles(n, typ), typ))
+
+    fixed_lens = set(entries.get(('cfft', 'q15'), ())) | set(entries.get(('cfft', 'q31'), ()))
+    for n in sorted(fixed_lens):
+        tables.append(('uint16_t', 'armBitRevIndexTable_fixed_%d' % n, [8 * v for v in bitrev_pairs(n)], 'u16'))
+
+    for typ in ('q15', 'q31'):
+        for n in sorted(entries.get(('cfft', typ), ())):
+            structs.append(('arm_cfft_instance_%s' % typ, 'arm_cfft_sR_%s_len%d' % (typ, n),
+                            '%d, twiddleCoef_%d_%s, armBitRevIndexTable_fixed_%d, %d'
+                            % (n, n, typ, n, len(bitrev_pairs(n)))))
+
+    m23_lens = set(entries.get(('cfft_m23', 'q15'), ())) | set(entries.get(('cfft_m23', 'q31'), ()))
+    for n in sorted(m23_lens):
+        tables.append(('uint16_t', 'armBitRevPairsM23_%d' % n, bitrev_pairs(n), 'u16'))
+
+    for typ in ('q15', 'q31'):
+        lens = sorted(entries.get(('cfft_m23', typ), ()))
+        if not lens:
+            continue
+        rlens = sorted(entries.get(('rfft_m23', typ), ()))
+        top = max(lens + rlens)
+        tables.append((ctype(typ), 'twiddleCoefM23_%s' % typ, twiddles(top, typ), typ))
+        for n in lens:
+            structs.append(('arm_cfft_plan_%s' % typ, 'arm_cfft_plan_%s_len%d' % (typ, n),
+                            '%d, %d, twiddleCoefM23_%s, armBitRevPairsM23_%d, %d'
+                            % (n, top // n, typ, n, len(bitrev_pairs(n)))))
+        for n in rlens:
+            structs.append(('arm_rfft_plan_%s' % typ, 'arm_rfft_plan_%s_len%d' % (typ, n),
+                            '&arm_cfft_plan_%s_len%d, %d, %d, twiddleCoefM23_%s'
+                            % (typ, n // 2, n, top // n, typ)))
+
+    for typ in ('q15', 'q31'):
+        bins = entries.get(('goertzel', typ), {})
+        for n in sorted(bins):
+            vals = []
+            for k in bins[n]:
+                a = 2.0 * math.pi * k / n
+                vals += [quant(math.cos(a), FIXED[typ]), quant(math.sin(a), FIXED[typ])]
+            tables.append((ctype(typ), 'goertzelCoef_%s_%d' % (typ, n), vals, typ))
+
+    for kind in sorted(WINDOWS):
+        label, coefs = WINDOWS[kind]
+        for typ in ('q15', 'q31', 'f32'):
+            for n in sorted(entries.get((kind, typ), ())):
+                tables.append((ctype(typ), 'window%s_%s_%d' % (label, typ, n), window(coefs, n, typ), typ))
+
+    sizes = {'q15': 2, 'q31': 4, 'f32': 4, 'u16': 2}
+    total = sum(len(t[2]) * sizes[t[3]] for t in tables)
+    summary = '\n'.join(' *             %-36s %6d bytes' % (t[1], len(t[2]) * sizes[t[3]]) for t in tables)
+
+    h = ['/**************************************************************************//**',
+         ' * @file     %s.h' % name,
+         ' * @version  V1.00',
+         ' * @brief    FFT and window tables listed in %s.' % cfg_name,
+         ' *           Generated by Library/CMSIS/DSP/Scripts/gen_fft_tables.py, do not edit.',
+         ' *',
+         ' * SPDX-License-Identifier: Apache-2.0',
+         ' * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.',
+         ' *****************************************************************************/',
+         '#ifndef %s' % guard,
+         '#define %s' % guard,
+         '',
+         '#include "arm_math.h"',
+         '',
+         '#ifdef __cplusplus',
+         'extern "C"',
+         '{',
+         '#endif',
+         '']
+    for t in tables:
+        size = '[]' if t[1].startswith('twiddleCoefM23_') else '[%d]' % len(t[2])
+        h.append('extern const %s %s%s;' % (t[0], t[1], size))
+    h.append('')
+    for s in structs:
+        h.append('extern const %s %s;' % (s[0], s[1]))
+    h += ['',
+          '#ifdef __cplusplus',
+          '}',
+          '#endif',
+          '',
+          '#endif  /* %s */' % guard,
+          '']
+
+    c = ['/**************************************************************************//**',
+         ' * @file     %s.c' % name,
+         ' * @version  V1.00',
+         ' * @brief    FFT and window tables listed in %s, %d bytes of flash:' % (cfg_name, total),
+         summary,
+         ' *           Generated by Library/CMSIS/DSP/Scripts/gen_fft_tables.py, do not edit.',
+         ' *',
+         ' * SPDX-License-Identifier: Apache-2.0',
+         ' * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.',
+         ' *****************************************************************************/',
+         '#include "%s.h"' % name,
+         '']
+    for t in tables:
+        if t[1].startswith('twiddleCoefM23_'):
+            top = len(t[2]) * 2 // 3
+            c.append('/* {cos, sin} of 2*pi*k/%d for k < %d, a plan of length N reads every (%d / N)-th entry */'
+                     % (top, 3 * top // 4, top))
+        c += ['const %s %s[%d] ARM_DSP_TABLE_ATTRIBUTE =' % (t[0], t[1], len(t[2])),
+              '{',
+              fmt(t[2], t[3]),
+              '};',
+              '']
+    for s in structs:
+        c += ['const %s %s ARM_DSP_TABLE_ATTRIBUTE =' % (s[0], s[1]),
+              '{',
+              '    ' + s[2],
+              '};',
+              '']
+
+    for path, lines in ((base + '.h', h), (base + '.c', c)):
+        with open(path, 'w', newline='\n') as f:
+            f.write('\n'.join(lines))
+    return total
+
+
+def main(argv):
+    if len(argv) != 3:
+        raise SystemExit(__doc__)
+    entries = parse(argv[1])
+    total = generate(entries, os.path.basename(argv[1]), argv[2])
+    print('%s.c: %d bytes of tables' % (argv[2], total))
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -28,4 +28,5 @@
 
 #include "arm_common_tables.c"
 #include "arm_const_structs.c"
+#include "arm_cfft_m23_tables.c"
 #include "arm_mve_tables.c"
@@ -8,6 +8,7 @@ target_sources(CMSISDSP PRIVATE CommonTables/arm_common_tables.c
 
 target_sources(CMSISDSP PRIVATE CommonTables/arm_const_structs.c)
 target_sources(CMSISDSP PRIVATE CommonTables/arm_const_structs_f16.c)
+target_sources(CMSISDSP PRIVATE CommonTables/arm_cfft_m23_tables.c)
 
 
 
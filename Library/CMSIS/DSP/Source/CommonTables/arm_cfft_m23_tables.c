@@ -0,0 +1,685 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_m23_tables.c
+ * Description:  Twiddle and bit reversal tables and constant plans of the
+ *               Q15/Q31 complex and real FFT for cores without DSP extension.
+ *               Applications can build the tables of their own lengths with
+ *               Scripts/gen_fft_tables.py and define ARM_DSP_APP_FFT_TABLES
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math_types.h"
+#include "arm_const_structs.h"
+
+#if !defined(ARM_DSP_APP_FFT_TABLES)
+
+/* Twiddles of the 1024-point transform, {cos, sin} of 2*pi*k/1024 for k < 768.
+   A plan of length N reads every (1024 / N)-th entry. */
+const q15_t twiddleCoefM23_q15[1536] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x7FFE, (q15_t)0x0192, (q15_t)0x7FFA, (q15_t)0x025B,
+    (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FF1, (q15_t)0x03ED, (q15_t)0x7FEA, (q15_t)0x04B6, (q15_t)0x7FE2, (q15_t)0x057F,
+    (q15_t)0x7FD9, (q15_t)0x0648, (q15_t)0x7FCE, (q15_t)0x0711, (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x7FB5, (q15_t)0x08A2,
+    (q15_t)0x7FA7, (q15_t)0x096B, (q15_t)0x7F98, (q15_t)0x0A33, (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x7F75, (q15_t)0x0BC4,
+    (q15_t)0x7F62, (q15_t)0x0C8C, (q15_t)0x7F4E, (q15_t)0x0D54, (q15_t)0x7F38, (q15_t)0x0E1C, (q15_t)0x7F22, (q15_t)0x0EE4,
+    (q15_t)0x7F0A, (q15_t)0x0FAB, (q15_t)0x7EF0, (q15_t)0x1073, (q15_t)0x7ED6, (q15_t)0x113A, (q15_t)0x7EBA, (q15_t)0x1201,
+    (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7E7F, (q15_t)0x138F, (q15_t)0x7E60, (q15_t)0x1455, (q15_t)0x7E3F, (q15_t)0x151C,
+    (q15_t)0x7E1E, (q15_t)0x15E2, (q15_t)0x7DFB, (q15_t)0x16A8, (q15_t)0x7DD6, (q15_t)0x176E, (q15_t)0x7DB1, (q15_t)0x1833,
+    (q15_t)0x7D8A, (q15_t)0x18F9, (q15_t)0x7D63, (q15_t)0x19BE, (q15_t)0x7D3A, (q15_t)0x1A83, (q15_t)0x7D0F, (q15_t)0x1B47,
+    (q15_t)0x7CE4, (q15_t)0x1C0C, (q15_t)0x7CB7, (q15_t)0x1CD0, (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x7C5A, (q15_t)0x1E57,
+    (q15_t)0x7C2A, (q15_t)0x1F1A, (q15_t)0x7BF9, (q15_t)0x1FDD, (q15_t)0x7BC6, (q15_t)0x209F, (q15_t)0x7B92, (q15_t)0x2162,
+    (q15_t)0x7B5D, (q15_t)0x2224, (q15_t)0x7B27, (q15_t)0x22E5, (q15_t)0x7AEF, (q15_t)0x23A7, (q15_t)0x7AB7, (q15_t)0x2467,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7A42, (q15_t)0x25E8, (q15_t)0x7A06, (q15_t)0x26A8, (q15_t)0x79C9, (q15_t)0x2768,
+    (q15_t)0x798A, (q15_t)0x2827, (q15_t)0x794A, (q15_t)0x28E5, (q15_t)0x790A, (q15_t)0x29A4, (q15_t)0x78C8, (q15_t)0x2A62,
+    (q15_t)0x7885, (q15_t)0x2B1F, (q15_t)0x7840, (q15_t)0x2BDC, (q15_t)0x77FB, (q15_t)0x2C99, (q15_t)0x77B4, (q15_t)0x2D55,
+    (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x7723, (q15_t)0x2ECC, (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x768E, (q15_t)0x3042,
+    (q15_t)0x7642, (q15_t)0x30FC, (q15_t)0x75F4, (q15_t)0x31B5, (q15_t)0x75A6, (q15_t)0x326E, (q15_t)0x7556, (q15_t)0x3327,
+    (q15_t)0x7505, (q15_t)0x33DF, (q15_t)0x74B3, (q15_t)0x3497, (q15_t)0x7460, (q15_t)0x354E, (q15_t)0x740B, (q15_t)0x3604,
+    (q15_t)0x73B6, (q15_t)0x36BA, (q15_t)0x735F, (q15_t)0x3770, (q15_t)0x7308, (q15_t)0x3825, (q15_t)0x72AF, (q15_t)0x38D9,
+    (q15_t)0x7255, (q15_t)0x398D, (q15_t)0x71FA, (q15_t)0x3A40, (q15_t)0x719E, (q15_t)0x3AF3, (q15_t)0x7141, (q15_t)0x3BA5,
+    (q15_t)0x70E3, (q15_t)0x3C57, (q15_t)0x7083, (q15_t)0x3D08, (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x6FC2, (q15_t)0x3E68,
+    (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x6EFB, (q15_t)0x3FC6, (q15_t)0x6E97, (q15_t)0x4074, (q15_t)0x6E31, (q15_t)0x4121,
+    (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x6D62, (q15_t)0x427A, (q15_t)0x6CF9, (q15_t)0x4326, (q15_t)0x6C8F, (q15_t)0x43D1,
+    (q15_t)0x6C24, (q15_t)0x447B, (q15_t)0x6BB8, (q15_t)0x4524, (q15_t)0x6B4B, (q15_t)0x45CD, (q15_t)0x6ADD, (q15_t)0x4675,
+    (q15_t)0x6A6E, (q15_t)0x471D, (q15_t)0x69FD, (q15_t)0x47C4, (q15_t)0x698C, (q15_t)0x486A, (q15_t)0x691A, (q15_t)0x490F,
+    (q15_t)0x68A7, (q15_t)0x49B4, (q15_t)0x6832, (q15_t)0x4A58, (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x6747, (q15_t)0x4B9E,
+    (q15_t)0x66D0, (q15_t)0x4C40, (q15_t)0x6657, (q15_t)0x4CE1, (q15_t)0x65DE, (q15_t)0x4D81, (q15_t)0x6564, (q15_t)0x4E21,
+    (q15_t)0x64E9, (q15_t)0x4EC0, (q15_t)0x646C, (q15_t)0x4F5E, (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x6371, (q15_t)0x5098,
+    (q15_t)0x62F2, (q15_t)0x5134, (q15_t)0x6272, (q15_t)0x51CF, (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x616F, (q15_t)0x5303,
+    (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x6068, (q15_t)0x5433, (q15_t)0x5FE4, (q15_t)0x54CA, (q15_t)0x5F5E, (q15_t)0x5560,
+    (q15_t)0x5ED7, (q15_t)0x55F6, (q15_t)0x5E50, (q15_t)0x568A, (q15_t)0x5DC8, (q15_t)0x571E, (q15_t)0x5D3E, (q15_t)0x57B1,
+    (q15_t)0x5CB4, (q15_t)0x5843, (q15_t)0x5C29, (q15_t)0x58D4, (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x5B10, (q15_t)0x59F4,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x59F4, (q15_t)0x5B10, (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0x58D4, (q15_t)0x5C29,
+    (q15_t)0x5843, (q15_t)0x5CB4, (q15_t)0x57B1, (q15_t)0x5D3E, (q15_t)0x571E, (q15_t)0x5DC8, (q15_t)0x568A, (q15_t)0x5E50,
+    (q15_t)0x55F6, (q15_t)0x5ED7, (q15_t)0x5560, (q15_t)0x5F5E, (q15_t)0x54CA, (q15_t)0x5FE4, (q15_t)0x5433, (q15_t)0x6068,
+    (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0x5303, (q15_t)0x616F, (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0x51CF, (q15_t)0x6272,
+    (q15_t)0x5134, (q15_t)0x62F2, (q15_t)0x5098, (q15_t)0x6371, (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0x4F5E, (q15_t)0x646C,
+    (q15_t)0x4EC0, (q15_t)0x64E9, (q15_t)0x4E21, (q15_t)0x6564, (q15_t)0x4D81, (q15_t)0x65DE, (q15_t)0x4CE1, (q15_t)0x6657,
+    (q15_t)0x4C40, (q15_t)0x66D0, (q15_t)0x4B9E, (q15_t)0x6747, (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0x4A58, (q15_t)0x6832,
+    (q15_t)0x49B4, (q15_t)0x68A7, (q15_t)0x490F, (q15_t)0x691A, (q15_t)0x486A, (q15_t)0x698C, (q15_t)0x47C4, (q15_t)0x69FD,
+    (q15_t)0x471D, (q15_t)0x6A6E, (q15_t)0x4675, (q15_t)0x6ADD, (q15_t)0x45CD, (q15_t)0x6B4B, (q15_t)0x4524, (q15_t)0x6BB8,
+    (q15_t)0x447B, (q15_t)0x6C24, (q15_t)0x43D1, (q15_t)0x6C8F, (q15_t)0x4326, (q15_t)0x6CF9, (q15_t)0x427A, (q15_t)0x6D62,
+    (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x4121, (q15_t)0x6E31, (q15_t)0x4074, (q15_t)0x6E97, (q15_t)0x3FC6, (q15_t)0x6EFB,
+    (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0x3E68, (q15_t)0x6FC2, (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0x3D08, (q15_t)0x7083,
+    (q15_t)0x3C57, (q15_t)0x70E3, (q15_t)0x3BA5, (q15_t)0x7141, (q15_t)0x3AF3, (q15_t)0x719E, (q15_t)0x3A40, (q15_t)0x71FA,
+    (q15_t)0x398D, (q15_t)0x7255, (q15_t)0x38D9, (q15_t)0x72AF, (q15_t)0x3825, (q15_t)0x7308, (q15_t)0x3770, (q15_t)0x735F,
+    (q15_t)0x36BA, (q15_t)0x73B6, (q15_t)0x3604, (q15_t)0x740B, (q15_t)0x354E, (q15_t)0x7460, (q15_t)0x3497, (q15_t)0x74B3,
+    (q15_t)0x33DF, (q15_t)0x7505, (q15_t)0x3327, (q15_t)0x7556, (q15_t)0x326E, (q15_t)0x75A6, (q15_t)0x31B5, (q15_t)0x75F4,
+    (q15_t)0x30FC, (q15_t)0x7642, (q15_t)0x3042, (q15_t)0x768E, (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0x2ECC, (q15_t)0x7723,
+    (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0x2D55, (q15_t)0x77B4, (q15_t)0x2C99, (q15_t)0x77FB, (q15_t)0x2BDC, (q15_t)0x7840,
+    (q15_t)0x2B1F, (q15_t)0x7885, (q15_t)0x2A62, (q15_t)0x78C8, (q15_t)0x29A4, (q15_t)0x790A, (q15_t)0x28E5, (q15_t)0x794A,
+    (q15_t)0x2827, (q15_t)0x798A, (q15_t)0x2768, (q15_t)0x79C9, (q15_t)0x26A8, (q15_t)0x7A06, (q15_t)0x25E8, (q15_t)0x7A42,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x2467, (q15_t)0x7AB7, (q15_t)0x23A7, (q15_t)0x7AEF, (q15_t)0x22E5, (q15_t)0x7B27,
+    (q15_t)0x2224, (q15_t)0x7B5D, (q15_t)0x2162, (q15_t)0x7B92, (q15_t)0x209F, (q15_t)0x7BC6, (q15_t)0x1FDD, (q15_t)0x7BF9,
+    (q15_t)0x1F1A, (q15_t)0x7C2A, (q15_t)0x1E57, (q15_t)0x7C5A, (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0x1CD0, (q15_t)0x7CB7,
+    (q15_t)0x1C0C, (q15_t)0x7CE4, (q15_t)0x1B47, (q15_t)0x7D0F, (q15_t)0x1A83, (q15_t)0x7D3A, (q15_t)0x19BE, (q15_t)0x7D63,
+    (q15_t)0x18F9, (q15_t)0x7D8A, (q15_t)0x1833, (q15_t)0x7DB1, (q15_t)0x176E, (q15_t)0x7DD6, (q15_t)0x16A8, (q15_t)0x7DFB,
+    (q15_t)0x15E2, (q15_t)0x7E1E, (q15_t)0x151C, (q15_t)0x7E3F, (q15_t)0x1455, (q15_t)0x7E60, (q15_t)0x138F, (q15_t)0x7E7F,
+    (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x1201, (q15_t)0x7EBA, (q15_t)0x113A, (q15_t)0x7ED6, (q15_t)0x1073, (q15_t)0x7EF0,
+    (q15_t)0x0FAB, (q15_t)0x7F0A, (q15_t)0x0EE4, (q15_t)0x7F22, (q15_t)0x0E1C, (q15_t)0x7F38, (q15_t)0x0D54, (q15_t)0x7F4E,
+    (q15_t)0x0C8C, (q15_t)0x7F62, (q15_t)0x0BC4, (q15_t)0x7F75, (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0x0A33, (q15_t)0x7F98,
+    (q15_t)0x096B, (q15_t)0x7FA7, (q15_t)0x08A2, (q15_t)0x7FB5, (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0x0711, (q15_t)0x7FCE,
+    (q15_t)0x0648, (q15_t)0x7FD9, (q15_t)0x057F, (q15_t)0x7FE2, (q15_t)0x04B6, (q15_t)0x7FEA, (q15_t)0x03ED, (q15_t)0x7FF1,
+    (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x025B, (q15_t)0x7FFA, (q15_t)0x0192, (q15_t)0x7FFE, (q15_t)0x00C9, (q15_t)0x7FFF,
+    (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xFF37, (q15_t)0x7FFF, (q15_t)0xFE6E, (q15_t)0x7FFE, (q15_t)0xFDA5, (q15_t)0x7FFA,
+    (q15_t)0xFCDC, (q15_t)0x7FF6, (q15_t)0xFC13, (q15_t)0x7FF1, (q15_t)0xFB4A, (q15_t)0x7FEA, (q15_t)0xFA81, (q15_t)0x7FE2,
+    (q15_t)0xF9B8, (q15_t)0x7FD9, (q15_t)0xF8EF, (q15_t)0x7FCE, (q15_t)0xF827, (q15_t)0x7FC2, (q15_t)0xF75E, (q15_t)0x7FB5,
+    (q15_t)0xF695, (q15_t)0x7FA7, (q15_t)0xF5CD, (q15_t)0x7F98, (q15_t)0xF505, (q15_t)0x7F87, (q15_t)0xF43C, (q15_t)0x7F75,
+    (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0xF2AC, (q15_t)0x7F4E, (q15_t)0xF1E4, (q15_t)0x7F38, (q15_t)0xF11C, (q15_t)0x7F22,
+    (q15_t)0xF055, (q15_t)0x7F0A, (q15_t)0xEF8D, (q15_t)0x7EF0, (q15_t)0xEEC6, (q15_t)0x7ED6, (q15_t)0xEDFF, (q15_t)0x7EBA,
+    (q15_t)0xED38, (q15_t)0x7E9D, (q15_t)0xEC71, (q15_t)0x7E7F, (q15_t)0xEBAB, (q15_t)0x7E60, (q15_t)0xEAE4, (q15_t)0x7E3F,
+    (q15_t)0xEA1E, (q15_t)0x7E1E, (q15_t)0xE958, (q15_t)0x7DFB, (q15_t)0xE892, (q15_t)0x7DD6, (q15_t)0xE7CD, (q15_t)0x7DB1,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0xE642, (q15_t)0x7D63, (q15_t)0xE57D, (q15_t)0x7D3A, (q15_t)0xE4B9, (q15_t)0x7D0F,
+    (q15_t)0xE3F4, (q15_t)0x7CE4, (q15_t)0xE330, (q15_t)0x7CB7, (q15_t)0xE26D, (q15_t)0x7C89, (q15_t)0xE1A9, (q15_t)0x7C5A,
+    (q15_t)0xE0E6, (q15_t)0x7C2A, (q15_t)0xE023, (q15_t)0x7BF9, (q15_t)0xDF61, (q15_t)0x7BC6, (q15_t)0xDE9E, (q15_t)0x7B92,
+    (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0xDD1B, (q15_t)0x7B27, (q15_t)0xDC59, (q15_t)0x7AEF, (q15_t)0xDB99, (q15_t)0x7AB7,
+    (q15_t)0xDAD8, (q15_t)0x7A7D, (q15_t)0xDA18, (q15_t)0x7A42, (q15_t)0xD958, (q15_t)0x7A06, (q15_t)0xD898, (q15_t)0x79C9,
+    (q15_t)0xD7D9, (q15_t)0x798A, (q15_t)0xD71B, (q15_t)0x794A, (q15_t)0xD65C, (q15_t)0x790A, (q15_t)0xD59E, (q15_t)0x78C8,
+    (q15_t)0xD4E1, (q15_t)0x7885, (q15_t)0xD424, (q15_t)0x7840, (q15_t)0xD367, (q15_t)0x77FB, (q15_t)0xD2AB, (q15_t)0x77B4,
+    (q15_t)0xD1EF, (q15_t)0x776C, (q15_t)0xD134, (q15_t)0x7723, (q15_t)0xD079, (q15_t)0x76D9, (q15_t)0xCFBE, (q15_t)0x768E,
+    (q15_t)0xCF04, (q15_t)0x7642, (q15_t)0xCE4B, (q15_t)0x75F4, (q15_t)0xCD92, (q15_t)0x75A6, (q15_t)0xCCD9, (q15_t)0x7556,
+    (q15_t)0xCC21, (q15_t)0x7505, (q15_t)0xCB69, (q15_t)0x74B3, (q15_t)0xCAB2, (q15_t)0x7460, (q15_t)0xC9FC, (q15_t)0x740B,
+    (q15_t)0xC946, (q15_t)0x73B6, (q15_t)0xC890, (q15_t)0x735F, (q15_t)0xC7DB, (q15_t)0x7308, (q15_t)0xC727, (q15_t)0x72AF,
+    (q15_t)0xC673, (q15_t)0x7255, (q15_t)0xC5C0, (q15_t)0x71FA, (q15_t)0xC50D, (q15_t)0x719E, (q15_t)0xC45B, (q15_t)0x7141,
+    (q15_t)0xC3A9, (q15_t)0x70E3, (q15_t)0xC2F8, (q15_t)0x7083, (q15_t)0xC248, (q15_t)0x7023, (q15_t)0xC198, (q15_t)0x6FC2,
+    (q15_t)0xC0E9, (q15_t)0x6F5F, (q15_t)0xC03A, (q15_t)0x6EFB, (q15_t)0xBF8C, (q15_t)0x6E97, (q15_t)0xBEDF, (q15_t)0x6E31,
+    (q15_t)0xBE32, (q15_t)0x6DCA, (q15_t)0xBD86, (q15_t)0x6D62, (q15_t)0xBCDA, (q15_t)0x6CF9, (q15_t)0xBC2F, (q15_t)0x6C8F,
+    (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0xBADC, (q15_t)0x6BB8, (q15_t)0xBA33, (q15_t)0x6B4B, (q15_t)0xB98B, (q15_t)0x6ADD,
+    (q15_t)0xB8E3, (q15_t)0x6A6E, (q15_t)0xB83C, (q15_t)0x69FD, (q15_t)0xB796, (q15_t)0x698C, (q15_t)0xB6F1, (q15_t)0x691A,
+    (q15_t)0xB64C, (q15_t)0x68A7, (q15_t)0xB5A8, (q15_t)0x6832, (q15_t)0xB505, (q15_t)0x67BD, (q15_t)0xB462, (q15_t)0x6747,
+    (q15_t)0xB3C0, (q15_t)0x66D0, (q15_t)0xB31F, (q15_t)0x6657, (q15_t)0xB27F, (q15_t)0x65DE, (q15_t)0xB1DF, (q15_t)0x6564,
+    (q15_t)0xB140, (q15_t)0x64E9, (q15_t)0xB0A2, (q15_t)0x646C, (q15_t)0xB005, (q15_t)0x63EF, (q15_t)0xAF68, (q15_t)0x6371,
+    (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0xAE31, (q15_t)0x6272, (q15_t)0xAD97, (q15_t)0x61F1, (q15_t)0xACFD, (q15_t)0x616F,
+    (q15_t)0xAC65, (q15_t)0x60EC, (q15_t)0xABCD, (q15_t)0x6068, (q15_t)0xAB36, (q15_t)0x5FE4, (q15_t)0xAAA0, (q15_t)0x5F5E,
+    (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0xA976, (q15_t)0x5E50, (q15_t)0xA8E2, (q15_t)0x5DC8, (q15_t)0xA84F, (q15_t)0x5D3E,
+    (q15_t)0xA7BD, (q15_t)0x5CB4, (q15_t)0xA72C, (q15_t)0x5C29, (q15_t)0xA69C, (q15_t)0x5B9D, (q15_t)0xA60C, (q15_t)0x5B10,
+    (q15_t)0xA57E, (q15_t)0x5A82, (q15_t)0xA4F0, (q15_t)0x59F4, (q15_t)0xA463, (q15_t)0x5964, (q15_t)0xA3D7, (q15_t)0x58D4,
+    (q15_t)0xA34C, (q15_t)0x5843, (q15_t)0xA2C2, (q15_t)0x57B1, (q15_t)0xA238, (q15_t)0x571E, (q15_t)0xA1B0, (q15_t)0x568A,
+    (q15_t)0xA129, (q15_t)0x55F6, (q15_t)0xA0A2, (q15_t)0x5560, (q15_t)0xA01C, (q15_t)0x54CA, (q15_t)0x9F98, (q15_t)0x5433,
+    (q15_t)0x9F14, (q15_t)0x539B, (q15_t)0x9E91, (q15_t)0x5303, (q15_t)0x9E0F, (q15_t)0x5269, (q15_t)0x9D8E, (q15_t)0x51CF,
+    (q15_t)0x9D0E, (q15_t)0x5134, (q15_t)0x9C8F, (q15_t)0x5098, (q15_t)0x9C11, (q15_t)0x4FFB, (q15_t)0x9B94, (q15_t)0x4F5E,
+    (q15_t)0x9B17, (q15_t)0x4EC0, (q15_t)0x9A9C, (q15_t)0x4E21, (q15_t)0x9A22, (q15_t)0x4D81, (q15_t)0x99A9, (q15_t)0x4CE1,
+    (q15_t)0x9930, (q15_t)0x4C40, (q15_t)0x98B9, (q15_t)0x4B9E, (q15_t)0x9843, (q15_t)0x4AFB, (q15_t)0x97CE, (q15_t)0x4A58,
+    (q15_t)0x9759, (q15_t)0x49B4, (q15_t)0x96E6, (q15_t)0x490F, (q15_t)0x9674, (q15_t)0x486A, (q15_t)0x9603, (q15_t)0x47C4,
+    (q15_t)0x9592, (q15_t)0x471D, (q15_t)0x9523, (q15_t)0x4675, (q15_t)0x94B5, (q15_t)0x45CD, (q15_t)0x9448, (q15_t)0x4524,
+    (q15_t)0x93DC, (q15_t)0x447B, (q15_t)0x9371, (q15_t)0x43D1, (q15_t)0x9307, (q15_t)0x4326, (q15_t)0x929E, (q15_t)0x427A,
+    (q15_t)0x9236, (q15_t)0x41CE, (q15_t)0x91CF, (q15_t)0x4121, (q15_t)0x9169, (q15_t)0x4074, (q15_t)0x9105, (q15_t)0x3FC6,
+    (q15_t)0x90A1, (q15_t)0x3F17, (q15_t)0x903E, (q15_t)0x3E68, (q15_t)0x8FDD, (q15_t)0x3DB8, (q15_t)0x8F7D, (q15_t)0x3D08,
+    (q15_t)0x8F1D, (q15_t)0x3C57, (q15_t)0x8EBF, (q15_t)0x3BA5, (q15_t)0x8E62, (q15_t)0x3AF3, (q15_t)0x8E06, (q15_t)0x3A40,
+    (q15_t)0x8DAB, (q15_t)0x398D, (q15_t)0x8D51, (q15_t)0x38D9, (q15_t)0x8CF8, (q15_t)0x3825, (q15_t)0x8CA1, (q15_t)0x3770,
+    (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0x8BF5, (q15_t)0x3604, (q15_t)0x8BA0, (q15_t)0x354E, (q15_t)0x8B4D, (q15_t)0x3497,
+    (q15_t)0x8AFB, (q15_t)0x33DF, (q15_t)0x8AAA, (q15_t)0x3327, (q15_t)0x8A5A, (q15_t)0x326E, (q15_t)0x8A0C, (q15_t)0x31B5,
+    (q15_t)0x89BE, (q15_t)0x30FC, (q15_t)0x8972, (q15_t)0x3042, (q15_t)0x8927, (q15_t)0x2F87, (q15_t)0x88DD, (q15_t)0x2ECC,
+    (q15_t)0x8894, (q15_t)0x2E11, (q15_t)0x884C, (q15_t)0x2D55, (q15_t)0x8805, (q15_t)0x2C99, (q15_t)0x87C0, (q15_t)0x2BDC,
+    (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x8738, (q15_t)0x2A62, (q15_t)0x86F6, (q15_t)0x29A4, (q15_t)0x86B6, (q15_t)0x28E5,
+    (q15_t)0x8676, (q15_t)0x2827, (q15_t)0x8637, (q15_t)0x2768, (q15_t)0x85FA, (q15_t)0x26A8, (q15_t)0x85BE, (q15_t)0x25E8,
+    (q15_t)0x8583, (q15_t)0x2528, (q15_t)0x8549, (q15_t)0x2467, (q15_t)0x8511, (q15_t)0x23A7, (q15_t)0x84D9, (q15_t)0x22E5,
+    (q15_t)0x84A3, (q15_t)0x2224, (q15_t)0x846E, (q15_t)0x2162, (q15_t)0x843A, (q15_t)0x209F, (q15_t)0x8407, (q15_t)0x1FDD,
+    (q15_t)0x83D6, (q15_t)0x1F1A, (q15_t)0x83A6, (q15_t)0x1E57, (q15_t)0x8377, (q15_t)0x1D93, (q15_t)0x8349, (q15_t)0x1CD0,
+    (q15_t)0x831C, (q15_t)0x1C0C, (q15_t)0x82F1, (q15_t)0x1B47, (q15_t)0x82C6, (q15_t)0x1A83, (q15_t)0x829D, (q15_t)0x19BE,
+    (q15_t)0x8276, (q15_t)0x18F9, (q15_t)0x824F, (q15_t)0x1833, (q15_t)0x822A, (q15_t)0x176E, (q15_t)0x8205, (q15_t)0x16A8,
+    (q15_t)0x81E2, (q15_t)0x15E2, (q15_t)0x81C1, (q15_t)0x151C, (q15_t)0x81A0, (q15_t)0x1455, (q15_t)0x8181, (q15_t)0x138F,
+    (q15_t)0x8163, (q15_t)0x12C8, (q15_t)0x8146, (q15_t)0x1201, (q15_t)0x812A, (q15_t)0x113A, (q15_t)0x8110, (q15_t)0x1073,
+    (q15_t)0x80F6, (q15_t)0x0FAB, (q15_t)0x80DE, (q15_t)0x0EE4, (q15_t)0x80C8, (q15_t)0x0E1C, (q15_t)0x80B2, (q15_t)0x0D54,
+    (q15_t)0x809E, (q15_t)0x0C8C, (q15_t)0x808B, (q15_t)0x0BC4, (q15_t)0x8079, (q15_t)0x0AFB, (q15_t)0x8068, (q15_t)0x0A33,
+    (q15_t)0x8059, (q15_t)0x096B, (q15_t)0x804B, (q15_t)0x08A2, (q15_t)0x803E, (q15_t)0x07D9, (q15_t)0x8032, (q15_t)0x0711,
+    (q15_t)0x8027, (q15_t)0x0648, (q15_t)0x801E, (q15_t)0x057F, (q15_t)0x8016, (q15_t)0x04B6, (q15_t)0x800F, (q15_t)0x03ED,
+    (q15_t)0x800A, (q15_t)0x0324, (q15_t)0x8006, (q15_t)0x025B, (q15_t)0x8002, (q15_t)0x0192, (q15_t)0x8001, (q15_t)0x00C9,
+    (q15_t)0x8000, (q15_t)0x0000, (q15_t)0x8001, (q15_t)0xFF37, (q15_t)0x8002, (q15_t)0xFE6E, (q15_t)0x8006, (q15_t)0xFDA5,
+    (q15_t)0x800A, (q15_t)0xFCDC, (q15_t)0x800F, (q15_t)0xFC13, (q15_t)0x8016, (q15_t)0xFB4A, (q15_t)0x801E, (q15_t)0xFA81,
+    (q15_t)0x8027, (q15_t)0xF9B8, (q15_t)0x8032, (q15_t)0xF8EF, (q15_t)0x803E, (q15_t)0xF827, (q15_t)0x804B, (q15_t)0xF75E,
+    (q15_t)0x8059, (q15_t)0xF695, (q15_t)0x8068, (q15_t)0xF5CD, (q15_t)0x8079, (q15_t)0xF505, (q15_t)0x808B, (q15_t)0xF43C,
+    (q15_t)0x809E, (q15_t)0xF374, (q15_t)0x80B2, (q15_t)0xF2AC, (q15_t)0x80C8, (q15_t)0xF1E4, (q15_t)0x80DE, (q15_t)0xF11C,
+    (q15_t)0x80F6, (q15_t)0xF055, (q15_t)0x8110, (q15_t)0xEF8D, (q15_t)0x812A, (q15_t)0xEEC6, (q15_t)0x8146, (q15_t)0xEDFF,
+    (q15_t)0x8163, (q15_t)0xED38, (q15_t)0x8181, (q15_t)0xEC71, (q15_t)0x81A0, (q15_t)0xEBAB, (q15_t)0x81C1, (q15_t)0xEAE4,
+    (q15_t)0x81E2, (q15_t)0xEA1E, (q15_t)0x8205, (q15_t)0xE958, (q15_t)0x822A, (q15_t)0xE892, (q15_t)0x824F, (q15_t)0xE7CD,
+    (q15_t)0x8276, (q15_t)0xE707, (q15_t)0x829D, (q15_t)0xE642, (q15_t)0x82C6, (q15_t)0xE57D, (q15_t)0x82F1, (q15_t)0xE4B9,
+    (q15_t)0x831C, (q15_t)0xE3F4, (q15_t)0x8349, (q15_t)0xE330, (q15_t)0x8377, (q15_t)0xE26D, (q15_t)0x83A6, (q15_t)0xE1A9,
+    (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x8407, (q15_t)0xE023, (q15_t)0x843A, (q15_t)0xDF61, (q15_t)0x846E, (q15_t)0xDE9E,
+    (q15_t)0x84A3, (q15_t)0xDDDC, (q15_t)0x84D9, (q15_t)0xDD1B, (q15_t)0x8511, (q15_t)0xDC59, (q15_t)0x8549, (q15_t)0xDB99,
+    (q15_t)0x8583, (q15_t)0xDAD8, (q15_t)0x85BE, (q15_t)0xDA18, (q15_t)0x85FA, (q15_t)0xD958, (q15_t)0x8637, (q15_t)0xD898,
+    (q15_t)0x8676, (q15_t)0xD7D9, (q15_t)0x86B6, (q15_t)0xD71B, (q15_t)0x86F6, (q15_t)0xD65C, (q15_t)0x8738, (q15_t)0xD59E,
+    (q15_t)0x877B, (q15_t)0xD4E1, (q15_t)0x87C0, (q15_t)0xD424, (q15_t)0x8805, (q15_t)0xD367, (q15_t)0x884C, (q15_t)0xD2AB,
+    (q15_t)0x8894, (q15_t)0xD1EF, (q15_t)0x88DD, (q15_t)0xD134, (q15_t)0x8927, (q15_t)0xD079, (q15_t)0x8972, (q15_t)0xCFBE,
+    (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x8A0C, (q15_t)0xCE4B, (q15_t)0x8A5A, (q15_t)0xCD92, (q15_t)0x8AAA, (q15_t)0xCCD9,
+    (q15_t)0x8AFB, (q15_t)0xCC21, (q15_t)0x8B4D, (q15_t)0xCB69, (q15_t)0x8BA0, (q15_t)0xCAB2, (q15_t)0x8BF5, (q15_t)0xC9FC,
+    (q15_t)0x8C4A, (q15_t)0xC946, (q15_t)0x8CA1, (q15_t)0xC890, (q15_t)0x8CF8, (q15_t)0xC7DB, (q15_t)0x8D51, (q15_t)0xC727,
+    (q15_t)0x8DAB, (q15_t)0xC673, (q15_t)0x8E06, (q15_t)0xC5C0, (q15_t)0x8E62, (q15_t)0xC50D, (q15_t)0x8EBF, (q15_t)0xC45B,
+    (q15_t)0x8F1D, (q15_t)0xC3A9, (q15_t)0x8F7D, (q15_t)0xC2F8, (q15_t)0x8FDD, (q15_t)0xC248, (q15_t)0x903E, (q15_t)0xC198,
+    (q15_t)0x90A1, (q15_t)0xC0E9, (q15_t)0x9105, (q15_t)0xC03A, (q15_t)0x9169, (q15_t)0xBF8C, (q15_t)0x91CF, (q15_t)0xBEDF,
+    (q15_t)0x9236, (q15_t)0xBE32, (q15_t)0x929E, (q15_t)0xBD86, (q15_t)0x9307, (q15_t)0xBCDA, (q15_t)0x9371, (q15_t)0xBC2F,
+    (q15_t)0x93DC, (q15_t)0xBB85, (q15_t)0x9448, (q15_t)0xBADC, (q15_t)0x94B5, (q15_t)0xBA33, (q15_t)0x9523, (q15_t)0xB98B,
+    (q15_t)0x9592, (q15_t)0xB8E3, (q15_t)0x9603, (q15_t)0xB83C, (q15_t)0x9674, (q15_t)0xB796, (q15_t)0x96E6, (q15_t)0xB6F1,
+    (q15_t)0x9759, (q15_t)0xB64C, (q15_t)0x97CE, (q15_t)0xB5A8, (q15_t)0x9843, (q15_t)0xB505, (q15_t)0x98B9, (q15_t)0xB462,
+    (q15_t)0x9930, (q15_t)0xB3C0, (q15_t)0x99A9, (q15_t)0xB31F, (q15_t)0x9A22, (q15_t)0xB27F, (q15_t)0x9A9C, (q15_t)0xB1DF,
+    (q15_t)0x9B17, (q15_t)0xB140, (q15_t)0x9B94, (q15_t)0xB0A2, (q15_t)0x9C11, (q15_t)0xB005, (q15_t)0x9C8F, (q15_t)0xAF68,
+    (q15_t)0x9D0E, (q15_t)0xAECC, (q15_t)0x9D8E, (q15_t)0xAE31, (q15_t)0x9E0F, (q15_t)0xAD97, (q15_t)0x9E91, (q15_t)0xACFD,
+    (q15_t)0x9F14, (q15_t)0xAC65, (q15_t)0x9F98, (q15_t)0xABCD, (q15_t)0xA01C, (q15_t)0xAB36, (q15_t)0xA0A2, (q15_t)0xAAA0,
+    (q15_t)0xA129, (q15_t)0xAA0A, (q15_t)0xA1B0, (q15_t)0xA976, (q15_t)0xA238, (q15_t)0xA8E2, (q15_t)0xA2C2, (q15_t)0xA84F,
+    (q15_t)0xA34C, (q15_t)0xA7BD, (q15_t)0xA3D7, (q15_t)0xA72C, (q15_t)0xA463, (q15_t)0xA69C, (q15_t)0xA4F0, (q15_t)0xA60C,
+    (q15_t)0xA57E, (q15_t)0xA57E, (q15_t)0xA60C, (q15_t)0xA4F0, (q15_t)0xA69C, (q15_t)0xA463, (q15_t)0xA72C, (q15_t)0xA3D7,
+    (q15_t)0xA7BD, (q15_t)0xA34C, (q15_t)0xA84F, (q15_t)0xA2C2, (q15_t)0xA8E2, (q15_t)0xA238, (q15_t)0xA976, (q15_t)0xA1B0,
+    (q15_t)0xAA0A, (q15_t)0xA129, (q15_t)0xAAA0, (q15_t)0xA0A2, (q15_t)0xAB36, (q15_t)0xA01C, (q15_t)0xABCD, (q15_t)0x9F98,
+    (q15_t)0xAC65, (q15_t)0x9F14, (q15_t)0xACFD, (q15_t)0x9E91, (q15_t)0xAD97, (q15_t)0x9E0F, (q15_t)0xAE31, (q15_t)0x9D8E,
+    (q15_t)0xAECC, (q15_t)0x9D0E, (q15_t)0xAF68, (q15_t)0x9C8F, (q15_t)0xB005, (q15_t)0x9C11, (q15_t)0xB0A2, (q15_t)0x9B94,
+    (q15_t)0xB140, (q15_t)0x9B17, (q15_t)0xB1DF, (q15_t)0x9A9C, (q15_t)0xB27F, (q15_t)0x9A22, (q15_t)0xB31F, (q15_t)0x99A9,
+    (q15_t)0xB3C0, (q15_t)0x9930, (q15_t)0xB462, (q15_t)0x98B9, (q15_t)0xB505, (q15_t)0x9843, (q15_t)0xB5A8, (q15_t)0x97CE,
+    (q15_t)0xB64C, (q15_t)0x9759, (q15_t)0xB6F1, (q15_t)0x96E6, (q15_t)0xB796, (q15_t)0x9674, (q15_t)0xB83C, (q15_t)0x9603,
+    (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0xB98B, (q15_t)0x9523, (q15_t)0xBA33, (q15_t)0x94B5, (q15_t)0xBADC, (q15_t)0x9448,
+    (q15_t)0xBB85, (q15_t)0x93DC, (q15_t)0xBC2F, (q15_t)0x9371, (q15_t)0xBCDA, (q15_t)0x9307, (q15_t)0xBD86, (q15_t)0x929E,
+    (q15_t)0xBE32, (q15_t)0x9236, (q15_t)0xBEDF, (q15_t)0x91CF, (q15_t)0xBF8C, (q15_t)0x9169, (q15_t)0xC03A, (q15_t)0x9105,
+    (q15_t)0xC0E9, (q15_t)0x90A1, (q15_t)0xC198, (q15_t)0x903E, (q15_t)0xC248, (q15_t)0x8FDD, (q15_t)0xC2F8, (q15_t)0x8F7D,
+    (q15_t)0xC3A9, (q15_t)0x8F1D, (q15_t)0xC45B, (q15_t)0x8EBF, (q15_t)0xC50D, (q15_t)0x8E62, (q15_t)0xC5C0, (q15_t)0x8E06,
+    (q15_t)0xC673, (q15_t)0x8DAB, (q15_t)0xC727, (q15_t)0x8D51, (q15_t)0xC7DB, (q15_t)0x8CF8, (q15_t)0xC890, (q15_t)0x8CA1,
+    (q15_t)0xC946, (q15_t)0x8C4A, (q15_t)0xC9FC, (q15_t)0x8BF5, (q15_t)0xCAB2, (q15_t)0x8BA0, (q15_t)0xCB69, (q15_t)0x8B4D,
+    (q15_t)0xCC21, (q15_t)0x8AFB, (q15_t)0xCCD9, (q15_t)0x8AAA, (q15_t)0xCD92, (q15_t)0x8A5A, (q15_t)0xCE4B, (q15_t)0x8A0C,
+    (q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xCFBE, (q15_t)0x8972, (q15_t)0xD079, (q15_t)0x8927, (q15_t)0xD134, (q15_t)0x88DD,
+    (q15_t)0xD1EF, (q15_t)0x8894, (q15_t)0xD2AB, (q15_t)0x884C, (q15_t)0xD367, (q15_t)0x8805, (q15_t)0xD424, (q15_t)0x87C0,
+    (q15_t)0xD4E1, (q15_t)0x877B, (q15_t)0xD59E, (q15_t)0x8738, (q15_t)0xD65C, (q15_t)0x86F6, (q15_t)0xD71B, (q15_t)0x86B6,
+    (q15_t)0xD7D9, (q15_t)0x8676, (q15_t)0xD898, (q15_t)0x8637, (q15_t)0xD958, (q15_t)0x85FA, (q15_t)0xDA18, (q15_t)0x85BE,
+    (q15_t)0xDAD8, (q15_t)0x8583, (q15_t)0xDB99, (q15_t)0x8549, (q15_t)0xDC59, (q15_t)0x8511, (q15_t)0xDD1B, (q15_t)0x84D9,
+    (q15_t)0xDDDC, (q15_t)0x84A3, (q15_t)0xDE9E, (q15_t)0x846E, (q15_t)0xDF61, (q15_t)0x843A, (q15_t)0xE023, (q15_t)0x8407,
+    (q15_t)0xE0E6, (q15_t)0x83D6, (q15_t)0xE1A9, (q15_t)0x83A6, (q15_t)0xE26D, (q15_t)0x8377, (q15_t)0xE330, (q15_t)0x8349,
+    (q15_t)0xE3F4, (q15_t)0x831C, (q15_t)0xE4B9, (q15_t)0x82F1, (q15_t)0xE57D, (q15_t)0x82C6, (q15_t)0xE642, (q15_t)0x829D,
+    (q15_t)0xE707, (q15_t)0x8276, (q15_t)0xE7CD, (q15_t)0x824F, (q15_t)0xE892, (q15_t)0x822A, (q15_t)0xE958, (q15_t)0x8205,
+    (q15_t)0xEA1E, (q15_t)0x81E2, (q15_t)0xEAE4, (q15_t)0x81C1, (q15_t)0xEBAB, (q15_t)0x81A0, (q15_t)0xEC71, (q15_t)0x8181,
+    (q15_t)0xED38, (q15_t)0x8163, (q15_t)0xEDFF, (q15_t)0x8146, (q15_t)0xEEC6, (q15_t)0x812A, (q15_t)0xEF8D, (q15_t)0x8110,
+    (q15_t)0xF055, (q15_t)0x80F6, (q15_t)0xF11C, (q15_t)0x80DE, (q15_t)0xF1E4, (q15_t)0x80C8, (q15_t)0xF2AC, (q15_t)0x80B2,
+    (q15_t)0xF374, (q15_t)0x809E, (q15_t)0xF43C, (q15_t)0x808B, (q15_t)0xF505, (q15_t)0x8079, (q15_t)0xF5CD, (q15_t)0x8068,
+    (q15_t)0xF695, (q15_t)0x8059, (q15_t)0xF75E, (q15_t)0x804B, (q15_t)0xF827, (q15_t)0x803E, (q15_t)0xF8EF, (q15_t)0x8032,
+    (q15_t)0xF9B8, (q15_t)0x8027, (q15_t)0xFA81, (q15_t)0x801E, (q15_t)0xFB4A, (q15_t)0x8016, (q15_t)0xFC13, (q15_t)0x800F,
+    (q15_t)0xFCDC, (q15_t)0x800A, (q15_t)0xFDA5, (q15_t)0x8006, (q15_t)0xFE6E, (q15_t)0x8002, (q15_t)0xFF37, (q15_t)0x8001
+};
+
+const q31_t twiddleCoefM23_q31[1536] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    0x7FFFFFFF, 0x00000000, 0x7FFF6216, 0x00C90F88, 0x7FFD885A, 0x01921D20, 0x7FFA72D1, 0x025B26D7,
+    0x7FF62182, 0x03242ABF, 0x7FF09478, 0x03ED26E6, 0x7FE9CBC0, 0x04B6195D, 0x7FE1C76B, 0x057F0035,
+    0x7FD8878E, 0x0647D97C, 0x7FCE0C3E, 0x0710A345, 0x7FC25596, 0x07D95B9E, 0x7FB563B3, 0x08A2009A,
+    0x7FA736B4, 0x096A9049, 0x7F97CEBD, 0x0A3308BD, 0x7F872BF3, 0x0AFB6805, 0x7F754E80, 0x0BC3AC35,
+    0x7F62368F, 0x0C8BD35E, 0x7F4DE451, 0x0D53DB92, 0x7F3857F6, 0x0E1BC2E4, 0x7F2191B4, 0x0EE38766,
+    0x7F0991C4, 0x0FAB272B, 0x7EF05860, 0x1072A048, 0x7ED5E5C6, 0x1139F0CF, 0x7EBA3A39, 0x120116D5,
+    0x7E9D55FC, 0x12C8106F, 0x7E7F3957, 0x138EDBB1, 0x7E5FE493, 0x145576B1, 0x7E3F57FF, 0x151BDF86,
+    0x7E1D93EA, 0x15E21445, 0x7DFA98A8, 0x16A81305, 0x7DD6668F, 0x176DD9DE, 0x7DB0FDF8, 0x183366E9,
+    0x7D8A5F40, 0x18F8B83C, 0x7D628AC6, 0x19BDCBF3, 0x7D3980EC, 0x1A82A026, 0x7D0F4218, 0x1B4732EF,
+    0x7CE3CEB2, 0x1C0B826A, 0x7CB72724, 0x1CCF8CB3, 0x7C894BDE, 0x1D934FE5, 0x7C5A3D50, 0x1E56CA1E,
+    0x7C29FBEE, 0x1F19F97B, 0x7BF88830, 0x1FDCDC1B, 0x7BC5E290, 0x209F701C, 0x7B920B89, 0x2161B3A0,
+    0x7B5D039E, 0x2223A4C5, 0x7B26CB4F, 0x22E541AF, 0x7AEF6323, 0x23A6887F, 0x7AB6CBA4, 0x24677758,
+    0x7A7D055B, 0x25280C5E, 0x7A4210D8, 0x25E845B6, 0x7A05EEAD, 0x26A82186, 0x79C89F6E, 0x27679DF4,
+    0x798A23B1, 0x2826B928, 0x794A7C12, 0x28E5714B, 0x7909A92D, 0x29A3C485, 0x78C7ABA2, 0x2A61B101,
+    0x78848414, 0x2B1F34EB, 0x78403329, 0x2BDC4E6F, 0x77FAB989, 0x2C98FBBA, 0x77B417DF, 0x2D553AFC,
+    0x776C4EDB, 0x2E110A62, 0x77235F2D, 0x2ECC681E, 0x76D94989, 0x2F875262, 0x768E0EA6, 0x3041C761,
+    0x7641AF3D, 0x30FBC54D, 0x75F42C0B, 0x31B54A5E, 0x75A585CF, 0x326E54C7, 0x7555BD4C, 0x3326E2C3,
+    0x7504D345, 0x33DEF287, 0x74B2C884, 0x34968250, 0x745F9DD1, 0x354D9057, 0x740B53FB, 0x36041AD9,
+    0x73B5EBD1, 0x36BA2014, 0x735F6626, 0x376F9E46, 0x7307C3D0, 0x382493B0, 0x72AF05A7, 0x38D8FE93,
+    0x72552C85, 0x398CDD32, 0x71FA3949, 0x3A402DD2, 0x719E2CD2, 0x3AF2EEB7, 0x71410805, 0x3BA51E29,
+    0x70E2CBC6, 0x3C56BA70, 0x708378FF, 0x3D07C1D6, 0x7023109A, 0x3DB832A6, 0x6FC19385, 0x3E680B2C,
+    0x6F5F02B2, 0x3F1749B8, 0x6EFB5F12, 0x3FC5EC98, 0x6E96A99D, 0x4073F21D, 0x6E30E34A, 0x4121589B,
+    0x6DCA0D14, 0x41CE1E65, 0x6D6227FA, 0x427A41D0, 0x6CF934FC, 0x4325C135, 0x6C8F351C, 0x43D09AED,
+    0x6C242960, 0x447ACD50, 0x6BB812D1, 0x452456BD, 0x6B4AF279, 0x45CD358F, 0x6ADCC964, 0x46756828,
+    0x6A6D98A4, 0x471CECE7, 0x69FD614A, 0x47C3C22F, 0x698C246C, 0x4869E665, 0x6919E320, 0x490F57EE,
+    0x68A69E81, 0x49B41533, 0x683257AB, 0x4A581C9E, 0x67BD0FBD, 0x4AFB6C98, 0x6746C7D8, 0x4B9E0390,
+    0x66CF8120, 0x4C3FDFF4, 0x66573CBB, 0x4CE10034, 0x65DDFBD3, 0x4D8162C4, 0x6563BF92, 0x4E210617,
+    0x64E88926, 0x4EBFE8A5, 0x646C59BF, 0x4F5E08E3, 0x63EF3290, 0x4FFB654D, 0x637114CC, 0x5097FC5E,
+    0x62F201AC, 0x5133CC94, 0x6271FA69, 0x51CED46E, 0x61F1003F, 0x5269126E, 0x616F146C, 0x53028518,
+    0x60EC3830, 0x539B2AF0, 0x60686CCF, 0x5433027D, 0x5FE3B38D, 0x54CA0A4B, 0x5F5E0DB3, 0x556040E2,
+    0x5ED77C8A, 0x55F5A4D2, 0x5E50015D, 0x568A34A9, 0x5DC79D7C, 0x571DEEFA, 0x5D3E5237, 0x57B0D256,
+    0x5CB420E0, 0x5842DD54, 0x5C290ACC, 0x58D40E8C, 0x5B9D1154, 0x59646498, 0x5B1035CF, 0x59F3DE12,
+    0x5A82799A, 0x5A82799A, 0x59F3DE12, 0x5B1035CF, 0x59646498, 0x5B9D1154, 0x58D40E8C, 0x5C290ACC,
+    0x5842DD54, 0x5CB420E0, 0x57B0D256, 0x5D3E5237, 0x571DEEFA, 0x5DC79D7C, 0x568A34A9, 0x5E50015D,
+    0x55F5A4D2, 0x5ED77C8A, 0x556040E2, 0x5F5E0DB3, 0x54CA0A4B, 0x5FE3B38D, 0x5433027D, 0x60686CCF,
+    0x539B2AF0, 0x60EC3830, 0x53028518, 0x616F146C, 0x5269126E, 0x61F1003F, 0x51CED46E, 0x6271FA69,
+    0x5133CC94, 0x62F201AC, 0x5097FC5E, 0x637114CC, 0x4FFB654D, 0x63EF3290, 0x4F5E08E3, 0x646C59BF,
+    0x4EBFE8A5, 0x64E88926, 0x4E210617, 0x6563BF92, 0x4D8162C4, 0x65DDFBD3, 0x4CE10034, 0x66573CBB,
+    0x4C3FDFF4, 0x66CF8120, 0x4B9E0390, 0x6746C7D8, 0x4AFB6C98, 0x67BD0FBD, 0x4A581C9E, 0x683257AB,
+    0x49B41533, 0x68A69E81, 0x490F57EE, 0x6919E320, 0x4869E665, 0x698C246C, 0x47C3C22F, 0x69FD614A,
+    0x471CECE7, 0x6A6D98A4, 0x46756828, 0x6ADCC964, 0x45CD358F, 0x6B4AF279, 0x452456BD, 0x6BB812D1,
+    0x447ACD50, 0x6C242960, 0x43D09AED, 0x6C8F351C, 0x4325C135, 0x6CF934FC, 0x427A41D0, 0x6D6227FA,
+    0x41CE1E65, 0x6DCA0D14, 0x4121589B, 0x6E30E34A, 0x4073F21D, 0x6E96A99D, 0x3FC5EC98, 0x6EFB5F12,
+    0x3F1749B8, 0x6F5F02B2, 0x3E680B2C, 0x6FC19385, 0x3DB832A6, 0x7023109A, 0x3D07C1D6, 0x708378FF,
+    0x3C56BA70, 0x70E2CBC6, 0x3BA51E29, 0x71410805, 0x3AF2EEB7, 0x719E2CD2, 0x3A402DD2, 0x71FA3949,
+    0x398CDD32, 0x72552C85, 0x38D8FE93, 0x72AF05A7, 0x382493B0, 0x7307C3D0, 0x376F9E46, 0x735F6626,
+    0x36BA2014, 0x73B5EBD1, 0x36041AD9, 0x740B53FB, 0x354D9057, 0x745F9DD1, 0x34968250, 0x74B2C884,
+    0x33DEF287, 0x7504D345, 0x3326E2C3, 0x7555BD4C, 0x326E54C7, 0x75A585CF, 0x31B54A5E, 0x75F42C0B,
+    0x30FBC54D, 0x7641AF3D, 0x3041C761, 0x768E0EA6, 0x2F875262, 0x76D94989, 0x2ECC681E, 0x77235F2D,
+    0x2E110A62, 0x776C4EDB, 0x2D553AFC, 0x77B417DF, 0x2C98FBBA, 0x77FAB989, 0x2BDC4E6F, 0x78403329,
+    0x2B1F34EB, 0x78848414, 0x2A61B101, 0x78C7ABA2, 0x29A3C485, 0x7909A92D, 0x28E5714B, 0x794A7C12,
+    0x2826B928, 0x798A23B1, 0x27679DF4, 0x79C89F6E, 0x26A82186, 0x7A05EEAD, 0x25E845B6, 0x7A4210D8,
+    0x25280C5E, 0x7A7D055B, 0x24677758, 0x7AB6CBA4, 0x23A6887F, 0x7AEF6323, 0x22E541AF, 0x7B26CB4F,
+    0x2223A4C5, 0x7B5D039E, 0x2161B3A0, 0x7B920B89, 0x209F701C, 0x7BC5E290, 0x1FDCDC1B, 0x7BF88830,
+    0x1F19F97B, 0x7C29FBEE, 0x1E56CA1E, 0x7C5A3D50, 0x1D934FE5, 0x7C894BDE, 0x1CCF8CB3, 0x7CB72724,
+    0x1C0B826A, 0x7CE3CEB2, 0x1B4732EF, 0x7D0F4218, 0x1A82A026, 0x7D3980EC, 0x19BDCBF3, 0x7D628AC6,
+    0x18F8B83C, 0x7D8A5F40, 0x183366E9, 0x7DB0FDF8, 0x176DD9DE, 0x7DD6668F, 0x16A81305, 0x7DFA98A8,
+    0x15E21445, 0x7E1D93EA, 0x151BDF86, 0x7E3F57FF, 0x145576B1, 0x7E5FE493, 0x138EDBB1, 0x7E7F3957,
+    0x12C8106F, 0x7E9D55FC, 0x120116D5, 0x7EBA3A39, 0x1139F0CF, 0x7ED5E5C6, 0x1072A048, 0x7EF05860,
+    0x0FAB272B, 0x7F0991C4, 0x0EE38766, 0x7F2191B4, 0x0E1BC2E4, 0x7F3857F6, 0x0D53DB92, 0x7F4DE451,
+    0x0C8BD35E, 0x7F62368F, 0x0BC3AC35, 0x7F754E80, 0x0AFB6805, 0x7F872BF3, 0x0A3308BD, 0x7F97CEBD,
+    0x096A9049, 0x7FA736B4, 0x08A2009A, 0x7FB563B3, 0x07D95B9E, 0x7FC25596, 0x0710A345, 0x7FCE0C3E,
+    0x0647D97C, 0x7FD8878E, 0x057F0035, 0x7FE1C76B, 0x04B6195D, 0x7FE9CBC0, 0x03ED26E6, 0x7FF09478,
+    0x03242ABF, 0x7FF62182, 0x025B26D7, 0x7FFA72D1, 0x01921D20, 0x7FFD885A, 0x00C90F88, 0x7FFF6216,
+    0x00000000, 0x7FFFFFFF, 0xFF36F078, 0x7FFF6216, 0xFE6DE2E0, 0x7FFD885A, 0xFDA4D929, 0x7FFA72D1,
+    0xFCDBD541, 0x7FF62182, 0xFC12D91A, 0x7FF09478, 0xFB49E6A3, 0x7FE9CBC0, 0xFA80FFCB, 0x7FE1C76B,
+    0xF9B82684, 0x7FD8878E, 0xF8EF5CBB, 0x7FCE0C3E, 0xF826A462, 0x7FC25596, 0xF75DFF66, 0x7FB563B3,
+    0xF6956FB7, 0x7FA736B4, 0xF5CCF743, 0x7F97CEBD, 0xF50497FB, 0x7F872BF3, 0xF43C53CB, 0x7F754E80,
+    0xF3742CA2, 0x7F62368F, 0xF2AC246E, 0x7F4DE451, 0xF1E43D1C, 0x7F3857F6, 0xF11C789A, 0x7F2191B4,
+    0xF054D8D5, 0x7F0991C4, 0xEF8D5FB8, 0x7EF05860, 0xEEC60F31, 0x7ED5E5C6, 0xEDFEE92B, 0x7EBA3A39,
+    0xED37EF91, 0x7E9D55FC, 0xEC71244F, 0x7E7F3957, 0xEBAA894F, 0x7E5FE493, 0xEAE4207A, 0x7E3F57FF,
+    0xEA1DEBBB, 0x7E1D93EA, 0xE957ECFB, 0x7DFA98A8, 0xE8922622, 0x7DD6668F, 0xE7CC9917, 0x7DB0FDF8,
+    0xE70747C4, 0x7D8A5F40, 0xE642340D, 0x7D628AC6, 0xE57D5FDA, 0x7D3980EC, 0xE4B8CD11, 0x7D0F4218,
+    0xE3F47D96, 0x7CE3CEB2, 0xE330734D, 0x7CB72724, 0xE26CB01B, 0x7C894BDE, 0xE1A935E2, 0x7C5A3D50,
+    0xE0E60685, 0x7C29FBEE, 0xE02323E5, 0x7BF88830, 0xDF608FE4, 0x7BC5E290, 0xDE9E4C60, 0x7B920B89,
+    0xDDDC5B3B, 0x7B5D039E, 0xDD1ABE51, 0x7B26CB4F, 0xDC597781, 0x7AEF6323, 0xDB9888A8, 0x7AB6CBA4,
+    0xDAD7F3A2, 0x7A7D055B, 0xDA17BA4A, 0x7A4210D8, 0xD957DE7A, 0x7A05EEAD, 0xD898620C, 0x79C89F6E,
+    0xD7D946D8, 0x798A23B1, 0xD71A8EB5, 0x794A7C12, 0xD65C3B7B, 0x7909A92D, 0xD59E4EFF, 0x78C7ABA2,
+    0xD4E0CB15, 0x78848414, 0xD423B191, 0x78403329, 0xD3670446, 0x77FAB989, 0xD2AAC504, 0x77B417DF,
+    0xD1EEF59E, 0x776C4EDB, 0xD13397E2, 0x77235F2D, 0xD078AD9E, 0x76D94989, 0xCFBE389F, 0x768E0EA6,
+    0xCF043AB3, 0x7641AF3D, 0xCE4AB5A2, 0x75F42C0B, 0xCD91AB39, 0x75A585CF, 0xCCD91D3D, 0x7555BD4C,
+    0xCC210D79, 0x7504D345, 0xCB697DB0, 0x74B2C884, 0xCAB26FA9, 0x745F9DD1, 0xC9FBE527, 0x740B53FB,
+    0xC945DFEC, 0x73B5EBD1, 0xC89061BA, 0x735F6626, 0xC7DB6C50, 0x7307C3D0, 0xC727016D, 0x72AF05A7,
+    0xC67322CE, 0x72552C85, 0xC5BFD22E, 0x71FA3949, 0xC50D1149, 0x719E2CD2, 0xC45AE1D7, 0x71410805,
+    0xC3A94590, 0x70E2CBC6, 0xC2F83E2A, 0x708378FF, 0xC247CD5A, 0x7023109A, 0xC197F4D4, 0x6FC19385,
+    0xC0E8B648, 0x6F5F02B2, 0xC03A1368, 0x6EFB5F12, 0xBF8C0DE3, 0x6E96A99D, 0xBEDEA765, 0x6E30E34A,
+    0xBE31E19B, 0x6DCA0D14, 0xBD85BE30, 0x6D6227FA, 0xBCDA3ECB, 0x6CF934FC, 0xBC2F6513, 0x6C8F351C,
+    0xBB8532B0, 0x6C242960, 0xBADBA943, 0x6BB812D1, 0xBA32CA71, 0x6B4AF279, 0xB98A97D8, 0x6ADCC964,
+    0xB8E31319, 0x6A6D98A4, 0xB83C3DD1, 0x69FD614A, 0xB796199B, 0x698C246C, 0xB6F0A812, 0x6919E320,
+    0xB64BEACD, 0x68A69E81, 0xB5A7E362, 0x683257AB, 0xB5049368, 0x67BD0FBD, 0xB461FC70, 0x6746C7D8,
+    0xB3C0200C, 0x66CF8120, 0xB31EFFCC, 0x66573CBB, 0xB27E9D3C, 0x65DDFBD3, 0xB1DEF9E9, 0x6563BF92,
+    0xB140175B, 0x64E88926, 0xB0A1F71D, 0x646C59BF, 0xB0049AB3, 0x63EF3290, 0xAF6803A2, 0x637114CC,
+    0xAECC336C, 0x62F201AC, 0xAE312B92, 0x6271FA69, 0xAD96ED92, 0x61F1003F, 0xACFD7AE8, 0x616F146C,
+    0xAC64D510, 0x60EC3830, 0xABCCFD83, 0x60686CCF, 0xAB35F5B5, 0x5FE3B38D, 0xAA9FBF1E, 0x5F5E0DB3,
+    0xAA0A5B2E, 0x5ED77C8A, 0xA975CB57, 0x5E50015D, 0xA8E21106, 0x5DC79D7C, 0xA84F2DAA, 0x5D3E5237,
+    0xA7BD22AC, 0x5CB420E0, 0xA72BF174, 0x5C290ACC, 0xA69B9B68, 0x5B9D1154, 0xA60C21EE, 0x5B1035CF,
+    0xA57D8666, 0x5A82799A, 0xA4EFCA31, 0x59F3DE12, 0xA462EEAC, 0x59646498, 0xA3D6F534, 0x58D40E8C,
+    0xA34BDF20, 0x5842DD54, 0xA2C1ADC9, 0x57B0D256, 0xA2386284, 0x571DEEFA, 0xA1AFFEA3, 0x568A34A9,
+    0xA1288376, 0x55F5A4D2, 0xA0A1F24D, 0x556040E2, 0xA01C4C73, 0x54CA0A4B, 0x9F979331, 0x5433027D,
+    0x9F13C7D0, 0x539B2AF0, 0x9E90EB94, 0x53028518, 0x9E0EFFC1, 0x5269126E, 0x9D8E0597, 0x51CED46E,
+    0x9D0DFE54, 0x5133CC94, 0x9C8EEB34, 0x5097FC5E, 0x9C10CD70, 0x4FFB654D, 0x9B93A641, 0x4F5E08E3,
+    0x9B1776DA, 0x4EBFE8A5, 0x9A9C406E, 0x4E210617, 0x9A22042D, 0x4D8162C4, 0x99A8C345, 0x4CE10034,
+    0x99307EE0, 0x4C3FDFF4, 0x98B93828, 0x4B9E0390, 0x9842F043, 0x4AFB6C98, 0x97CDA855, 0x4A581C9E,
+    0x9759617F, 0x49B41533, 0x96E61CE0, 0x490F57EE, 0x9673DB94, 0x4869E665, 0x96029EB6, 0x47C3C22F,
+    0x9592675C, 0x471CECE7, 0x9523369C, 0x46756828, 0x94B50D87, 0x45CD358F, 0x9447ED2F, 0x452456BD,
+    0x93DBD6A0, 0x447ACD50, 0x9370CAE4, 0x43D09AED, 0x9306CB04, 0x4325C135, 0x929DD806, 0x427A41D0,
+    0x9235F2EC, 0x41CE1E65, 0x91CF1CB6, 0x4121589B, 0x91695663, 0x4073F21D, 0x9104A0EE, 0x3FC5EC98,
+    0x90A0FD4E, 0x3F1749B8, 0x903E6C7B, 0x3E680B2C, 0x8FDCEF66, 0x3DB832A6, 0x8F7C8701, 0x3D07C1D6,
+    0x8F1D343A, 0x3C56BA70, 0x8EBEF7FB, 0x3BA51E29, 0x8E61D32E, 0x3AF2EEB7, 0x8E05C6B7, 0x3A402DD2,
+    0x8DAAD37B, 0x398CDD32, 0x8D50FA59, 0x38D8FE93, 0x8CF83C30, 0x382493B0, 0x8CA099DA, 0x376F9E46,
+    0x8C4A142F, 0x36BA2014, 0x8BF4AC05, 0x36041AD9, 0x8BA0622F, 0x354D9057, 0x8B4D377C, 0x34968250,
+    0x8AFB2CBB, 0x33DEF287, 0x8AAA42B4, 0x3326E2C3, 0x8A5A7A31, 0x326E54C7, 0x8A0BD3F5, 0x31B54A5E,
+    0x89BE50C3, 0x30FBC54D, 0x8971F15A, 0x3041C761, 0x8926B677, 0x2F875262, 0x88DCA0D3, 0x2ECC681E,
+    0x8893B125, 0x2E110A62, 0x884BE821, 0x2D553AFC, 0x88054677, 0x2C98FBBA, 0x87BFCCD7, 0x2BDC4E6F,
+    0x877B7BEC, 0x2B1F34EB, 0x8738545E, 0x2A61B101, 0x86F656D3, 0x29A3C485, 0x86B583EE, 0x28E5714B,
+    0x8675DC4F, 0x2826B928, 0x86376092, 0x27679DF4, 0x85FA1153, 0x26A82186, 0x85BDEF28, 0x25E845B6,
+    0x8582FAA5, 0x25280C5E, 0x8549345C, 0x24677758, 0x85109CDD, 0x23A6887F, 0x84D934B1, 0x22E541AF,
+    0x84A2FC62, 0x2223A4C5, 0x846DF477, 0x2161B3A0, 0x843A1D70, 0x209F701C, 0x840777D0, 0x1FDCDC1B,
+    0x83D60412, 0x1F19F97B, 0x83A5C2B0, 0x1E56CA1E, 0x8376B422, 0x1D934FE5, 0x8348D8DC, 0x1CCF8CB3,
+    0x831C314E, 0x1C0B826A, 0x82F0BDE8, 0x1B4732EF, 0x82C67F14, 0x1A82A026, 0x829D753A, 0x19BDCBF3,
+    0x8275A0C0, 0x18F8B83C, 0x824F0208, 0x183366E9, 0x82299971, 0x176DD9DE, 0x82056758, 0x16A81305,
+    0x81E26C16, 0x15E21445, 0x81C0A801, 0x151BDF86, 0x81A01B6D, 0x145576B1, 0x8180C6A9, 0x138EDBB1,
+    0x8162AA04, 0x12C8106F, 0x8145C5C7, 0x120116D5, 0x812A1A3A, 0x1139F0CF, 0x810FA7A0, 0x1072A048,
+    0x80F66E3C, 0x0FAB272B, 0x80DE6E4C, 0x0EE38766, 0x80C7A80A, 0x0E1BC2E4, 0x80B21BAF, 0x0D53DB92,
+    0x809DC971, 0x0C8BD35E, 0x808AB180, 0x0BC3AC35, 0x8078D40D, 0x0AFB6805, 0x80683143, 0x0A3308BD,
+    0x8058C94C, 0x096A9049, 0x804A9C4D, 0x08A2009A, 0x803DAA6A, 0x07D95B9E, 0x8031F3C2, 0x0710A345,
+    0x80277872, 0x0647D97C, 0x801E3895, 0x057F0035, 0x80163440, 0x04B6195D, 0x800F6B88, 0x03ED26E6,
+    0x8009DE7E, 0x03242ABF, 0x80058D2F, 0x025B26D7, 0x800277A6, 0x01921D20, 0x80009DEA, 0x00C90F88,
+    0x80000000, 0x00000000, 0x80009DEA, 0xFF36F078, 0x800277A6, 0xFE6DE2E0, 0x80058D2F, 0xFDA4D929,
+    0x8009DE7E, 0xFCDBD541, 0x800F6B88, 0xFC12D91A, 0x80163440, 0xFB49E6A3, 0x801E3895, 0xFA80FFCB,
+    0x80277872, 0xF9B82684, 0x8031F3C2, 0xF8EF5CBB, 0x803DAA6A, 0xF826A462, 0x804A9C4D, 0xF75DFF66,
+    0x8058C94C, 0xF6956FB7, 0x80683143, 0xF5CCF743, 0x8078D40D, 0xF50497FB, 0x808AB180, 0xF43C53CB,
+    0x809DC971, 0xF3742CA2, 0x80B21BAF, 0xF2AC246E, 0x80C7A80A, 0xF1E43D1C, 0x80DE6E4C, 0xF11C789A,
+    0x80F66E3C, 0xF054D8D5, 0x810FA7A0, 0xEF8D5FB8, 0x812A1A3A, 0xEEC60F31, 0x8145C5C7, 0xEDFEE92B,
+    0x8162AA04, 0xED37EF91, 0x8180C6A9, 0xEC71244F, 0x81A01B6D, 0xEBAA894F, 0x81C0A801, 0xEAE4207A,
+    0x81E26C16, 0xEA1DEBBB, 0x82056758, 0xE957ECFB, 0x82299971, 0xE8922622, 0x824F0208, 0xE7CC9917,
+    0x8275A0C0, 0xE70747C4, 0x829D753A, 0xE642340D, 0x82C67F14, 0xE57D5FDA, 0x82F0BDE8, 0xE4B8CD11,
+    0x831C314E, 0xE3F47D96, 0x8348D8DC, 0xE330734D, 0x8376B422, 0xE26CB01B, 0x83A5C2B0, 0xE1A935E2,
+    0x83D60412, 0xE0E60685, 0x840777D0, 0xE02323E5, 0x843A1D70, 0xDF608FE4, 0x846DF477, 0xDE9E4C60,
+    0x84A2FC62, 0xDDDC5B3B, 0x84D934B1, 0xDD1ABE51, 0x85109CDD, 0xDC597781, 0x8549345C, 0xDB9888A8,
+    0x8582FAA5, 0xDAD7F3A2, 0x85BDEF28, 0xDA17BA4A, 0x85FA1153, 0xD957DE7A, 0x86376092, 0xD898620C,
+    0x8675DC4F, 0xD7D946D8, 0x86B583EE, 0xD71A8EB5, 0x86F656D3, 0xD65C3B7B, 0x8738545E, 0xD59E4EFF,
+    0x877B7BEC, 0xD4E0CB15, 0x87BFCCD7, 0xD423B191, 0x88054677, 0xD3670446, 0x884BE821, 0xD2AAC504,
+    0x8893B125, 0xD1EEF59E, 0x88DCA0D3, 0xD13397E2, 0x8926B677, 0xD078AD9E, 0x8971F15A, 0xCFBE389F,
+    0x89BE50C3, 0xCF043AB3, 0x8A0BD3F5, 0xCE4AB5A2, 0x8A5A7A31, 0xCD91AB39, 0x8AAA42B4, 0xCCD91D3D,
+    0x8AFB2CBB, 0xCC210D79, 0x8B4D377C, 0xCB697DB0, 0x8BA0622F, 0xCAB26FA9, 0x8BF4AC05, 0xC9FBE527,
+    0x8C4A142F, 0xC945DFEC, 0x8CA099DA, 0xC89061BA, 0x8CF83C30, 0xC7DB6C50, 0x8D50FA59, 0xC727016D,
+    0x8DAAD37B, 0xC67322CE, 0x8E05C6B7, 0xC5BFD22E, 0x8E61D32E, 0xC50D1149, 0x8EBEF7FB, 0xC45AE1D7,
+    0x8F1D343A, 0xC3A94590, 0x8F7C8701, 0xC2F83E2A, 0x8FDCEF66, 0xC247CD5A, 0x903E6C7B, 0xC197F4D4,
+    0x90A0FD4E, 0xC0E8B648, 0x9104A0EE, 0xC03A1368, 0x91695663, 0xBF8C0DE3, 0x91CF1CB6, 0xBEDEA765,
+    0x9235F2EC, 0xBE31E19B, 0x929DD806, 0xBD85BE30, 0x9306CB04, 0xBCDA3ECB, 0x9370CAE4, 0xBC2F6513,
+    0x93DBD6A0, 0xBB8532B0, 0x9447ED2F, 0xBADBA943, 0x94B50D87, 0xBA32CA71, 0x9523369C, 0xB98A97D8,
+    0x9592675C, 0xB8E31319, 0x96029EB6, 0xB83C3DD1, 0x9673DB94, 0xB796199B, 0x96E61CE0, 0xB6F0A812,
+    0x9759617F, 0xB64BEACD, 0x97CDA855, 0xB5A7E362, 0x9842F043, 0xB5049368, 0x98B93828, 0xB461FC70,
+    0x99307EE0, 0xB3C0200C, 0x99A8C345, 0xB31EFFCC, 0x9A22042D, 0xB27E9D3C, 0x9A9C406E, 0xB1DEF9E9,
+    0x9B1776DA, 0xB140175B, 0x9B93A641, 0xB0A1F71D, 0x9C10CD70, 0xB0049AB3, 0x9C8EEB34, 0xAF6803A2,
+    0x9D0DFE54, 0xAECC336C, 0x9D8E0597, 0xAE312B92, 0x9E0EFFC1, 0xAD96ED92, 0x9E90EB94, 0xACFD7AE8,
+    0x9F13C7D0, 0xAC64D510, 0x9F979331, 0xABCCFD83, 0xA01C4C73, 0xAB35F5B5, 0xA0A1F24D, 0xAA9FBF1E,
+    0xA1288376, 0xAA0A5B2E, 0xA1AFFEA3, 0xA975CB57, 0xA2386284, 0xA8E21106, 0xA2C1ADC9, 0xA84F2DAA,
+    0xA34BDF20, 0xA7BD22AC, 0xA3D6F534, 0xA72BF174, 0xA462EEAC, 0xA69B9B68, 0xA4EFCA31, 0xA60C21EE,
+    0xA57D8666, 0xA57D8666, 0xA60C21EE, 0xA4EFCA31, 0xA69B9B68, 0xA462EEAC, 0xA72BF174, 0xA3D6F534,
+    0xA7BD22AC, 0xA34BDF20, 0xA84F2DAA, 0xA2C1ADC9, 0xA8E21106, 0xA2386284, 0xA975CB57, 0xA1AFFEA3,
+    0xAA0A5B2E, 0xA1288376, 0xAA9FBF1E, 0xA0A1F24D, 0xAB35F5B5, 0xA01C4C73, 0xABCCFD83, 0x9F979331,
+    0xAC64D510, 0x9F13C7D0, 0xACFD7AE8, 0x9E90EB94, 0xAD96ED92, 0x9E0EFFC1, 0xAE312B92, 0x9D8E0597,
+    0xAECC336C, 0x9D0DFE54, 0xAF6803A2, 0x9C8EEB34, 0xB0049AB3, 0x9C10CD70, 0xB0A1F71D, 0x9B93A641,
+    0xB140175B, 0x9B1776DA, 0xB1DEF9E9, 0x9A9C406E, 0xB27E9D3C, 0x9A22042D, 0xB31EFFCC, 0x99A8C345,
+    0xB3C0200C, 0x99307EE0, 0xB461FC70, 0x98B93828, 0xB5049368, 0x9842F043, 0xB5A7E362, 0x97CDA855,
+    0xB64BEACD, 0x9759617F, 0xB6F0A812, 0x96E61CE0, 0xB796199B, 0x9673DB94, 0xB83C3DD1, 0x96029EB6,
+    0xB8E31319, 0x9592675C, 0xB98A97D8, 0x9523369C, 0xBA32CA71, 0x94B50D87, 0xBADBA943, 0x9447ED2F,
+    0xBB8532B0, 0x93DBD6A0, 0xBC2F6513, 0x9370CAE4, 0xBCDA3ECB, 0x9306CB04, 0xBD85BE30, 0x929DD806,
+    0xBE31E19B, 0x9235F2EC, 0xBEDEA765, 0x91CF1CB6, 0xBF8C0DE3, 0x91695663, 0xC03A1368, 0x9104A0EE,
+    0xC0E8B648, 0x90A0FD4E, 0xC197F4D4, 0x903E6C7B, 0xC247CD5A, 0x8FDCEF66, 0xC2F83E2A, 0x8F7C8701,
+    0xC3A94590, 0x8F1D343A, 0xC45AE1D7, 0x8EBEF7FB, 0xC50D1149, 0x8E61D32E, 0xC5BFD22E, 0x8E05C6B7,
+    0xC67322CE, 0x8DAAD37B, 0xC727016D, 0x8D50FA59, 0xC7DB6C50, 0x8CF83C30, 0xC89061BA, 0x8CA099DA,
+    0xC945DFEC, 0x8C4A142F, 0xC9FBE527, 0x8BF4AC05, 0xCAB26FA9, 0x8BA0622F, 0xCB697DB0, 0x8B4D377C,
+    0xCC210D79, 0x8AFB2CBB, 0xCCD91D3D, 0x8AAA42B4, 0xCD91AB39, 0x8A5A7A31, 0xCE4AB5A2, 0x8A0BD3F5,
+    0xCF043AB3, 0x89BE50C3, 0xCFBE389F, 0x8971F15A, 0xD078AD9E, 0x8926B677, 0xD13397E2, 0x88DCA0D3,
+    0xD1EEF59E, 0x8893B125, 0xD2AAC504, 0x884BE821, 0xD3670446, 0x88054677, 0xD423B191, 0x87BFCCD7,
+    0xD4E0CB15, 0x877B7BEC, 0xD59E4EFF, 0x8738545E, 0xD65C3B7B, 0x86F656D3, 0xD71A8EB5, 0x86B583EE,
+    0xD7D946D8, 0x8675DC4F, 0xD898620C, 0x86376092, 0xD957DE7A, 0x85FA1153, 0xDA17BA4A, 0x85BDEF28,
+    0xDAD7F3A2, 0x8582FAA5, 0xDB9888A8, 0x8549345C, 0xDC597781, 0x85109CDD, 0xDD1ABE51, 0x84D934B1,
+    0xDDDC5B3B, 0x84A2FC62, 0xDE9E4C60, 0x846DF477, 0xDF608FE4, 0x843A1D70, 0xE02323E5, 0x840777D0,
+    0xE0E60685, 0x83D60412, 0xE1A935E2, 0x83A5C2B0, 0xE26CB01B, 0x8376B422, 0xE330734D, 0x8348D8DC,
+    0xE3F47D96, 0x831C314E, 0xE4B8CD11, 0x82F0BDE8, 0xE57D5FDA, 0x82C67F14, 0xE642340D, 0x829D753A,
+    0xE70747C4, 0x8275A0C0, 0xE7CC9917, 0x824F0208, 0xE8922622, 0x82299971, 0xE957ECFB, 0x82056758,
+    0xEA1DEBBB, 0x81E26C16, 0xEAE4207A, 0x81C0A801, 0xEBAA894F, 0x81A01B6D, 0xEC71244F, 0x8180C6A9,
+    0xED37EF91, 0x8162AA04, 0xEDFEE92B, 0x8145C5C7, 0xEEC60F31, 0x812A1A3A, 0xEF8D5FB8, 0x810FA7A0,
+    0xF054D8D5, 0x80F66E3C, 0xF11C789A, 0x80DE6E4C, 0xF1E43D1C, 0x80C7A80A, 0xF2AC246E, 0x80B21BAF,
+    0xF3742CA2, 0x809DC971, 0xF43C53CB, 0x808AB180, 0xF50497FB, 0x8078D40D, 0xF5CCF743, 0x80683143,
+    0xF6956FB7, 0x8058C94C, 0xF75DFF66, 0x804A9C4D, 0xF826A462, 0x803DAA6A, 0xF8EF5CBB, 0x8031F3C2,
+    0xF9B82684, 0x80277872, 0xFA80FFCB, 0x801E3895, 0xFB49E6A3, 0x80163440, 0xFC12D91A, 0x800F6B88,
+    0xFCDBD541, 0x8009DE7E, 0xFDA4D929, 0x80058D2F, 0xFE6DE2E0, 0x800277A6, 0xFF36F078, 0x80009DEA
+};
+
+/* Bit reversal as pairs of complex indexes to swap */
+const uint16_t armBitRevPairsM23_16[ARMBITREVPAIRSM23_16_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,    8,    2,    4,    3,   12,    5,   10,    7,   14,   11,   13
+};
+
+const uint16_t armBitRevPairsM23_32[ARMBITREVPAIRSM23_32_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,   16,    2,    8,    3,   24,    5,   20,    6,   12,    7,   28,    9,   18,   11,   26,
+      13,   22,   15,   30,   19,   25,   23,   29
+};
+
+const uint16_t armBitRevPairsM23_64[ARMBITREVPAIRSM23_64_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,   32,    2,   16,    3,   48,    4,    8,    5,   40,    6,   24,    7,   56,    9,   36,
+      10,   20,   11,   52,   13,   44,   14,   28,   15,   60,   17,   34,   19,   50,   21,   42,
+      22,   26,   23,   58,   25,   38,   27,   54,   29,   46,   31,   62,   35,   49,   37,   41,
+      39,   57,   43,   53,   47,   61,   55,   59
+};
+
+const uint16_t armBitRevPairsM23_128[ARMBITREVPAIRSM23_128_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,   64,    2,   32,    3,   96,    4,   16,    5,   80,    6,   48,    7,  112,    9,   72,
+      10,   40,   11,  104,   12,   24,   13,   88,   14,   56,   15,  120,   17,   68,   18,   36,
+      19,  100,   21,   84,   22,   52,   23,  116,   25,   76,   26,   44,   27,  108,   29,   92,
+      30,   60,   31,  124,   33,   66,   35,   98,   37,   82,   38,   50,   39,  114,   41,   74,
+      43,  106,   45,   90,   46,   58,   47,  122,   49,   70,   51,  102,   53,   86,   55,  118,
+      57,   78,   59,  110,   61,   94,   63,  126,   67,   97,   69,   81,   71,  113,   75,  105,
+      77,   89,   79,  121,   83,  101,   87,  117,   91,  109,   95,  125,  103,  115,  111,  123
+};
+
+const uint16_t armBitRevPairsM23_256[ARMBITREVPAIRSM23_256_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,  128,    2,   64,    3,  192,    4,   32,    5,  160,    6,   96,    7,  224,    8,   16,
+       9,  144,   10,   80,   11,  208,   12,   48,   13,  176,   14,  112,   15,  240,   17,  136,
+      18,   72,   19,  200,   20,   40,   21,  168,   22,  104,   23,  232,   25,  152,   26,   88,
+      27,  216,   28,   56,   29,  184,   30,  120,   31,  248,   33,  132,   34,   68,   35,  196,
+      37,  164,   38,  100,   39,  228,   41,  148,   42,   84,   43,  212,   44,   52,   45,  180,
+      46,  116,   47,  244,   49,  140,   50,   76,   51,  204,   53,  172,   54,  108,   55,  236,
+      57,  156,   58,   92,   59,  220,   61,  188,   62,  124,   63,  252,   65,  130,   67,  194,
+      69,  162,   70,   98,   71,  226,   73,  146,   74,   82,   75,  210,   77,  178,   78,  114,
+      79,  242,   81,  138,   83,  202,   85,  170,   86,  106,   87,  234,   89,  154,   91,  218,
+      93,  186,   94,  122,   95,  250,   97,  134,   99,  198,  101,  166,  103,  230,  105,  150,
+     107,  214,  109,  182,  110,  118,  111,  246,  113,  142,  115,  206,  117,  174,  119,  238,
+     121,  158,  123,  222,  125,  190,  127,  254,  131,  193,  133,  161,  135,  225,  137,  145,
+     139,  209,  141,  177,  143,  241,  147,  201,  149,  169,  151,  233,  155,  217,  157,  185,
+     159,  249,  163,  197,  167,  229,  171,  213,  173,  181,  175,  245,  179,  205,  183,  237,
+     187,  221,  191,  253,  199,  227,  203,  211,  207,  243,  215,  235,  223,  251,  239,  247
+};
+
+const uint16_t armBitRevPairsM23_512[ARMBITREVPAIRSM23_512_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,  256,    2,  128,    3,  384,    4,   64,    5,  320,    6,  192,    7,  448,    8,   32,
+       9,  288,   10,  160,   11,  416,   12,   96,   13,  352,   14,  224,   15,  480,   17,  272,
+      18,  144,   19,  400,   20,   80,   21,  336,   22,  208,   23,  464,   24,   48,   25,  304,
+      26,  176,   27,  432,   28,  112,   29,  368,   30,  240,   31,  496,   33,  264,   34,  136,
+      35,  392,   36,   72,   37,  328,   38,  200,   39,  456,   41,  296,   42,  168,   43,  424,
+      44,  104,   45,  360,   46,  232,   47,  488,   49,  280,   50,  152,   51,  408,   52,   88,
+      53,  344,   54,  216,   55,  472,   57,  312,   58,  184,   59,  440,   60,  120,   61,  376,
+      62,  248,   63,  504,   65,  260,   66,  132,   67,  388,   69,  324,   70,  196,   71,  452,
+      73,  292,   74,  164,   75,  420,   76,  100,   77,  356,   78,  228,   79,  484,   81,  276,
+      82,  148,   83,  404,   85,  340,   86,  212,   87,  468,   89,  308,   90,  180,   91,  436,
+      92,  116,   93,  372,   94,  244,   95,  500,   97,  268,   98,  140,   99,  396,  101,  332,
+     102,  204,  103,  460,  105,  300,  106,  172,  107,  428,  109,  364,  110,  236,  111,  492,
+     113,  284,  114,  156,  115,  412,  117,  348,  118,  220,  119,  476,  121,  316,  122,  188,
+     123,  444,  125,  380,  126,  252,  127,  508,  129,  258,  131,  386,  133,  322,  134,  194,
+     135,  450,  137,  290,  138,  162,  139,  418,  141,  354,  142,  226,  143,  482,  145,  274,
+     147,  402,  149,  338,  150,  210,  151,  466,  153,  306,  154,  178,  155,  434,  157,  370,
+     158,  242,  159,  498,  161,  266,  163,  394,  165,  330,  166,  202,  167,  458,  169,  298,
+     171,  426,  173,  362,  174,  234,  175,  490,  177,  282,  179,  410,  181,  346,  182,  218,
+     183,  474,  185,  314,  187,  442,  189,  378,  190,  250,  191,  506,  193,  262,  195,  390,
+     197,  326,  199,  454,  201,  294,  203,  422,  205,  358,  206,  230,  207,  486,  209,  278,
+     211,  406,  213,  342,  215,  470,  217,  310,  219,  438,  221,  374,  222,  246,  223,  502,
+     225,  270,  227,  398,  229,  334,  231,  462,  233,  302,  235,  430,  237,  366,  239,  494,
+     241,  286,  243,  414,  245,  350,  247,  478,  249,  318,  251,  446,  253,  382,  255,  510,
+     259,  385,  261,  321,  263,  449,  265,  289,  267,  417,  269,  353,  271,  481,  275,  401,
+     277,  337,  279,  465,  281,  305,  283,  433,  285,  369,  287,  497,  291,  393,  293,  329,
+     295,  457,  299,  425,  301,  361,  303,  489,  307,  409,  309,  345,  311,  473,  315,  441,
+     317,  377,  319,  505,  323,  389,  327,  453,  331,  421,  333,  357,  335,  485,  339,  405,
+     343,  469,  347,  437,  349,  373,  351,  501,  355,  397,  359,  461,  363,  429,  367,  493,
+     371,  413,  375,  477,  379,  445,  383,  509,  391,  451,  395,  419,  399,  483,  407,  467,
+     411,  435,  415,  499,  423,  459,  431,  491,  439,  475,  447,  507,  463,  487,  479,  503
+};
+
+const uint16_t armBitRevPairsM23_1024[ARMBITREVPAIRSM23_1024_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,  512,    2,  256,    3,  768,    4,  128,    5,  640,    6,  384,    7,  896,    8,   64,
+       9,  576,   10,  320,   11,  832,   12,  192,   13,  704,   14,  448,   15,  960,   16,   32,
+      17,  544,   18,  288,   19,  800,   20,  160,   21,  672,   22,  416,   23,  928,   24,   96,
+      25,  608,   26,  352,   27,  864,   28,  224,   29,  736,   30,  480,   31,  992,   33,  528,
+      34,  272,   35,  784,   36,  144,   37,  656,   38,  400,   39,  912,   40,   80,   41,  592,
+      42,  336,   43,  848,   44,  208,   45,  720,   46,  464,   47,  976,   49,  560,   50,  304,
+      51,  816,   52,  176,   53,  688,   54,  432,   55,  944,   56,  112,   57,  624,   58,  368,
+      59,  880,   60,  240,   61,  752,   62,  496,   63, 1008,   65,  520,   66,  264,   67,  776,
+      68,  136,   69,  648,   70,  392,   71,  904,   73,  584,   74,  328,   75,  840,   76,  200,
+      77,  712,   78,  456,   79,  968,   81,  552,   82,  296,   83,  808,   84,  168,   85,  680,
+      86,  424,   87,  936,   88,  104,   89,  616,   90,  360,   91,  872,   92,  232,   93,  744,
+      94,  488,   95, 1000,   97,  536,   98,  280,   99,  792,  100,  152,  101,  664,  102,  408,
+     103,  920,  105,  600,  106,  344,  107,  856,  108,  216,  109,  728,  110,  472,  111,  984,
+     113,  568,  114,  312,  115,  824,  116,  184,  117,  696,  118,  440,  119,  952,  121,  632,
+     122,  376,  123,  888,  124,  248,  125,  760,  126,  504,  127, 1016,  129,  516,  130,  260,
+     131,  772,  133,  644,  134,  388,  135,  900,  137,  580,  138,  324,  139,  836,  140,  196,
+     141,  708,  142,  452,  143,  964,  145,  548,  146,  292,  147,  804,  148,  164,  149,  676,
+     150,  420,  151,  932,  153,  612,  154,  356,  155,  868,  156,  228,  157,  740,  158,  484,
+     159,  996,  161,  532,  162,  276,  163,  788,  165,  660,  166,  404,  167,  916,  169,  596,
+     170,  340,  171,  852,  172,  212,  173,  724,  174,  468,  175,  980,  177,  564,  178,  308,
+     179,  820,  181,  692,  182,  436,  183,  948,  185,  628,  186,  372,  187,  884,  188,  244,
+     189,  756,  190,  500,  191, 1012,  193,  524,  194,  268,  195,  780,  197,  652,  198,  396,
+     199,  908,  201,  588,  202,  332,  203,  844,  205,  716,  206,  460,  207,  972,  209,  556,
+     210,  300,  211,  812,  213,  684,  214,  428,  215,  940,  217,  620,  218,  364,  219,  876,
+     220,  236,  221,  748,  222,  492,  223, 1004,  225,  540,  226,  284,  227,  796,  229,  668,
+     230,  412,  231,  924,  233,  604,  234,  348,  235,  860,  237,  732,  238,  476,  239,  988,
+     241,  572,  242,  316,  243,  828,  245,  700,  246,  444,  247,  956,  249,  636,  250,  380,
+     251,  892,  253,  764,  254,  508,  255, 1020,  257,  514,  259,  770,  261,  642,  262,  386,
+     263,  898,  265,  578,  266,  322,  267,  834,  269,  706,  270,  450,  271,  962,  273,  546,
+     274,  290,  275,  802,  277,  674,  278,  418,  279,  930,  281,  610,  282,  354,  283,  866,
+     285,  738,  286,  482,  287,  994,  289,  530,  291,  786,  293,  658,  294,  402,  295,  914,
+     297,  594,  298,  338,  299,  850,  301,  722,  302,  466,  303,  978,  305,  562,  307,  818,
+     309,  690,  310,  434,  311,  946,  313,  626,  314,  370,  315,  882,  317,  754,  318,  498,
+     319, 1010,  321,  522,  323,  778,  325,  650,  326,  394,  327,  906,  329,  586,  331,  842,
+     333,  714,  334,  458,  335,  970,  337,  554,  339,  810,  341,  682,  342,  426,  343,  938,
+     345,  618,  346,  362,  347,  874,  349,  746,  350,  490,  351, 1002,  353,  538,  355,  794,
+     357,  666,  358,  410,  359,  922,  361,  602,  363,  858,  365,  730,  366,  474,  367,  986,
+     369,  570,  371,  826,  373,  698,  374,  442,  375,  954,  377,  634,  379,  890,  381,  762,
+     382,  506,  383, 1018,  385,  518,  387,  774,  389,  646,  391,  902,  393,  582,  395,  838,
+     397,  710,  398,  454,  399,  966,  401,  550,  403,  806,  405,  678,  406,  422,  407,  934,
+     409,  614,  411,  870,  413,  742,  414,  486,  415,  998,  417,  534,  419,  790,  421,  662,
+     423,  918,  425,  598,  427,  854,  429,  726,  430,  470,  431,  982,  433,  566,  435,  822,
+     437,  694,  439,  950,  441,  630,  443,  886,  445,  758,  446,  502,  447, 1014,  449,  526,
+     451,  782,  453,  654,  455,  910,  457,  590,  459,  846,  461,  718,  463,  974,  465,  558,
+     467,  814,  469,  686,  471,  942,  473,  622,  475,  878,  477,  750,  478,  494,  479, 1006,
+     481,  542,  483,  798,  485,  670,  487,  926,  489,  606,  491,  862,  493,  734,  495,  990,
+     497,  574,  499,  830,  501,  702,  503,  958,  505,  638,  507,  894,  509,  766,  511, 1022,
+     515,  769,  517,  641,  519,  897,  521,  577,  523,  833,  525,  705,  527,  961,  529,  545,
+     531,  801,  533,  673,  535,  929,  537,  609,  539,  865,  541,  737,  543,  993,  547,  785,
+     549,  657,  551,  913,  553,  593,  555,  849,  557,  721,  559,  977,  563,  817,  565,  689,
+     567,  945,  569,  625,  571,  881,  573,  753,  575, 1009,  579,  777,  581,  649,  583,  905,
+     587,  841,  589,  713,  591,  969,  595,  809,  597,  681,  599,  937,  601,  617,  603,  873,
+     605,  745,  607, 1001,  611,  793,  613,  665,  615,  921,  619,  857,  621,  729,  623,  985,
+     627,  825,  629,  697,  631,  953,  635,  889,  637,  761,  639, 1017,  643,  773,  647,  901,
+     651,  837,  653,  709,  655,  965,  659,  805,  661,  677,  663,  933,  667,  869,  669,  741,
+     671,  997,  675,  789,  679,  917,  683,  853,  685,  725,  687,  981,  691,  821,  695,  949,
+     699,  885,  701,  757,  703, 1013,  707,  781,  711,  909,  715,  845,  719,  973,  723,  813,
+     727,  941,  731,  877,  733,  749,  735, 1005,  739,  797,  743,  925,  747,  861,  751,  989,
+     755,  829,  759,  957,  763,  893,  767, 1021,  775,  899,  779,  835,  783,  963,  787,  803,
+     791,  931,  795,  867,  799,  995,  807,  915,  811,  851,  815,  979,  823,  947,  827,  883,
+     831, 1011,  839,  907,  847,  971,  855,  939,  859,  875,  863, 1003,  871,  923,  879,  987,
+     887,  955,  895, 1019,  911,  967,  919,  935,  927,  999,  943,  983,  959, 1015,  991, 1007
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len16 ARM_DSP_TABLE_ATTRIBUTE = {
+  16, 64, twiddleCoefM23_q15, armBitRevPairsM23_16, ARMBITREVPAIRSM23_16_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len32 ARM_DSP_TABLE_ATTRIBUTE = {
+  32, 32, twiddleCoefM23_q15, armBitRevPairsM23_32, ARMBITREVPAIRSM23_32_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len64 ARM_DSP_TABLE_ATTRIBUTE = {
+  64, 16, twiddleCoefM23_q15, armBitRevPairsM23_64, ARMBITREVPAIRSM23_64_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len128 ARM_DSP_TABLE_ATTRIBUTE = {
+  128, 8, twiddleCoefM23_q15, armBitRevPairsM23_128, ARMBITREVPAIRSM23_128_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len256 ARM_DSP_TABLE_ATTRIBUTE = {
+  256, 4, twiddleCoefM23_q15, armBitRevPairsM23_256, ARMBITREVPAIRSM23_256_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len512 ARM_DSP_TABLE_ATTRIBUTE = {
+  512, 2, twiddleCoefM23_q15, armBitRevPairsM23_512, ARMBITREVPAIRSM23_512_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len1024 ARM_DSP_TABLE_ATTRIBUTE = {
+  1024, 1, twiddleCoefM23_q15, armBitRevPairsM23_1024, ARMBITREVPAIRSM23_1024_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len16 ARM_DSP_TABLE_ATTRIBUTE = {
+  16, 64, twiddleCoefM23_q31, armBitRevPairsM23_16, ARMBITREVPAIRSM23_16_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len32 ARM_DSP_TABLE_ATTRIBUTE = {
+  32, 32, twiddleCoefM23_q31, armBitRevPairsM23_32, ARMBITREVPAIRSM23_32_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len64 ARM_DSP_TABLE_ATTRIBUTE = {
+  64, 16, twiddleCoefM23_q31, armBitRevPairsM23_64, ARMBITREVPAIRSM23_64_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len128 ARM_DSP_TABLE_ATTRIBUTE = {
+  128, 8, twiddleCoefM23_q31, armBitRevPairsM23_128, ARMBITREVPAIRSM23_128_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len256 ARM_DSP_TABLE_ATTRIBUTE = {
+  256, 4, twiddleCoefM23_q31, armBitRevPairsM23_256, ARMBITREVPAIRSM23_256_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len512 ARM_DSP_TABLE_ATTRIBUTE = {
+  512, 2, twiddleCoefM23_q31, armBitRevPairsM23_512, ARMBITREVPAIRSM23_512_TABLE_LENGTH
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len1024 ARM_DSP_TABLE_ATTRIBUTE = {
+  1024, 1, twiddleCoefM23_q31, armBitRevPairsM23_1024, ARMBITREVPAIRSM23_1024_TABLE_LENGTH
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len32 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q15_len16, 32, 32, twiddleCoefM23_q15
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len64 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q15_len32, 64, 16, twiddleCoefM23_q15
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len128 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q15_len64, 128, 8, twiddleCoefM23_q15
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len256 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q15_len128, 256, 4, twiddleCoefM23_q15
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len512 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q15_len256, 512, 2, twiddleCoefM23_q15
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len1024 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q15_len512, 1024, 1, twiddleCoefM23_q15
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len32 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q31_len16, 32, 32, twiddleCoefM23_q31
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len64 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q31_len32, 64, 16, twiddleCoefM23_q31
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len128 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q31_len64, 128, 8, twiddleCoefM23_q31
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len256 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q31_len128, 256, 4, twiddleCoefM23_q31
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len512 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q31_len256, 512, 2, twiddleCoefM23_q31
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len1024 ARM_DSP_TABLE_ATTRIBUTE = {
+  &arm_cfft_plan_q31_len512, 1024, 1, twiddleCoefM23_q31
+};
+
+#endif /* !defined(ARM_DSP_APP_FFT_TABLES) */
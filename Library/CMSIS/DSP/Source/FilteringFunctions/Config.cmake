@@ -0,0 +1,22 @@
+cmake_minimum_required (VERSION 3.14)
+
+
+
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_fast_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_fast_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df1_init_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df1_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df1_fast_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df1_init_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df1_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df1_fast_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_init_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_fast_q15.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_init_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_fast_q31.c)
@@ -0,0 +1,46 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        FilteringFunctions.c
+ * Description:  Combination of all filtering function source files.
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_fir_init_q15.c"
+#include "arm_fir_q15.c"
+#include "arm_fir_fast_q15.c"
+#include "arm_fir_init_q31.c"
+#include "arm_fir_q31.c"
+#include "arm_fir_fast_q31.c"
+#include "arm_biquad_cascade_df1_init_q15.c"
+#include "arm_biquad_cascade_df1_q15.c"
+#include "arm_biquad_cascade_df1_fast_q15.c"
+#include "arm_biquad_cascade_df1_init_q31.c"
+#include "arm_biquad_cascade_df1_q31.c"
+#include "arm_biquad_cascade_df1_fast_q31.c"
+#include "arm_fir_decimate_init_q15.c"
+#include "arm_fir_decimate_q15.c"
+#include "arm_fir_decimate_fast_q15.c"
+#include "arm_fir_decimate_init_q31.c"
+#include "arm_fir_decimate_q31.c"
+#include "arm_fir_decimate_fast_q31.c"
@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df1_q15.c
+ * Description:  Processing function for the Q15 Biquad cascade DirectFormI(DF1) filter
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup BiquadCascadeDF1 Biquad Cascade IIR Filters Using Direct Form I Structure
+
+  A cascade of second order sections, each implementing
+  <pre>
+      y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+  </pre>
+  The feedback coefficients <code>a1</code> and <code>a2</code> are stored with the sign
+  which is added, i.e. negated compared with the usual <code>1 + a1 z^-1 + a2 z^-2</code>
+  denominator of filter design tools. The output of one stage is the input of the next,
+  the stages are processed one at a time over the whole block.
+
+  @par           Cores without DSP extension
+                   Every output depends on the previous one, so the kernels unroll by two samples
+                   and let the state variables swap roles instead of moving them on every sample.
+                   The fast variants keep a 32-bit accumulator, which removes the 64-bit additions
+                   of Q15 and the 64-bit multiply of Q31 on a core with no long multiply.
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 Biquad cascade filter.
+  @param[in]     S         points to an instance of the Q15 Biquad cascade structure
+  @param[in]     pSrc      points to the block of input data
+  @param[out]    pDst      points to the location where the output result is written
+  @param[in]     blockSize number of samples to process
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   The accumulator is then shifted by <code>postShift</code> bits to truncate the result to 1.15 format by discarding the low 16 bits.
+                   Finally, the result is saturated to 1.15 format.
+
+  @remark
+                   Refer to \ref arm_biquad_cascade_df1_fast_q15() for a faster but less precise implementation of this filter.
+ */
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_df1_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pIn = pSrc;                             /* Source pointer */
+        q15_t *pOut = pDst;                            /* Destination pointer */
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q63_t acc;                                     /* Accumulator */
+        q31_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+        q31_t Xn, Xn1, Xn2, Yn1, Yn2;                  /* Filter state variables */
+        int32_t shift = (15 - (int32_t) S->postShift); /* Post shift */
+        uint32_t sample, stage = (uint32_t) S->numStages; /* Loop counters */
+
+  do
+  {
+    /* Reading the coefficients, the zero coefficient after b0 is skipped */
+    b0 = *pCoeffs++;
+    pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time.
+       The second output reads the state in swapped order, so no variable is moved. */
+    sample = blockSize >> 1U;
+
+    while (sample > 0U)
+    {
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      Xn = *pIn++;
+      acc  = (q63_t) (b0 * Xn);
+      acc += (q63_t) (b1 * Xn1);
+      acc += (q63_t) (b2 * Xn2);
+      acc += (q63_t) (a1 * Yn1);
+      acc += (q63_t) (a2 * Yn2);
+
+      /* x[n-2] and y[n-2] are not needed anymore, they now hold x[n] and y[n] */
+      Xn2 = Xn;
+      Yn2 = __SSAT((q31_t) (acc >> shift), 16);
+      *pOut++ = (q15_t) Yn2;
+
+      /* Same with the roles of (Xn1, Yn1) and (Xn2, Yn2) swapped */
+      Xn = *pIn++;
+      acc  = (q63_t) (b0 * Xn);
+      acc += (q63_t) (b1 * Xn2);
+      acc += (q63_t) (b2 * Xn1);
+      acc += (q63_t) (a1 * Yn2);
+      acc += (q63_t) (a2 * Yn1);
+
+      Xn1 = Xn;
+      Yn1 = __SSAT((q31_t) (acc >> shift), 16);
+      *pOut++ = (q15_t) Yn1;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* Loop unrolling: Compute remaining output */
+    sample = blockSize & 1U;
+
+#else
+
+    /* Initialize blkCnt with number of samples */
+    sample = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (sample > 0U)
+    {
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      Xn = *pIn++;
+      acc  = (q63_t) (b0 * Xn);
+      acc += (q63_t) (b1 * Xn1);
+      acc += (q63_t) (b2 * Xn2);
+      acc += (q63_t) (a1 * Yn1);
+      acc += (q63_t) (a2 * Yn2);
+
+      /* Every time after the output is computed state should be updated. */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = __SSAT((q31_t) (acc >> shift), 16);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = (q15_t) Yn1;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer.
+       Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Reset to destination pointer */
+    pOut = pDst;
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = (q15_t) Xn1;
+    *pState++ = (q15_t) Xn2;
+    *pState++ = (q15_t) Yn1;
+    *pState++ = (q15_t) Yn2;
+
+  } while (--stage);
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_decimate_q15.c
+ * Description:  Q15 FIR Decimator
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_decimate Finite Impulse Response (FIR) Decimator
+
+  Lowpass FIR filter followed by the removal of <code>M-1</code> out of every <code>M</code> samples.
+  Only the kept outputs are computed: a block of <code>blockSize</code> input samples produces
+  <code>blockSize/M</code> outputs, each a dot product of <code>numTaps</code> state samples
+  with the coefficients, stored in time reversed order like \ref FIR.
+
+  @par           Cores without DSP extension
+                   The kernels compute two outputs per pass over the coefficients. The outputs
+                   are <code>M</code> samples apart in the state buffer, so each coefficient load
+                   is shared by the two multiply-accumulates.
+ */
+
+/**
+  @addtogroup FIR_decimate
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 FIR decimator.
+  @param[in]     S          points to an instance of the Q15 FIR decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the location where the output result is written
+  @param[in]     blockSize  number of input samples to process per call
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+
+  @remark
+                   Refer to \ref arm_fir_decimate_fast_q15() for a faster but less precise implementation of this function.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_decimate_q15(
+  const arm_fir_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q15_t *pStateCur;                              /* Points to the current sample of the state */
+  const q15_t *px0;                                    /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q31_t c0;                                      /* Temporary variable to hold coefficient value */
+        q63_t acc0;                                    /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t M = S->M;                             /* Decimation factor */
+        uint32_t i, tapCnt, blkCnt, outBlockSize = blockSize / M;  /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  const q15_t *px1;                                    /* Temporary pointer for state buffer of the second output */
+        q63_t acc1;                                    /* Accumulator of the second output */
+#endif
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCur points to the location where the new input data should be written */
+  pStateCur = S->pState + (numTaps - 1U);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 2 samples at a time */
+  blkCnt = outBlockSize >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy 2 * decimation factor number of new input samples into the state buffer */
+    i = M * 2U;
+
+    do
+    {
+      *pStateCur++ = *pSrc++;
+
+    } while (--i);
+
+    /* Set accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+
+    /* Initialize state pointers, the second output starts M samples later */
+    px0 = pState;
+    px1 = pState + M;
+
+    /* Initialize coeff pointer */
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Read the coefficient once for the two outputs */
+      c0 = *pb++;
+
+      /* Perform the multiply-accumulates */
+      acc0 += (q63_t) (*px0++ * c0);
+      acc1 += (q63_t) (*px1++ * c0);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Advance the state pointer by the decimation factor
+     * to process the next group of decimation factor number samples */
+    pState = pState + M * 2U;
+
+    /* The results are in 34.30 format. Convert to 1.15 with saturation. */
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc0 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc1 >> 15), 16);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining samples */
+  blkCnt = outBlockSize & 1U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = outBlockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* Copy decimation factor number of new input samples into the state buffer */
+    i = M;
+
+    do
+    {
+      *pStateCur++ = *pSrc++;
+
+    } while (--i);
+
+    /* Set accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state pointer */
+    px0 = pState;
+
+    /* Initialize coeff pointer */
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Read coefficients */
+      c0 = *pb++;
+
+      /* Perform the multiply-accumulate */
+      acc0 += (q63_t) (*px0++ * c0);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Advance the state pointer by the decimation factor
+     * to process the next group of decimation factor number samples */
+    pState = pState + M;
+
+    /* The result is in 34.30 format. Convert to 1.15 with saturation. */
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc0 >> 15), 16);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCur = S->pState;
+
+  i = numTaps - 1U;
+
+  /* Copy data */
+  while (i > 0U)
+  {
+    *pStateCur++ = *pState++;
+
+    /* Decrement loop counter */
+    i--;
+  }
+}
+
+/**
+  @} end of FIR_decimate group
+ */
@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fast_q31.c
+ * Description:  Processing function for the Q31 Fast FIR filter
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 FIR filter (fast version).
+  @param[in]     S          points to an instance of the Q31 FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+
+  @par           Scaling and Overflow Behavior
+                   This function is optimized for speed at the expense of fixed-point precision and overflow protection.
+                   The result of each 1.31 x 1.31 multiplication is rounded to 2.30 format.
+                   These intermediate results are added to a 2.30 accumulator.
+                   Finally, the accumulator is shifted left by one bit to yield a 1.31 result.
+                   In order to avoid overflows completely the input signal must be scaled down by log2(numTaps) bits.
+
+  @remark
+                   Refer to \ref arm_fir_q31() for a slower implementation of this function which uses 64-bit accumulation and provides slightly better precision.
+                   Both the slow and the fast versions use the same instance structure.
+                   Use function \ref arm_fir_init_q31() to initialize the filter structure.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_fast_q31(
+  const arm_fir_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                     /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  const q31_t *px;                                     /* Temporary pointer for state buffer */
+  const q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q31_t acc0;                                    /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q31_t acc1;                                    /* Accumulator of the second output */
+        q31_t x0, x1, c0;                              /* Temporary variables to hold state and coefficient values */
+#endif
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 2 output values simultaneously */
+  blkCnt = blockSize >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+
+    /* Initialize state and coefficient pointers */
+    px = pState;
+    pb = pCoeffs;
+
+    /* Read the first sample of the first output */
+    x0 = *px++;
+
+    /* Loop unrolling: 2 taps per loop, x0 and x1 alternate as the sample shared by the two outputs */
+    tapCnt = numTaps >> 1U;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      x1 = *px++;
+
+      /* acc0 +=  b[numTaps-1-k] * x[n-numTaps+1+k], acc1 is one sample later */
+      acc0 += mult_32x32_hi_R(x0, c0);
+      acc1 += mult_32x32_hi_R(x1, c0);
+
+      c0 = *pb++;
+      x0 = *px++;
+
+      acc0 += mult_32x32_hi_R(x1, c0);
+      acc1 += mult_32x32_hi_R(x0, c0);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Odd number of taps */
+    if ((numTaps & 1U) != 0U)
+    {
+      c0 = *pb;
+      x1 = *px;
+
+      acc0 += mult_32x32_hi_R(x0, c0);
+      acc1 += mult_32x32_hi_R(x1, c0);
+    }
+
+    /* The results are in 2.30 format. Convert to 1.31. */
+    *pDst++ = (q31_t) ((uint32_t) acc0 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc1 << 1);
+
+    /* Advance state pointer by 2 for the next 2 samples */
+    pState = pState + 2U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining output */
+  blkCnt = blockSize & 1U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state and coefficient pointers */
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      acc0 += mult_32x32_hi_R(*px++, *pb++);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in 2.30 format. Convert to 1.31. */
+    *pDst++ = (q31_t) ((uint32_t) acc0 << 1);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = numTaps - 1U;
+
+  /* Copy remaining data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+}
+
+/**
+  @} end of FIR group
+ */
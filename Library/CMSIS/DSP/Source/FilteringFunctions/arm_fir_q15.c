@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_q15.c
+ * Description:  Q15 FIR filter processing function
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR Finite Impulse Response (FIR) Filters
+
+  Block processing of a direct form FIR filter:
+  <pre>
+      y[n] = b[0] * x[n] + b[1] * x[n-1] + b[2] * x[n-2] + ...+ b[numTaps-1] * x[n-numTaps+1]
+  </pre>
+  The coefficients are stored in time reversed order in <code>pCoeffs</code> and
+  the state buffer keeps the last <code>numTaps-1</code> input samples between calls.
+  Every function operates on blocks of input and output data, and each call to the
+  function processes <code>blockSize</code> samples.
+
+  @par           Cores without DSP extension
+                   The kernels compute two output samples per pass over the coefficients.
+                   Each coefficient load and each state load is shared by the two outputs,
+                   and the two accumulators, one coefficient and two samples stay in the eight
+                   low registers of a Thumb-1 core such as the Cortex-M23.
+                   The multiply-accumulate is a 32-bit MULS and ADDS, no SMLAD is required.
+  @par
+                   The fast variants keep a 32-bit accumulator. On a core with no long multiply
+                   this removes the 64-bit addition of every tap for Q15 and the call to the
+                   compiler 64-bit multiply for Q31.
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 FIR filter.
+  @param[in]     S          points to an instance of the Q15 FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+
+  @remark
+                   Refer to \ref arm_fir_fast_q15() for a faster but less precise implementation of this function.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_q15(
+  const arm_fir_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  const q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q63_t acc0;                                    /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q63_t acc1;                                    /* Accumulator of the second output */
+        q31_t x0, x1, c0;                              /* Temporary variables to hold state and coefficient values */
+#endif
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 2 output values simultaneously */
+  blkCnt = blockSize >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+
+    /* Initialize state and coefficient pointers */
+    px = pState;
+    pb = pCoeffs;
+
+    /* Read the first sample of the first output */
+    x0 = *px++;
+
+    /* Loop unrolling: 2 taps per loop, x0 and x1 alternate as the sample shared by the two outputs */
+    tapCnt = numTaps >> 1U;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      x1 = *px++;
+
+      /* acc0 +=  b[numTaps-1-k] * x[n-numTaps+1+k], acc1 is one sample later */
+      acc0 += (q63_t) (x0 * c0);
+      acc1 += (q63_t) (x1 * c0);
+
+      c0 = *pb++;
+      x0 = *px++;
+
+      acc0 += (q63_t) (x1 * c0);
+      acc1 += (q63_t) (x0 * c0);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Odd number of taps */
+    if ((numTaps & 1U) != 0U)
+    {
+      c0 = *pb;
+      x1 = *px;
+
+      acc0 += (q63_t) (x0 * c0);
+      acc1 += (q63_t) (x1 * c0);
+    }
+
+    /* The results are in 34.30 format. Convert to 1.15 with saturation. */
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc0 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc1 >> 15), 16);
+
+    /* Advance state pointer by 2 for the next 2 samples */
+    pState = pState + 2U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining output */
+  blkCnt = blockSize & 1U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state and coefficient pointers */
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      acc0 += (q63_t) ((q31_t) *px++ * *pb++);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in 34.30 format. Convert to 1.15 with saturation. */
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc0 >> 15), 16);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = numTaps - 1U;
+
+  /* Copy remaining data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+}
+
+/**
+  @} end of FIR group
+ */
@@ -83,6 +83,10 @@ target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_mse_f32.c)
 target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_mse_f64.c)
 target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_accumulate_f64.c)
 target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_accumulate_f32.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_q15.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_running_stats_q31.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_minmax_q15.c)
+target_sources(CMSISDSP PRIVATE StatisticsFunctions/arm_sliding_minmax_q31.c)
 
 
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
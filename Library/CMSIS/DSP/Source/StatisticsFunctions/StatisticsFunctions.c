@@ -100,5 +100,9 @@
 #include "arm_mse_f64.c"
 #include "arm_accumulate_f32.c"
 #include "arm_accumulate_f64.c"
+#include "arm_running_stats_q15.c"
+#include "arm_running_stats_q31.c"
+#include "arm_sliding_minmax_q15.c"
+#include "arm_sliding_minmax_q31.c"
 
 
@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_stats_q15.c
+ * Description:  Running mean, variance and RMS of a Q15 stream
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup RunningStats Running Statistics
+
+  Incremental mean, variance and RMS of a sample stream.
+
+  The instance keeps the same accumulators as the block functions
+  (arm_mean_qxx(), arm_var_qxx(), arm_rms_qxx()) in exact integer arithmetic.
+  Adding a block costs O(blockSize) and the result can be queried at any time,
+  so a monitoring loop does not re-scan its whole history.
+
+  The query result is bit-exact with the block function applied to all samples
+  added since init, as long as that block function would not overflow itself.
+
+  Welford's recurrence is not used: it protects floating-point sums against
+  cancellation, while the integer accumulators here are exact, and its rounded
+  mean update would break bit-exactness with the block functions.
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 running statistics.
+  @param[out]    S          points to an instance of the running statistics structure.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_init_q15(
+        arm_running_stats_instance_q15 * S)
+{
+  S->count = 0U;
+  S->sum = 0;
+  S->sumOfSquares = 0;
+}
+
+/**
+  @brief         Adds a block of Q15 samples to the running statistics.
+  @param[in,out] S          points to an instance of the running statistics structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Scaling and Overflow Behavior
+                   The block sum and sum of squares are computed in 32-bit and 64-bit
+                   accumulators and added to the 64-bit running values.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_update_q15(
+        arm_running_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        q31_t sum = 0;                                 /* Block sum */
+        q63_t sumOfSquares = 0;                        /* Block sum of squares */
+        q15_t in;                                      /* Temporary variable to store input value */
+
+  S->count += blockSize;
+
+  while (blockSize > 0U)
+  {
+    /* Keep the 32-bit block sum inside its range */
+    blkCnt = (blockSize > 0x8000U) ? 0x8000U : blockSize;
+    blockSize -= blkCnt;
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+      sumOfSquares += ((q31_t) in * in);
+      sum += in;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    S->sum += sum;
+    sum = 0;
+  }
+
+  S->sumOfSquares += sumOfSquares;
+}
+
+/**
+  @brief         Mean value of all samples added to the Q15 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    mean value returned here. 0 if no sample was added.
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_mean_q15(): the sum is divided by the sample count and
+                   truncated to 1.15 format.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_mean_q15(
+  const arm_running_stats_instance_q15 * S,
+        q15_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  *pResult = (q15_t) (S->sum / (q63_t) S->count);
+}
+
+/**
+  @brief         Variance of all samples added to the Q15 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    variance value returned here. 0 if less than 2 samples were added.
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_var_q15(). The sample count product is computed in 64-bit,
+                   so the result stays valid beyond 65536 samples. When the square of the
+                   running sum would overflow the 64-bit range, after about 92000 full scale
+                   samples, the square of mean is computed as (sum / count) * sum / (count - 1)
+                   instead. The result is then within one LSB of the exact value instead of
+                   bit-exact.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_var_q15(
+  const arm_running_stats_instance_q15 * S,
+        q15_t * pResult)
+{
+        q31_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+        q63_t sum = S->sum;
+        uint32_t blockSize = S->count;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Compute Mean of squares and store result in a temporary variable, meanOfSquares. */
+  meanOfSquares = (q31_t) (S->sumOfSquares / (q63_t)(blockSize - 1U));
+
+  /* Compute square of mean */
+  if ((sum < (q63_t) 0x7FFFFFFF) && (sum > -(q63_t) 0x7FFFFFFF))
+  {
+    squareOfMean = (q31_t) (sum * sum / ((q63_t) blockSize * (blockSize - 1U)));
+  }
+  else
+  {
+    squareOfMean = (q31_t) ((sum / (q63_t) blockSize) * sum / (q63_t)(blockSize - 1U));
+  }
+
+  /* mean of squares minus the square of mean. */
+  *pResult = (meanOfSquares - squareOfMean) >> 15U;
+}
+
+/**
+  @brief         Root Mean Square of all samples added to the Q15 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    RMS value returned here. 0 if no sample was added.
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_rms_q15(): the mean of squares is truncated to 1.15 format,
+                   saturated and passed to arm_sqrt_q15().
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_rms_q15(
+  const arm_running_stats_instance_q15 * S,
+        q15_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  arm_sqrt_q15(__SSAT((S->sumOfSquares / (q63_t) S->count) >> 15, 16), pResult);
+}
+
+/**
+  @} end of RunningStats group
+ */
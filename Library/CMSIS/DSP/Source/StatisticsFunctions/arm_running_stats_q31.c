@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_stats_q31.c
+ * Description:  Running mean, variance and RMS of a Q31 stream
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup RunningStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 running statistics.
+  @param[out]    S          points to an instance of the running statistics structure.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_init_q31(
+        arm_running_stats_instance_q31 * S)
+{
+  S->count = 0U;
+  S->sum = 0;
+  S->sumShifted = 0;
+  S->sumOfSquares = 0;
+  S->sumOfSquaresRms = 0U;
+}
+
+/**
+  @brief         Adds a block of Q31 samples to the running statistics.
+  @param[in,out] S          points to an instance of the running statistics structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[in]     blockSize  number of samples to process.
+
+  @par           Scaling and Overflow Behavior
+                   The accumulators are the ones of arm_mean_q31(), arm_var_q31() and
+                   arm_rms_q31(): the variance uses the input shifted right by 8 bits.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_update_q31(
+        arm_running_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        q63_t sum = S->sum;
+        q63_t sumShifted = S->sumShifted;
+        q63_t sumOfSquares = S->sumOfSquares;
+        uint64_t sumOfSquaresRms = S->sumOfSquaresRms;
+        q31_t in, inShifted;
+
+  S->count += blockSize;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+    inShifted = in >> 8U;
+
+    sum += in;
+    sumShifted += inShifted;
+    sumOfSquares += ((q63_t) (inShifted) * (inShifted));
+    sumOfSquaresRms += ((q63_t) in * in);
+
+    /* Decrement loop counter */
+    blockSize--;
+  }
+
+  S->sum = sum;
+  S->sumShifted = sumShifted;
+  S->sumOfSquares = sumOfSquares;
+  S->sumOfSquaresRms = sumOfSquaresRms;
+}
+
+/**
+  @brief         Mean value of all samples added to the Q31 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    mean value returned here. 0 if no sample was added.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_mean_q31(
+  const arm_running_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  *pResult = (q31_t) (S->sum / S->count);
+}
+
+/**
+  @brief         Variance of all samples added to the Q31 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    variance value returned here. 0 if less than 2 samples were added.
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_var_q31(). When the square of the running sum would overflow
+                   the 64-bit range, which arm_var_q31() does not handle, the square of mean is
+                   computed as (sum / count) * sum / (count - 1) instead. The result is then
+                   within one LSB of the exact value instead of bit-exact.
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_var_q31(
+  const arm_running_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+        q63_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+        q63_t sum = S->sumShifted;
+        uint32_t blockSize = S->count;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Compute Mean of squares of the input samples
+   * and then store the result in a temporary variable, meanOfSquares. */
+  meanOfSquares = (S->sumOfSquares / (q63_t)(blockSize - 1U));
+
+  /* Compute square of mean */
+  if ((sum < (q63_t) 0x7FFFFFFF) && (sum > -(q63_t) 0x7FFFFFFF))
+  {
+    squareOfMean = (sum * sum / ((q63_t) blockSize * (blockSize - 1U)));
+  }
+  else
+  {
+    squareOfMean = (sum / (q63_t) blockSize) * sum / (q63_t)(blockSize - 1U);
+  }
+
+  /* Compute standard deviation and store result in destination */
+  *pResult = (meanOfSquares - squareOfMean) >> 15U;
+}
+
+/**
+  @brief         Root Mean Square of all samples added to the Q31 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure.
+  @param[out]    pResult    RMS value returned here. 0 if no sample was added.
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_rms_q31(): the sum of squares is kept in an unsigned 64-bit
+                   accumulator, the mean of squares is truncated to 1.31 format, saturated
+                   and passed to arm_sqrt_q31().
+ */
+ARM_DSP_ATTRIBUTE void arm_running_stats_rms_q31(
+  const arm_running_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquaresRms / (q63_t) S->count) >> 31), pResult);
+}
+
+/**
+  @} end of RunningStats group
+ */
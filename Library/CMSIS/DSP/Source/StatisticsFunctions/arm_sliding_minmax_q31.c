@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_minmax_q31.c
+ * Description:  Sliding window minimum and maximum of a Q31 stream
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingMinMax
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 sliding window minimum and maximum.
+  @param[out]    S           points to an instance of the sliding min/max structure.
+  @param[in]     windowSize  number of samples in the window.
+  @param[in]     pValState   points to the value state buffer of 2 * windowSize samples.
+  @param[in]     pIdxState   points to the index state buffer of 2 * windowSize words.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_sliding_minmax_init_q31(
+        arm_sliding_minmax_instance_q31 * S,
+        uint32_t windowSize,
+        q31_t * pValState,
+        uint32_t * pIdxState)
+{
+  if (windowSize == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowSize = windowSize;
+  S->sampleCount = 0U;
+
+  S->pMaxVal = pValState;
+  S->pMaxIdx = pIdxState;
+  S->pMinVal = pValState + windowSize;
+  S->pMinIdx = pIdxState + windowSize;
+
+  S->maxHead = 0U;
+  S->maxCount = 0U;
+  S->minHead = 0U;
+  S->minCount = 0U;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Adds a block of Q31 samples to the sliding window.
+  @param[in,out] S          points to an instance of the sliding min/max structure.
+  @param[in]     pSrc       points to the block of input data.
+  @param[in]     blockSize  number of samples to process.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_minmax_update_q31(
+        arm_sliding_minmax_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t windowSize = S->windowSize;
+        uint32_t sampleIdx = S->sampleCount;           /* Free running index of the new sample */
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t pos;                                  /* Ring position */
+        q31_t in;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+
+    /* Drop the max candidates not greater than the new sample */
+    while (maxCount > 0U)
+    {
+      pos = maxHead + maxCount - 1U;
+      pos = (pos >= windowSize) ? (pos - windowSize) : pos;
+
+      if (S->pMaxVal[pos] > in)
+      {
+        break;
+      }
+
+      maxCount--;
+    }
+
+    /* Drop the max candidate leaving the window. The queue is full only then. */
+    if ((maxCount > 0U) && ((sampleIdx - S->pMaxIdx[maxHead]) >= windowSize))
+    {
+      maxHead = (maxHead + 1U == windowSize) ? 0U : (maxHead + 1U);
+      maxCount--;
+    }
+
+    pos = maxHead + maxCount;
+    pos = (pos >= windowSize) ? (pos - windowSize) : pos;
+    S->pMaxVal[pos] = in;
+    S->pMaxIdx[pos] = sampleIdx;
+    maxCount++;
+
+    /* Same for the min candidates not less than the new sample */
+    while (minCount > 0U)
+    {
+      pos = minHead + minCount - 1U;
+      pos = (pos >= windowSize) ? (pos - windowSize) : pos;
+
+      if (S->pMinVal[pos] < in)
+      {
+        break;
+      }
+
+      minCount--;
+    }
+
+    if ((minCount > 0U) && ((sampleIdx - S->pMinIdx[minHead]) >= windowSize))
+    {
+      minHead = (minHead + 1U == windowSize) ? 0U : (minHead + 1U);
+      minCount--;
+    }
+
+    pos = minHead + minCount;
+    pos = (pos >= windowSize) ? (pos - windowSize) : pos;
+    S->pMinVal[pos] = in;
+    S->pMinIdx[pos] = sampleIdx;
+    minCount++;
+
+    sampleIdx++;
+
+    /* Decrement loop counter */
+    blockSize--;
+  }
+
+  S->sampleCount = sampleIdx;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->minHead = minHead;
+  S->minCount = minCount;
+}
+
+/**
+  @brief         Minimum and maximum of the Q31 samples in the sliding window.
+  @param[in]     S          points to an instance of the sliding min/max structure.
+  @param[out]    pMin       minimum value returned here. 0 if no sample was added.
+  @param[out]    pMax       maximum value returned here. 0 if no sample was added.
+
+  @par
+                   Before windowSize samples were added, the window holds all samples added so far.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_minmax_get_q31(
+  const arm_sliding_minmax_instance_q31 * S,
+        q31_t * pMin,
+        q31_t * pMax)
+{
+  *pMin = (S->minCount > 0U) ? S->pMinVal[S->minHead] : 0;
+  *pMax = (S->maxCount > 0U) ? S->pMaxVal[S->maxHead] : 0;
+}
+
+/**
+  @} end of SlidingMinMax group
+ */
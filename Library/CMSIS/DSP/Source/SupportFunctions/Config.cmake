@@ -46,6 +46,12 @@ SupportFunctions/arm_quick_sort_f32.c
 SupportFunctions/arm_selection_sort_f32.c
 SupportFunctions/arm_sort_f32.c
 SupportFunctions/arm_sort_init_f32.c
+SupportFunctions/arm_sort_q15.c
+SupportFunctions/arm_sort_q31.c
+SupportFunctions/arm_sort_q7.c
+SupportFunctions/arm_sort_init_q15.c
+SupportFunctions/arm_sort_init_q31.c
+SupportFunctions/arm_sort_init_q7.c
 SupportFunctions/arm_weighted_average_f32.c
 )
 
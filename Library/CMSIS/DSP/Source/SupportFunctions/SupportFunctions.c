@@ -47,6 +47,12 @@
 #include "arm_selection_sort_f32.c"
 #include "arm_sort_f32.c"
 #include "arm_sort_init_f32.c"
+#include "arm_sort_q15.c"
+#include "arm_sort_q31.c"
+#include "arm_sort_q7.c"
+#include "arm_sort_init_q15.c"
+#include "arm_sort_init_q31.c"
+#include "arm_sort_init_q7.c"
 #include "arm_weighted_average_f32.c"
 
 #include "arm_f64_to_float.c"
@@ -78,6 +78,11 @@ ARM_DSP_ATTRIBUTE void arm_sort_f32(
         case ARM_SORT_SELECTION:
         arm_selection_sort_f32(S, pSrc, pDst, blockSize);
         break;
+
+        case ARM_SORT_RADIX:
+        /* Radix sort is only provided for fixed-point data */
+        arm_quick_sort_f32(S, pSrc, pDst, blockSize);
+        break;
     }
 }
 
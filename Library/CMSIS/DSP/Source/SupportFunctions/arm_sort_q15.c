@@ -0,0 +1,287 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q15.c
+ * Description:  Q15 sort
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/* Partitions smaller than this are finished by insertion sort */
+#define ARM_SORT_Q15_INSERTION_LIMIT 12
+
+/* Non-zero when a must be placed after b */
+#define ARM_SORT_Q15_AFTER(a, b, dir) ((dir) ? ((a) > (b)) : ((a) < (b)))
+
+static void arm_insertion_sort_core_q15(q15_t *pA, int32_t first, int32_t last, uint8_t dir)
+{
+    int32_t i, j;
+    q15_t temp;
+
+    for (i = first + 1; i <= last; i++)
+    {
+        temp = pA[i];
+
+        /* Shift the larger (smaller) elements up instead of swapping */
+        for (j = i; (j > first) && ARM_SORT_Q15_AFTER(pA[j - 1], temp, dir); j--)
+        {
+            pA[j] = pA[j - 1];
+        }
+
+        pA[j] = temp;
+    }
+}
+
+static void arm_heap_sort_core_q15(q15_t *pA, uint32_t blockSize, uint8_t dir)
+{
+    uint32_t n, i, k, c;
+    q15_t temp;
+
+    /* Build the heap, then move the root to the end of the shrinking heap */
+    for (n = blockSize, i = blockSize / 2; n > 1U; )
+    {
+        if (i > 0U)
+        {
+            temp = pA[--i];
+        }
+        else
+        {
+            n--;
+            temp = pA[n];
+            pA[n] = pA[0];
+        }
+
+        /* Iterative sift-down: no recursion on the M-profile stack */
+        k = i;
+        while ((c = 2U * k + 1U) < n)
+        {
+            if ((c + 1U < n) && ARM_SORT_Q15_AFTER(pA[c + 1U], pA[c], dir))
+            {
+                c++;
+            }
+
+            if (!ARM_SORT_Q15_AFTER(pA[c], temp, dir))
+            {
+                break;
+            }
+
+            pA[k] = pA[c];
+            k = c;
+        }
+
+        pA[k] = temp;
+    }
+}
+
+static void arm_quick_sort_core_q15(q15_t *pA, int32_t first, int32_t last, uint8_t dir)
+{
+    int32_t i, j, mid;
+    q15_t pivot, temp;
+
+    while (last - first >= ARM_SORT_Q15_INSERTION_LIMIT)
+    {
+        /* Median of three as pivot avoids the O(n^2) case of sorted windows */
+        mid = first + ((last - first) >> 1);
+
+        if (ARM_SORT_Q15_AFTER(pA[first], pA[mid], dir))
+        {
+            temp = pA[first]; pA[first] = pA[mid]; pA[mid] = temp;
+        }
+        if (ARM_SORT_Q15_AFTER(pA[mid], pA[last], dir))
+        {
+            temp = pA[mid]; pA[mid] = pA[last]; pA[last] = temp;
+            if (ARM_SORT_Q15_AFTER(pA[first], pA[mid], dir))
+            {
+                temp = pA[first]; pA[first] = pA[mid]; pA[mid] = temp;
+            }
+        }
+
+        pivot = pA[mid];
+
+        /* Hoare partition */
+        i = first - 1;
+        j = last + 1;
+
+        for (;;)
+        {
+            do
+            {
+                i++;
+            } while (ARM_SORT_Q15_AFTER(pivot, pA[i], dir));
+
+            do
+            {
+                j--;
+            } while (ARM_SORT_Q15_AFTER(pA[j], pivot, dir));
+
+            if (i >= j)
+            {
+                break;
+            }
+
+            temp = pA[i]; pA[i] = pA[j]; pA[j] = temp;
+        }
+
+        /* Recurse into the smaller part and loop on the larger one: stack depth is O(log n) */
+        if (j - first < last - j)
+        {
+            arm_quick_sort_core_q15(pA, first, j, dir);
+            first = j + 1;
+        }
+        else
+        {
+            arm_quick_sort_core_q15(pA, j + 1, last, dir);
+            last = j;
+        }
+    }
+
+    arm_insertion_sort_core_q15(pA, first, last, dir);
+}
+
+static void arm_radix_pass_q15(const q15_t *pIn, q15_t *pOut, uint32_t blockSize, uint32_t shift, uint16_t flip, uint8_t dir)
+{
+    uint16_t count[256];
+    uint16_t pos, c;
+    uint32_t i, k;
+
+    memset(count, 0, sizeof(count));
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        count[(((uint16_t)pIn[i] ^ flip) >> shift) & 0xFFU]++;
+    }
+
+    /* Exclusive prefix sum; descending order takes the buckets from the top */
+    pos = 0U;
+    for (i = 0U; i < 256U; i++)
+    {
+        k = dir ? i : (255U - i);
+        c = count[k];
+        count[k] = pos;
+        pos += c;
+    }
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pOut[count[(((uint16_t)pIn[i] ^ flip) >> shift) & 0xFFU]++] = pIn[i];
+    }
+}
+
+static void arm_radix_sort_core_q15(q15_t *pSrc, q15_t *pDst, uint32_t blockSize, uint8_t dir)
+{
+    /* The sign bit is flipped so that the unsigned digit order is the signed value order */
+    arm_radix_pass_q15(pSrc, pDst, blockSize, 0U, 0x8000U, dir);
+    arm_radix_pass_q15(pDst, pSrc, blockSize, 8U, 0x8000U, dir);
+    memcpy(pDst, pSrc, blockSize*sizeof(q15_t));
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+
+/**
+ * @brief Generic sorting function for Q15 data
+ *
+ * @param[in]  S          points to an instance of the sorting structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data.
+ * @param[in]  blockSize  number of samples to process.
+ *
+ * @par        Algorithm
+ *               Integer comparisons are used, so no soft-float call is made on cores
+ *               without FPU. The supported algorithms are:
+ *               - ARM_SORT_QUICK: median-of-three quick sort finished by insertion sort on
+ *                 small partitions. The smaller partition is sorted recursively, so the
+ *                 stack depth is O(log(blockSize)).
+ *               - ARM_SORT_HEAP: in-place heap sort with iterative sift-down, O(n log n) in all cases.
+ *               - ARM_SORT_INSERTION: best for short or nearly sorted blocks.
+ *               - ARM_SORT_RADIX: stable LSD radix sort, two passes on 8-bit digits with a
+ *                 256-entry count table on the stack. It needs a second buffer, so pSrc is used
+ *                 as working buffer and its content is destroyed. An in-place call (pSrc == pDst)
+ *                 or a block larger than 65535 samples is served by quick sort.
+ *
+ * @par
+ *               ARM_SORT_BITONIC is served by heap sort. ARM_SORT_BUBBLE and ARM_SORT_SELECTION are served
+ *               by insertion sort, which does fewer moves with the same complexity.
+ *
+ * @par
+ *               The other algorithms are in-place. In order to obtain an out-of-place
+ *               function, a memcpy of the source vector is performed.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_sort_q15(
+  const arm_sort_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+    q15_t * pA;
+
+    if((S->alg == ARM_SORT_RADIX) && (pSrc != pDst) && (blockSize >= 2U) && (blockSize <= 0xFFFFU))
+    {
+        arm_radix_sort_core_q15(pSrc, pDst, blockSize, S->dir);
+        return;
+    }
+
+    if(pSrc != pDst) // out-of-place
+    {
+        memcpy(pDst, pSrc, blockSize*sizeof(q15_t) );
+        pA = pDst;
+    }
+    else
+        pA = pSrc;
+
+    if(blockSize < 2U)
+        return;
+
+    switch(S->alg)
+    {
+        case ARM_SORT_BITONIC:
+        case ARM_SORT_HEAP:
+        arm_heap_sort_core_q15(pA, blockSize, S->dir);
+        break;
+
+        case ARM_SORT_BUBBLE:
+        case ARM_SORT_INSERTION:
+        case ARM_SORT_SELECTION:
+        arm_insertion_sort_core_q15(pA, 0, (int32_t)blockSize - 1, S->dir);
+        break;
+
+        case ARM_SORT_QUICK:
+        case ARM_SORT_RADIX:
+        arm_quick_sort_core_q15(pA, 0, (int32_t)blockSize - 1, S->dir);
+        break;
+    }
+}
+
+/**
+  @} end of Sorting group
+ */
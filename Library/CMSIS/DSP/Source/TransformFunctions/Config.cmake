@@ -40,6 +40,20 @@ target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix4_q31.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_q31.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_init_q31.c)
 
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_m23_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_m23_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_m23_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_m23_q31.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_goertzel_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_goertzel_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_goertzel_init_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_goertzel_init_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_sdft_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_sdft_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_sdft_init_q15.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_sdft_init_q31.c)
+
 
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct4_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct4_init_f32.c)
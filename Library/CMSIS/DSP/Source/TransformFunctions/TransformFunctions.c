@@ -32,6 +32,18 @@
 #include "arm_cfft_f64.c"
 #include "arm_cfft_q15.c"
 #include "arm_cfft_q31.c"
+#include "arm_cfft_m23_q15.c"
+#include "arm_cfft_m23_q31.c"
+#include "arm_rfft_m23_q15.c"
+#include "arm_rfft_m23_q31.c"
+#include "arm_goertzel_q15.c"
+#include "arm_goertzel_q31.c"
+#include "arm_goertzel_init_q15.c"
+#include "arm_goertzel_init_q31.c"
+#include "arm_sdft_q15.c"
+#include "arm_sdft_q31.c"
+#include "arm_sdft_init_q15.c"
+#include "arm_sdft_init_q31.c"
 #include "arm_cfft_init_f32.c"
 #include "arm_cfft_init_f64.c"
 #include "arm_cfft_init_q15.c"
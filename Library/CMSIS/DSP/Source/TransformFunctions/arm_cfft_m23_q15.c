@@ -0,0 +1,262 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_m23_q15.c
+ * Description:  Q15 complex FFT with constant plans for cores without DSP extension
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup ComplexFFTM23 Complex FFT for Cortex-M23
+
+  Q15 and Q31 complex FFT for Thumb-1 cores such as the Cortex-M23, which have
+  neither the DSP extension used by \ref arm_cfft_q15() nor a long multiply.
+  The result has the same format and scaling as \ref arm_cfft_q15() and
+  \ref arm_cfft_q31(): the transform is scaled down by <code>fftLen</code>.
+
+  @par           Plans
+                   The transform is described by a constant plan, <code>arm_cfft_plan_q15_lenN</code>
+                   or <code>arm_cfft_plan_q31_lenN</code> for N = 16 to 1024, declared in arm_const_structs.h.
+                   There is no init function. The plans and their tables are in flash and every length
+                   walks one shared twiddle table with its own stride.
+
+  @par           Algorithm
+                   Each radix-4 stage is two fused radix-2 decimation in frequency stages, so the output
+                   is in plain bit reversed order for any length. An odd number of radix-2 stages ends
+                   with a radix-2 stage, and the last radix-4 or radix-2 stage has no twiddle multiply.
+                   The inverse transform reads the second and fourth inputs of the butterfly swapped and
+                   negates the sine, so it runs the same code without a flag test per butterfly.
+
+  @par           Cortex-M23
+                   The Q15 butterfly is built on 16 x 16 -> 32 MULS and rounds every stage instead of
+                   truncating, so no bias builds up along the stages.
+                   The Q31 butterfly computes the rounded high word of every twiddle product from three
+                   16 x 16 partial products, without the call to the compiler 64-bit multiply.
+ */
+
+/**
+  @addtogroup ComplexFFTM23
+  @{
+ */
+
+/* Radix-4 stage of span L, scaled down by 4 */
+static void arm_cfft_m23_radix4_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint32_t L,
+  const q15_t * pCoef,
+        uint32_t twidStep,
+        uint8_t ifftFlag)
+{
+        q15_t *p;
+        q15_t *pEnd = pSrc + 2U * fftLen;
+  const q15_t *pW1 = pCoef, *pW2 = pCoef, *pW3 = pCoef;
+        uint32_t n, n2 = L >> 1U;                      /* a quarter of the span, in q15_t */
+        uint32_t o1, o3;
+        int32_t c1, s1, c2, s2, c3, s3;
+        int32_t ar, ai, br, bi, cr, ci, dr, di, tr, ti;
+
+  /* The inverse turns -j into +j: reading x1 and x3 swapped negates x1 - x3 alone */
+  o1 = (ifftFlag == 1U) ? 3U * n2 : n2;
+  o3 = (ifftFlag == 1U) ? n2 : 3U * n2;
+
+  for (n = 0U; n < (L >> 2U); n++)
+  {
+    c1 = pW1[0];
+    s1 = pW1[1];
+    c2 = pW2[0];
+    s2 = pW2[1];
+    c3 = pW3[0];
+    s3 = pW3[1];
+
+    if (ifftFlag == 1U)
+    {
+      s1 = -s1;
+      s2 = -s2;
+      s3 = -s3;
+    }
+
+    pW1 += 2U * twidStep;
+    pW2 += 4U * twidStep;
+    pW3 += 6U * twidStep;
+
+    for (p = pSrc + 2U * n; p < pEnd; p += 2U * L)
+    {
+      ar = p[0] + p[2U * n2];
+      ai = p[1] + p[2U * n2 + 1U];
+      cr = p[0] - p[2U * n2];
+      ci = p[1] - p[2U * n2 + 1U];
+      br = p[o1] + p[o3];
+      bi = p[o1 + 1U] + p[o3 + 1U];
+      dr = p[o1] - p[o3];
+      di = p[o1 + 1U] - p[o3 + 1U];
+
+      p[0] = (q15_t) ((ar + br + 2) >> 2);
+      p[1] = (q15_t) ((ai + bi + 2) >> 2);
+
+      /* (a - b) * W^2n */
+      tr = (ar - br + 2) >> 2;
+      ti = (ai - bi + 2) >> 2;
+      p[n2]      = (q15_t) ((tr * c2 + ti * s2 + 0x4000) >> 15);
+      p[n2 + 1U] = (q15_t) ((ti * c2 - tr * s2 + 0x4000) >> 15);
+
+      /* (c - jd) * W^n */
+      tr = (cr + di + 2) >> 2;
+      ti = (ci - dr + 2) >> 2;
+      p[2U * n2]      = (q15_t) ((tr * c1 + ti * s1 + 0x4000) >> 15);
+      p[2U * n2 + 1U] = (q15_t) ((ti * c1 - tr * s1 + 0x4000) >> 15);
+
+      /* (c + jd) * W^3n */
+      tr = (cr - di + 2) >> 2;
+      ti = (ci + dr + 2) >> 2;
+      p[3U * n2]      = (q15_t) ((tr * c3 + ti * s3 + 0x4000) >> 15);
+      p[3U * n2 + 1U] = (q15_t) ((ti * c3 - tr * s3 + 0x4000) >> 15);
+    }
+  }
+}
+
+/* Last radix-4 stage, span 4: all the twiddles are 1 */
+static void arm_cfft_m23_radix4_last_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint8_t ifftFlag)
+{
+        q15_t *p;
+        q15_t *pEnd = pSrc + 2U * fftLen;
+        uint32_t o1 = (ifftFlag == 1U) ? 6U : 2U;
+        uint32_t o3 = (ifftFlag == 1U) ? 2U : 6U;
+        int32_t ar, ai, br, bi, cr, ci, dr, di;
+
+  for (p = pSrc; p < pEnd; p += 8U)
+  {
+    ar = p[0] + p[4];
+    ai = p[1] + p[5];
+    cr = p[0] - p[4];
+    ci = p[1] - p[5];
+    br = p[o1] + p[o3];
+    bi = p[o1 + 1U] + p[o3 + 1U];
+    dr = p[o1] - p[o3];
+    di = p[o1 + 1U] - p[o3 + 1U];
+
+    p[0] = (q15_t) ((ar + br + 2) >> 2);
+    p[1] = (q15_t) ((ai + bi + 2) >> 2);
+    p[2] = (q15_t) ((ar - br + 2) >> 2);
+    p[3] = (q15_t) ((ai - bi + 2) >> 2);
+    p[4] = (q15_t) ((cr + di + 2) >> 2);
+    p[5] = (q15_t) ((ci - dr + 2) >> 2);
+    p[6] = (q15_t) ((cr - di + 2) >> 2);
+    p[7] = (q15_t) ((ci + dr + 2) >> 2);
+  }
+}
+
+/* Last radix-2 stage, span 2, for an odd number of radix-2 stages */
+static void arm_cfft_m23_radix2_last_q15(
+        q15_t * pSrc,
+        uint32_t fftLen)
+{
+        q15_t *p;
+        q15_t *pEnd = pSrc + 2U * fftLen;
+        int32_t xr, xi, yr, yi;
+
+  for (p = pSrc; p < pEnd; p += 4U)
+  {
+    xr = p[0];
+    xi = p[1];
+    yr = p[2];
+    yi = p[3];
+
+    p[0] = (q15_t) ((xr + yr + 1) >> 1);
+    p[1] = (q15_t) ((xi + yi + 1) >> 1);
+    p[2] = (q15_t) ((xr - yr + 1) >> 1);
+    p[3] = (q15_t) ((xi - yi + 1) >> 1);
+  }
+}
+
+/**
+  @brief         Processing function for the Q15 complex FFT on a constant plan.
+  @param[in]     P               points to a constant plan, arm_cfft_plan_q15_lenN
+  @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+
+  @par           Scaling and Overflow Behavior
+                   Every radix-4 stage scales down by 4 and the radix-2 stage by 2, so the output is
+                   the transform divided by <code>fftLen</code>, in the same format as \ref arm_cfft_q15().
+                   The complex magnitude of the input samples must stay below 1.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_m23_q15(
+  const arm_cfft_plan_q15 * P,
+        q15_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+        uint32_t fftLen = P->fftLen;
+        uint32_t L = fftLen;
+        uint32_t twidStep = P->twidStride;
+  const uint16_t *pTab = P->pBitRevTable;
+        uint32_t i, a, b;
+        q15_t t;
+
+  while (L >= 8U)
+  {
+    arm_cfft_m23_radix4_q15(p1, fftLen, L, P->pTwiddle, twidStep, ifftFlag);
+    L >>= 2U;
+    twidStep <<= 2U;
+  }
+
+  if (L == 4U)
+    arm_cfft_m23_radix4_last_q15(p1, fftLen, ifftFlag);
+  else
+    arm_cfft_m23_radix2_last_q15(p1, fftLen);
+
+  if (bitReverseFlag)
+  {
+    for (i = 0U; i < P->bitRevLength; i += 2U)
+    {
+      a = 2U * pTab[i];
+      b = 2U * pTab[i + 1U];
+
+      t = p1[a];
+      p1[a] = p1[b];
+      p1[b] = t;
+
+      t = p1[a + 1U];
+      p1[a + 1U] = p1[b + 1U];
+      p1[b + 1U] = t;
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFTM23 group
+ */
@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_m23_q31.c
+ * Description:  Q31 complex FFT with constant plans for cores without DSP extension
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_m23_fft.h"
+
+/**
+  @addtogroup ComplexFFTM23
+  @{
+ */
+
+/* Radix-4 stage of span L, scaled down by 4 */
+static void arm_cfft_m23_radix4_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+        uint32_t L,
+  const q31_t * pCoef,
+        uint32_t twidStep,
+        uint8_t ifftFlag)
+{
+        q31_t *p;
+        q31_t *pEnd = pSrc + 2U * fftLen;
+  const q31_t *pW1 = pCoef, *pW2 = pCoef, *pW3 = pCoef;
+        uint32_t n, n2 = L >> 1U;                      /* a quarter of the span, in q31_t */
+        uint32_t o1, o3;
+        q31_t c1, s1, c2, s2, c3, s3;
+        q31_t x0r, x0i, x2r, x2i, ar, ai, br, bi, cr, ci, dr, di, tr, ti;
+
+  /* The inverse turns -j into +j: reading x1 and x3 swapped negates x1 - x3 alone */
+  o1 = (ifftFlag == 1U) ? 3U * n2 : n2;
+  o3 = (ifftFlag == 1U) ? n2 : 3U * n2;
+
+  for (n = 0U; n < (L >> 2U); n++)
+  {
+    c1 = pW1[0];
+    s1 = pW1[1];
+    c2 = pW2[0];
+    s2 = pW2[1];
+    c3 = pW3[0];
+    s3 = pW3[1];
+
+    if (ifftFlag == 1U)
+    {
+      s1 = -s1;
+      s2 = -s2;
+      s3 = -s3;
+    }
+
+    pW1 += 2U * twidStep;
+    pW2 += 4U * twidStep;
+    pW3 += 6U * twidStep;
+
+    for (p = pSrc + 2U * n; p < pEnd; p += 2U * L)
+    {
+      /* Scaled down by 4 first, so the sums do not overflow */
+      x0r = p[0] >> 2;
+      x0i = p[1] >> 2;
+      x2r = p[2U * n2] >> 2;
+      x2i = p[2U * n2 + 1U] >> 2;
+      ar = x0r + x2r;
+      ai = x0i + x2i;
+      cr = x0r - x2r;
+      ci = x0i - x2i;
+      x0r = p[o1] >> 2;
+      x0i = p[o1 + 1U] >> 2;
+      x2r = p[o3] >> 2;
+      x2i = p[o3 + 1U] >> 2;
+      br = x0r + x2r;
+      bi = x0i + x2i;
+      dr = x0r - x2r;
+      di = x0i - x2i;
+
+      p[0] = ar + br;
+      p[1] = ai + bi;
+
+      /* (a - b) * W^2n, the sum of two high words is the product in 2.30 */
+      tr = ar - br;
+      ti = ai - bi;
+      p[n2]      = (q31_t) ((uint32_t) (arm_cfft_m23_mul_q31(tr, c2) + arm_cfft_m23_mul_q31(ti, s2)) << 1U);
+      p[n2 + 1U] = (q31_t) ((uint32_t) (arm_cfft_m23_mul_q31(ti, c2) - arm_cfft_m23_mul_q31(tr, s2)) << 1U);
+
+      /* (c - jd) * W^n */
+      tr = cr + di;
+      ti = ci - dr;
+      p[2U * n2]      = (q31_t) ((uint32_t) (arm_cfft_m23_mul_q31(tr, c1) + arm_cfft_m23_mul_q31(ti, s1)) << 1U);
+      p[2U * n2 + 1U] = (q31_t) ((uint32_t) (arm_cfft_m23_mul_q31(ti, c1) - arm_cfft_m23_mul_q31(tr, s1)) << 1U);
+
+      /* (c + jd) * W^3n */
+      tr = cr - di;
+      ti = ci + dr;
+      p[3U * n2]      = (q31_t) ((uint32_t) (arm_cfft_m23_mul_q31(tr, c3) + arm_cfft_m23_mul_q31(ti, s3)) << 1U);
+      p[3U * n2 + 1U] = (q31_t) ((uint32_t) (arm_cfft_m23_mul_q31(ti, c3) - arm_cfft_m23_mul_q31(tr, s3)) << 1U);
+    }
+  }
+}
+
+/* Last radix-4 stage, span 4: all the twiddles are 1 */
+static void arm_cfft_m23_radix4_last_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+        uint8_t ifftFlag)
+{
+        q31_t *p;
+        q31_t *pEnd = pSrc + 2U * fftLen;
+        uint32_t o1 = (ifftFlag == 1U) ? 6U : 2U;
+        uint32_t o3 = (ifftFlag == 1U) ? 2U : 6U;
+        q31_t x0r, x0i, x2r, x2i, ar, ai, br, bi, cr, ci, dr, di;
+
+  for (p = pSrc; p < pEnd; p += 8U)
+  {
+    x0r = p[0] >> 2;
+    x0i = p[1] >> 2;
+    x2r = p[4] >> 2;
+    x2i = p[5] >> 2;
+    ar = x0r + x2r;
+    ai = x0i + x2i;
+    cr = x0r - x2r;
+    ci = x0i - x2i;
+    x0r = p[o1] >> 2;
+    x0i = p[o1 + 1U] >> 2;
+    x2r = p[o3] >> 2;
+    x2i = p[o3 + 1U] >> 2;
+    br = x0r + x2r;
+    bi = x0i + x2i;
+    dr = x0r - x2r;
+    di = x0i - x2i;
+
+    p[0] = ar + br;
+    p[1] = ai + bi;
+    p[2] = ar - br;
+    p[3] = ai - bi;
+    p[4] = cr + di;
+    p[5] = ci - dr;
+    p[6] = cr - di;
+    p[7] = ci + dr;
+  }
+}
+
+/* Last radix-2 stage, span 2, for an odd number of radix-2 stages */
+static void arm_cfft_m23_radix2_last_q31(
+        q31_t * pSrc,
+        uint32_t fftLen)
+{
+        q31_t *p;
+        q31_t *pEnd = pSrc + 2U * fftLen;
+        q31_t xr, xi, yr, yi;
+
+  for (p = pSrc; p < pEnd; p += 4U)
+  {
+    xr = p[0] >> 1;
+    xi = p[1] >> 1;
+    yr = p[2] >> 1;
+    yi = p[3] >> 1;
+
+    p[0] = xr + yr;
+    p[1] = xi + yi;
+    p[2] = xr - yr;
+    p[3] = xi - yi;
+  }
+}
+
+/**
+  @brief         Processing function for the Q31 complex FFT on a constant plan.
+  @param[in]     P               points to a constant plan, arm_cfft_plan_q31_lenN
+  @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+
+  @par           Scaling and Overflow Behavior
+                   Every radix-4 stage scales down by 4 and the radix-2 stage by 2, so the output is
+                   the transform divided by <code>fftLen</code>, in the same format as \ref arm_cfft_q31().
+                   The complex magnitude of the input samples must stay below 1.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_m23_q31(
+  const arm_cfft_plan_q31 * P,
+        q31_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+        uint32_t fftLen = P->fftLen;
+        uint32_t L = fftLen;
+        uint32_t twidStep = P->twidStride;
+  const uint16_t *pTab = P->pBitRevTable;
+        uint32_t i, a, b;
+        q31_t t;
+
+  while (L >= 8U)
+  {
+    arm_cfft_m23_radix4_q31(p1, fftLen, L, P->pTwiddle, twidStep, ifftFlag);
+    L >>= 2U;
+    twidStep <<= 2U;
+  }
+
+  if (L == 4U)
+    arm_cfft_m23_radix4_last_q31(p1, fftLen, ifftFlag);
+  else
+    arm_cfft_m23_radix2_last_q31(p1, fftLen);
+
+  if (bitReverseFlag)
+  {
+    for (i = 0U; i < P->bitRevLength; i += 2U)
+    {
+      a = 2U * pTab[i];
+      b = 2U * pTab[i + 1U];
+
+      t = p1[a];
+      p1[a] = p1[b];
+      p1[b] = t;
+
+      t = p1[a + 1U];
+      p1[a + 1U] = p1[b + 1U];
+      p1[b + 1U] = t;
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFTM23 group
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q15.c
+ * Description:  Initialization function for the Q15 multi-bin Goertzel detector
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 multi-bin Goertzel detector.
+  @param[in,out] S          points to an instance of the Q15 Goertzel structure
+  @param[in]     numBins    number of tracked bins
+  @param[in]     frameLen   number of samples per result, 2 to 4096
+  @param[in]     pCoeffs    points to the {cos, sin} pairs of the bin frequencies
+  @param[in]     pState     points to the state buffer of 2*numBins values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> or <code>frameLen</code> is out of range
+
+  @par           Details
+                   <code>pCoeffs</code> holds cos(w) and sin(w) of every bin frequency w = 2*pi*k/frameLen,
+                   k need not be an integer:
+  <pre>
+      {cos(w[0]), sin(w[0]), cos(w[1]), sin(w[1]), ..., cos(w[numBins-1]), sin(w[numBins-1])}
+  </pre>
+                   gen_fft_tables.py writes the table of a <code>goertzel</code> entry.
+  @par
+                   The input is scaled down so the resonators cannot overflow. The gain of a resonator
+                   is at most frameLen * min(frameLen, 1/|sin(w)|), bins close to DC or Nyquist need
+                   the most headroom.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_goertzel_init_q15(
+        arm_goertzel_instance_q15 * S,
+        uint16_t numBins,
+        uint16_t frameLen,
+  const q15_t * pCoeffs,
+        q31_t * pState)
+{
+  uint32_t i, gain, maxGain, s;
+  uint8_t shift;
+
+  if ((numBins == 0U) || (frameLen < 2U) || (frameLen > 4096U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Largest resonator gain over the bins */
+  maxGain = frameLen;
+  for (i = 0U; i < numBins; i++)
+  {
+    s = (pCoeffs[2U * i + 1U] < 0) ? (uint32_t) -pCoeffs[2U * i + 1U] : (uint32_t) pCoeffs[2U * i + 1U];
+    gain = (s == 0U) ? frameLen : ((32768U + s - 1U) / s);
+    if (gain > frameLen)
+    {
+      gain = frameLen;
+    }
+
+    gain *= frameLen;
+    if (gain > maxGain)
+    {
+      maxGain = gain;
+    }
+  }
+
+  shift = 0U;
+  while ((1UL << shift) < maxGain)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->count = 0U;
+  S->shift = shift;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer, two resonator states per bin */
+  memset(pState, 0, 2U * numBins * sizeof(q31_t));
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Goertzel group
+ */
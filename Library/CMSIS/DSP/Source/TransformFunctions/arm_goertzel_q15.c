@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q15.c
+ * Description:  Q15 multi-bin Goertzel detector
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Detector
+
+  Power of a few frequency bins over frames of N samples, for tone detection
+  (DTMF, mains harmonics) where a full FFT would compute bins nobody reads.
+
+  @par           Algorithm
+                   Every bin runs the second order resonator
+                   <pre>
+                   s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]
+                   </pre>
+                   over a frame of N samples, one multiply per sample. At the end of the frame
+                   <pre>
+                   X = s[N-1] - (cos(w) - j * sin(w)) * s[N-2]
+                   </pre>
+                   is the DFT of the frame at the frequency w, up to a phase, and w need not be
+                   a multiple of 2*pi/N.
+
+  @par           Processing
+                   One call runs any number of samples through all the bins of the instance. The
+                   samples of a call are processed bin by bin, so the two states of a resonator stay
+                   in registers, and the result is the same as with one sample per call. Every time
+                   a frame completes, the squared magnitude of each bin is written and the resonators
+                   restart from zero.
+
+  @par           Cost
+                   A frame costs numBins * N resonator steps, against N/2 * log2(N) butterflies for
+                   the FFT and a pass over the spectrum for the magnitudes. The detector is cheaper
+                   for a handful of bins and needs 8 bytes of RAM per bin.
+
+  @par           Fixed-Point Behavior
+                   The states are 32 bits wide and the input is scaled down by the initialization
+                   function so they stay below 2^29. The Q15 coefficients set the frequency to within
+                   2^-15 / sin(w) radians: near DC or Nyquist use the Q31 version.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/* s * c >> 14 for a state below 2^30 and a Q15 coefficient, with two 16 x 16
+   partial products */
+__STATIC_FORCEINLINE q31_t arm_goertzel_mul_q15(
+  q31_t s,
+  q31_t c)
+{
+  q31_t sh = s >> 16;
+  q31_t sl = (q31_t) ((uint32_t) s & 0xFFFFU);
+
+  return ((q31_t) ((uint32_t) (sh * c) << 2U) + ((sl * c) >> 14));
+}
+
+/**
+  @brief         Processing function for the Q15 multi-bin Goertzel detector.
+  @param[in,out] S          points to an instance of the Q15 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pPower     points to the squared magnitudes, numBins values per completed frame
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames completed by this call
+
+  @par           Scaling and Overflow Behavior
+                   The DFT of a frame is scaled down by <code>frameLen</code>, like the output of
+                   \ref arm_rfft_m23_q15(), and squared into 3.13 format as in \ref arm_cmplx_mag_squared_q15().
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_goertzel_q15(
+        arm_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pPower,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;
+        uint32_t frameLen = S->frameLen;
+        uint32_t shift = S->shift;
+  const q15_t *pCoeffs;
+  const q15_t *pIn;
+        q31_t *pState;
+        q31_t c, s0, s1, s2, xr, xi;
+        uint32_t n, i, blkCnt, frames = 0U;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the frame */
+    n = frameLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    for (i = 0U; i < numBins; i++)
+    {
+      c = pCoeffs[0];
+      s1 = pState[0];
+      s2 = pState[1];
+      pIn = pSrc;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+      /* Two samples per pass, the states swap roles instead of moving */
+      blkCnt = n >> 1U;
+      while (blkCnt > 0U)
+      {
+        s2 = (arm_goertzel_mul_q15(s1, c) - s2) + (((q31_t) ((uint32_t) *pIn++ << 14U)) >> shift);
+        s1 = (arm_goertzel_mul_q15(s2, c) - s1) + (((q31_t) ((uint32_t) *pIn++ << 14U)) >> shift);
+
+        blkCnt--;
+      }
+
+      blkCnt = n & 0x1U;
+
+#else
+
+      blkCnt = n;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+      while (blkCnt > 0U)
+      {
+        s0 = (arm_goertzel_mul_q15(s1, c) - s2) + (((q31_t) ((uint32_t) *pIn++ << 14U)) >> shift);
+        s2 = s1;
+        s1 = s0;
+
+        blkCnt--;
+      }
+
+      pState[0] = s1;
+      pState[1] = s2;
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count += (uint16_t) n;
+
+    if (S->count == frameLen)
+    {
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+
+      for (i = 0U; i < numBins; i++)
+      {
+        s1 = pState[0];
+        s2 = pState[1];
+
+        /* X = s[N-1] - conj(W) * s[N-2], at the scale of the states */
+        xr = s1 - (arm_goertzel_mul_q15(s2, pCoeffs[0]) >> 1);
+        xi = arm_goertzel_mul_q15(s2, pCoeffs[1]) >> 1;
+
+        /* X / N in Q15: the states hold X * 2^(14 - shift) */
+        if (shift >= 14U)
+        {
+          xr = (q31_t) ((uint32_t) xr << (shift - 14U)) / (q31_t) frameLen;
+          xi = (q31_t) ((uint32_t) xi << (shift - 14U)) / (q31_t) frameLen;
+        }
+        else
+        {
+          xr = xr / (q31_t) (frameLen << (14U - shift));
+          xi = xi / (q31_t) (frameLen << (14U - shift));
+        }
+
+        *pPower++ = (q15_t) (((uint32_t) (xr * xr) + (uint32_t) (xi * xi)) >> 17);
+
+        pState[0] = 0;
+        pState[1] = 0;
+        pCoeffs += 2U;
+        pState += 2U;
+      }
+
+      S->count = 0U;
+      frames++;
+    }
+  }
+
+  return (frames);
+}
+
+/**
+  @} end of Goertzel group
+ */
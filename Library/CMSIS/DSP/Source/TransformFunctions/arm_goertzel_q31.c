@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 multi-bin Goertzel detector
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/* s * c >> 30 for a state below 2^30 and a Q31 coefficient, 2 * cos(w) * s for c = cos(w) */
+__STATIC_FORCEINLINE q31_t arm_goertzel_mul_q31(
+  q31_t s,
+  q31_t c)
+{
+  return ((q31_t) ((uint32_t) mult_32x32_hi((q31_t) ((uint32_t) s << 1U), c) << 1U));
+}
+
+/**
+  @brief         Processing function for the Q31 multi-bin Goertzel detector.
+  @param[in,out] S          points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pPower     points to the squared magnitudes, numBins values per completed frame
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames completed by this call
+
+  @par           Scaling and Overflow Behavior
+                   The DFT of a frame is scaled down by <code>frameLen</code>, like the output of
+                   \ref arm_rfft_m23_q31(), and squared into 3.29 format as in \ref arm_cmplx_mag_squared_q31().
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pPower,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;
+        uint32_t frameLen = S->frameLen;
+        uint32_t shift = S->shift + 2U;
+  const q31_t *pCoeffs;
+  const q31_t *pIn;
+        q31_t *pState;
+        q31_t c, s0, s1, s2, xr, xi;
+        uint32_t n, i, blkCnt, frames = 0U;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the frame */
+    n = frameLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    for (i = 0U; i < numBins; i++)
+    {
+      c = pCoeffs[0];
+      s1 = pState[0];
+      s2 = pState[1];
+      pIn = pSrc;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+      /* Two samples per pass, the states swap roles instead of moving */
+      blkCnt = n >> 1U;
+      while (blkCnt > 0U)
+      {
+        s2 = (arm_goertzel_mul_q31(s1, c) - s2) + (*pIn++ >> shift);
+        s1 = (arm_goertzel_mul_q31(s2, c) - s1) + (*pIn++ >> shift);
+
+        blkCnt--;
+      }
+
+      blkCnt = n & 0x1U;
+
+#else
+
+      blkCnt = n;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+      while (blkCnt > 0U)
+      {
+        s0 = (arm_goertzel_mul_q31(s1, c) - s2) + (*pIn++ >> shift);
+        s2 = s1;
+        s1 = s0;
+
+        blkCnt--;
+      }
+
+      pState[0] = s1;
+      pState[1] = s2;
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count += (uint16_t) n;
+
+    if (S->count == frameLen)
+    {
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+
+      for (i = 0U; i < numBins; i++)
+      {
+        s1 = pState[0];
+        s2 = pState[1];
+
+        /* X = s[N-1] - conj(W) * s[N-2], at the scale of the states */
+        xr = s1 - (arm_goertzel_mul_q31(s2, pCoeffs[0]) >> 1);
+        xi = arm_goertzel_mul_q31(s2, pCoeffs[1]) >> 1;
+
+        /* X / N in Q31: the states hold X * 2^-shift. Once per frame, so a 64-bit division is fine */
+        xr = clip_q63_to_q31(((q63_t) xr * (1LL << shift)) / (q31_t) frameLen);
+        xi = clip_q63_to_q31(((q63_t) xi * (1LL << shift)) / (q31_t) frameLen);
+
+        *pPower++ = (mult_32x32_hi(xr, xr) >> 1) + (mult_32x32_hi(xi, xi) >> 1);
+
+        pState[0] = 0;
+        pState[1] = 0;
+        pCoeffs += 2U;
+        pState += 2U;
+      }
+
+      S->count = 0U;
+      frames++;
+    }
+  }
+
+  return (frames);
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,276 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_m23_q15.c
+ * Description:  In-place Q15 real FFT with packed output for cores without DSP extension
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup RealFFTM23 Real FFT for Cortex-M23
+
+  In-place Q15 and Q31 real FFT for Thumb-1 cores such as the Cortex-M23.
+  Unlike \ref arm_rfft_q15() it needs no output buffer twice the size of the
+  input: the N real samples are transformed in their own buffer.
+
+  @par           Algorithm
+                   The N real samples are read as N/2 complex samples, even samples in the real part
+                   and odd samples in the imaginary part, and transformed by the complex plan of length
+                   N/2 with \ref arm_cfft_m23_q15(). A split stage then builds the bins k and N/2 - k
+                   of the real transform from the bins k and N/2 - k of the complex one, so it works in
+                   place. The inverse transform runs the same steps backwards.
+
+  @par           Packed spectrum
+                   The spectrum of a real signal is conjugate symmetric, so only the bins 0 to N/2 are
+                   kept. Bins 0 and N/2 are real and share the first complex entry, as with
+                   \ref arm_rfft_fast_f32():
+                   <pre>
+                   pData[0]      = X[0]      (DC)
+                   pData[1]      = X[N/2]    (Nyquist)
+                   pData[2k]     = Re{X[k]}  k = 1 .. N/2 - 1
+                   pData[2k + 1] = Im{X[k]}
+                   </pre>
+
+  @par           Magnitude squared
+                   \ref arm_rfft_m23_mag_squared_q15() and \ref arm_rfft_m23_mag_squared_q31() write the
+                   squared magnitude of bins 0 to N/2 straight from the split stage, in the format of
+                   \ref arm_cmplx_mag_squared_q15() and \ref arm_cmplx_mag_squared_q31(), so a power
+                   spectrum takes no extra pass over the data.
+
+  @par           Plans
+                   The transform is described by a constant plan, <code>arm_rfft_plan_q15_lenN</code> or
+                   <code>arm_rfft_plan_q31_lenN</code> for N = 32 to 1024, declared in arm_const_structs.h.
+                   The split stage reads its twiddles from the table shared with the complex plans.
+ */
+
+/**
+  @addtogroup RealFFTM23
+  @{
+ */
+
+/* Bins k and N/2 - k of the real transform from bins a = Z[k] and b = Z[N/2 - k]
+   of the complex one, divided by 2. The products are at most 2^31 and are
+   scaled down by 4 before the sums */
+__STATIC_FORCEINLINE void arm_rfft_m23_split_pair_q15(
+  const q15_t * pA,
+  const q15_t * pB,
+        int32_t c,
+        int32_t s,
+        int32_t * pX)
+{
+  int32_t er, ei, odr, odi, tr, ti;
+
+  /* 2 * Xe, the transform of the even samples */
+  er = (int32_t) ((uint32_t) (pA[0] + pB[0]) << 13U);
+  ei = (int32_t) ((uint32_t) (pA[1] - pB[1]) << 13U);
+
+  /* 2 * Xo, the transform of the odd samples */
+  odr = pA[1] + pB[1];
+  odi = pB[0] - pA[0];
+
+  /* W^k * 2 * Xo, W = cos - j sin */
+  tr = ((c * odr) >> 2) + ((s * odi) >> 2);
+  ti = ((c * odi) >> 2) - ((s * odr) >> 2);
+
+  /* X[k] = (Xe + W^k Xo) / 2, X[N/2 - k] = conj(Xe - W^k Xo) / 2 */
+  pX[0] = (er + tr + 0x4000) >> 15;
+  pX[1] = (ei + ti + 0x4000) >> 15;
+  pX[2] = (er - tr + 0x4000) >> 15;
+  pX[3] = (ti - ei + 0x4000) >> 15;
+}
+
+/* Split stage of the forward transform, the packed spectrum replaces Z */
+static void arm_rfft_m23_split_q15(
+  const arm_rfft_plan_q15 * P,
+        q15_t * pData)
+{
+        uint32_t n = P->fftLenReal >> 1U;              /* length of the complex transform */
+        uint32_t k;
+  const q15_t *pW = P->pTwiddle;
+        q15_t *pA = pData + 2U;
+        q15_t *pB = pData + 2U * n - 2U;
+        int32_t aX[4], zr, zi;
+
+  for (k = 1U; k < (n >> 1U); k++)
+  {
+    pW += 2U * P->twidStride;
+    arm_rfft_m23_split_pair_q15(pA, pB, pW[0], pW[1], aX);
+
+    pA[0] = (q15_t) aX[0];
+    pA[1] = (q15_t) aX[1];
+    pB[0] = (q15_t) aX[2];
+    pB[1] = (q15_t) aX[3];
+    pA += 2U;
+    pB -= 2U;
+  }
+
+  /* Bin N/4 pairs with itself: X = conj(Z) / 2 */
+  zr = pA[0];
+  zi = pA[1];
+  pA[0] = (q15_t) ((zr + 1) >> 1);
+  pA[1] = (q15_t) ((1 - zi) >> 1);
+
+  /* DC and Nyquist, both real */
+  zr = pData[0];
+  zi = pData[1];
+  pData[0] = (q15_t) ((zr + zi + 1) >> 1);
+  pData[1] = (q15_t) ((zr - zi + 1) >> 1);
+}
+
+/* Split stage of the inverse transform, the complex spectrum Z replaces the packed one */
+static void arm_rfft_m23_split_inv_q15(
+  const arm_rfft_plan_q15 * P,
+        q15_t * pData)
+{
+        uint32_t n = P->fftLenReal >> 1U;
+        uint32_t k;
+  const q15_t *pW = P->pTwiddle;
+        q15_t *pA = pData + 2U;
+        q15_t *pB = pData + 2U * n - 2U;
+        int32_t c, s, er, ei, dr, di, tr, ti, yr, yi;
+
+  for (k = 1U; k < (n >> 1U); k++)
+  {
+    pW += 2U * P->twidStride;
+    c = pW[0];
+    s = pW[1];
+
+    /* 2 * Xe and 2 * Xo * W^k from X[k] and X[N/2 - k] */
+    er = (int32_t) ((uint32_t) (pA[0] + pB[0]) << 13U);
+    ei = (int32_t) ((uint32_t) (pA[1] - pB[1]) << 13U);
+    dr = pA[0] - pB[0];
+    di = pA[1] + pB[1];
+
+    /* 2 * Xo = (X[k] - conj(X[N/2 - k])) * conj(W^k) */
+    tr = ((c * dr) >> 2) - ((s * di) >> 2);
+    ti = ((s * dr) >> 2) + ((c * di) >> 2);
+
+    /* Z[k] = Xe + j Xo, Z[N/2 - k] = conj(Xe) + j conj(Xo) */
+    yr = er - ti;
+    yi = ei + tr;
+    pA[0] = (q15_t) ((yr + 0x2000) >> 14);
+    pA[1] = (q15_t) ((yi + 0x2000) >> 14);
+    yr = er + ti;
+    yi = tr - ei;
+    pB[0] = (q15_t) ((yr + 0x2000) >> 14);
+    pB[1] = (q15_t) ((yi + 0x2000) >> 14);
+    pA += 2U;
+    pB -= 2U;
+  }
+
+  /* Bin N/4: Z = conj(X) */
+  pA[1] = (q15_t) -pA[1];
+
+  /* Z[0] from DC and Nyquist */
+  yr = pData[0];
+  yi = pData[1];
+  pData[0] = (q15_t) ((yr + yi + 1) >> 1);
+  pData[1] = (q15_t) ((yr - yi + 1) >> 1);
+}
+
+/**
+  @brief         Processing function for the in-place Q15 real FFT on a constant plan.
+  @param[in]     P          points to a constant plan, arm_rfft_plan_q15_lenN
+  @param[in,out] pData      points to the buffer of <code>fftLenReal</code> samples. Processing occurs in-place
+  @param[in]     ifftFlag   flag that selects transform direction
+                   - value = 0: forward transform, real samples in and packed spectrum out
+                   - value = 1: inverse transform, packed spectrum in and real samples out
+
+  @par           Scaling and Overflow Behavior
+                   The forward transform is scaled down by <code>fftLenReal</code>, like \ref arm_rfft_q15().
+                   The inverse transform of the forward output returns the input divided by
+                   <code>fftLenReal</code>. The input of the inverse transform must be the spectrum of
+                   a real signal, as the forward transform returns it.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_m23_q15(
+  const arm_rfft_plan_q15 * P,
+        q15_t * pData,
+        uint8_t ifftFlag)
+{
+  if (ifftFlag == 1U)
+  {
+    arm_rfft_m23_split_inv_q15(P, pData);
+    arm_cfft_m23_q15(P->pCfft, pData, 1U, 1U);
+  }
+  else
+  {
+    arm_cfft_m23_q15(P->pCfft, pData, 0U, 1U);
+    arm_rfft_m23_split_q15(P, pData);
+  }
+}
+
+/**
+  @brief         Squared magnitude of the Q15 real FFT on a constant plan.
+  @param[in]     P          points to a constant plan, arm_rfft_plan_q15_lenN
+  @param[in,out] pData      points to the buffer of <code>fftLenReal</code> real samples, used as work buffer
+  @param[out]    pMag       points to the <code>fftLenReal/2 + 1</code> squared magnitudes of bins 0 to N/2
+
+  @par           Scaling and Overflow Behavior
+                   The spectrum is scaled down by <code>fftLenReal</code> as in \ref arm_rfft_m23_q15()
+                   and squared into 3.13 format as in \ref arm_cmplx_mag_squared_q15().
+                   On return pData holds the spectrum of the complex transform, not the packed one.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_m23_mag_squared_q15(
+  const arm_rfft_plan_q15 * P,
+        q15_t * pData,
+        q15_t * pMag)
+{
+        uint32_t n = P->fftLenReal >> 1U;
+        uint32_t k;
+  const q15_t *pW = P->pTwiddle;
+  const q15_t *pA = pData + 2U;
+  const q15_t *pB = pData + 2U * n - 2U;
+        int32_t aX[4], zr, zi;
+
+  arm_cfft_m23_q15(P->pCfft, pData, 0U, 1U);
+
+  for (k = 1U; k < (n >> 1U); k++)
+  {
+    pW += 2U * P->twidStride;
+    arm_rfft_m23_split_pair_q15(pA, pB, pW[0], pW[1], aX);
+
+    pMag[k]     = (q15_t) (((uint32_t) (aX[0] * aX[0]) + (uint32_t) (aX[1] * aX[1])) >> 17);
+    pMag[n - k] = (q15_t) (((uint32_t) (aX[2] * aX[2]) + (uint32_t) (aX[3] * aX[3])) >> 17);
+    pA += 2U;
+    pB -= 2U;
+  }
+
+  zr = (pA[0] + 1) >> 1;
+  zi = (1 - pA[1]) >> 1;
+  pMag[n >> 1U] = (q15_t) (((uint32_t) (zr * zr) + (uint32_t) (zi * zi)) >> 17);
+
+  zr = (pData[0] + pData[1] + 1) >> 1;
+  zi = (pData[0] - pData[1] + 1) >> 1;
+  pMag[0] = (q15_t) ((uint32_t) (zr * zr) >> 17);
+  pMag[n] = (q15_t) ((uint32_t) (zi * zi) >> 17);
+}
+
+/**
+  @} end of RealFFTM23 group
+ */
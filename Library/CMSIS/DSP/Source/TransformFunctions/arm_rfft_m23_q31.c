@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_m23_q31.c
+ * Description:  In-place Q31 real FFT with packed output for cores without DSP extension
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_m23_fft.h"
+
+/**
+  @addtogroup RealFFTM23
+  @{
+ */
+
+/* x * x >> 33, the 3.29 format of arm_cmplx_mag_squared_q31(). The square of |x| keeps
+   the partial products positive */
+__STATIC_FORCEINLINE q31_t arm_rfft_m23_square_q31(
+  q31_t x)
+{
+#if defined (ARM_MATH_NO_SMULL)
+  uint32_t u = (x < 0) ? (0U - (uint32_t) x) : (uint32_t) x;
+  uint32_t uh = u >> 16;
+  uint32_t ul = u & 0xFFFFU;
+
+  return ((q31_t) ((uh * uh + ((uh * ul + 0x4000U) >> 15)) >> 1));
+#else
+  return ((q31_t) (((q63_t) x * x) >> 33));
+#endif
+}
+
+/* Bins k and N/2 - k of the real transform from bins a = Z[k] and b = Z[N/2 - k]
+   of the complex one, divided by 2. The inputs are halved first so the sums
+   do not overflow */
+__STATIC_FORCEINLINE void arm_rfft_m23_split_pair_q31(
+  const q31_t * pA,
+  const q31_t * pB,
+        q31_t c,
+        q31_t s,
+        q31_t * pX)
+{
+  q31_t er, ei, odr, odi, tr, ti;
+
+  /* Xe, the transform of the even samples */
+  er = (pA[0] >> 1) + (pB[0] >> 1);
+  ei = (pA[1] >> 1) - (pB[1] >> 1);
+
+  /* Xo, the transform of the odd samples */
+  odr = (pA[1] >> 1) + (pB[1] >> 1);
+  odi = (pB[0] >> 1) - (pA[0] >> 1);
+
+  /* W^k * Xo / 2, W = cos - j sin */
+  tr = arm_cfft_m23_mul_q31(odr, c) + arm_cfft_m23_mul_q31(odi, s);
+  ti = arm_cfft_m23_mul_q31(odi, c) - arm_cfft_m23_mul_q31(odr, s);
+
+  /* X[k] = (Xe + W^k Xo) / 2, X[N/2 - k] = conj(Xe - W^k Xo) / 2 */
+  pX[0] = (er >> 1) + tr;
+  pX[1] = (ei >> 1) + ti;
+  pX[2] = (er >> 1) - tr;
+  pX[3] = ti - (ei >> 1);
+}
+
+/* Split stage of the forward transform, the packed spectrum replaces Z */
+static void arm_rfft_m23_split_q31(
+  const arm_rfft_plan_q31 * P,
+        q31_t * pData)
+{
+        uint32_t n = P->fftLenReal >> 1U;              /* length of the complex transform */
+        uint32_t k;
+  const q31_t *pW = P->pTwiddle;
+        q31_t *pA = pData + 2U;
+        q31_t *pB = pData + 2U * n - 2U;
+        q31_t aX[4], zr, zi;
+
+  for (k = 1U; k < (n >> 1U); k++)
+  {
+    pW += 2U * P->twidStride;
+    arm_rfft_m23_split_pair_q31(pA, pB, pW[0], pW[1], aX);
+
+    pA[0] = aX[0];
+    pA[1] = aX[1];
+    pB[0] = aX[2];
+    pB[1] = aX[3];
+    pA += 2U;
+    pB -= 2U;
+  }
+
+  /* Bin N/4 pairs with itself: X = conj(Z) / 2 */
+  pA[0] = pA[0] >> 1;
+  pA[1] = -(pA[1] >> 1);
+
+  /* DC and Nyquist, both real */
+  zr = pData[0] >> 1;
+  zi = pData[1] >> 1;
+  pData[0] = zr + zi;
+  pData[1] = zr - zi;
+}
+
+/* Split stage of the inverse transform, the complex spectrum Z replaces the packed one */
+static void arm_rfft_m23_split_inv_q31(
+  const arm_rfft_plan_q31 * P,
+        q31_t * pData)
+{
+        uint32_t n = P->fftLenReal >> 1U;
+        uint32_t k;
+  const q31_t *pW = P->pTwiddle;
+        q31_t *pA = pData + 2U;
+        q31_t *pB = pData + 2U * n - 2U;
+        q31_t c, s, er, ei, dr, di, tr, ti;
+
+  for (k = 1U; k < (n >> 1U); k++)
+  {
+    pW += 2U * P->twidStride;
+    c = pW[0];
+    s = pW[1];
+
+    /* Xe and Xo * W^k from X[k] and X[N/2 - k] */
+    er = (pA[0] >> 1) + (pB[0] >> 1);
+    ei = (pA[1] >> 1) - (pB[1] >> 1);
+    dr = (pA[0] >> 1) - (pB[0] >> 1);
+    di = (pA[1] >> 1) + (pB[1] >> 1);
+
+    /* Xo / 2 = (X[k] - conj(X[N/2 - k])) * conj(W^k) / 4 */
+    tr = arm_cfft_m23_mul_q31(dr, c) - arm_cfft_m23_mul_q31(di, s);
+    ti = arm_cfft_m23_mul_q31(dr, s) + arm_cfft_m23_mul_q31(di, c);
+    tr = (q31_t) ((uint32_t) tr << 1U);
+    ti = (q31_t) ((uint32_t) ti << 1U);
+
+    /* Z[k] = Xe + j Xo, Z[N/2 - k] = conj(Xe) + j conj(Xo) */
+    pA[0] = er - ti;
+    pA[1] = ei + tr;
+    pB[0] = er + ti;
+    pB[1] = tr - ei;
+    pA += 2U;
+    pB -= 2U;
+  }
+
+  /* Bin N/4: Z = conj(X) */
+  pA[1] = -pA[1];
+
+  /* Z[0] from DC and Nyquist */
+  er = pData[0] >> 1;
+  ei = pData[1] >> 1;
+  pData[0] = er + ei;
+  pData[1] = er - ei;
+}
+
+/**
+  @brief         Processing function for the in-place Q31 real FFT on a constant plan.
+  @param[in]     P          points to a constant plan, arm_rfft_plan_q31_lenN
+  @param[in,out] pData      points to the buffer of <code>fftLenReal</code> samples. Processing occurs in-place
+  @param[in]     ifftFlag   flag that selects transform direction
+                   - value = 0: forward transform, real samples in and packed spectrum out
+                   - value = 1: inverse transform, packed spectrum in and real samples out
+
+  @par           Scaling and Overflow Behavior
+                   The forward transform is scaled down by <code>fftLenReal</code>, like \ref arm_rfft_q31().
+                   The inverse transform of the forward output returns the input divided by
+                   <code>fftLenReal</code>. The input of the inverse transform must be the spectrum of
+                   a real signal, as the forward transform returns it.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_m23_q31(
+  const arm_rfft_plan_q31 * P,
+        q31_t * pData,
+        uint8_t ifftFlag)
+{
+  if (ifftFlag == 1U)
+  {
+    arm_rfft_m23_split_inv_q31(P, pData);
+    arm_cfft_m23_q31(P->pCfft, pData, 1U, 1U);
+  }
+  else
+  {
+    arm_cfft_m23_q31(P->pCfft, pData, 0U, 1U);
+    arm_rfft_m23_split_q31(P, pData);
+  }
+}
+
+/**
+  @brief         Squared magnitude of the Q31 real FFT on a constant plan.
+  @param[in]     P          points to a constant plan, arm_rfft_plan_q31_lenN
+  @param[in,out] pData      points to the buffer of <code>fftLenReal</code> real samples, used as work buffer
+  @param[out]    pMag       points to the <code>fftLenReal/2 + 1</code> squared magnitudes of bins 0 to N/2
+
+  @par           Scaling and Overflow Behavior
+                   The spectrum is scaled down by <code>fftLenReal</code> as in \ref arm_rfft_m23_q31()
+                   and squared into 3.29 format as in \ref arm_cmplx_mag_squared_q31().
+                   On return pData holds the spectrum of the complex transform, not the packed one.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_m23_mag_squared_q31(
+  const arm_rfft_plan_q31 * P,
+        q31_t * pData,
+        q31_t * pMag)
+{
+        uint32_t n = P->fftLenReal >> 1U;
+        uint32_t k;
+  const q31_t *pW = P->pTwiddle;
+  const q31_t *pA = pData + 2U;
+  const q31_t *pB = pData + 2U * n - 2U;
+        q31_t aX[4], zr, zi;
+
+  arm_cfft_m23_q31(P->pCfft, pData, 0U, 1U);
+
+  for (k = 1U; k < (n >> 1U); k++)
+  {
+    pW += 2U * P->twidStride;
+    arm_rfft_m23_split_pair_q31(pA, pB, pW[0], pW[1], aX);
+
+    pMag[k]     = arm_rfft_m23_square_q31(aX[0]) + arm_rfft_m23_square_q31(aX[1]);
+    pMag[n - k] = arm_rfft_m23_square_q31(aX[2]) + arm_rfft_m23_square_q31(aX[3]);
+    pA += 2U;
+    pB -= 2U;
+  }
+
+  zr = pA[0] >> 1;
+  zi = pA[1] >> 1;
+  pMag[n >> 1U] = arm_rfft_m23_square_q31(zr) + arm_rfft_m23_square_q31(zi);
+
+  zr = (pData[0] >> 1) + (pData[1] >> 1);
+  zi = (pData[0] >> 1) - (pData[1] >> 1);
+  pMag[0] = arm_rfft_m23_square_q31(zr);
+  pMag[n] = arm_rfft_m23_square_q31(zi);
+}
+
+/**
+  @} end of RealFFTM23 group
+ */
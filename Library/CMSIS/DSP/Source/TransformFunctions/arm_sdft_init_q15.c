@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q15.c
+ * Description:  Initialization function for the Q15 multi-bin sliding DFT
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 multi-bin sliding DFT.
+  @param[in,out] S          points to an instance of the Q15 sliding DFT structure
+  @param[in]     numBins    number of tracked bins
+  @param[in]     frameLen   length of the sliding window, a power of 2 from 2 to 4096
+  @param[in]     pBins      points to the bin indexes, 0 <= k < frameLen
+  @param[in]     pTwiddle   points to a table of {cos, sin} pairs of the angles 2*pi*m/frameLen, m < frameLen/2
+  @param[in]     twidStride step through pTwiddle from one angle to the next
+  @param[in]     pDelay     points to the window buffer of frameLen samples
+  @param[in]     pState     points to the state buffer of 2*numBins values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code>, <code>frameLen</code> or a bin is out of range
+
+  @par           Details
+                   The shared table of the Cortex-M23 FFT plans holds the twiddles: pass
+                   <code>arm_cfft_plan_q15_lenN.pTwiddle</code> and <code>arm_cfft_plan_q15_lenN.twidStride</code>
+                   for N = frameLen, no plan needs to run.
+  @par
+                   The window and the accumulators start from zero, so the bins build up over the
+                   first frameLen samples.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_sdft_init_q15(
+        arm_sdft_instance_q15 * S,
+        uint16_t numBins,
+        uint16_t frameLen,
+  const uint16_t * pBins,
+  const q15_t * pTwiddle,
+        uint16_t twidStride,
+        q15_t * pDelay,
+        q31_t * pState)
+{
+  uint32_t i;
+  uint8_t log2Len;
+
+  if ((numBins == 0U) || (frameLen < 2U) || (frameLen > 4096U) || ((frameLen & (frameLen - 1U)) != 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    if (pBins[i] >= frameLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  log2Len = 0U;
+  while ((1UL << log2Len) < frameLen)
+  {
+    log2Len++;
+  }
+
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->index = 0U;
+  S->twidStride = twidStride;
+  S->log2Len = log2Len;
+  S->pBins = pBins;
+  S->pTwiddle = pTwiddle;
+
+  /* Clear the window and the accumulators */
+  memset(pDelay, 0, frameLen * sizeof(q15_t));
+  S->pDelay = pDelay;
+  memset(pState, 0, 2U * numBins * sizeof(q31_t));
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q15.c
+ * Description:  Q15 multi-bin sliding DFT
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SlidingDFT Sliding DFT
+
+  DFT of a few bins over the last N samples, updated at every sample, for tone
+  tracking where the \ref Goertzel "Goertzel detector" would wait for the end
+  of a frame.
+
+  @par           Algorithm
+                   The modulated sliding DFT keeps, for every bin k, the sum
+                   <pre>
+                   Y[n] = Y[n-1] + (x[n] - x[n-N]) * W^(-k*n)
+                   </pre>
+                   with W = exp(-j*2*pi/N). Y[n] is the DFT of the last N samples turned by the phase
+                   W^(-k*(n+1)), so it has the magnitude of the DFT. The sample leaving the window is
+                   multiplied by the same twiddle as when it entered and both products are rounded the
+                   same way, so it is removed exactly: unlike the recursive sliding DFT, the rounding
+                   errors do not build up and no damping is needed.
+
+  @par           Processing
+                   One call runs any number of samples through all the bins of the instance, and
+                   \ref arm_sdft_power_q15() or \ref arm_sdft_power_q31() reads the squared magnitudes
+                   of the window at any time. The samples of a call are processed bin by bin, so the
+                   accumulators stay in registers, and the result is the same as with one sample per call.
+
+  @par           Cost
+                   A sample costs numBins complex multiplies by the entering and the leaving sample, and
+                   the window of N samples is the only large buffer. The twiddles are read from the table
+                   shared with the Cortex-M23 FFT plans. The bins must be integers.
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 multi-bin sliding DFT.
+  @param[in,out] S          points to an instance of the Q15 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+ */
+ARM_DSP_ATTRIBUTE void arm_sdft_q15(
+        arm_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;
+        uint32_t mask = S->frameLen - 1U;
+        uint32_t half = S->frameLen >> 1U;
+        uint32_t step = 2U * S->twidStride;
+        uint32_t log2Len = S->log2Len;
+  const q15_t *pIn;
+  const q15_t *pOld;
+  const q15_t *pW;
+        q31_t *pState;
+        q31_t accR, accI, c, s, xn, xo;
+        uint32_t n, i, k, m, blkCnt;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the window buffer */
+    n = S->frameLen - S->index;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pState = S->pState;
+
+    for (i = 0U; i < numBins; i++)
+    {
+      k = S->pBins[i];
+      m = (k * S->index) & mask;
+      accR = pState[0];
+      accI = pState[1];
+      pIn = pSrc;
+      pOld = S->pDelay + S->index;
+
+      blkCnt = n;
+      while (blkCnt > 0U)
+      {
+        /* W^(-m) = cos + j sin of 2*pi*m/N, the second half of the circle is the first one negated */
+        pW = S->pTwiddle + (m & (half - 1U)) * step;
+        c = pW[0];
+        s = pW[1];
+        if ((m & half) != 0U)
+        {
+          c = -c;
+          s = -s;
+        }
+
+        xn = *pIn++;
+        xo = *pOld++;
+
+        /* Add the entering sample and remove the leaving one, both rounded alike */
+        accR += ((xn * c) >> log2Len) - ((xo * c) >> log2Len);
+        accI += ((xn * s) >> log2Len) - ((xo * s) >> log2Len);
+
+        m = (m + k) & mask;
+        blkCnt--;
+      }
+
+      pState[0] = accR;
+      pState[1] = accI;
+      pState += 2U;
+    }
+
+    /* The block replaces the samples it pushed out of the window */
+    memcpy(S->pDelay + S->index, pSrc, n * sizeof(q15_t));
+    S->index = (uint16_t) ((S->index + n) & mask);
+    pSrc += n;
+    blockSize -= n;
+  }
+}
+
+/**
+  @brief         Squared magnitudes of the Q15 sliding DFT.
+  @param[in]     S          points to an instance of the Q15 sliding DFT structure
+  @param[out]    pPower     points to the numBins squared magnitudes
+
+  @par           Scaling and Overflow Behavior
+                   The DFT of the window is scaled down by <code>frameLen</code>, like the output of
+                   \ref arm_rfft_m23_q15(), and squared into 3.13 format as in \ref arm_cmplx_mag_squared_q15().
+ */
+ARM_DSP_ATTRIBUTE void arm_sdft_power_q15(
+  const arm_sdft_instance_q15 * S,
+        q15_t * pPower)
+{
+  const q31_t *pState = S->pState;
+        q31_t xr, xi;
+        uint32_t i;
+
+  for (i = 0U; i < S->numBins; i++)
+  {
+    /* The accumulators hold X / N in Q30 */
+    xr = (pState[0] + 0x4000) >> 15;
+    xi = (pState[1] + 0x4000) >> 15;
+    pState += 2U;
+
+    *pPower++ = (q15_t) (((uint32_t) (xr * xr) + (uint32_t) (xi * xi)) >> 17);
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 multi-bin sliding DFT
+ *
+ * $Date:        17 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 multi-bin sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+ */
+ARM_DSP_ATTRIBUTE void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;
+        uint32_t mask = S->frameLen - 1U;
+        uint32_t half = S->frameLen >> 1U;
+        uint32_t step = 2U * S->twidStride;
+  const q31_t *pIn;
+  const q31_t *pOld;
+  const q31_t *pW;
+        q63_t *pState;
+        q63_t accR, accI;
+        q31_t c, s, xn, xo;
+        uint32_t n, i, k, m, blkCnt;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the window buffer */
+    n = S->frameLen - S->index;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pState = S->pState;
+
+    for (i = 0U; i < numBins; i++)
+    {
+      k = S->pBins[i];
+      m = (k * S->index) & mask;
+      accR = pState[0];
+      accI = pState[1];
+      pIn = pSrc;
+      pOld = S->pDelay + S->index;
+
+      blkCnt = n;
+      while (blkCnt > 0U)
+      {
+        /* W^(-m) = cos + j sin of 2*pi*m/N, the second half of the circle is the first one negated */
+        pW = S->pTwiddle + (m & (half - 1U)) * step;
+        c = pW[0];
+        s = pW[1];
+        if ((m & half) != 0U)
+        {
+          c = -c;
+          s = -s;
+        }
+
+        xn = *pIn++;
+        xo = *pOld++;
+
+        /* Add the entering sample and remove the leaving one, both rounded alike */
+        accR += mult_32x32_hi(xn, c) - mult_32x32_hi(xo, c);
+        accI += mult_32x32_hi(xn, s) - mult_32x32_hi(xo, s);
+
+        m = (m + k) & mask;
+        blkCnt--;
+      }
+
+      pState[0] = accR;
+      pState[1] = accI;
+      pState += 2U;
+    }
+
+    /* The block replaces the samples it pushed out of the window */
+    memcpy(S->pDelay + S->index, pSrc, n * sizeof(q31_t));
+    S->index = (uint16_t) ((S->index + n) & mask);
+    pSrc += n;
+    blockSize -= n;
+  }
+}
+
+/**
+  @brief         Squared magnitudes of the Q31 sliding DFT.
+  @param[in]     S          points to an instance of the Q31 sliding DFT structure
+  @param[out]    pPower     points to the numBins squared magnitudes
+
+  @par           Scaling and Overflow Behavior
+                   The DFT of the window is scaled down by <code>frameLen</code>, like the output of
+                   \ref arm_rfft_m23_q31(), and squared into 3.29 format as in \ref arm_cmplx_mag_squared_q31().
+ */
+ARM_DSP_ATTRIBUTE void arm_sdft_power_q31(
+  const arm_sdft_instance_q31 * S,
+        q31_t * pPower)
+{
+  const q63_t *pState = S->pState;
+        uint32_t shift = S->log2Len - 1U;
+        q31_t xr, xi;
+        uint32_t i;
+
+  for (i = 0U; i < S->numBins; i++)
+  {
+    /* The accumulators hold X in Q30, X / N in Q31 is 2 * X / N */
+    xr = clip_q63_to_q31((pState[0] + ((1LL << shift) >> 1)) >> shift);
+    xi = clip_q63_to_q31((pState[1] + ((1LL << shift) >> 1)) >> shift);
+    pState += 2U;
+
+    *pPower++ = (mult_32x32_hi(xr, xr) >> 1) + (mult_32x32_hi(xi, xi) >> 1);
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -55,5 +55,9 @@ if (DISABLEFLOAT16)
     target_compile_definitions(${project} PRIVATE DISABLEFLOAT16) 
 endif()
 
+if (APPFFTTABLES)
+    target_compile_definitions(${project} PRIVATE ARM_DSP_APP_FFT_TABLES)
+endif()
+
 
 endfunction()
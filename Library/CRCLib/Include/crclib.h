@@ -0,0 +1,100 @@
+/**************************************************************************//**
+ * @file     crclib.h
+ * @version  V1.00
+ * @brief    Table-driven software CRC library header file
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __CRCLIB_H
+#define __CRCLIB_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef CRCLIB_HOST
+#include <stdint.h>
+#else
+#include "NuMicro.h"
+#endif
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup CRCLIB Software CRC Library
+  @{
+*/
+
+/** @addtogroup CRCLIB_EXPORTED_CONSTANTS Software CRC Library Exported Constants
+  @{
+*/
+
+/**
+  * @details    Lookup tables per byte step, selects the flash used by the tables of the 4 modes:
+  *             0 = bitwise, only the 256 bytes bit reverse table.
+  *             1 = one 256-entry table per mode, 2.5 KB with the bit reverse table.
+  *             4 = slicing-by-4, four 256-entry tables per mode, 9.3 KB with the bit reverse table.
+  */
+#ifndef CRCLIB_SLICES
+#define CRCLIB_SLICES           4
+#endif
+
+#if (CRCLIB_SLICES != 0) && (CRCLIB_SLICES != 1) && (CRCLIB_SLICES != 4)
+#error "CRCLIB_SLICES must be 0, 1 or 4"
+#endif
+
+#ifdef CRCLIB_HOST
+/* Same values as the CRC driver constants, so the modes and attributes of CRC_Open() are shared */
+#define CRC_CCITT               (0UL << 30)     /*!< CRC Polynomial Mode - CCITT */
+#define CRC_8                   (1UL << 30)     /*!< CRC Polynomial Mode - CRC8 */
+#define CRC_16                  (2UL << 30)     /*!< CRC Polynomial Mode - CRC16 */
+#define CRC_32                  (3UL << 30)     /*!< CRC Polynomial Mode - CRC32 */
+#define CRC_CHECKSUM_COM        (1UL << 27)     /*!< CRC Checksum Complement */
+#define CRC_CHECKSUM_RVS        (1UL << 25)     /*!< CRC Checksum Reverse */
+#define CRC_WDATA_COM           (1UL << 26)     /*!< CRC Write Data Complement */
+#define CRC_WDATA_RVS           (1UL << 24)     /*!< CRC Write Data Reverse */
+#endif
+
+/** @} end of group CRCLIB_EXPORTED_CONSTANTS */
+
+
+/** @addtogroup CRCLIB_EXPORTED_STRUCTS Software CRC Library Exported Structs
+  @{
+*/
+
+/**
+  * @details    Software CRC stream. u32State is the raw CRC state before checksum reverse and complement,
+  *             the same as CRC_CONTEXT_T::u32State of the CRC driver, so a stream can move between the CRC
+  *             controller and the software implementation.
+  */
+typedef struct
+{
+    uint32_t u32Mode;           /*!< \ref CRC_CCITT, \ref CRC_8, \ref CRC_16 or \ref CRC_32 */
+    uint32_t u32Attribute;      /*!< Combination of \ref CRC_CHECKSUM_COM, \ref CRC_CHECKSUM_RVS, \ref CRC_WDATA_COM and \ref CRC_WDATA_RVS */
+    uint32_t u32State;          /*!< Raw CRC state */
+} CRCLIB_T;
+
+/** @} end of group CRCLIB_EXPORTED_STRUCTS */
+
+
+/** @addtogroup CRCLIB_EXPORTED_FUNCTIONS Software CRC Library Exported Functions
+  @{
+*/
+
+void     CRCLIB_Open(CRCLIB_T *psCrc, uint32_t u32Mode, uint32_t u32Attribute, uint32_t u32Seed);
+void     CRCLIB_Update(CRCLIB_T *psCrc, const void *pvBuf, uint32_t u32Len);
+uint32_t CRCLIB_GetChecksum(const CRCLIB_T *psCrc);
+
+/** @} end of group CRCLIB_EXPORTED_FUNCTIONS */
+/** @} end of group CRCLIB */
+/** @} end of group Library */
+
+#ifdef __cplusplus
+}
+
+#endif
+
+#endif  /* __CRCLIB_H */
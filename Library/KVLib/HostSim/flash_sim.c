@@ -0,0 +1,265 @@
+/**************************************************************************//**
+ * @file     flash_sim.c
+ * @version  V1.00
+ * @brief    Host-side Data Flash simulator for the key/value store library
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include <stdint.h>
+
+#include "flash_sim.h"
+
+#define FLASH_SIM_PAGE_NUM      (FLASH_SIM_SIZE / FMC_FLASH_PAGE_SIZE)
+
+int32_t g_FMC_i32ErrCode;
+
+static uint8_t s_au8Flash[FLASH_SIM_SIZE];
+static uint32_t s_au32EraseCount[FLASH_SIM_PAGE_NUM];
+static uint32_t s_u32ProgramCount;
+static uint32_t s_u32OpsLeft;           /* Flash operations before power loss, 0 to disable */
+static uint32_t s_u32PowerLost;
+static uint32_t s_u32Seed = 1;
+
+static uint32_t FlashSim_Rand(void)
+{
+    s_u32Seed = s_u32Seed * 1103515245UL + 12345UL;
+    return s_u32Seed >> 8;
+}
+
+static int32_t FlashSim_IsValid(uint32_t u32Addr, uint32_t u32Len)
+{
+    return (u32Addr >= FLASH_SIM_BASE) && (u32Addr - FLASH_SIM_BASE <= FLASH_SIM_SIZE - u32Len);
+}
+
+/* Return 1 if the operation must be torn by the power loss */
+static int32_t FlashSim_Tick(void)
+{
+    if ((s_u32OpsLeft != 0) && (--s_u32OpsLeft == 0))
+    {
+        s_u32PowerLost = 1;
+        return 1;
+    }
+
+    return 0;
+}
+
+static void FlashSim_Program(uint32_t u32Addr, uint32_t u32Data, int32_t i32Torn)
+{
+    uint32_t u32Old;
+    uint8_t *pu8 = &s_au8Flash[u32Addr - FLASH_SIM_BASE];
+
+    memcpy(&u32Old, pu8, 4);
+
+    /* A torn program clears only part of the bits */
+    if (i32Torn)
+        u32Data |= FlashSim_Rand();
+
+    u32Old &= u32Data;
+    memcpy(pu8, &u32Old, 4);
+    s_u32ProgramCount++;
+}
+
+/**
+ *  @brief  Erase a simulated flash page. A torn erase leaves random words of the page programmed.
+ */
+int32_t FMC_Erase(uint32_t u32PageAddr)
+{
+    uint32_t i;
+    uint8_t *pu8Page;
+
+    g_FMC_i32ErrCode = 0;
+
+    if (s_u32PowerLost || !FlashSim_IsValid(u32PageAddr, FMC_FLASH_PAGE_SIZE) ||
+            (u32PageAddr & (FMC_FLASH_PAGE_SIZE - 1UL)))
+    {
+        g_FMC_i32ErrCode = -1;
+        return -1;
+    }
+
+    pu8Page = &s_au8Flash[u32PageAddr - FLASH_SIM_BASE];
+
+    if (FlashSim_Tick())
+    {
+        for (i = 0; i < FMC_FLASH_PAGE_SIZE; i += 4)
+        {
+            if (FlashSim_Rand() & 1UL)
+                memset(&pu8Page[i], 0xFF, 4);
+        }
+
+        g_FMC_i32ErrCode = -1;
+        return -1;
+    }
+
+    memset(pu8Page, 0xFF, FMC_FLASH_PAGE_SIZE);
+    s_au32EraseCount[(u32PageAddr - FLASH_SIM_BASE) / FMC_FLASH_PAGE_SIZE]++;
+    return 0;
+}
+
+/**
+ *  @brief  Read a word of the simulated flash.
+ */
+uint32_t FMC_Read(uint32_t u32Addr)
+{
+    uint32_t u32Data;
+
+    g_FMC_i32ErrCode = 0;
+
+    if (!FlashSim_IsValid(u32Addr, 4) || (u32Addr & 3UL))
+    {
+        g_FMC_i32ErrCode = -1;
+        return 0xFFFFFFFF;
+    }
+
+    memcpy(&u32Data, &s_au8Flash[u32Addr - FLASH_SIM_BASE], 4);
+    return u32Data;
+}
+
+/**
+ *  @brief  Simulated Data Flash base address.
+ */
+uint32_t FMC_ReadDataFlashBaseAddr(void)
+{
+    return FLASH_SIM_BASE;
+}
+
+/**
+ *  @brief  Program a word of the simulated flash.
+ */
+int32_t FMC_Write(uint32_t u32Addr, uint32_t u32Data)
+{
+    int32_t i32Torn;
+
+    g_FMC_i32ErrCode = 0;
+
+    if (s_u32PowerLost || !FlashSim_IsValid(u32Addr, 4) || (u32Addr & 3UL))
+    {
+        g_FMC_i32ErrCode = -1;
+        return -1;
+    }
+
+    i32Torn = FlashSim_Tick();
+    FlashSim_Program(u32Addr, u32Data, i32Torn);
+
+    if (i32Torn)
+    {
+        g_FMC_i32ErrCode = -1;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ *  @brief  Program a multi-word block of the simulated flash.
+ *  @details Like the FMC driver, a full FMC_MULTI_WORD_PROG_LEN block is programmed whatever u32Len is.
+ */
+int32_t FMC_WriteMultiple(uint32_t u32Addr, uint32_t pu32Buf[], uint32_t u32Len)
+{
+    uint32_t i;
+    int32_t i32Torn;
+
+    (void)u32Len;
+    g_FMC_i32ErrCode = 0;
+
+    if (s_u32PowerLost || !FlashSim_IsValid(u32Addr, FMC_MULTI_WORD_PROG_LEN) || (u32Addr & 7UL))
+    {
+        g_FMC_i32ErrCode = -2;
+        return -2;
+    }
+
+    for (i = 0; i < FMC_MULTI_WORD_PROG_LEN / 4; i++)
+    {
+        i32Torn = FlashSim_Tick();
+        FlashSim_Program(u32Addr + i * 4, pu32Buf[i], i32Torn);
+
+        if (i32Torn)
+        {
+            g_FMC_i32ErrCode = -1;
+            return -1;
+        }
+    }
+
+    return FMC_MULTI_WORD_PROG_LEN;
+}
+
+/**
+ *  @brief  Pointer to the simulated flash content, used by the library for memory mapped reads.
+ */
+const uint8_t *FlashSim_Ptr(uint32_t u32Addr)
+{
+    return &s_au8Flash[u32Addr - FLASH_SIM_BASE];
+}
+
+/**
+ *  @brief  Erase the whole simulated flash and clear the statistics.
+ */
+void FlashSim_Reset(void)
+{
+    memset(s_au8Flash, 0xFF, sizeof(s_au8Flash));
+    memset(s_au32EraseCount, 0, sizeof(s_au32EraseCount));
+    s_u32ProgramCount = 0;
+    s_u32OpsLeft = 0;
+    s_u32PowerLost = 0;
+}
+
+/**
+ *  @brief  Lose power during the u32OpCount-th next word program or page erase.
+ *  @details The operation is torn and every later operation fails until FlashSim_PowerOn().
+ *           0 disables the power loss.
+ */
+void FlashSim_SetPowerLoss(uint32_t u32OpCount, uint32_t u32Seed)
+{
+    s_u32OpsLeft = u32OpCount;
+    s_u32Seed = u32Seed;
+}
+
+/**
+ *  @brief  Return 1 after the injected power loss occurred.
+ */
+uint32_t FlashSim_IsPowerLost(void)
+{
+    return s_u32PowerLost;
+}
+
+/**
+ *  @brief  Restore power. The flash content is kept, the store must be mounted again.
+ */
+void FlashSim_PowerOn(void)
+{
+    s_u32PowerLost = 0;
+    s_u32OpsLeft = 0;
+}
+
+/**
+ *  @brief  Number of erases of the page at u32PageAddr.
+ */
+uint32_t FlashSim_GetEraseCount(uint32_t u32PageAddr)
+{
+    return s_au32EraseCount[(u32PageAddr - FLASH_SIM_BASE) / FMC_FLASH_PAGE_SIZE];
+}
+
+/**
+ *  @brief  Number of programmed words.
+ */
+uint32_t FlashSim_GetProgramCount(void)
+{
+    return s_u32ProgramCount;
+}
+
+/**
+ *  @brief  Copy the simulated flash content, FLASH_SIM_SIZE bytes, to pu8Buf.
+ */
+void FlashSim_Save(uint8_t *pu8Buf)
+{
+    memcpy(pu8Buf, s_au8Flash, sizeof(s_au8Flash));
+}
+
+/**
+ *  @brief  Restore a flash content saved by FlashSim_Save(), to replay an operation from the same state.
+ */
+void FlashSim_Load(const uint8_t *pu8Buf)
+{
+    memcpy(s_au8Flash, pu8Buf, sizeof(s_au8Flash));
+}
@@ -0,0 +1,58 @@
+/**************************************************************************//**
+ * @file     flash_sim.h
+ * @version  V1.00
+ * @brief    Host-side Data Flash simulator for the key/value store library
+ *
+ * @details
+ *           Build kvlib.c on the host with -DKVLIB_HOST_SIM and this directory
+ *           in the include path. The FMC functions used by the library are
+ *           replaced by a RAM image with NOR flash semantics: erase sets a page
+ *           to 0xFF and programming can only clear bits. Power loss can be
+ *           injected after a given number of flash operations.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __FLASH_SIM_H
+#define __FLASH_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#ifndef FLASH_SIM_BASE
+#define FLASH_SIM_BASE          0x0003E000UL    /*!< Simulated Data Flash base address */
+#endif
+#ifndef FLASH_SIM_SIZE
+#define FLASH_SIM_SIZE          0x2000UL        /*!< Simulated Data Flash size */
+#endif
+
+#define FMC_FLASH_PAGE_SIZE     0x200UL         /*!< Flash Page Size (512 bytes) */
+#define FMC_MULTI_WORD_PROG_LEN 128             /*!< The maximum length of a multi-word program. */
+
+extern int32_t g_FMC_i32ErrCode;
+
+int32_t  FMC_Erase(uint32_t u32PageAddr);
+uint32_t FMC_Read(uint32_t u32Addr);
+uint32_t FMC_ReadDataFlashBaseAddr(void);
+int32_t  FMC_Write(uint32_t u32Addr, uint32_t u32Data);
+int32_t  FMC_WriteMultiple(uint32_t u32Addr, uint32_t pu32Buf[], uint32_t u32Len);
+
+const uint8_t *FlashSim_Ptr(uint32_t u32Addr);
+void     FlashSim_Reset(void);
+void     FlashSim_SetPowerLoss(uint32_t u32OpCount, uint32_t u32Seed);
+uint32_t FlashSim_IsPowerLost(void);
+void     FlashSim_PowerOn(void);
+uint32_t FlashSim_GetEraseCount(uint32_t u32PageAddr);
+uint32_t FlashSim_GetProgramCount(void);
+void     FlashSim_Save(uint8_t *pu8Buf);
+void     FlashSim_Load(const uint8_t *pu8Buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __FLASH_SIM_H */
@@ -0,0 +1,122 @@
+/**************************************************************************//**
+ * @file     kvlib.h
+ * @version  V1.00
+ * @brief    Log-structured key/value store on Data Flash library header file
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __KVLIB_H
+#define __KVLIB_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef KVLIB_HOST_SIM
+#include "flash_sim.h"
+#else
+#include "NuMicro.h"
+#endif
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup KVLIB Key/Value Store Library
+  @{
+*/
+
+/** @addtogroup KVLIB_EXPORTED_CONSTANTS Key/Value Store Library Exported Constants
+  @{
+*/
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Flash layout                                                                                           */
+/*---------------------------------------------------------------------------------------------------------*/
+#define KVLIB_PAGE_MAGIC        0x3153564BUL    /*!< Page header magic "KVS1" */
+#define KVLIB_PAGE_HDR_SIZE     8UL             /*!< Page header: magic and page sequence number */
+#define KVLIB_REC_HDR_SIZE      8UL             /*!< Record header: length/type word and CRC32 word */
+#define KVLIB_REC_VALUE         0xA5UL          /*!< Record type of a key/value pair */
+#define KVLIB_REC_DELETE        0x5AUL          /*!< Record type of a key deletion */
+#define KVLIB_REC_PAD           0x00000000UL    /*!< Record header of 8 bytes padding over a torn record */
+#define KVLIB_KEY_MAX_LEN       255UL           /*!< Maximum key length in bytes */
+#define KVLIB_MIN_PAGE_NUM      3UL             /*!< Minimum number of pages: head, tail and one spare */
+
+/*! Maximum value length in bytes for a key of u32KeyLen bytes */
+#define KVLIB_VALUE_MAX_LEN(u32KeyLen)  (FMC_FLASH_PAGE_SIZE - KVLIB_PAGE_HDR_SIZE - KVLIB_REC_HDR_SIZE - (u32KeyLen))
+
+/*! Flash size of a record, key and value padded to 8 bytes */
+#define KVLIB_REC_SIZE_OF(u32KeyLen, u32ValueLen)   (KVLIB_REC_HDR_SIZE + (((u32KeyLen) + (u32ValueLen) + 7UL) & ~7UL))
+
+/*! Live record bytes held by a store of u32PageNum pages: one page is erased and one page is collection headroom */
+#define KVLIB_CAPACITY(u32PageNum)      (((u32PageNum) - 2UL) * (FMC_FLASH_PAGE_SIZE - KVLIB_PAGE_HDR_SIZE))
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Error codes                                                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+#define KVLIB_ERR_PARAM         (-1L)           /*!< Invalid parameter */
+#define KVLIB_ERR_NOT_FOUND     (-2L)           /*!< Key not found */
+#define KVLIB_ERR_FULL          (-3L)           /*!< Not enough flash space for the record */
+#define KVLIB_ERR_INDEX_FULL    (-4L)           /*!< RAM index has no free entry */
+#define KVLIB_ERR_FLASH         (-5L)           /*!< Flash erase or program failed */
+
+/** @} end of group KVLIB_EXPORTED_CONSTANTS */
+
+
+/** @addtogroup KVLIB_EXPORTED_STRUCTS Key/Value Store Library Exported Structs
+  @{
+*/
+
+/**
+  * @details    RAM index entry. The table is an open-addressing hash table of key hash and record address.
+  */
+typedef struct
+{
+    uint32_t u32Hash;       /*!< Hash of the key */
+    uint32_t u32Addr;       /*!< Flash address of the latest record of the key, 0 if free, 1 if removed */
+} KVLIB_IDX_T;
+
+/**
+  * @details    Key/value store instance.
+  */
+typedef struct
+{
+    uint32_t u32Base;       /*!< Address of the first page */
+    uint32_t u32PageNum;    /*!< Number of pages in the store */
+    uint32_t u32Head;       /*!< Page receiving new records */
+    uint32_t u32Tail;       /*!< Oldest page in use */
+    uint32_t u32Used;       /*!< Number of pages in use, head and tail included */
+    uint32_t u32Offset;     /*!< Offset of the next record in the head page */
+    uint32_t u32Seq;        /*!< Sequence number of the head page */
+    KVLIB_IDX_T *psIdx;     /*!< RAM index table */
+    uint32_t u32IdxSize;    /*!< Number of index entries, power of two */
+    uint32_t u32Count;      /*!< Number of keys in the store */
+    uint32_t u32LiveSize;   /*!< Flash bytes of the latest records of the keys */
+    uint32_t u32InGC;       /*!< Garbage collection in progress */
+} KVLIB_T;
+
+/** @} end of group KVLIB_EXPORTED_STRUCTS */
+
+
+/** @addtogroup KVLIB_EXPORTED_FUNCTIONS Key/Value Store Library Exported Functions
+  @{
+*/
+
+int32_t KVLIB_Init(KVLIB_T *psKV, uint32_t u32Base, uint32_t u32PageNum, KVLIB_IDX_T *psIdx, uint32_t u32IdxSize);
+int32_t KVLIB_Set(KVLIB_T *psKV, const void *pvKey, uint32_t u32KeyLen, const void *pvValue, uint32_t u32ValueLen);
+int32_t KVLIB_Get(KVLIB_T *psKV, const void *pvKey, uint32_t u32KeyLen, void *pvValue, uint32_t u32BufLen);
+int32_t KVLIB_Delete(KVLIB_T *psKV, const void *pvKey, uint32_t u32KeyLen);
+int32_t KVLIB_Format(KVLIB_T *psKV);
+
+/** @} end of group KVLIB_EXPORTED_FUNCTIONS */
+/** @} end of group KVLIB */
+/** @} end of group Library */
+
+#ifdef __cplusplus
+}
+
+#endif
+
+#endif  /* __KVLIB_H */
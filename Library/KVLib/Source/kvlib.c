@@ -0,0 +1,757 @@
+/**************************************************************************//**
+ * @file     kvlib.c
+ * @version  V1.00
+ * @brief    Log-structured key/value store on Data Flash library source file
+ *
+ * @details
+ *           Records are appended to a ring of flash pages, so updating a key
+ *           programs a few words instead of erasing a page. A page starts with
+ *           a header of magic and sequence number, followed by records:
+ *
+ *             word 0  : value length[31:16] | key length[15:8] | type[7:0]
+ *             word 1  : CRC32 of word 0, key and value
+ *             word 2~ : key, value, padded with 0xFF to 8 bytes
+ *
+ *           Word 0 is programmed last. A record torn by power loss has a blank
+ *           or a corrupted word 0. Mount programs its words to zero, and a zero
+ *           word 0 is read as 8 bytes of padding.
+ *           When only one erased page is left, the live records of the oldest
+ *           page are copied behind the head records and into the erased page,
+ *           then the oldest page is erased. The erased page is only used by
+ *           these copies, so they always fit. Mount drops a copy page left by
+ *           power loss instead of finishing the collection.
+ *
+ *           A record is accepted when the live records and the new one fit in
+ *           KVLIB_CAPACITY() bytes, which leaves one page of headroom for the
+ *           collection. A store of 3 pages holds about one page of records.
+ *           Deletions are always accepted, they only need the space of the
+ *           value they drop.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "kvlib.h"
+
+/** @addtogroup Library Library
+  @{
+*/
+
+/** @addtogroup KVLIB Key/Value Store Library
+  @{
+*/
+
+#ifdef KVLIB_HOST_SIM
+#define KVLIB_FLASH_PTR(addr)   FlashSim_Ptr(addr)
+#else
+#define KVLIB_FLASH_PTR(addr)   ((const uint8_t *)(addr))    /* Data Flash is memory mapped */
+#endif
+
+#define KVLIB_ALIGN8(x)         (((x) + 7UL) & ~7UL)
+#define KVLIB_IDX_FREE          0UL
+#define KVLIB_IDX_REMOVED       1UL
+
+#define KVLIB_HDR_TYPE(hdr)     ((hdr) & 0xFFUL)
+#define KVLIB_HDR_KEY_LEN(hdr)  (((hdr) >> 8) & 0xFFUL)
+#define KVLIB_HDR_VAL_LEN(hdr)  ((hdr) >> 16)
+#define KVLIB_REC_SIZE(hdr)     KVLIB_REC_SIZE_OF(KVLIB_HDR_KEY_LEN(hdr), KVLIB_HDR_VAL_LEN(hdr))
+
+static int32_t KVLIB_NewPage(KVLIB_T *psKV);
+
+static uint32_t KVLIB_ReadWord(uint32_t u32Addr)
+{
+    uint32_t u32Data;
+
+    memcpy(&u32Data, KVLIB_FLASH_PTR(u32Addr), 4);
+    return u32Data;
+}
+
+static uint32_t KVLIB_PageAddr(const KVLIB_T *psKV, uint32_t u32Page)
+{
+    return psKV->u32Base + u32Page * FMC_FLASH_PAGE_SIZE;
+}
+
+static uint32_t KVLIB_Hash(const uint8_t *pu8Key, uint32_t u32Len)
+{
+    uint32_t u32Hash = 0x811C9DC5UL;     /* FNV-1a */
+
+    while (u32Len--)
+    {
+        u32Hash ^= *pu8Key++;
+        u32Hash *= 0x01000193UL;
+    }
+
+    return u32Hash;
+}
+
+static uint32_t KVLIB_Crc32(uint32_t u32Crc, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t i;
+
+    /* Bitwise CRC-32 (0xEDB88320): records are short and no table is kept in flash or RAM */
+    while (u32Len--)
+    {
+        u32Crc ^= *pu8Data++;
+
+        for (i = 0; i < 8; i++)
+            u32Crc = (u32Crc >> 1) ^ (0xEDB88320UL & (0UL - (u32Crc & 1UL)));
+    }
+
+    return u32Crc;
+}
+
+static uint32_t KVLIB_RecordCrc(uint32_t u32Hdr, const uint8_t *pu8Key, const uint8_t *pu8Value)
+{
+    uint8_t au8Hdr[4];
+    uint32_t u32Crc;
+
+    au8Hdr[0] = (uint8_t)u32Hdr;
+    au8Hdr[1] = (uint8_t)(u32Hdr >> 8);
+    au8Hdr[2] = (uint8_t)(u32Hdr >> 16);
+    au8Hdr[3] = (uint8_t)(u32Hdr >> 24);
+
+    u32Crc = KVLIB_Crc32(0xFFFFFFFFUL, au8Hdr, 4);
+    u32Crc = KVLIB_Crc32(u32Crc, pu8Key, KVLIB_HDR_KEY_LEN(u32Hdr));
+    u32Crc = KVLIB_Crc32(u32Crc, pu8Value, KVLIB_HDR_VAL_LEN(u32Hdr));
+
+    return ~u32Crc;
+}
+
+/* Return record or padding size, 0 at the end of the log or -1 for a torn or corrupted record */
+static int32_t KVLIB_CheckRecord(uint32_t u32Addr, uint32_t u32PageEnd, uint32_t *pu32Hdr)
+{
+    uint32_t u32Hdr, u32Size;
+    const uint8_t *pu8Key;
+
+    if (u32Addr >= u32PageEnd)
+        return 0;
+
+    u32Hdr = KVLIB_ReadWord(u32Addr);
+
+    if (u32Hdr == 0xFFFFFFFFUL)
+        return 0;
+
+    if (u32Hdr == KVLIB_REC_PAD)
+    {
+        *pu32Hdr = u32Hdr;
+        return (int32_t)KVLIB_REC_HDR_SIZE;
+    }
+
+    if (((KVLIB_HDR_TYPE(u32Hdr) != KVLIB_REC_VALUE) && (KVLIB_HDR_TYPE(u32Hdr) != KVLIB_REC_DELETE)) ||
+            (KVLIB_HDR_KEY_LEN(u32Hdr) == 0UL))
+        return -1;
+
+    u32Size = KVLIB_REC_SIZE(u32Hdr);
+
+    if (u32Size > u32PageEnd - u32Addr)
+        return -1;
+
+    pu8Key = KVLIB_FLASH_PTR(u32Addr + KVLIB_REC_HDR_SIZE);
+
+    if (KVLIB_RecordCrc(u32Hdr, pu8Key, pu8Key + KVLIB_HDR_KEY_LEN(u32Hdr)) != KVLIB_ReadWord(u32Addr + 4))
+        return -1;
+
+    *pu32Hdr = u32Hdr;
+    return (int32_t)u32Size;
+}
+
+/* Offset behind the last programmed word of a page, but not below u32Offset */
+static uint32_t KVLIB_FindFree(uint32_t u32PageAddr, uint32_t u32Offset)
+{
+    uint32_t u32End = FMC_FLASH_PAGE_SIZE;
+
+    while ((u32End > u32Offset) && (KVLIB_ReadWord(u32PageAddr + u32End - 4) == 0xFFFFFFFFUL))
+        u32End -= 4;
+
+    return KVLIB_ALIGN8(u32End);
+}
+
+/* Turn the words left by an interrupted record into padding, return the offset for the next record */
+static uint32_t KVLIB_Pad(uint32_t u32PageAddr, uint32_t u32Offset)
+{
+    uint32_t u32End = KVLIB_FindFree(u32PageAddr, u32Offset);
+
+    for (; u32Offset < u32End; u32Offset += 4)
+    {
+        /* Programming zero is allowed on any partially programmed word */
+        if (FMC_Write(u32PageAddr + u32Offset, KVLIB_REC_PAD) != 0)
+            return FMC_FLASH_PAGE_SIZE;     /* Close the page, the padding is completed at next mount */
+    }
+
+    return u32End;
+}
+
+static int32_t KVLIB_Program(uint32_t u32Addr, uint32_t u32Hdr, const uint8_t *pu8Key, const uint8_t *pu8Value)
+{
+    uint32_t au32Buf[FMC_MULTI_WORD_PROG_LEN / 4];
+    uint8_t *pu8Buf = (uint8_t *)au32Buf;
+    uint32_t u32KeyLen = KVLIB_HDR_KEY_LEN(u32Hdr);
+    uint32_t u32DataLen = u32KeyLen + KVLIB_HDR_VAL_LEN(u32Hdr);
+    uint32_t u32BodyLen = KVLIB_ALIGN8(u32DataLen);
+    uint32_t u32Pos, u32Len, i;
+
+    /* Key and value first: an interrupted record keeps a blank header word */
+    for (u32Pos = 0; u32Pos < u32BodyLen; u32Pos += u32Len)
+    {
+        u32Len = u32BodyLen - u32Pos;
+
+        if (u32Len > FMC_MULTI_WORD_PROG_LEN)
+            u32Len = FMC_MULTI_WORD_PROG_LEN;
+
+        for (i = 0; i < u32Len; i++)
+        {
+            if (u32Pos + i < u32KeyLen)
+                pu8Buf[i] = pu8Key[u32Pos + i];
+            else if (u32Pos + i < u32DataLen)
+                pu8Buf[i] = pu8Value[u32Pos + i - u32KeyLen];
+            else
+                pu8Buf[i] = 0xFF;
+        }
+
+        if (u32Len == FMC_MULTI_WORD_PROG_LEN)
+        {
+            /* FMC_WriteMultiple() always programs a full multi-word block */
+            if (FMC_WriteMultiple(u32Addr + KVLIB_REC_HDR_SIZE + u32Pos, au32Buf, u32Len) < 0)
+                return KVLIB_ERR_FLASH;
+        }
+        else
+        {
+            for (i = 0; i < u32Len / 4; i++)
+            {
+                if ((au32Buf[i] != 0xFFFFFFFFUL) &&
+                        (FMC_Write(u32Addr + KVLIB_REC_HDR_SIZE + u32Pos + i * 4, au32Buf[i]) != 0))
+                    return KVLIB_ERR_FLASH;
+            }
+        }
+    }
+
+    if ((FMC_Write(u32Addr + 4, KVLIB_RecordCrc(u32Hdr, pu8Key, pu8Value)) != 0) ||
+            (FMC_Write(u32Addr, u32Hdr) != 0))
+        return KVLIB_ERR_FLASH;
+
+    return 0;
+}
+
+static int32_t KVLIB_KeyMatch(uint32_t u32Addr, const uint8_t *pu8Key, uint32_t u32KeyLen)
+{
+    return (KVLIB_HDR_KEY_LEN(KVLIB_ReadWord(u32Addr)) == u32KeyLen) &&
+           (memcmp(KVLIB_FLASH_PTR(u32Addr + KVLIB_REC_HDR_SIZE), pu8Key, u32KeyLen) == 0);
+}
+
+static KVLIB_IDX_T *KVLIB_Find(KVLIB_T *psKV, const uint8_t *pu8Key, uint32_t u32KeyLen, uint32_t u32Hash, KVLIB_IDX_T **ppsFree)
+{
+    uint32_t u32Mask = psKV->u32IdxSize - 1UL;
+    uint32_t i, n;
+    KVLIB_IDX_T *psEntry, *psFree = NULL;
+
+    /* Linear probing, removed entries keep the probe chains intact */
+    for (n = 0, i = u32Hash & u32Mask; n < psKV->u32IdxSize; n++, i = (i + 1UL) & u32Mask)
+    {
+        psEntry = &psKV->psIdx[i];
+
+        if (psEntry->u32Addr == KVLIB_IDX_FREE)
+        {
+            if (psFree == NULL)
+                psFree = psEntry;
+
+            break;
+        }
+
+        if (psEntry->u32Addr == KVLIB_IDX_REMOVED)
+        {
+            if (psFree == NULL)
+                psFree = psEntry;
+        }
+        else if ((psEntry->u32Hash == u32Hash) && KVLIB_KeyMatch(psEntry->u32Addr, pu8Key, u32KeyLen))
+        {
+            return psEntry;
+        }
+    }
+
+    if (ppsFree != NULL)
+        *ppsFree = psFree;
+
+    return NULL;
+}
+
+static int32_t KVLIB_IndexUpdate(KVLIB_T *psKV, uint32_t u32Addr, uint32_t u32Hdr)
+{
+    const uint8_t *pu8Key = KVLIB_FLASH_PTR(u32Addr + KVLIB_REC_HDR_SIZE);
+    uint32_t u32KeyLen = KVLIB_HDR_KEY_LEN(u32Hdr);
+    uint32_t u32Hash = KVLIB_Hash(pu8Key, u32KeyLen);
+    KVLIB_IDX_T *psEntry, *psFree;
+
+    psEntry = KVLIB_Find(psKV, pu8Key, u32KeyLen, u32Hash, &psFree);
+
+    if (KVLIB_HDR_TYPE(u32Hdr) == KVLIB_REC_DELETE)
+    {
+        if (psEntry != NULL)
+        {
+            psKV->u32LiveSize -= KVLIB_REC_SIZE(KVLIB_ReadWord(psEntry->u32Addr));
+            psEntry->u32Addr = KVLIB_IDX_REMOVED;
+            psKV->u32Count--;
+        }
+
+        return 0;
+    }
+
+    if (psEntry == NULL)
+    {
+        if (psFree == NULL)
+            return KVLIB_ERR_INDEX_FULL;
+
+        psEntry = psFree;
+        psEntry->u32Hash = u32Hash;
+        psKV->u32Count++;
+    }
+    else
+    {
+        psKV->u32LiveSize -= KVLIB_REC_SIZE(KVLIB_ReadWord(psEntry->u32Addr));
+    }
+
+    psKV->u32LiveSize += KVLIB_REC_SIZE(u32Hdr);
+    psEntry->u32Addr = u32Addr;
+    return 0;
+}
+
+static int32_t KVLIB_Append(KVLIB_T *psKV, uint32_t u32Hdr, const uint8_t *pu8Key, const uint8_t *pu8Value, uint32_t *pu32Addr)
+{
+    uint32_t u32Size = KVLIB_REC_SIZE(u32Hdr);
+    uint32_t u32Addr, n;
+    int32_t i32Ret;
+
+    for (n = 0; psKV->u32Offset + u32Size > FMC_FLASH_PAGE_SIZE; n++)
+    {
+        /* A full turn of the ring: the garbage collection only moves the live records around */
+        if (n > psKV->u32PageNum)
+            return KVLIB_ERR_FULL;
+
+        i32Ret = KVLIB_NewPage(psKV);
+
+        if (i32Ret != 0)
+            return i32Ret;
+    }
+
+    u32Addr = KVLIB_PageAddr(psKV, psKV->u32Head) + psKV->u32Offset;
+
+    i32Ret = KVLIB_Program(u32Addr, u32Hdr, pu8Key, pu8Value);
+
+    if (i32Ret != 0)
+    {
+        /* Mount stops reading a page at a broken record: close the page */
+        psKV->u32Offset = FMC_FLASH_PAGE_SIZE;
+        return i32Ret;
+    }
+
+    psKV->u32Offset += u32Size;
+    *pu32Addr = u32Addr;
+    return 0;
+}
+
+/*
+ * Copy the live records of the tail page behind the head records and into the erased page, then erase
+ * the tail page. The live records of one page always fit in the erased page.
+ */
+static int32_t KVLIB_Collect(KVLIB_T *psKV)
+{
+    uint32_t u32PageAddr = KVLIB_PageAddr(psKV, psKV->u32Tail);
+    uint32_t u32Offset = KVLIB_PAGE_HDR_SIZE;
+    uint32_t u32Hdr, u32Addr, u32NewAddr;
+    const uint8_t *pu8Key;
+    KVLIB_IDX_T *psEntry;
+    int32_t i32Size, i32Ret = 0;
+
+    psKV->u32InGC = 1;
+
+    while ((i32Size = KVLIB_CheckRecord(u32PageAddr + u32Offset, u32PageAddr + FMC_FLASH_PAGE_SIZE, &u32Hdr)) > 0)
+    {
+        u32Addr = u32PageAddr + u32Offset;
+        u32Offset += (uint32_t)i32Size;
+
+        if (KVLIB_HDR_TYPE(u32Hdr) != KVLIB_REC_VALUE)
+            continue;           /* Older records of a deleted key are at most as old as this page */
+
+        pu8Key = KVLIB_FLASH_PTR(u32Addr + KVLIB_REC_HDR_SIZE);
+        psEntry = KVLIB_Find(psKV, pu8Key, KVLIB_HDR_KEY_LEN(u32Hdr), KVLIB_Hash(pu8Key, KVLIB_HDR_KEY_LEN(u32Hdr)), NULL);
+
+        if ((psEntry == NULL) || (psEntry->u32Addr != u32Addr))
+            continue;           /* Superseded record */
+
+        i32Ret = KVLIB_Append(psKV, u32Hdr, pu8Key, pu8Key + KVLIB_HDR_KEY_LEN(u32Hdr), &u32NewAddr);
+
+        if (i32Ret != 0)
+            break;
+
+        psEntry->u32Addr = u32NewAddr;
+    }
+
+    if (i32Ret == 0)
+    {
+        /* Clear the magic first, so a torn erase cannot bring back deleted keys */
+        if ((FMC_Write(u32PageAddr, 0) != 0) || (FMC_Erase(u32PageAddr) != 0))
+        {
+            i32Ret = KVLIB_ERR_FLASH;
+        }
+        else
+        {
+            psKV->u32Tail = (psKV->u32Tail + 1UL) % psKV->u32PageNum;
+            psKV->u32Used--;
+        }
+    }
+
+    psKV->u32InGC = 0;
+    return i32Ret;
+}
+
+static int32_t KVLIB_OpenPage(KVLIB_T *psKV, uint32_t u32Page, uint32_t u32Seq)
+{
+    uint32_t u32PageAddr = KVLIB_PageAddr(psKV, u32Page);
+
+    /* Free pages are erased lazily, this also covers an erase torn by power loss */
+    if ((KVLIB_FindFree(u32PageAddr, 0) != 0) && (FMC_Erase(u32PageAddr) != 0))
+        return KVLIB_ERR_FLASH;
+
+    /* Magic is programmed last to commit the page */
+    if ((FMC_Write(u32PageAddr + 4, u32Seq) != 0) || (FMC_Write(u32PageAddr, KVLIB_PAGE_MAGIC) != 0))
+        return KVLIB_ERR_FLASH;
+
+    psKV->u32Head = u32Page;
+    psKV->u32Seq = u32Seq;
+    psKV->u32Offset = KVLIB_PAGE_HDR_SIZE;
+    return 0;
+}
+
+static int32_t KVLIB_NewPage(KVLIB_T *psKV)
+{
+    int32_t i32Ret;
+
+    /* Keep one erased page as copy space for the garbage collection. The caller checks the head page again. */
+    if ((psKV->u32InGC == 0) && (psKV->u32Used >= psKV->u32PageNum - 1UL))
+        return KVLIB_Collect(psKV);
+
+    if (psKV->u32Used >= psKV->u32PageNum)
+        return KVLIB_ERR_FULL;
+
+    i32Ret = KVLIB_OpenPage(psKV, (psKV->u32Head + 1UL) % psKV->u32PageNum, psKV->u32Seq + 1UL);
+
+    if (i32Ret != 0)
+        return i32Ret;
+
+    psKV->u32Used++;
+    return 0;
+}
+
+static int32_t KVLIB_Mount(KVLIB_T *psKV)
+{
+    uint32_t u32Page, u32PageAddr, u32Seq = 0, u32Offset, u32Hdr, i;
+    int32_t i32Size, i32Ret, i32Found = 0;
+
+    memset(psKV->psIdx, 0, psKV->u32IdxSize * sizeof(KVLIB_IDX_T));
+    psKV->u32Count = 0;
+    psKV->u32LiveSize = 0;
+    psKV->u32InGC = 0;
+
+    /* Head page has the newest sequence number */
+    for (u32Page = 0; u32Page < psKV->u32PageNum; u32Page++)
+    {
+        u32PageAddr = KVLIB_PageAddr(psKV, u32Page);
+
+        if (KVLIB_ReadWord(u32PageAddr) != KVLIB_PAGE_MAGIC)
+            continue;
+
+        if ((i32Found == 0) || ((int32_t)(KVLIB_ReadWord(u32PageAddr + 4) - u32Seq) > 0))
+        {
+            psKV->u32Head = u32Page;
+            u32Seq = KVLIB_ReadWord(u32PageAddr + 4);
+            i32Found = 1;
+        }
+    }
+
+    if (i32Found == 0)
+        return KVLIB_Format(psKV);
+
+    psKV->u32Seq = u32Seq;
+
+    /* Pages in use are consecutive in the ring with consecutive sequence numbers */
+    psKV->u32Tail = psKV->u32Head;
+    psKV->u32Used = 1;
+
+    while (psKV->u32Used < psKV->u32PageNum)
+    {
+        u32Page = (psKV->u32Tail + psKV->u32PageNum - 1UL) % psKV->u32PageNum;
+        u32PageAddr = KVLIB_PageAddr(psKV, u32Page);
+
+        if ((KVLIB_ReadWord(u32PageAddr) != KVLIB_PAGE_MAGIC) ||
+                (KVLIB_ReadWord(u32PageAddr + 4) != u32Seq - psKV->u32Used))
+            break;
+
+        psKV->u32Tail = u32Page;
+        psKV->u32Used++;
+    }
+
+    /*
+     * All pages in use: a garbage collection was interrupted after it opened the erased page. The head page only
+     * holds copies of tail records, drop it. Finishing the collection instead could run out of space, as the
+     * padding of a torn copy takes room again.
+     */
+    if (psKV->u32Used >= psKV->u32PageNum)
+    {
+        if (FMC_Write(KVLIB_PageAddr(psKV, psKV->u32Head), 0) != 0)
+            return KVLIB_ERR_FLASH;
+
+        psKV->u32Head = (psKV->u32Head + psKV->u32PageNum - 1UL) % psKV->u32PageNum;
+        psKV->u32Seq--;
+        psKV->u32Used--;
+    }
+
+    /* Replay the log from the oldest record, newer records override older ones */
+    for (i = 0, u32Page = psKV->u32Tail; i < psKV->u32Used; i++, u32Page = (u32Page + 1UL) % psKV->u32PageNum)
+    {
+        u32PageAddr = KVLIB_PageAddr(psKV, u32Page);
+        u32Offset = KVLIB_PAGE_HDR_SIZE;
+
+        while ((i32Size = KVLIB_CheckRecord(u32PageAddr + u32Offset, u32PageAddr + FMC_FLASH_PAGE_SIZE, &u32Hdr)) > 0)
+        {
+            if (u32Hdr != KVLIB_REC_PAD)
+            {
+                i32Ret = KVLIB_IndexUpdate(psKV, u32PageAddr + u32Offset, u32Hdr);
+
+                if (i32Ret != 0)
+                    return i32Ret;
+            }
+
+            u32Offset += (uint32_t)i32Size;
+        }
+
+        if (u32Page == psKV->u32Head)
+            psKV->u32Offset = KVLIB_Pad(u32PageAddr, u32Offset);
+    }
+
+    return 0;
+}
+
+/** @addtogroup KVLIB_EXPORTED_FUNCTIONS Key/Value Store Library Exported Functions
+  @{
+*/
+
+/**
+ *  @brief      Mount the key/value store
+ *
+ *  @param[in]  psKV        The key/value store instance
+ *  @param[in]  u32Base     Page aligned address of the first flash page, e.g. FMC_ReadDataFlashBaseAddr()
+ *  @param[in]  u32PageNum  Number of flash pages, at least KVLIB_MIN_PAGE_NUM
+ *  @param[in]  psIdx       RAM index table
+ *  @param[in]  u32IdxSize  Number of index entries. It must be a power of two and larger than the number of keys.
+ *
+ *  @retval     0                       Success
+ *  @retval     KVLIB_ERR_PARAM         Invalid parameter
+ *  @retval     KVLIB_ERR_INDEX_FULL    Index table too small for the stored keys
+ *  @retval     KVLIB_ERR_FLASH         Flash erase or program failed
+ *
+ *  @details    The pages are scanned to rebuild the RAM index. Records torn by power loss are dropped and
+ *              the copies of an interrupted garbage collection are discarded. An unformatted area is formatted.
+ *  @note       FMC ISP function must be enabled by FMC_Open() and the Data Flash must be enabled in User Configuration.
+ */
+int32_t KVLIB_Init(KVLIB_T *psKV, uint32_t u32Base, uint32_t u32PageNum, KVLIB_IDX_T *psIdx, uint32_t u32IdxSize)
+{
+    if ((psKV == NULL) || (psIdx == NULL) || (u32PageNum < KVLIB_MIN_PAGE_NUM) ||
+            (u32IdxSize == 0UL) || ((u32IdxSize & (u32IdxSize - 1UL)) != 0UL) ||
+            ((u32Base & (FMC_FLASH_PAGE_SIZE - 1UL)) != 0UL))
+        return KVLIB_ERR_PARAM;
+
+    psKV->u32Base = u32Base;
+    psKV->u32PageNum = u32PageNum;
+    psKV->psIdx = psIdx;
+    psKV->u32IdxSize = u32IdxSize;
+
+    return KVLIB_Mount(psKV);
+}
+
+/**
+ *  @brief      Store a value
+ *
+ *  @param[in]  psKV        The key/value store instance
+ *  @param[in]  pvKey       Key, any byte string
+ *  @param[in]  u32KeyLen   Key length, 1 ~ KVLIB_KEY_MAX_LEN
+ *  @param[in]  pvValue     Value
+ *  @param[in]  u32ValueLen Value length, 0 ~ KVLIB_VALUE_MAX_LEN(u32KeyLen)
+ *
+ *  @retval     0                       Success
+ *  @retval     KVLIB_ERR_PARAM         Invalid parameter
+ *  @retval     KVLIB_ERR_FULL          Not enough flash space
+ *  @retval     KVLIB_ERR_INDEX_FULL    Index table full
+ *  @retval     KVLIB_ERR_FLASH         Flash erase or program failed
+ *
+ *  @details    The record is appended to the log. Storing the current value again does not program flash.
+ *              If power is lost, the key keeps either the old or the new value.
+ *  @note       The old value counts as live until the new record is written: the live records and the new one
+ *              must fit in KVLIB_CAPACITY(). Large values in a store of many pages can still get KVLIB_ERR_FULL
+ *              when the records do not pack in the pages. Deleting keys always frees their space.
+ */
+int32_t KVLIB_Set(KVLIB_T *psKV, const void *pvKey, uint32_t u32KeyLen, const void *pvValue, uint32_t u32ValueLen)
+{
+    const uint8_t *pu8Key = (const uint8_t *)pvKey;
+    uint32_t u32Hdr, u32Addr;
+    KVLIB_IDX_T *psEntry, *psFree;
+    int32_t i32Ret;
+
+    if ((pu8Key == NULL) || (u32KeyLen == 0UL) || (u32KeyLen > KVLIB_KEY_MAX_LEN) ||
+            ((pvValue == NULL) && (u32ValueLen != 0UL)) || (u32ValueLen > KVLIB_VALUE_MAX_LEN(u32KeyLen)))
+        return KVLIB_ERR_PARAM;
+
+    psEntry = KVLIB_Find(psKV, pu8Key, u32KeyLen, KVLIB_Hash(pu8Key, u32KeyLen), &psFree);
+
+    if (psEntry != NULL)
+    {
+        /* Unchanged value: save the flash wear */
+        if ((KVLIB_HDR_VAL_LEN(KVLIB_ReadWord(psEntry->u32Addr)) == u32ValueLen) && ((u32ValueLen == 0UL) ||
+                (memcmp(KVLIB_FLASH_PTR(psEntry->u32Addr + KVLIB_REC_HDR_SIZE + u32KeyLen), pvValue, u32ValueLen) == 0)))
+            return 0;
+    }
+    else if (psFree == NULL)
+    {
+        return KVLIB_ERR_INDEX_FULL;
+    }
+
+    u32Hdr = (u32ValueLen << 16) | (u32KeyLen << 8) | KVLIB_REC_VALUE;
+
+    /* Leave one page of headroom, so the garbage collection can always free space for deletions */
+    if (psKV->u32LiveSize + KVLIB_REC_SIZE(u32Hdr) > KVLIB_CAPACITY(psKV->u32PageNum))
+        return KVLIB_ERR_FULL;
+
+    i32Ret = KVLIB_Append(psKV, u32Hdr, pu8Key, (const uint8_t *)pvValue, &u32Addr);
+
+    if (i32Ret != 0)
+        return i32Ret;
+
+    return KVLIB_IndexUpdate(psKV, u32Addr, u32Hdr);
+}
+
+/**
+ *  @brief      Read a value
+ *
+ *  @param[in]  psKV        The key/value store instance
+ *  @param[in]  pvKey       Key
+ *  @param[in]  u32KeyLen   Key length
+ *  @param[out] pvValue     Buffer for the value. It can be NULL to get the value length only.
+ *  @param[in]  u32BufLen   Buffer size. A longer value is truncated.
+ *
+ *  @return     Value length, or
+ *  @retval     KVLIB_ERR_PARAM         Invalid parameter
+ *  @retval     KVLIB_ERR_NOT_FOUND     Key not found
+ *
+ *  @details    The lookup is an O(1) hash index access. The value is copied directly from flash.
+ */
+int32_t KVLIB_Get(KVLIB_T *psKV, const void *pvKey, uint32_t u32KeyLen, void *pvValue, uint32_t u32BufLen)
+{
+    KVLIB_IDX_T *psEntry;
+    uint32_t u32ValueLen;
+
+    if ((pvKey == NULL) || (u32KeyLen == 0UL) || (u32KeyLen > KVLIB_KEY_MAX_LEN))
+        return KVLIB_ERR_PARAM;
+
+    psEntry = KVLIB_Find(psKV, (const uint8_t *)pvKey, u32KeyLen, KVLIB_Hash((const uint8_t *)pvKey, u32KeyLen), NULL);
+
+    if (psEntry == NULL)
+        return KVLIB_ERR_NOT_FOUND;
+
+    u32ValueLen = KVLIB_HDR_VAL_LEN(KVLIB_ReadWord(psEntry->u32Addr));
+
+    if (pvValue != NULL)
+        memcpy(pvValue, KVLIB_FLASH_PTR(psEntry->u32Addr + KVLIB_REC_HDR_SIZE + u32KeyLen),
+               (u32ValueLen < u32BufLen) ? u32ValueLen : u32BufLen);
+
+    return (int32_t)u32ValueLen;
+}
+
+/**
+ *  @brief      Delete a key
+ *
+ *  @param[in]  psKV        The key/value store instance
+ *  @param[in]  pvKey       Key
+ *  @param[in]  u32KeyLen   Key length
+ *
+ *  @retval     0                       Success
+ *  @retval     KVLIB_ERR_PARAM         Invalid parameter
+ *  @retval     KVLIB_ERR_NOT_FOUND     Key not found
+ *  @retval     KVLIB_ERR_FLASH         Flash erase or program failed
+ *
+ *  @details    A deletion record is appended. The space of the key is reclaimed by the garbage collection.
+ *              A deletion is accepted in a full store: the record is smaller than the value it drops.
+ */
+int32_t KVLIB_Delete(KVLIB_T *psKV, const void *pvKey, uint32_t u32KeyLen)
+{
+    const uint8_t *pu8Key = (const uint8_t *)pvKey;
+    uint32_t u32Hdr, u32Addr, u32OldAddr, u32OldHdr;
+    KVLIB_IDX_T *psEntry;
+    int32_t i32Ret;
+
+    if ((pu8Key == NULL) || (u32KeyLen == 0UL) || (u32KeyLen > KVLIB_KEY_MAX_LEN))
+        return KVLIB_ERR_PARAM;
+
+    psEntry = KVLIB_Find(psKV, pu8Key, u32KeyLen, KVLIB_Hash(pu8Key, u32KeyLen), NULL);
+
+    if (psEntry == NULL)
+        return KVLIB_ERR_NOT_FOUND;
+
+    /*
+     * Remove the key first, so a garbage collection started by the deletion record does not copy the value.
+     * If the value page is erased before the record is written, the key is deleted all the same.
+     */
+    u32OldAddr = psEntry->u32Addr;
+    u32OldHdr = KVLIB_ReadWord(u32OldAddr);
+    psEntry->u32Addr = KVLIB_IDX_REMOVED;
+    psKV->u32Count--;
+    psKV->u32LiveSize -= KVLIB_REC_SIZE(u32OldHdr);
+
+    u32Hdr = (u32KeyLen << 8) | KVLIB_REC_DELETE;
+
+    i32Ret = KVLIB_Append(psKV, u32Hdr, pu8Key, NULL, &u32Addr);
+
+    if ((i32Ret != 0) && (KVLIB_ReadWord(u32OldAddr) == u32OldHdr))
+    {
+        /* The value is still in flash */
+        psEntry->u32Addr = u32OldAddr;
+        psKV->u32Count++;
+        psKV->u32LiveSize += KVLIB_REC_SIZE(u32OldHdr);
+    }
+
+    return i32Ret;
+}
+
+/**
+ *  @brief      Erase all keys
+ *
+ *  @param[in]  psKV        The key/value store instance
+ *
+ *  @retval     0                       Success
+ *  @retval     KVLIB_ERR_FLASH         Flash erase or program failed
+ *
+ *  @details    All pages of the store are erased and the first page is opened.
+ */
+int32_t KVLIB_Format(KVLIB_T *psKV)
+{
+    uint32_t u32Page;
+
+    for (u32Page = 0; u32Page < psKV->u32PageNum; u32Page++)
+    {
+        if (FMC_Erase(KVLIB_PageAddr(psKV, u32Page)) != 0)
+            return KVLIB_ERR_FLASH;
+    }
+
+    memset(psKV->psIdx, 0, psKV->u32IdxSize * sizeof(KVLIB_IDX_T));
+    psKV->u32Count = 0;
+    psKV->u32LiveSize = 0;
+    psKV->u32InGC = 0;
+    psKV->u32Tail = 0;
+    psKV->u32Used = 1;
+
+    return KVLIB_OpenPage(psKV, 0, 1);
+}
+
+/** @} end of group KVLIB_EXPORTED_FUNCTIONS */
+/** @} end of group KVLIB */
+/** @} end of group Library */
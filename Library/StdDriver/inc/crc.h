@@ -49,8 +49,40 @@ extern "C"
 #define CRC_CPU_WDATA_16    (1UL << CRC_CTL_DATLEN_Pos) /*!<CRC CPU Write Data length is 16-bit \hideinitializer */
 #define CRC_CPU_WDATA_32    (2UL << CRC_CTL_DATLEN_Pos) /*!<CRC CPU Write Data length is 32-bit \hideinitializer */
 
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Streaming API Return Codes                                                                             */
+/*---------------------------------------------------------------------------------------------------------*/
+#define CRC_OK              ( 0L)   /*!<Operation completed or started \hideinitializer */
+#define CRC_ERR_PARAM       (-1L)   /*!<Invalid PDMA module or too long buffer \hideinitializer */
+#define CRC_ERR_BUSY        (-2L)   /*!<A PDMA update is in progress \hideinitializer */
+#define CRC_ERR_NO_CH       (-3L)   /*!<No free PDMA channel \hideinitializer */
+
 /*@}*/ /* end of group CRC_EXPORTED_CONSTANTS */
 
+/** @addtogroup CRC_EXPORTED_STRUCTS CRC Exported Structs
+  @{
+*/
+
+/**
+  * @details    Saved state of a CRC stream. Several streams can share the CRC controller by saving the
+  *             context of one stream and restoring the context of another.
+  */
+typedef struct
+{
+    uint32_t u32Ctl;                    /*!< Polynomial mode, attribute and CPU write data length */
+    uint32_t u32Polynomial;             /*!< Polynomial */
+    uint32_t u32State;                  /*!< Raw CRC state before checksum reverse and complement, reloaded as seed */
+} CRC_CONTEXT_T;
+
+/**
+  * @brief  PDMA update completion callback
+  * @details It is called in PDMA interrupt context by PDMA_IRQHandler() after the tail bytes are written.
+  *          CRC_GetChecksum() returns the checksum of the stream so far.
+  */
+typedef void (*CRC_DMA_CALLBACK_T)(void *pvUserData);
+
+/*@}*/ /* end of group CRC_EXPORTED_STRUCTS */
+
 /** @addtogroup CRC_EXPORTED_MACROS CRC Exported Macros
   @{
 */
@@ -237,6 +269,11 @@ extern "C"
 void CRC_Open(uint32_t u32Mode, uint32_t u32Attribute, uint32_t u32Seed, uint32_t u32DataLen);
 
 uint32_t CRC_GetChecksum(void);
+void CRC_Update(const void *pvBuf, uint32_t u32Len);
+int32_t CRC_UpdateDMA(PDMA_T *pdma, const void *pvBuf, uint32_t u32Len, CRC_DMA_CALLBACK_T pfnCallback, void *pvUserData);
+uint32_t CRC_IsBusy(void);
+void CRC_SaveContext(CRC_CONTEXT_T *psCtx);
+void CRC_RestoreContext(const CRC_CONTEXT_T *psCtx);
 
 /*@}*/ /* end of group CRC_EXPORTED_FUNCTIONS */
 
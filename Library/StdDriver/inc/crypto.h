@@ -53,10 +53,55 @@ extern "C"
 #define CRYPTO_DMA_CONTINUE     (0x6UL)   /*!< Do continuous encrypt/decrypt in DMA cascade \hideinitializer */
 #define CRYPTO_DMA_LAST         (0x7UL)   /*!< Do last encrypt/decrypt in DMA cascade          \hideinitializer */
 
+/*---------------------------------------------------------------------------------------------------------*/
+/*  AES Streaming API Return Codes                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+#define AES_OK                  ( 0L)     /*!< Operation completed or started          \hideinitializer */
+#define AES_ERR_PARAM           (-1L)     /*!< Invalid mode, length or context         \hideinitializer */
+#define AES_ERR_BUSY            (-2L)     /*!< An AES_Update()/AES_Final() is in progress \hideinitializer */
+#define AES_ERR_TIMEOUT         (-3L)     /*!< AES engine did not finish in AES_TIMEOUT \hideinitializer */
+#define AES_ERR_ENGINE          (-4L)     /*!< AES engine error flag, e.g. DMA bus error \hideinitializer */
+#define AES_TIMEOUT             SystemCoreClock /*!< Blocking round time-out counter (about 1 second) \hideinitializer */
 
 /**@}*/ /* end of group CRYPTO_EXPORTED_CONSTANTS */
 
 
+/** @addtogroup CRYPTO_EXPORTED_STRUCTS CRYPTO Exported Structs
+  @{
+*/
+
+typedef struct AES_CONTEXT AES_CONTEXT_T;
+
+/**
+  * @brief   AES_Update()/AES_Final() completion callback
+  * @details i32Status is \ref AES_OK or a negative AES_ERR code. It is called in CRPT interrupt context by
+  *          AES_IRQHandler(), or before returning when the call did not need an asynchronous DMA round.
+  */
+typedef void (*AES_CALLBACK_T)(AES_CONTEXT_T *psCtx, int32_t i32Status, void *pvUserData);
+
+/**
+  * @details AES stream context. The key, the chaining value and a partial keystream block are kept here between
+  *          calls, so several streams can share the AES engine. The fields are managed by the driver.
+  */
+struct AES_CONTEXT
+{
+    uint32_t u32OpMode;                 /*!< AES_MODE_xxx of AES_Init() */
+    uint32_t u32Ctl;                    /*!< CRPT_AES_CTL image of the whole-block DMA rounds, 0 when not initialized */
+    uint32_t au32Key[8];                /*!< Key words, as AES_SetKey() */
+    uint32_t au32IV[4];                 /*!< IV or counter of the next block, as AES_SetInitVect() */
+    uint32_t au32Buf[8];                /*!< Keystream and CFB feedback of a partial block, bounce buffer of unaligned blocks */
+    uint32_t u32Pos;                    /*!< Bytes of the keystream block already used, 0 at a block boundary */
+    const uint8_t *pu8TailIn;           /*!< Bytes after the whole-block DMA round */
+    uint8_t *pu8TailOut;                /*!< Output of the tail bytes */
+    uint32_t u32TailLen;                /*!< Number of tail bytes */
+    uint32_t u32Final;                  /*!< 1 if the call is AES_Final() */
+    AES_CALLBACK_T pfnCallback;         /*!< Completion callback of the call in progress */
+    void *pvUserData;                   /*!< User data of the callback */
+};
+
+/**@}*/ /* end of group CRYPTO_EXPORTED_STRUCTS */
+
+
 /** @addtogroup CRYPTO_EXPORTED_MACROS CRYPTO Exported Macros
   @{
 */
@@ -129,6 +174,11 @@ void AES_Start(CRPT_T *crpt, int32_t u32Channel, uint32_t u32DMAMode);
 void AES_SetKey(CRPT_T *crpt, uint32_t u32Channel, uint32_t au32Keys[], uint32_t u32KeySize);
 void AES_SetInitVect(CRPT_T *crpt, uint32_t u32Channel, uint32_t au32IV[]);
 void AES_SetDMATransfer(CRPT_T *crpt, uint32_t u32Channel, uint32_t u32SrcAddr, uint32_t u32DstAddr, uint32_t u32TransCnt);
+int32_t AES_Init(AES_CONTEXT_T *psCtx, uint32_t u32EncDec, uint32_t u32OpMode, uint32_t u32KeySize, const uint32_t au32Key[], const uint32_t au32IV[]);
+int32_t AES_Update(CRPT_T *crpt, AES_CONTEXT_T *psCtx, const void *pvIn, void *pvOut, uint32_t u32Len, AES_CALLBACK_T pfnCallback, void *pvUserData);
+int32_t AES_Final(CRPT_T *crpt, AES_CONTEXT_T *psCtx, const void *pvIn, void *pvOut, uint32_t u32Len, AES_CALLBACK_T pfnCallback, void *pvUserData);
+uint32_t AES_IsBusy(void);
+void AES_IRQHandler(CRPT_T *crpt);
 
 /**@}*/ /* end of group CRYPTO_EXPORTED_FUNCTIONS */
 
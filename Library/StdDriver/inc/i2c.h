@@ -68,6 +68,18 @@ extern "C"
 #define I2C_OK          ( 0L)            /*!< I2C operation OK                                                            \hideinitializer */
 #define I2C_ERR_FAIL    (-1L)            /*!< I2C operation failed                                                        \hideinitializer */
 #define I2C_ERR_TIMEOUT (-2L)            /*!< I2C operation abort due to timeout error                                    \hideinitializer */
+#define I2C_ERR_NACK    (-3L)            /*!< Slave did not acknowledge the address or a data byte                        \hideinitializer */
+#define I2C_ERR_ARB_LOST (-4L)           /*!< Arbitration lost after \ref I2C_XFER_ARB_RETRY retries                      \hideinitializer */
+#define I2C_ERR_BUS     (-5L)            /*!< Bus error, illegal START or STOP on the bus                                 \hideinitializer */
+#define I2C_ERR_PARAM   (-6L)            /*!< Invalid port or transaction descriptor                                      \hideinitializer */
+#define I2C_ERR_BUSY    (-7L)            /*!< Transaction descriptor is already queued                                    \hideinitializer */
+#define I2C_ERR_ABORT   (-8L)            /*!< Transaction removed from the queue by I2C_XferAbort()                       \hideinitializer */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  I2C Transaction Engine constant definitions.                                                           */
+/*---------------------------------------------------------------------------------------------------------*/
+#define I2C_XFER_PENDING    (1L)         /*!< Transaction is queued or in progress                                        \hideinitializer */
+#define I2C_XFER_ARB_RETRY  3UL          /*!< START retries after arbitration lost before the transaction fails           \hideinitializer */
 
 /*---------------------------------------------------------------------------------------------------------*/
 /*  I2C AUTOMode constant definitions.                                                                     */
@@ -92,6 +104,43 @@ extern "C"
 
 /*@}*/ /* end of group I2C_EXPORTED_CONSTANTS */
 
+/** @addtogroup I2C_EXPORTED_STRUCTS I2C Exported Structs
+  @{
+*/
+
+typedef struct I2C_XFER I2C_XFER_T;
+
+/**
+  * @brief  Transaction completion callback
+  * @details It is called in I2C interrupt context by I2C_XferIRQHandler() or by I2C_XferAbort().
+  *          psXfer->i32Status holds the result. The descriptor is free again and can be re-submitted.
+  */
+typedef void (*I2C_XFER_CALLBACK_T)(I2C_XFER_T *psXfer);
+
+/**
+  * @details    Write-then-read transaction descriptor of the interrupt driven transaction engine.
+  *             START, SLA+W and u32TxLen bytes, then repeated START, SLA+R and u32RxLen bytes, then STOP.
+  *             Either phase can be empty. Zero the descriptor before its first submit, it and its buffers
+  *             must stay valid until completion.
+  */
+struct I2C_XFER
+{
+    uint8_t u8SlaveAddr;                /*!< 7-bit slave address */
+    const uint8_t *pu8TxBuf;            /*!< Bytes to write, usually the register address */
+    uint32_t u32TxLen;                  /*!< Bytes to write, 0 for a read only transaction */
+    uint8_t *pu8RxBuf;                  /*!< Buffer of the read bytes */
+    uint32_t u32RxLen;                  /*!< Bytes to read, 0 for a write only transaction */
+    I2C_XFER_CALLBACK_T pfnCallback;    /*!< Completion callback, can be NULL */
+    void *pvUserData;                   /*!< User data of the callback */
+    volatile int32_t i32Status;         /*!< \ref I2C_XFER_PENDING, \ref I2C_OK or a negative I2C error code */
+    uint32_t u32TxCnt;                  /*!< Bytes written, used by the engine */
+    uint32_t u32RxCnt;                  /*!< Bytes read, used by the engine */
+    uint32_t u32Retry;                  /*!< Arbitration lost retries, used by the engine */
+    I2C_XFER_T *psNext;                 /*!< Next queued transaction, used by the engine */
+};
+
+/*@}*/ /* end of group I2C_EXPORTED_STRUCTS */
+
 /** @addtogroup I2C_EXPORTED_MACROS I2C Exported Macros
   @{
 */
@@ -578,6 +627,12 @@ uint8_t I2C_ReadByteOneReg(I2C_T *i2c, uint8_t u8SlaveAddr, uint8_t u8DataAddr);
 uint32_t I2C_ReadMultiBytesOneReg(I2C_T *i2c, uint8_t u8SlaveAddr, uint8_t u8DataAddr, uint8_t rdata[], uint32_t u32rLen);
 uint8_t I2C_ReadByteTwoRegs(I2C_T *i2c, uint8_t u8SlaveAddr, uint16_t u16DataAddr);
 uint32_t I2C_ReadMultiBytesTwoRegs(I2C_T *i2c, uint8_t u8SlaveAddr, uint16_t u16DataAddr, uint8_t rdata[], uint32_t u32rLen);
+uint32_t I2C_WriteMultiBytesPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t data[], uint32_t u32wLen);
+uint32_t I2C_WriteMultiBytesOneRegPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t u8DataAddr, uint8_t data[], uint32_t u32wLen);
+uint32_t I2C_WriteMultiBytesTwoRegsPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint16_t u16DataAddr, uint8_t data[], uint32_t u32wLen);
+uint32_t I2C_ReadMultiBytesPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t rdata[], uint32_t u32rLen);
+uint32_t I2C_ReadMultiBytesOneRegPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t u8DataAddr, uint8_t rdata[], uint32_t u32rLen);
+uint32_t I2C_ReadMultiBytesTwoRegsPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint16_t u16DataAddr, uint8_t rdata[], uint32_t u32rLen);
 uint32_t I2C_SMBusGetStatus(I2C_T *i2c);
 void I2C_SMBusClearInterruptFlag(I2C_T *i2c, uint8_t u8SMBusIntFlag);
 void I2C_SMBusSetPacketByteCount(I2C_T *i2c, uint32_t u32PktSize);
@@ -588,6 +643,10 @@ uint8_t I2C_SMBusGetPECValue(I2C_T *i2c);
 void I2C_SMBusIdleTimeout(I2C_T *i2c, uint32_t us, uint32_t u32Hclk);
 void I2C_SMBusTimeout(I2C_T *i2c, uint32_t ms, uint32_t u32Pclk);
 void I2C_SMBusClockLoTimeout(I2C_T *i2c, uint32_t ms, uint32_t u32Pclk);
+int32_t I2C_XferSubmit(I2C_T *i2c, I2C_XFER_T *psXfer);
+void I2C_XferAbort(I2C_T *i2c);
+uint32_t I2C_XferIsBusy(I2C_T *i2c);
+void I2C_XferIRQHandler(I2C_T *i2c);
 
 /*@}*/ /* end of group I2C_EXPORTED_FUNCTIONS */
 
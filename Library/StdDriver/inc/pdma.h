@@ -115,9 +115,48 @@ extern "C"
 #define PDMA_INT_TEMPTY     0x00000001UL            /*!<Table Empty Interrupt  \hideinitializer */
 #define PDMA_INT_TIMEOUT    0x00000002UL            /*!<Timeout Interrupt \hideinitializer */
 
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Channel Callback Event Constant Definitions                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+#define PDMA_EVT_TRANS_DONE 0x00000001UL            /*!<Transfer done or table done event  \hideinitializer */
+#define PDMA_EVT_ABORT      0x00000002UL            /*!<Target abort event  \hideinitializer */
+#define PDMA_EVT_TIMEOUT    0x00000004UL            /*!<Request time-out event  \hideinitializer */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Error Code Constant Definitions                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+#define PDMA_ERR_PARAM      (-1L)                   /*!<Invalid channel, width, alignment or transfer count  \hideinitializer */
+#define PDMA_ERR_NO_CH      (-2L)                   /*!<No free channel in the requested channel mask  \hideinitializer */
+#define PDMA_ERR_SCATBA     (-3L)                   /*!<Descriptor is out of the 64KB window addressed by SCATBA  \hideinitializer */
+
+#define PDMA_ERR_ABORT      (-4L)                   /*!<Target abort during memory transfer  \hideinitializer */
+
+#define PDMA_TXCNT_MAX      65536UL                 /*!<Maximum transfer count of one descriptor  \hideinitializer */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Memory Copy/Set Constant Definitions                                                                   */
+/*---------------------------------------------------------------------------------------------------------*/
+#ifndef PDMA_MEM_CPU_THRESHOLD
+#define PDMA_MEM_CPU_THRESHOLD  64UL                /*!<Default byte count below which PDMA_Memcpy/PDMA_Memset use CPU. It can be re-calibrated by PDMA_SetMemThreshold()  \hideinitializer */
+#endif
+#define PDMA_MEM_DONE_BY_CPU    (1L)                /*!<Asynchronous request was completed by CPU, no PDMA event follows  \hideinitializer */
+
 
 /*@}*/ /* end of group PDMA_EXPORTED_CONSTANTS */
 
+/** @addtogroup PDMA_EXPORTED_STRUCTS PDMA Exported Structs
+  @{
+*/
+
+/**
+  * @brief  PDMA channel callback
+  * @details u32Event is the combination of \ref PDMA_EVT_TRANS_DONE, \ref PDMA_EVT_ABORT and \ref PDMA_EVT_TIMEOUT.
+  *          It is called in PDMA interrupt context by PDMA_IRQHandler().
+  */
+typedef void (*PDMA_CALLBACK_T)(uint32_t u32Ch, uint32_t u32Event, void *pvUserData);
+
+/*@}*/ /* end of group PDMA_EXPORTED_STRUCTS */
+
 /** @addtogroup PDMA_EXPORTED_MACROS PDMA Exported Macros
   @{
 */
@@ -335,6 +374,24 @@ extern "C"
  */
 #define PDMA_RESET(pdma, u32Ch) ((uint32_t)((pdma)->CHRST = (1UL << (u32Ch))))
 
+/**
+ * @brief       Set the request source of the channel
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The selected channel
+ * @param[in]   u32Peripheral   The selected peripheral, e.g. \ref PDMA_MEM, \ref PDMA_UART0_RX.
+ *
+ * @return      None
+ *
+ * @details     This macro only programs REQSEL of the selected channel. It can be used by other drivers
+ *              which configure PDMA registers directly.
+ * \hideinitializer
+ */
+#define PDMA_SET_REQ_SRC(pdma, u32Ch, u32Peripheral) \
+    ((uint32_t)(((u32Ch) < 4UL) ? \
+    ((pdma)->REQSEL0_3 = ((pdma)->REQSEL0_3 & ~(PDMA_REQSEL0_3_REQSRC0_Msk << ((u32Ch) * 8UL))) | ((u32Peripheral) << ((u32Ch) * 8UL))) : \
+    ((pdma)->REQSEL4_7 = ((pdma)->REQSEL4_7 & ~(PDMA_REQSEL4_7_REQSRC4_Msk << (((u32Ch) - 4UL) * 8UL))) | ((u32Peripheral) << (((u32Ch) - 4UL) * 8UL)))))
+
 /*@}*/ /* end of group PDMA_EXPORTED_MACROS */
 
 /** @addtogroup PDMA_EXPORTED_FUNCTIONS PDMA Exported Functions
@@ -355,6 +412,19 @@ void PDMA_SetTimeOut(PDMA_T * pdma,uint32_t u32Ch, uint32_t u32OnOff, uint32_t u
 void PDMA_Trigger(PDMA_T * pdma,uint32_t u32Ch);
 void PDMA_EnableInt(PDMA_T * pdma,uint32_t u32Ch, uint32_t u32Mask);
 void PDMA_DisableInt(PDMA_T * pdma,uint32_t u32Ch, uint32_t u32Mask);
+int32_t PDMA_RequestChannel(PDMA_T * pdma, uint32_t u32Mask);
+void PDMA_ReleaseChannel(PDMA_T * pdma, uint32_t u32Ch);
+int32_t PDMA_DescInit(DSCT_T *psDesc, uint32_t u32Width, uint32_t u32SrcAddr, uint32_t u32SrcCtrl, uint32_t u32DstAddr, uint32_t u32DstCtrl, uint32_t u32TransCount, uint32_t u32Burst);
+int32_t PDMA_DescLink(PDMA_T * pdma, DSCT_T *psDesc, DSCT_T *psNext, uint32_t u32TableInt);
+int32_t PDMA_StartChain(PDMA_T * pdma, uint32_t u32Ch, uint32_t u32Peripheral, DSCT_T *psFirst);
+void PDMA_SetCallback(PDMA_T * pdma, uint32_t u32Ch, PDMA_CALLBACK_T pfnCallback, void *pvUserData);
+void PDMA_IRQHandler(PDMA_T * pdma);
+void PDMA_SetMemThreshold(uint32_t u32Bytes);
+uint32_t PDMA_GetMemThreshold(void);
+int32_t PDMA_Memcpy(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, const void *pvSrc, uint32_t u32Len);
+int32_t PDMA_MemcpyAsync(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, const void *pvSrc, uint32_t u32Len);
+int32_t PDMA_Memset(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, uint8_t u8Value, uint32_t u32Len);
+int32_t PDMA_MemsetAsync(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, uint8_t u8Value, uint32_t u32Len);
 
 
 /*@}*/ /* end of group PDMA_EXPORTED_FUNCTIONS */
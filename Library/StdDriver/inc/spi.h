@@ -71,8 +71,71 @@ extern "C"
 #define SPI_AUTOCTL_TRIGSEL_WKIOC0    (6UL<<SPI_AUTOCTL_TRIGSEL_Pos)       /*!< SPI Automatic Operation Trigger Source Select is WKIOC0  \hideinitializer */
 #define SPI_AUTOCTL_TRIGSEL_WKIOD0    (7UL<<SPI_AUTOCTL_TRIGSEL_Pos)       /*!< SPI Automatic Operation Trigger Source Select is WKIOD0  \hideinitializer */
 
+/* SPI Transfer Return Codes */
+#define SPI_XFER_OK                   ( 0L)                                /*!< Transfer completed \hideinitializer */
+#define SPI_XFER_ERR_PARAM            (-1L)                                /*!< Invalid SPI module, buffer alignment or length \hideinitializer */
+#define SPI_XFER_ERR_BUSY             (-2L)                                /*!< A transfer is in progress on the SPI module \hideinitializer */
+#define SPI_XFER_ERR_TIMEOUT          (-3L)                                /*!< Transfer did not complete in SPI_TIMEOUT \hideinitializer */
+#define SPI_XFER_ERR_NO_CH            (-4L)                                /*!< No free PDMA channel for the PDMA path \hideinitializer */
+#define SPI_XFER_ERR_ABORT            (-5L)                                /*!< PDMA target abort \hideinitializer */
+#define SPI_TIMEOUT                   SystemCoreClock                      /*!< Blocking transfer time-out counter (about 1 second) \hideinitializer */
+#define SPI_XFER_PENDING              ( 1L)                                /*!< Bus transaction is queued or in progress \hideinitializer */
+
 /*@}*/ /* end of group SPI_EXPORTED_CONSTANTS */
 
+/** @addtogroup SPI_EXPORTED_STRUCTS SPI Exported Structs
+  @{
+*/
+
+/**
+  * @brief  Transfer completion callback
+  * @details i32Status is \ref SPI_XFER_OK, or \ref SPI_XFER_ERR_ABORT on the PDMA path. It is called in interrupt context
+  *          by SPI_TransferIRQHandler(), or by PDMA_IRQHandler() on the PDMA path.
+  */
+typedef void (*SPI_XFER_CALLBACK_T)(SPI_T *spi, int32_t i32Status, void *pvUserData);
+
+/**
+  * @details    Device on a shared SPI bus. SPI_DevInit() precomputes the register images, so switching to the
+  *             device costs three register writes. The images can be adjusted after SPI_DevInit(),
+  *             e.g. u32Ctl |= SPI_CTL_LSB_Msk for LSB first.
+  */
+typedef struct
+{
+    SPI_T *spi;                         /*!< SPI module of the bus */
+    volatile uint32_t *pu32CsPin;       /*!< GPIO pin data register of the chip select (e.g. &PB1), NULL uses the SPI_SS pin */
+    uint32_t u32CsActive;               /*!< Output level of the GPIO chip select while selected */
+    uint32_t u32Ctl;                    /*!< SPI_CTL image: master, mode, data width and SPIEN */
+    uint32_t u32ClkDiv;                 /*!< SPI_CLKDIV image */
+    uint32_t u32SsCtl;                  /*!< SPI_SSCTL image */
+} SPI_DEV_T;
+
+typedef struct SPI_BUS_XFER SPI_BUS_XFER_T;
+
+/**
+  * @brief  Bus transaction completion callback
+  * @details It is called in interrupt context by SPI_TransferIRQHandler(). psXfer->i32Status holds the result.
+  *          The descriptor is free again and can be re-submitted.
+  */
+typedef void (*SPI_BUS_CALLBACK_T)(SPI_BUS_XFER_T *psXfer);
+
+/**
+  * @details    Transaction descriptor of the SPI bus manager. The chip select is active for the whole transaction.
+  *             Zero the descriptor before its first submit, it and its buffers must stay valid until completion.
+  */
+struct SPI_BUS_XFER
+{
+    SPI_DEV_T *psDev;                   /*!< Target device */
+    const void *pvTxBuf;                /*!< Data to send, NULL sends 0 */
+    void *pvRxBuf;                      /*!< Buffer of the received data, NULL drops the received data */
+    uint32_t u32Len;                    /*!< Number of data units, see SPI_Transfer() */
+    SPI_BUS_CALLBACK_T pfnCallback;     /*!< Completion callback, can be NULL */
+    void *pvUserData;                   /*!< User data of the callback */
+    volatile int32_t i32Status;         /*!< \ref SPI_XFER_PENDING, \ref SPI_XFER_OK or a negative SPI_XFER_ERR code */
+    SPI_BUS_XFER_T *psNext;             /*!< Next queued transaction, used by the bus manager */
+};
+
+/*@}*/ /* end of group SPI_EXPORTED_STRUCTS */
+
 /** @addtogroup SPI_EXPORTED_MACROS SPI Exported Macros
   @{
 */
@@ -557,6 +620,14 @@ void SPI_DisableInt(SPI_T *spi, uint32_t u32Mask);
 uint32_t SPI_GetIntFlag(SPI_T *spi, uint32_t u32Mask);
 void SPI_ClearIntFlag(SPI_T *spi, uint32_t u32Mask);
 uint32_t SPI_GetStatus(SPI_T *spi, uint32_t u32Mask);
+int32_t SPI_TransferSetPDMA(SPI_T *spi, PDMA_T *pdma, uint32_t u32Threshold);
+int32_t SPI_Transfer(SPI_T *spi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len);
+int32_t SPI_TransferAsync(SPI_T *spi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, SPI_XFER_CALLBACK_T pfnCallback, void *pvUserData);
+uint32_t SPI_TransferIsBusy(SPI_T *spi);
+void SPI_TransferIRQHandler(SPI_T *spi);
+uint32_t SPI_DevInit(SPI_DEV_T *psDev, SPI_T *spi, uint32_t u32SPIMode, uint32_t u32DataWidth, uint32_t u32BusClock, volatile uint32_t *pu32CsPin, uint32_t u32ActiveLevel);
+int32_t SPI_BusSubmit(SPI_BUS_XFER_T *psXfer);
+uint32_t SPI_BusIsBusy(SPI_T *spi);
 
 uint32_t SPII2S_Open(SPI_T *i2s, uint32_t u32MasterSlave, uint32_t u32SampleRate, uint32_t u32WordWidth, uint32_t u32Channels, uint32_t u32DataFormat);
 void SPII2S_Close(SPI_T *i2s);
@@ -113,9 +113,77 @@ extern "C"
 #define UART_AUTOCTL_TRIGSEL_WKIOD0   (0x7UL << UART_AUTOCTL_TRIGSEL_Pos) /*!< UART Automatic Operation Trigger Source Select is WKIOD0 \hideinitializer */
 
 
+/*---------------------------------------------------------------------------------------------------------*/
+/* UART ring buffer constants definitions                                                                  */
+/*---------------------------------------------------------------------------------------------------------*/
+#define UART_BUF_ERR_PARAM  (-1L)   /*!< UART ring buffer size is not a power of two or buffer pointer is NULL \hideinitializer */
+
+#define UART_BUF_RX_INT     (UART_INTEN_RDAIEN_Msk | UART_INTEN_RXTOIEN_Msk | UART_INTEN_RLSIEN_Msk | UART_INTEN_BUFERRIEN_Msk) /*!< UART interrupts serviced by UART_BufIRQHandler on receive side \hideinitializer */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* UART PDMA circular receive constants definitions                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+#define UART_PDMA_RX_SEG_NUM    2UL         /*!< Number of scatter-gather descriptors looping over the receive ring \hideinitializer */
+#define UART_PDMA_RX_ERR_PARAM  (-1L)       /*!< UART PDMA receive ring, channel or UART module is invalid \hideinitializer */
+#define UART_PDMA_RX_TOIC       40UL        /*!< Default idle-line time-out in bit times used to close a frame \hideinitializer */
+
+
 /*@}*/ /* end of group UART_EXPORTED_CONSTANTS */
 
 
+/** @addtogroup UART_EXPORTED_STRUCTS UART Exported Structs
+  @{
+*/
+
+/**
+ *  @brief  Interrupt-driven UART ring buffer control block.
+ *
+ *  @details Both rings are single-producer/single-consumer. The head index is written only by the producer and the
+ *           tail index only by the consumer, so the application and UART_BufIRQHandler never need a critical section.
+ *           Indexes are free-running and wrap by masking with (size - 1); ring sizes must be powers of two.
+ */
+typedef struct
+{
+    UART_T           *uart;             /*!< UART module served by this buffer */
+    uint8_t          *pu8TxBuf;         /*!< Transmit ring storage */
+    uint32_t          u32TxSize;        /*!< Transmit ring size in bytes (power of two) */
+    volatile uint32_t u32TxHead;        /*!< Transmit ring write index (application) */
+    volatile uint32_t u32TxTail;        /*!< Transmit ring read index (interrupt handler) */
+    uint8_t          *pu8RxBuf;         /*!< Receive ring storage */
+    uint32_t          u32RxSize;        /*!< Receive ring size in bytes (power of two) */
+    volatile uint32_t u32RxHead;        /*!< Receive ring write index (interrupt handler) */
+    volatile uint32_t u32RxTail;        /*!< Receive ring read index (application) */
+    volatile uint32_t u32RxOverflow;    /*!< Received bytes dropped because the receive ring was full */
+    volatile uint32_t u32TxOverflow;    /*!< Bytes rejected by UART_WriteAsync because the transmit ring was full */
+    volatile uint32_t u32FifoOverrun;   /*!< Hardware RX FIFO overrun events (RXOVIF) */
+} UART_BUF_T;
+
+/**
+ *  @brief  PDMA circular receive control block.
+ *
+ *  @details A PDMA channel loops forever over UART_PDMA_RX_SEG_NUM scatter-gather descriptors that split the receive
+ *           ring into equal segments, so received bytes never need CPU attention. The current write position is
+ *           derived from PDMA CURSCAT and the remaining TXCNT of the channel. The descriptors live in this block;
+ *           it must be placed in SRAM addressed by PDMA SCATBA.
+ */
+typedef struct
+{
+    DSCT_T            asDesc[UART_PDMA_RX_SEG_NUM];     /*!< Scatter-gather descriptors, last one links back to the first */
+    UART_T           *uart;             /*!< UART module served by this receiver */
+    PDMA_T           *pdma;             /*!< PDMA module moving the data */
+    uint32_t          u32Ch;            /*!< PDMA channel moving the data */
+    uint8_t          *pu8Buf;           /*!< Receive ring storage */
+    uint32_t          u32Size;          /*!< Receive ring size in bytes */
+    uint32_t          u32SegSize;       /*!< Bytes moved by each descriptor */
+    volatile uint32_t u32ReadPos;       /*!< Ring offset of the oldest byte not consumed by the application */
+    volatile uint32_t u32FramePos;      /*!< Ring offset of the write position latched at the last idle-line event */
+    volatile uint32_t u32FrameCount;    /*!< Number of idle-line events (frame boundaries) seen */
+    volatile uint32_t u32FifoOverrun;   /*!< Hardware RX FIFO overrun events (RXOVIF) */
+} UART_PDMA_RX_T;
+
+/*@}*/ /* end of group UART_EXPORTED_STRUCTS */
+
+
 /** @addtogroup UART_EXPORTED_MACROS UART Exported Macros
   @{
 */
@@ -495,6 +563,43 @@ __STATIC_INLINE void UART_SET_RTS(UART_T* uart)
  */
 #define UART_PDMA_DISABLE(uart, u32FuncSel)    ((uart)->INTEN &= ~(u32FuncSel))
 
+/**
+ *    @brief        Get the number of bytes waiting in the UART receive ring
+ *
+ *    @param[in]    psBuf   The pointer of the UART ring buffer control block
+ *
+ *    @return       Number of received bytes not yet consumed by the application
+ *
+ *    @details      This macro returns the fill level of the receive ring. It never touches the UART registers.
+ *    \hideinitializer
+ */
+#define UART_BUF_GET_RX_COUNT(psBuf)    ((psBuf)->u32RxHead - (psBuf)->u32RxTail)
+
+/**
+ *    @brief        Get the free space of the UART transmit ring
+ *
+ *    @param[in]    psBuf   The pointer of the UART ring buffer control block
+ *
+ *    @return       Number of bytes that can be queued without overflow
+ *
+ *    @details      This macro returns the free space of the transmit ring. It never touches the UART registers.
+ *    \hideinitializer
+ */
+#define UART_BUF_GET_TX_FREE(psBuf)    ((psBuf)->u32TxSize - ((psBuf)->u32TxHead - (psBuf)->u32TxTail))
+
+/**
+ *    @brief        Check all data queued in the UART transmit ring has been moved to TX FIFO
+ *
+ *    @param[in]    psBuf   The pointer of the UART ring buffer control block
+ *
+ *    @retval       0 Transmit ring still holds data
+ *    @retval       1 Transmit ring is empty
+ *
+ *    @details      Use UART_IS_TX_EMPTY() afterwards to know the last byte has left the shift register.
+ *    \hideinitializer
+ */
+#define UART_BUF_IS_TX_DONE(psBuf)    (((psBuf)->u32TxHead == (psBuf)->u32TxTail) ? 1UL : 0UL)
+
 /*@}*/ /* end of group UART_EXPORTED_MACROS */
 
 
@@ -515,6 +620,22 @@ void UART_SelectIrDAMode(UART_T* uart, uint32_t u32Buadrate, uint32_t u32Directi
 void UART_SelectRS485Mode(UART_T* uart, uint32_t u32Mode, uint32_t u32Addr);
 uint32_t UART_Write(UART_T* uart, uint8_t pu8TxBuf[], uint32_t u32WriteBytes);
 void UART_SelectSingleWireMode(UART_T *uart);
+int32_t UART_BufInit(UART_BUF_T *psBuf, UART_T *uart, uint8_t pu8TxBuf[], uint32_t u32TxSize, uint8_t pu8RxBuf[], uint32_t u32RxSize);
+void UART_BufClose(UART_BUF_T *psBuf);
+void UART_BufIRQHandler(UART_BUF_T *psBuf);
+uint32_t UART_WriteAsync(UART_BUF_T *psBuf, const uint8_t pu8TxData[], uint32_t u32WriteBytes);
+uint32_t UART_ReadAvailable(UART_BUF_T *psBuf, uint8_t pu8RxData[], uint32_t u32ReadBytes);
+uint32_t UART_PeekRx(UART_BUF_T *psBuf, uint8_t **ppu8Data);
+void UART_ConsumeRx(UART_BUF_T *psBuf, uint32_t u32Bytes);
+uint32_t UART_ReserveTx(UART_BUF_T *psBuf, uint8_t **ppu8Data);
+void UART_CommitTx(UART_BUF_T *psBuf, uint32_t u32Bytes);
+int32_t UART_PDMARxStart(UART_PDMA_RX_T *psRx, UART_T *uart, PDMA_T *pdma, uint32_t u32Ch, uint8_t pu8Buf[], uint32_t u32Size);
+void UART_PDMARxStop(UART_PDMA_RX_T *psRx);
+uint32_t UART_PDMARxIRQHandler(UART_PDMA_RX_T *psRx);
+uint32_t UART_PDMARxGetWritePos(UART_PDMA_RX_T *psRx);
+uint32_t UART_PDMARxGetCount(UART_PDMA_RX_T *psRx);
+uint32_t UART_PDMARxPeek(UART_PDMA_RX_T *psRx, uint8_t **ppu8Data);
+void UART_PDMARxConsume(UART_PDMA_RX_T *psRx, uint32_t u32Bytes);
 
 
 
@@ -59,8 +59,30 @@ extern "C"
 #define USPI_TX_FULL_MASK            (0x10ul)                          /*!< TX full status mask \hideinitializer */
 #define USPI_SSLINE_STS_MASK         (0x20ul)                          /*!< USCI_SPI_SS line status mask \hideinitializer */
 
+/* USCI_SPI Transfer Return Codes */
+#define USPI_XFER_OK                 ( 0L)                             /*!< Transfer completed \hideinitializer */
+#define USPI_XFER_ERR_PARAM          (-1L)                             /*!< Invalid USCI_SPI module, buffer alignment or length \hideinitializer */
+#define USPI_XFER_ERR_BUSY           (-2L)                             /*!< A transfer is in progress on the USCI_SPI module \hideinitializer */
+#define USPI_XFER_ERR_TIMEOUT        (-3L)                             /*!< Transfer did not complete in USPI_TIMEOUT \hideinitializer */
+#define USPI_XFER_ERR_NO_CH          (-4L)                             /*!< No free PDMA channel for the PDMA path \hideinitializer */
+#define USPI_XFER_ERR_ABORT          (-5L)                             /*!< PDMA target abort \hideinitializer */
+#define USPI_TIMEOUT                 SystemCoreClock                   /*!< Blocking transfer time-out counter (about 1 second) \hideinitializer */
+
 /*@}*/ /* end of group USCI_SPI_EXPORTED_CONSTANTS */
 
+/** @addtogroup USCI_SPI_EXPORTED_STRUCTS USCI_SPI Exported Structs
+  @{
+*/
+
+/**
+  * @brief  Transfer completion callback
+  * @details i32Status is \ref USPI_XFER_OK, or \ref USPI_XFER_ERR_ABORT on the PDMA path. It is called in interrupt
+  *          context by USPI_TransferIRQHandler(), or by PDMA_IRQHandler() on the PDMA path.
+  */
+typedef void (*USPI_XFER_CALLBACK_T)(USPI_T *uspi, int32_t i32Status, void *pvUserData);
+
+/*@}*/ /* end of group USCI_SPI_EXPORTED_STRUCTS */
+
 
 /** @addtogroup USCI_SPI_EXPORTED_MACROS USCI_SPI Exported Macros
   @{
@@ -416,6 +438,11 @@ void USPI_ClearIntFlag(USPI_T *uspi, uint32_t u32Mask);
 uint32_t USPI_GetStatus(USPI_T *uspi, uint32_t u32Mask);
 void USPI_EnableWakeup(USPI_T *uspi);
 void USPI_DisableWakeup(USPI_T *uspi);
+int32_t USPI_TransferSetPDMA(USPI_T *uspi, PDMA_T *pdma, uint32_t u32Threshold);
+int32_t USPI_Transfer(USPI_T *uspi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len);
+int32_t USPI_TransferAsync(USPI_T *uspi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, USPI_XFER_CALLBACK_T pfnCallback, void *pvUserData);
+uint32_t USPI_TransferIsBusy(USPI_T *uspi);
+void USPI_TransferIRQHandler(USPI_T *uspi);
 
 
 /*@}*/ /* end of group USCI_SPI_EXPORTED_FUNCTIONS */
@@ -16,6 +16,20 @@
   @{
 */
 
+/* PDMA update state */
+static PDMA_T *s_pCrcPdma;                  /* PDMA module of the update in progress, NULL if idle */
+static uint32_t s_u32CrcPdmaCh;             /* Channel requested for the update in progress */
+static DSCT_T s_sCrcDesc;                   /* Descriptor of the whole words */
+static const uint8_t *s_pu8CrcTail;         /* Bytes after the last whole word, written by CPU at the end */
+static uint32_t s_u32CrcTailLen;
+static uint32_t s_u32CrcDatLen;             /* CPU write data length restored at the end */
+static CRC_DMA_CALLBACK_T s_pfnCrcCallback;
+static void *s_pvCrcUserData;
+
+static void CRC_WriteBytes(const uint8_t *pu8Buf, uint32_t u32Len);
+static void CRC_DMAFinish(void);
+static void CRC_DMADone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData);
+
 /** @addtogroup CRC_EXPORTED_FUNCTIONS CRC Exported Functions
   @{
 */
@@ -103,8 +117,320 @@ uint32_t CRC_GetChecksum(void)
     return ret;
 }
 
+/**
+  * @brief      Feed bytes to the CRC stream
+  *
+  * @param[in]  pvBuf           Data bytes.
+  * @param[in]  u32Len          Number of bytes.
+  *
+  * @return     None
+  *
+  * @details    The bytes up to the first word boundary and after the last one are written with 8-bit CPU write data
+  *             length, the words between them with 32-bit length, so the result is the checksum of the byte stream
+  *             whatever the buffer alignment. The CPU write data length set by CRC_Open() is restored at the end.
+  *             It must not be called while CRC_UpdateDMA() is in progress.
+  */
+void CRC_Update(const void *pvBuf, uint32_t u32Len)
+{
+    const uint8_t *pu8Buf = (const uint8_t *)pvBuf;
+    const uint32_t *pu32Buf;
+    uint32_t u32Head, u32Words, u32DatLen;
+
+    u32DatLen = CRC->CTL & CRC_CTL_DATLEN_Msk;
+
+    u32Head = (4UL - ((uint32_t)pu8Buf & 3UL)) & 3UL;
+
+    if(u32Head > u32Len)
+    {
+        u32Head = u32Len;
+    }
+
+    CRC_WriteBytes(pu8Buf, u32Head);
+    pu8Buf += u32Head;
+    u32Len -= u32Head;
+
+    u32Words = u32Len >> 2;
+
+    if(u32Words)
+    {
+        CRC->CTL = (CRC->CTL & ~CRC_CTL_DATLEN_Msk) | CRC_CPU_WDATA_32;
+        pu32Buf = (const uint32_t *)(const void *)pu8Buf;
+
+        /* Unrolled by 4 to keep the write loop overhead off the CRC engine */
+        while(u32Words >= 4UL)
+        {
+            CRC->DAT = pu32Buf[0];
+            CRC->DAT = pu32Buf[1];
+            CRC->DAT = pu32Buf[2];
+            CRC->DAT = pu32Buf[3];
+            pu32Buf += 4;
+            u32Words -= 4UL;
+        }
+
+        while(u32Words--)
+        {
+            CRC->DAT = *pu32Buf++;
+        }
+
+        pu8Buf = (const uint8_t *)pu32Buf;
+    }
+
+    CRC_WriteBytes(pu8Buf, u32Len & 3UL);
+
+    CRC->CTL = (CRC->CTL & ~CRC_CTL_DATLEN_Msk) | u32DatLen;
+}
+
+/**
+  * @brief      Feed bytes to the CRC stream by PDMA
+  *
+  * @param[in]  pdma            The pointer of the PDMA module.
+  * @param[in]  pvBuf           Data bytes.
+  * @param[in]  u32Len          Number of bytes, the whole words between the unaligned head and tail bytes
+  *                             must not exceed \ref PDMA_TXCNT_MAX.
+  * @param[in]  pfnCallback     Completion callback. NULL waits for completion in this function.
+  * @param[in]  pvUserData      User data of the callback.
+  *
+  * @retval     CRC_OK          Completed (pfnCallback is NULL) or started.
+  * @retval     CRC_ERR_PARAM   Invalid PDMA module or too long buffer.
+  * @retval     CRC_ERR_BUSY    A PDMA update is in progress.
+  * @retval     CRC_ERR_NO_CH   PDMA_RequestChannel() found no free channel.
+  *
+  * @details    The unaligned head bytes are written by CPU, the words are moved to CRC_DAT by a memory-to-peripheral
+  *             PDMA transfer and the tail bytes are written by CPU when it is done. The result is the same as
+  *             CRC_Update(). The channel is requested by PDMA_RequestChannel() and released at the end. An
+  *             asynchronous update completes in the channel callback, so PDMA0_IRQHandler must call PDMA_IRQHandler()
+  *             and PDMA interrupt must be enabled in NVIC. The buffer must stay valid until completion.
+  */
+int32_t CRC_UpdateDMA(PDMA_T *pdma, const void *pvBuf, uint32_t u32Len, CRC_DMA_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    const uint8_t *pu8Buf = (const uint8_t *)pvBuf;
+    uint32_t u32Head, u32Words, u32PriMask;
+    int32_t i32Ch;
+
+    u32Head = (4UL - ((uint32_t)pu8Buf & 3UL)) & 3UL;
+
+    if(u32Head > u32Len)
+    {
+        u32Head = u32Len;
+    }
+
+    u32Words = (u32Len - u32Head) >> 2;
+
+    if((pdma == NULL) || (u32Words > PDMA_TXCNT_MAX))
+    {
+        return CRC_ERR_PARAM;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    if(s_pCrcPdma != NULL)
+    {
+        __set_PRIMASK(u32PriMask);
+        return CRC_ERR_BUSY;
+    }
+
+    /* No whole word for PDMA, only head and tail bytes */
+    if(u32Words == 0UL)
+    {
+        __set_PRIMASK(u32PriMask);
+        CRC_Update(pu8Buf, u32Len);
+
+        if(pfnCallback != NULL)
+        {
+            pfnCallback(pvUserData);
+        }
+
+        return CRC_OK;
+    }
+
+    s_pCrcPdma = pdma;
+    __set_PRIMASK(u32PriMask);
+
+    i32Ch = PDMA_RequestChannel(pdma, 0UL);
+
+    if(i32Ch < 0)
+    {
+        s_pCrcPdma = NULL;
+        return CRC_ERR_NO_CH;
+    }
+
+    s_u32CrcPdmaCh = (uint32_t)i32Ch;
+    s_u32CrcDatLen = CRC->CTL & CRC_CTL_DATLEN_Msk;
+    s_pu8CrcTail = pu8Buf + u32Head + (u32Words << 2);
+    s_u32CrcTailLen = (u32Len - u32Head) & 3UL;
+    s_pfnCrcCallback = pfnCallback;
+    s_pvCrcUserData = pvUserData;
+
+    CRC_WriteBytes(pu8Buf, u32Head);
+    CRC->CTL = (CRC->CTL & ~CRC_CTL_DATLEN_Msk) | CRC_CPU_WDATA_32;
+
+    /* The words are aligned and the count was checked */
+    PDMA_DescInit(&s_sCrcDesc, PDMA_WIDTH_32, (uint32_t)(pu8Buf + u32Head), PDMA_SAR_INC, (uint32_t)&CRC->DAT, PDMA_DAR_FIX,
+                  u32Words, PDMA_REQ_BURST | PDMA_BURST_4);
+
+    if(pfnCallback != NULL)
+    {
+        PDMA_SetCallback(pdma, s_u32CrcPdmaCh, CRC_DMADone, NULL);
+    }
+
+    /* Memory-to-peripheral transfer is started by software request */
+    if(PDMA_StartChain(pdma, s_u32CrcPdmaCh, PDMA_MEM, &s_sCrcDesc) != 0)
+    {
+        /* The descriptor is out of the PDMA SCATBA window, write the words by CPU */
+        CRC_Update(pu8Buf + u32Head, u32Words << 2);
+        CRC_DMAFinish();
+
+        if(pfnCallback != NULL)
+        {
+            pfnCallback(pvUserData);
+        }
+
+        return CRC_OK;
+    }
+
+    if(pfnCallback == NULL)
+    {
+        while(((PDMA_GET_TD_STS(pdma) | PDMA_GET_ABORT_STS(pdma)) & (1UL << s_u32CrcPdmaCh)) == 0UL) {}
+
+        CRC_DMAFinish();
+    }
+
+    return CRC_OK;
+}
+
+/**
+  * @brief      Check if a PDMA update is in progress
+  *
+  * @param[in]  None
+  *
+  * @retval     0               No PDMA update is in progress.
+  * @retval     1               A PDMA update is in progress.
+  */
+uint32_t CRC_IsBusy(void)
+{
+    return (s_pCrcPdma != NULL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief      Save the context of the current CRC stream
+  *
+  * @param[out] psCtx           The context.
+  *
+  * @return     None
+  *
+  * @details    The checksum reverse and complement attributes are undone to get the raw CRC state, so restoring it
+  *             as seed continues the stream where it was saved.
+  */
+void CRC_SaveContext(CRC_CONTEXT_T *psCtx)
+{
+    uint32_t u32Ctl = CRC->CTL;
+    uint32_t u32Bits, u32Mask, u32State;
+
+    switch(u32Ctl & CRC_CTL_CRCMODE_Msk)
+    {
+    case CRC_8:
+        u32Bits = 8UL;
+        break;
+    case CRC_32:
+        u32Bits = 32UL;
+        break;
+    default:
+        u32Bits = 16UL;
+        break;
+    }
+
+    u32Mask = 0xFFFFFFFFUL >> (32UL - u32Bits);
+    u32State = CRC->CHECKSUM & u32Mask;
+
+    if(u32Ctl & CRC_CHECKSUM_COM)
+    {
+        u32State ^= u32Mask;
+    }
+
+    if(u32Ctl & CRC_CHECKSUM_RVS)
+    {
+        u32State = __RBIT(u32State) >> (32UL - u32Bits);
+    }
+
+    psCtx->u32Ctl = u32Ctl & (CRC_CTL_CRCMODE_Msk | CRC_CTL_DATLEN_Msk | CRC_CTL_CHKSFMT_Msk | CRC_CTL_DATFMT_Msk |
+                              CRC_CTL_CHKSREV_Msk | CRC_CTL_DATREV_Msk);
+    psCtx->u32Polynomial = CRC->POLYNOMIAL;
+    psCtx->u32State = u32State;
+}
+
+/**
+  * @brief      Restore the context of a CRC stream
+  *
+  * @param[in]  psCtx           The context saved by CRC_SaveContext().
+  *
+  * @return     None
+  *
+  * @details    The following writes continue the saved stream. It must not be called while CRC_UpdateDMA() is in progress.
+  */
+void CRC_RestoreContext(const CRC_CONTEXT_T *psCtx)
+{
+    CRC->POLYNOMIAL = psCtx->u32Polynomial;
+    CRC->SEED = psCtx->u32State;
+    CRC->CTL = psCtx->u32Ctl | CRC_CTL_CRCEN_Msk;
+
+    /* Setting CHKSINIT bit will reload the saved state from CRC_SEED register to CRC controller */
+    CRC->CTL |= CRC_CTL_CHKSINIT_Msk;
+}
+
 /*@}*/ /* end of group CRC_EXPORTED_FUNCTIONS */
 
+/**
+  * @brief      Write bytes with 8-bit CPU write data length.
+  */
+static void CRC_WriteBytes(const uint8_t *pu8Buf, uint32_t u32Len)
+{
+    if(u32Len == 0UL)
+    {
+        return;
+    }
+
+    CRC->CTL = (CRC->CTL & ~CRC_CTL_DATLEN_Msk) | CRC_CPU_WDATA_8;
+
+    while(u32Len--)
+    {
+        CRC->DAT = *pu8Buf++;
+    }
+}
+
+/**
+  * @brief      End a PDMA update: write the tail bytes, restore the CPU write data length and release the channel.
+  */
+static void CRC_DMAFinish(void)
+{
+    PDMA_T *pdma = s_pCrcPdma;
+
+    PDMA_CLR_TD_FLAG(pdma, 1UL << s_u32CrcPdmaCh);
+    PDMA_CLR_ABORT_FLAG(pdma, 1UL << s_u32CrcPdmaCh);
+    PDMA_ReleaseChannel(pdma, s_u32CrcPdmaCh);
+
+    CRC_WriteBytes(s_pu8CrcTail, s_u32CrcTailLen);
+    CRC->CTL = (CRC->CTL & ~CRC_CTL_DATLEN_Msk) | s_u32CrcDatLen;
+
+    s_pCrcPdma = NULL;
+}
+
+/**
+  * @brief      PDMA channel callback of an asynchronous update.
+  */
+static void CRC_DMADone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    CRC_DMA_CALLBACK_T pfnCallback = s_pfnCrcCallback;
+    void *pvCbData = s_pvCrcUserData;
+
+    (void)u32Ch;
+    (void)u32Event;
+    (void)pvUserData;
+
+    CRC_DMAFinish();
+    pfnCallback(pvCbData);
+}
+
 /*@}*/ /* end of group CRC_Driver */
 
 /*@}*/ /* end of group Standard_Driver */
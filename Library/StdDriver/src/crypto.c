@@ -41,6 +41,324 @@
 
 /* // @cond HIDDEN_SYMBOLS */
 
+#define AES_INT_Msk         (CRPT_INTSTS_AESIF_Msk | CRPT_INTSTS_AESEIF_Msk)
+
+/* CFB, OFB and CTR only use the AES encryption of the IV, a stream can stop and resume inside a block */
+#define AES_IS_STREAM_MODE(mode)    (((mode) == AES_MODE_CFB) || ((mode) == AES_MODE_OFB) || ((mode) == AES_MODE_CTR))
+#define AES_IS_CS_MODE(mode)        (((mode) == AES_MODE_CBC_CS1) || ((mode) == AES_MODE_CBC_CS2) || ((mode) == AES_MODE_CBC_CS3))
+
+static AES_CONTEXT_T *volatile s_psAesCtx;     /* Context of the AES_Update()/AES_Final() in progress */
+
+static uint32_t AES_GetBE32(const uint8_t *pu8Buf)
+{
+    return ((uint32_t)pu8Buf[0] << 24) | ((uint32_t)pu8Buf[1] << 16) | ((uint32_t)pu8Buf[2] << 8) | pu8Buf[3];
+}
+
+static void AES_PutBE32(uint8_t *pu8Buf, uint32_t u32Val)
+{
+    pu8Buf[0] = (uint8_t)(u32Val >> 24);
+    pu8Buf[1] = (uint8_t)(u32Val >> 16);
+    pu8Buf[2] = (uint8_t)(u32Val >> 8);
+    pu8Buf[3] = (uint8_t)u32Val;
+}
+
+/* Wait for the end of a DMA round. AESIF is set when the last input is fed, BUSY clears when the last output is written. */
+static int32_t AES_WaitDone(CRPT_T *crpt)
+{
+    uint32_t u32TimeOutCnt = AES_TIMEOUT;
+    int32_t i32Ret;
+
+    while(((crpt->INTSTS & CRPT_INTSTS_AESEIF_Msk) == 0UL) &&
+            (((crpt->INTSTS & CRPT_INTSTS_AESIF_Msk) == 0UL) || (crpt->AES_STS & CRPT_AES_STS_BUSY_Msk)))
+    {
+        if(--u32TimeOutCnt == 0UL)
+        {
+            crpt->AES_CTL = CRPT_AES_CTL_STOP_Msk;
+            return AES_ERR_TIMEOUT;
+        }
+    }
+
+    i32Ret = (crpt->INTSTS & CRPT_INTSTS_AESEIF_Msk) ? AES_ERR_ENGINE : AES_OK;
+    crpt->INTSTS = AES_INT_Msk;
+
+    return i32Ret;
+}
+
+/* Load the key and IV of the context and run one DMA round. Unless u32Async it waits for the end of the round. */
+static int32_t AES_RunDMA(CRPT_T *crpt, const AES_CONTEXT_T *psCtx, uint32_t u32Ctl, uint32_t u32Src, uint32_t u32Dst,
+                          uint32_t u32Len, uint32_t u32Async)
+{
+    uint32_t i, u32KeyWords;
+
+    u32KeyWords = 4UL + ((u32Ctl & CRPT_AES_CTL_KEYSZ_Msk) >> CRPT_AES_CTL_KEYSZ_Pos) * 2UL;
+
+    for(i = 0UL; i < u32KeyWords; i++)
+    {
+        crpt->AES_KEY[i] = psCtx->au32Key[i];
+    }
+
+    for(i = 0UL; i < 4UL; i++)
+    {
+        crpt->AES_IV[i] = psCtx->au32IV[i];
+    }
+
+    crpt->AES_SADDR = u32Src;
+    crpt->AES_DADDR = u32Dst;
+    crpt->AES_CNT = u32Len;
+    crpt->INTSTS = AES_INT_Msk;
+
+    if(u32Async)
+    {
+        crpt->INTEN |= (CRPT_INTEN_AESIEN_Msk | CRPT_INTEN_AESEIEN_Msk);
+    }
+    else
+    {
+        crpt->INTEN &= ~(CRPT_INTEN_AESIEN_Msk | CRPT_INTEN_AESEIEN_Msk);
+    }
+
+    crpt->AES_CTL = u32Ctl | (CRYPTO_DMA_ONE_SHOT << CRPT_AES_CTL_DMALAST_Pos) | CRPT_AES_CTL_START_Msk;
+
+    return u32Async ? AES_OK : AES_WaitDone(crpt);
+}
+
+/* The feedback registers hold the IV of the block after the round */
+static void AES_SaveIV(const CRPT_T *crpt, AES_CONTEXT_T *psCtx)
+{
+    uint32_t i;
+
+    for(i = 0UL; i < 4UL; i++)
+    {
+        psCtx->au32IV[i] = crpt->AES_FDBCK[i];
+    }
+}
+
+/* Whole blocks, one DMA round for word aligned buffers, otherwise block by block through the context buffer */
+static int32_t AES_RunBlocks(CRPT_T *crpt, AES_CONTEXT_T *psCtx, const uint8_t *pu8In, uint8_t *pu8Out,
+                             uint32_t u32Len, uint32_t u32Async)
+{
+    int32_t i32Ret = AES_OK;
+
+    if((((uint32_t)pu8In | (uint32_t)pu8Out) & 3UL) == 0UL)
+    {
+        i32Ret = AES_RunDMA(crpt, psCtx, psCtx->u32Ctl, (uint32_t)pu8In, (uint32_t)pu8Out, u32Len, u32Async);
+
+        if((i32Ret == AES_OK) && (u32Async == 0UL))
+        {
+            AES_SaveIV(crpt, psCtx);
+        }
+
+        return i32Ret;
+    }
+
+    while((u32Len != 0UL) && (i32Ret == AES_OK))
+    {
+        memcpy(psCtx->au32Buf, pu8In, 16UL);
+        i32Ret = AES_RunDMA(crpt, psCtx, psCtx->u32Ctl, (uint32_t)psCtx->au32Buf, (uint32_t)psCtx->au32Buf, 16UL, 0UL);
+        AES_SaveIV(crpt, psCtx);
+        memcpy(pu8Out, psCtx->au32Buf, 16UL);
+        pu8In += 16;
+        pu8Out += 16;
+        u32Len -= 16UL;
+    }
+
+    return i32Ret;
+}
+
+/* Keystream block of a partial block: the AES encryption of the IV, by one ECB round on the context buffer */
+static int32_t AES_Keystream(CRPT_T *crpt, AES_CONTEXT_T *psCtx)
+{
+    uint8_t *pu8Ks = (uint8_t *)psCtx->au32Buf;
+    uint32_t i, u32Ctl;
+
+    for(i = 0UL; i < 4UL; i++)
+    {
+        AES_PutBE32(&pu8Ks[i * 4UL], psCtx->au32IV[i]);
+    }
+
+    u32Ctl = (psCtx->u32Ctl & ~(CRPT_AES_CTL_OPMODE_Msk | CRPT_AES_CTL_ENCRPT_Msk)) |
+             (AES_MODE_ECB << CRPT_AES_CTL_OPMODE_Pos) | CRPT_AES_CTL_ENCRPT_Msk;
+
+    return AES_RunDMA(crpt, psCtx, u32Ctl, (uint32_t)pu8Ks, (uint32_t)pu8Ks, 16UL, 0UL);
+}
+
+/* XOR bytes with the keystream block. When the block is used up the IV moves to the next block as the engine does. */
+static void AES_XorKeystream(AES_CONTEXT_T *psCtx, const uint8_t *pu8In, uint8_t *pu8Out, uint32_t u32Len)
+{
+    const uint8_t *pu8Ks = (const uint8_t *)&psCtx->au32Buf[0];
+    uint8_t *pu8Fb = (uint8_t *)&psCtx->au32Buf[4];
+    uint32_t i, u32Pos = psCtx->u32Pos;
+    uint8_t u8In, u8Out;
+
+    while(u32Len--)
+    {
+        u8In = *pu8In++;
+        u8Out = u8In ^ pu8Ks[u32Pos];
+        *pu8Out++ = u8Out;
+
+        /* CFB feeds back the ciphertext */
+        pu8Fb[u32Pos++] = (psCtx->u32Ctl & CRPT_AES_CTL_ENCRPT_Msk) ? u8Out : u8In;
+    }
+
+    if(u32Pos == 16UL)
+    {
+        if(psCtx->u32OpMode == AES_MODE_CTR)
+        {
+            /* 128-bit big-endian counter */
+            for(i = 4UL; i > 0UL; i--)
+            {
+                if(++psCtx->au32IV[i - 1UL] != 0UL)
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            for(i = 0UL; i < 4UL; i++)
+            {
+                psCtx->au32IV[i] = AES_GetBE32((psCtx->u32OpMode == AES_MODE_OFB) ? &pu8Ks[i * 4UL] : &pu8Fb[i * 4UL]);
+            }
+        }
+
+        u32Pos = 0UL;
+    }
+
+    psCtx->u32Pos = u32Pos;
+}
+
+/* After the whole blocks: tail bytes, end of the stream, release the engine and call back */
+static int32_t AES_Complete(CRPT_T *crpt, AES_CONTEXT_T *psCtx, int32_t i32Ret)
+{
+    AES_CALLBACK_T pfnCallback = psCtx->pfnCallback;
+    void *pvUserData = psCtx->pvUserData;
+    uint32_t u32Len = psCtx->u32TailLen;
+
+    if((i32Ret == AES_OK) && (u32Len != 0UL))
+    {
+        if(AES_IS_STREAM_MODE(psCtx->u32OpMode))
+        {
+            i32Ret = AES_Keystream(crpt, psCtx);
+
+            if(i32Ret == AES_OK)
+            {
+                AES_XorKeystream(psCtx, psCtx->pu8TailIn, psCtx->pu8TailOut, u32Len);
+            }
+        }
+        else
+        {
+            /* Last two blocks of ciphertext stealing, 17 to 32 bytes in one round */
+            memcpy(psCtx->au32Buf, psCtx->pu8TailIn, u32Len);
+            i32Ret = AES_RunDMA(crpt, psCtx, (psCtx->u32Ctl & ~CRPT_AES_CTL_OPMODE_Msk) | (psCtx->u32OpMode << CRPT_AES_CTL_OPMODE_Pos),
+                                (uint32_t)psCtx->au32Buf, (uint32_t)psCtx->au32Buf, u32Len, 0UL);
+            memcpy(psCtx->pu8TailOut, psCtx->au32Buf, u32Len);
+        }
+    }
+
+    if(psCtx->u32Final)
+    {
+        /* Wipe the key material, the context needs AES_Init() again */
+        memset(psCtx->au32Key, 0, sizeof(psCtx->au32Key));
+        memset(psCtx->au32IV, 0, sizeof(psCtx->au32IV));
+        memset(psCtx->au32Buf, 0, sizeof(psCtx->au32Buf));
+        psCtx->u32Ctl = 0UL;
+        psCtx->u32Pos = 0UL;
+    }
+
+    s_psAesCtx = NULL;
+
+    if(pfnCallback != NULL)
+    {
+        pfnCallback(psCtx, i32Ret, pvUserData);
+    }
+
+    return i32Ret;
+}
+
+static int32_t AES_Process(CRPT_T *crpt, AES_CONTEXT_T *psCtx, const uint8_t *pu8In, uint8_t *pu8Out, uint32_t u32Len,
+                           uint32_t u32Final, AES_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    uint32_t u32Head = 0UL, u32Body, u32Tail, u32Async, u32PriMask;
+    int32_t i32Ret = AES_OK;
+
+    if((crpt == NULL) || (psCtx == NULL) || (psCtx->u32Ctl == 0UL) || ((u32Len != 0UL) && ((pu8In == NULL) || (pu8Out == NULL))))
+    {
+        return AES_ERR_PARAM;
+    }
+
+    if(AES_IS_STREAM_MODE(psCtx->u32OpMode))
+    {
+        /* Finish the keystream block of the previous call first */
+        if(psCtx->u32Pos != 0UL)
+        {
+            u32Head = ((16UL - psCtx->u32Pos) < u32Len) ? (16UL - psCtx->u32Pos) : u32Len;
+        }
+
+        u32Body = (u32Len - u32Head) & ~15UL;
+        u32Tail = u32Len - u32Head - u32Body;
+    }
+    else if(u32Final && AES_IS_CS_MODE(psCtx->u32OpMode))
+    {
+        /* The last two blocks must be in the last round */
+        if(u32Len <= 16UL)
+        {
+            return AES_ERR_PARAM;
+        }
+
+        u32Tail = (u32Len & 15UL) ? (16UL + (u32Len & 15UL)) : 32UL;
+        u32Body = u32Len - u32Tail;
+    }
+    else
+    {
+        if(u32Len & 15UL)
+        {
+            return AES_ERR_PARAM;
+        }
+
+        u32Body = u32Len;
+        u32Tail = 0UL;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    if(s_psAesCtx != NULL)
+    {
+        __set_PRIMASK(u32PriMask);
+        return AES_ERR_BUSY;
+    }
+
+    s_psAesCtx = psCtx;
+    __set_PRIMASK(u32PriMask);
+
+    psCtx->pu8TailIn = pu8In + u32Head + u32Body;
+    psCtx->pu8TailOut = pu8Out + u32Head + u32Body;
+    psCtx->u32TailLen = u32Tail;
+    psCtx->u32Final = u32Final;
+    psCtx->pfnCallback = pfnCallback;
+    psCtx->pvUserData = pvUserData;
+
+    if(u32Head != 0UL)
+    {
+        AES_XorKeystream(psCtx, pu8In, pu8Out, u32Head);
+        pu8In += u32Head;
+        pu8Out += u32Head;
+    }
+
+    if(u32Body != 0UL)
+    {
+        /* Only a word aligned DMA round runs asynchronously, the rest completes before returning */
+        u32Async = ((pfnCallback != NULL) && ((((uint32_t)pu8In | (uint32_t)pu8Out) & 3UL) == 0UL)) ? 1UL : 0UL;
+        i32Ret = AES_RunBlocks(crpt, psCtx, pu8In, pu8Out, u32Body, u32Async);
+
+        if(u32Async && (i32Ret == AES_OK))
+        {
+            return AES_OK;
+        }
+    }
+
+    return AES_Complete(crpt, psCtx, i32Ret);
+}
+
 /* // @endcond HIDDEN_SYMBOLS */
 
 /**
@@ -170,6 +488,145 @@ void AES_SetDMATransfer(CRPT_T *crpt, uint32_t u32Channel, uint32_t u32SrcAddr,
 }
 
 
+/**
+  * @brief  Initialize an AES stream context
+  * @param[out] psCtx        The context.
+  * @param[in]  u32EncDec    1: AES encode;  0: AES decode
+  * @param[in]  u32OpMode    AES operation mode, including:
+  *         - \ref AES_MODE_ECB
+  *         - \ref AES_MODE_CBC
+  *         - \ref AES_MODE_CFB
+  *         - \ref AES_MODE_OFB
+  *         - \ref AES_MODE_CTR
+  *         - \ref AES_MODE_CBC_CS1
+  *         - \ref AES_MODE_CBC_CS2
+  *         - \ref AES_MODE_CBC_CS3
+  * @param[in]  u32KeySize is AES key size, including:
+  *         - \ref AES_KEY_SIZE_128
+  *         - \ref AES_KEY_SIZE_192
+  *         - \ref AES_KEY_SIZE_256
+  * @param[in]  au32Key      Key words, as AES_SetKey().
+  * @param[in]  au32IV       Four IV words, as AES_SetInitVect(). The initial counter in CTR mode. Can be NULL in ECB mode.
+  * @retval AES_OK          The context is ready.
+  * @retval AES_ERR_PARAM   Invalid mode, key size or NULL key.
+  * @details The key and IV are copied to the context. The data of AES_Update() and AES_Final() is a byte stream,
+  *          i.e. AES_IN_OUT_SWAP, the AES engine is programmed by each call.
+  */
+int32_t AES_Init(AES_CONTEXT_T *psCtx, uint32_t u32EncDec, uint32_t u32OpMode, uint32_t u32KeySize,
+                 const uint32_t au32Key[], const uint32_t au32IV[])
+{
+    uint32_t u32RoundMode = AES_IS_CS_MODE(u32OpMode) ? AES_MODE_CBC : u32OpMode;
+
+    if((psCtx == NULL) || (au32Key == NULL) || (u32KeySize > AES_KEY_SIZE_256) ||
+            ((u32OpMode > AES_MODE_CTR) && !AES_IS_CS_MODE(u32OpMode)) || ((au32IV == NULL) && (u32OpMode != AES_MODE_ECB)))
+    {
+        return AES_ERR_PARAM;
+    }
+
+    memset(psCtx, 0, sizeof(AES_CONTEXT_T));
+    memcpy(psCtx->au32Key, au32Key, (4UL + u32KeySize * 2UL) * 4UL);
+
+    if(au32IV != NULL)
+    {
+        memcpy(psCtx->au32IV, au32IV, sizeof(psCtx->au32IV));
+    }
+
+    /* Ciphertext stealing only changes the last two blocks, the rounds before AES_Final() are plain CBC */
+    psCtx->u32OpMode = u32OpMode;
+    psCtx->u32Ctl = ((u32EncDec ? 1UL : 0UL) << CRPT_AES_CTL_ENCRPT_Pos) |
+                    (u32RoundMode << CRPT_AES_CTL_OPMODE_Pos) |
+                    (u32KeySize << CRPT_AES_CTL_KEYSZ_Pos) |
+                    (AES_IN_OUT_SWAP << CRPT_AES_CTL_OUTSWAP_Pos) |
+                    CRPT_AES_CTL_DMAEN_Msk;
+
+    return AES_OK;
+}
+
+/**
+  * @brief  Encrypt or decrypt the next bytes of an AES stream
+  * @param[in]  crpt         The pointer of CRPT module
+  * @param[in]  psCtx        The context of AES_Init().
+  * @param[in]  pvIn         Input bytes.
+  * @param[out] pvOut        Output bytes, can be the same as pvIn.
+  * @param[in]  u32Len       Number of bytes. Any length in CFB, OFB and CTR mode, a multiple of 16 in the other modes.
+  * @param[in]  pfnCallback  Completion callback. NULL waits for completion in this function.
+  * @param[in]  pvUserData   User data of the callback.
+  * @retval AES_OK          Completed (pfnCallback is NULL) or started.
+  * @retval AES_ERR_PARAM   Invalid context, buffer or length.
+  * @retval AES_ERR_BUSY    Another AES_Update()/AES_Final() is in progress.
+  * @retval AES_ERR_TIMEOUT The AES engine did not finish.
+  * @retval AES_ERR_ENGINE  The AES engine reported an error.
+  * @details The whole blocks of word aligned buffers are done by one DMA round, the IV of the next call is read back
+  *          from the feedback registers. Unaligned buffers are done block by block through the context. In CFB, OFB
+  *          and CTR mode the bytes after the last whole block are XORed with a keystream block kept in the context,
+  *          the next call continues inside that block.
+  *          With pfnCallback the whole-block round completes in CRPT_IRQHandler, which must call AES_IRQHandler(),
+  *          and CRPT interrupt must be enabled in NVIC. The buffers must stay valid until completion.
+  */
+int32_t AES_Update(CRPT_T *crpt, AES_CONTEXT_T *psCtx, const void *pvIn, void *pvOut, uint32_t u32Len,
+                   AES_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    return AES_Process(crpt, psCtx, (const uint8_t *)pvIn, (uint8_t *)pvOut, u32Len, 0UL, pfnCallback, pvUserData);
+}
+
+/**
+  * @brief  Encrypt or decrypt the last bytes of an AES stream
+  * @param[in]  crpt         The pointer of CRPT module
+  * @param[in]  psCtx        The context of AES_Init().
+  * @param[in]  pvIn         Input bytes.
+  * @param[out] pvOut        Output bytes, can be the same as pvIn.
+  * @param[in]  u32Len       Number of bytes, can be 0. As AES_Update(), but in CBC-CS1/2/3 mode it must be more than 16
+  *                          and can be any length, the last two blocks are done by the ciphertext stealing mode.
+  * @param[in]  pfnCallback  Completion callback. NULL waits for completion in this function.
+  * @param[in]  pvUserData   User data of the callback.
+  * @return Same as AES_Update().
+  * @details The key and IV are wiped from the context at completion, psCtx needs AES_Init() before the next stream.
+  */
+int32_t AES_Final(CRPT_T *crpt, AES_CONTEXT_T *psCtx, const void *pvIn, void *pvOut, uint32_t u32Len,
+                  AES_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    return AES_Process(crpt, psCtx, (const uint8_t *)pvIn, (uint8_t *)pvOut, u32Len, 1UL, pfnCallback, pvUserData);
+}
+
+/**
+  * @brief  Check if an AES_Update()/AES_Final() is in progress
+  * @param  None
+  * @retval 0   The AES engine is free.
+  * @retval 1   An AES_Update()/AES_Final() is in progress.
+  */
+uint32_t AES_IsBusy(void)
+{
+    return (s_psAesCtx != NULL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  AES stream interrupt service
+  * @param[in]  crpt         The pointer of CRPT module
+  * @return None
+  * @details Call this function from CRPT_IRQHandler. When the DMA round of an asynchronous AES_Update()/AES_Final()
+  *          is done it saves the IV, processes the tail bytes and calls the callback.
+  */
+void AES_IRQHandler(CRPT_T *crpt)
+{
+    AES_CONTEXT_T *psCtx = s_psAesCtx;
+    int32_t i32Ret;
+
+    if((psCtx == NULL) || ((crpt->INTEN & CRPT_INTEN_AESIEN_Msk) == 0UL) || ((crpt->INTSTS & AES_INT_Msk) == 0UL))
+    {
+        return;
+    }
+
+    crpt->INTEN &= ~(CRPT_INTEN_AESIEN_Msk | CRPT_INTEN_AESEIEN_Msk);
+    i32Ret = AES_WaitDone(crpt);
+
+    if(i32Ret == AES_OK)
+    {
+        AES_SaveIV(crpt, psCtx);
+    }
+
+    (void)AES_Complete(crpt, psCtx, i32Ret);
+}
+
 /**@}*/ /* end of group CRYPTO_EXPORTED_FUNCTIONS */
 
 /**@}*/ /* end of group CRYPTO_Driver */
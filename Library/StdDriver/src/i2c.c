@@ -18,6 +18,29 @@
 
 int32_t g_I2C_i32ErrCode = 0;       /*!< I2C global error code */
 
+#define I2C_XFER_PORT_NUM   3UL
+
+static I2C_XFER_T *s_apsXferHead[I2C_XFER_PORT_NUM];   /* Transaction in progress, then the queued ones */
+static I2C_XFER_T *s_apsXferTail[I2C_XFER_PORT_NUM];
+
+/* PDMA payload state of an I2C port */
+typedef struct
+{
+    DSCT_T sDesc;                       /* Payload descriptor */
+    volatile uint32_t u32Event;         /* PDMA events reported by the channel callback */
+} I2C_PDMA_STATE_T;
+
+static I2C_PDMA_STATE_T s_asI2CPdma[I2C_XFER_PORT_NUM];
+
+static int32_t I2C_XferPort(I2C_T *i2c);
+static void I2C_XferStart(I2C_T *i2c, I2C_XFER_T *psXfer);
+static void I2C_XferFinish(I2C_T *i2c, uint32_t u32Port, int32_t i32Status, uint32_t u32Ctrl);
+static int32_t I2C_PDMAReq(I2C_T *i2c, uint32_t u32Rx);
+static int32_t I2C_PDMAStart(PDMA_T *pdma, uint32_t u32Ch, I2C_PDMA_STATE_T *psPdma, uint32_t u32Req, uint32_t u32SrcAddr, uint32_t u32SrcCtrl, uint32_t u32DstAddr, uint32_t u32DstCtrl, uint32_t u32Len);
+static void I2C_PDMADone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData);
+static uint32_t I2C_PDMAWrite(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, const uint8_t au8Reg[], uint32_t u32RegLen, uint8_t data[], uint32_t u32wLen);
+static uint32_t I2C_PDMARead(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, const uint8_t au8Reg[], uint32_t u32RegLen, uint8_t rdata[], uint32_t u32rLen);
+
 /** @addtogroup I2C_EXPORTED_FUNCTIONS I2C Exported Functions
   @{
 */
@@ -1482,9 +1505,843 @@ uint32_t I2C_ReadMultiBytesTwoRegs(I2C_T *i2c, uint8_t u8SlaveAddr, uint16_t u16
     return u32rxLen;                                                     /* Return bytes length that have been received */
 }
 
+/**
+  * @brief      Write multi bytes to Slave, the payload is moved by PDMA
+  *
+  * @param[in]  i2c             Point to I2C peripheral
+  * @param[in]  pdma            The pointer of the PDMA module
+  * @param[in]  u8SlaveAddr     Access Slave address(7-bit)
+  * @param[in]  data[]          A data array for write data to Slave
+  * @param[in]  u32wLen         How many bytes need to write to Slave, 1 ~ 65536
+  *
+  * @return     u32wLen if all bytes have been transmitted, 0 if failed
+  *
+  * @details    The CPU sends START and SLA+W and the STOP after the last byte, PDMA feeds the data bytes to I2C.
+  *             The channel is requested by PDMA_RequestChannel() and released before return, its completion
+  *             is signalled by the channel callback. PDMA clock must be enabled, PDMA0_IRQHandler must call
+  *             PDMA_IRQHandler() and PDMA0_IRQn must be enabled. g_I2C_i32ErrCode is \ref I2C_ERR_TIMEOUT on
+  *             time-out, or \ref I2C_ERR_FAIL if no channel is free or PDMA aborts.
+  */
+uint32_t I2C_WriteMultiBytesPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t data[], uint32_t u32wLen)
+{
+    return I2C_PDMAWrite(i2c, pdma, u8SlaveAddr, NULL, 0u, data, u32wLen);
+}
+
+/**
+  * @brief      Specify a byte register address and write multi bytes to Slave, the payload is moved by PDMA
+  *
+  * @param[in]  i2c             Point to I2C peripheral
+  * @param[in]  pdma            The pointer of the PDMA module
+  * @param[in]  u8SlaveAddr     Access Slave address(7-bit)
+  * @param[in]  u8DataAddr      Specify a address (1 byte) of data write to
+  * @param[in]  data[]          A data array for write data to Slave
+  * @param[in]  u32wLen         How many bytes need to write to Slave, 1 ~ 65536
+  *
+  * @return     u32wLen if all bytes have been transmitted, 0 if failed
+  *
+  * @details    The CPU sends START, SLA+W and the register address and the STOP after the last byte,
+  *             PDMA feeds the data bytes to I2C. See I2C_WriteMultiBytesPDMA() for the PDMA channel.
+  */
+uint32_t I2C_WriteMultiBytesOneRegPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t u8DataAddr, uint8_t data[], uint32_t u32wLen)
+{
+    return I2C_PDMAWrite(i2c, pdma, u8SlaveAddr, &u8DataAddr, 1u, data, u32wLen);
+}
+
+/**
+  * @brief      Specify two bytes register address and write multi bytes to Slave, the payload is moved by PDMA
+  *
+  * @param[in]  i2c             Point to I2C peripheral
+  * @param[in]  pdma            The pointer of the PDMA module
+  * @param[in]  u8SlaveAddr     Access Slave address(7-bit)
+  * @param[in]  u16DataAddr     Specify a address (2 bytes) of data write to
+  * @param[in]  data[]          A data array for write data to Slave
+  * @param[in]  u32wLen         How many bytes need to write to Slave, 1 ~ 65536
+  *
+  * @return     u32wLen if all bytes have been transmitted, 0 if failed
+  *
+  * @details    The CPU sends START, SLA+W and the register address and the STOP after the last byte,
+  *             PDMA feeds the data bytes to I2C. See I2C_WriteMultiBytesPDMA() for the PDMA channel.
+  */
+uint32_t I2C_WriteMultiBytesTwoRegsPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint16_t u16DataAddr, uint8_t data[], uint32_t u32wLen)
+{
+    uint8_t au8Reg[2];
+
+    au8Reg[0] = (uint8_t)((u16DataAddr & 0xFF00u) >> 8u);
+    au8Reg[1] = (uint8_t)(u16DataAddr & 0xFFu);
+
+    return I2C_PDMAWrite(i2c, pdma, u8SlaveAddr, au8Reg, 2u, data, u32wLen);
+}
+
+/**
+  * @brief      Read multi bytes from Slave, the payload is moved by PDMA
+  *
+  * @param[in]  i2c             Point to I2C peripheral
+  * @param[in]  pdma            The pointer of the PDMA module
+  * @param[in]  u8SlaveAddr     Access Slave address(7-bit)
+  * @param[out] rdata[]         A data array to store data from Slave
+  * @param[in]  u32rLen         How many bytes need to read from Slave, 1 ~ 65537
+  *
+  * @return     u32rLen if all bytes have been received, 0 if failed
+  *
+  * @details    The CPU sends START and SLA+R, PDMA stores all bytes except the last one, then the CPU
+  *             returns NACK for the last byte and sends STOP. The PDMA channel is handled as in
+  *             I2C_WriteMultiBytesPDMA(). g_I2C_i32ErrCode is \ref I2C_ERR_TIMEOUT on time-out, or
+  *             \ref I2C_ERR_FAIL if no channel is free or PDMA aborts.
+  */
+uint32_t I2C_ReadMultiBytesPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t rdata[], uint32_t u32rLen)
+{
+    return I2C_PDMARead(i2c, pdma, u8SlaveAddr, NULL, 0u, rdata, u32rLen);
+}
+
+/**
+  * @brief      Specify a byte register address and read multi bytes from Slave, the payload is moved by PDMA
+  *
+  * @param[in]  i2c             Point to I2C peripheral
+  * @param[in]  pdma            The pointer of the PDMA module
+  * @param[in]  u8SlaveAddr     Access Slave address(7-bit)
+  * @param[in]  u8DataAddr      Specify a address (1 byte) of data read from
+  * @param[out] rdata[]         A data array to store data from Slave
+  * @param[in]  u32rLen         How many bytes need to read from Slave, 1 ~ 65537
+  *
+  * @return     u32rLen if all bytes have been received, 0 if failed
+  *
+  * @details    The CPU writes the register address and sends repeated START and SLA+R, then the payload is
+  *             received as in I2C_ReadMultiBytesPDMA().
+  */
+uint32_t I2C_ReadMultiBytesOneRegPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint8_t u8DataAddr, uint8_t rdata[], uint32_t u32rLen)
+{
+    return I2C_PDMARead(i2c, pdma, u8SlaveAddr, &u8DataAddr, 1u, rdata, u32rLen);
+}
+
+/**
+  * @brief      Specify two bytes register address and read multi bytes from Slave, the payload is moved by PDMA
+  *
+  * @param[in]  i2c             Point to I2C peripheral
+  * @param[in]  pdma            The pointer of the PDMA module
+  * @param[in]  u8SlaveAddr     Access Slave address(7-bit)
+  * @param[in]  u16DataAddr     Specify a address (2 bytes) of data read from
+  * @param[out] rdata[]         A data array to store data from Slave
+  * @param[in]  u32rLen         How many bytes need to read from Slave, 1 ~ 65537
+  *
+  * @return     u32rLen if all bytes have been received, 0 if failed
+  *
+  * @details    The CPU writes the register address and sends repeated START and SLA+R, then the payload is
+  *             received as in I2C_ReadMultiBytesPDMA().
+  */
+uint32_t I2C_ReadMultiBytesTwoRegsPDMA(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, uint16_t u16DataAddr, uint8_t rdata[], uint32_t u32rLen)
+{
+    uint8_t au8Reg[2];
+
+    au8Reg[0] = (uint8_t)((u16DataAddr & 0xFF00u) >> 8u);
+    au8Reg[1] = (uint8_t)(u16DataAddr & 0xFFu);
+
+    return I2C_PDMARead(i2c, pdma, u8SlaveAddr, au8Reg, 2u, rdata, u32rLen);
+}
+
+/**
+ * @brief      Queue a write-then-read transaction
+ *
+ * @param[in]  i2c          Specify I2C port
+ * @param[in]  psXfer       Transaction descriptor. Slave address, buffers, lengths and callback must be set.
+ *
+ * @retval     I2C_OK           Transaction is queued, psXfer->i32Status is \ref I2C_XFER_PENDING
+ * @retval     I2C_ERR_PARAM    Invalid port or descriptor
+ * @retval     I2C_ERR_BUSY     Descriptor is still queued
+ *
+ * @details    The transaction starts at once if the bus engine is idle, otherwise after the queued ones.
+ *             The function returns immediately, the transaction runs in I2C interrupt and psXfer->pfnCallback
+ *             is called when it completes. The port must be opened by I2C_Open() in master mode. Application
+ *             must call I2C_XferIRQHandler() in I2Cn_IRQHandler and enable I2Cn_IRQn.
+ *             The time-out counter is enabled while a transaction is in progress.
+ */
+int32_t I2C_XferSubmit(I2C_T *i2c, I2C_XFER_T *psXfer)
+{
+    int32_t i32Port = I2C_XferPort(i2c);
+    uint32_t u32PriMask;
+
+    if((i32Port < 0) || (psXfer == NULL) || (psXfer->u8SlaveAddr > 0x7FU) ||
+            ((psXfer->u32TxLen == 0UL) && (psXfer->u32RxLen == 0UL)) ||
+            ((psXfer->u32TxLen != 0UL) && (psXfer->pu8TxBuf == NULL)) ||
+            ((psXfer->u32RxLen != 0UL) && (psXfer->pu8RxBuf == NULL)))
+    {
+        return I2C_ERR_PARAM;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    if(psXfer->i32Status == I2C_XFER_PENDING)
+    {
+        __set_PRIMASK(u32PriMask);
+        return I2C_ERR_BUSY;
+    }
+
+    psXfer->i32Status = I2C_XFER_PENDING;
+    psXfer->u32Retry = 0UL;
+    psXfer->psNext = NULL;
+
+    if(s_apsXferHead[i32Port] == NULL)
+    {
+        s_apsXferHead[i32Port] = psXfer;
+        s_apsXferTail[i32Port] = psXfer;
+        I2C_XferStart(i2c, psXfer);
+    }
+    else
+    {
+        s_apsXferTail[i32Port]->psNext = psXfer;
+        s_apsXferTail[i32Port] = psXfer;
+    }
+
+    __set_PRIMASK(u32PriMask);
+
+    return I2C_OK;
+}
+
+/**
+ * @brief      Abort all transactions of a port
+ *
+ * @param[in]  i2c          Specify I2C port
+ *
+ * @return     None
+ *
+ * @details    The transaction in progress is stopped with a STOP condition. It and all queued transactions
+ *             complete with \ref I2C_ERR_ABORT, their callbacks are called by this function.
+ */
+void I2C_XferAbort(I2C_T *i2c)
+{
+    int32_t i32Port = I2C_XferPort(i2c);
+    I2C_XFER_T *psXfer, *psNext;
+    uint32_t u32PriMask;
+
+    if(i32Port < 0)
+    {
+        return;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    psXfer = s_apsXferHead[i32Port];
+    s_apsXferHead[i32Port] = NULL;
+    s_apsXferTail[i32Port] = NULL;
+
+    if(psXfer != NULL)
+    {
+        I2C_DisableInt(i2c);
+        I2C_DisableTimeout(i2c);
+        I2C_SET_CONTROL_REG(i2c, I2C_CTL_STO_SI);
+    }
+
+    __set_PRIMASK(u32PriMask);
+
+    while(psXfer != NULL)
+    {
+        psNext = psXfer->psNext;
+        psXfer->psNext = NULL;
+        psXfer->i32Status = I2C_ERR_ABORT;
+
+        if(psXfer->pfnCallback != NULL)
+        {
+            psXfer->pfnCallback(psXfer);
+        }
+
+        psXfer = psNext;
+    }
+}
+
+/**
+ * @brief      Check if the transaction engine of a port is busy
+ *
+ * @param[in]  i2c          Specify I2C port
+ *
+ * @retval     0            No transaction is queued or in progress
+ * @retval     1            A transaction is in progress
+ */
+uint32_t I2C_XferIsBusy(I2C_T *i2c)
+{
+    int32_t i32Port = I2C_XferPort(i2c);
+
+    return ((i32Port >= 0) && (s_apsXferHead[i32Port] != NULL)) ? 1UL : 0UL;
+}
+
+/**
+ * @brief      Transaction engine interrupt service
+ *
+ * @param[in]  i2c          Specify I2C port
+ *
+ * @return     None
+ *
+ * @details    Call this function from I2Cn_IRQHandler. It runs one step of the master state machine of the
+ *             transaction in progress and starts the next queued transaction when it completes.
+ *             NACK, bus error and time-out fail the transaction and release the bus. Arbitration lost
+ *             restarts the transaction when the bus is free, up to \ref I2C_XFER_ARB_RETRY times.
+ */
+void I2C_XferIRQHandler(I2C_T *i2c)
+{
+    int32_t i32Port = I2C_XferPort(i2c);
+    I2C_XFER_T *psXfer;
+    uint32_t u32Ctrl = I2C_CTL_SI;
+
+    if(i32Port < 0)
+    {
+        return;
+    }
+
+    psXfer = s_apsXferHead[i32Port];
+
+    if(I2C_GET_TIMEOUT_FLAG(i2c))
+    {
+        I2C_ClearTimeoutFlag(i2c);
+
+        if(psXfer != NULL)
+        {
+            /* SCL is held low, re-enable the controller to reset its state machine and release the bus */
+            i2c->CTL0 &= ~I2C_CTL0_I2CEN_Msk;
+            i2c->CTL0 |= I2C_CTL0_I2CEN_Msk;
+            I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_ERR_TIMEOUT, 0UL);
+        }
+
+        return;
+    }
+
+    if((i2c->CTL0 & I2C_CTL0_SI_Msk) == 0UL)
+    {
+        return;
+    }
+
+    if(psXfer == NULL)
+    {
+        I2C_SET_CONTROL_REG(i2c, I2C_CTL_SI);
+        return;
+    }
+
+    switch(I2C_GET_STATUS(i2c))
+    {
+        case 0x08u:                                         /* START has been transmitted */
+            if(psXfer->u32TxLen != 0UL)
+            {
+                I2C_SET_DATA(i2c, (uint8_t)(psXfer->u8SlaveAddr << 1u));            /* Write SLA+W */
+            }
+            else
+            {
+                I2C_SET_DATA(i2c, (uint8_t)((psXfer->u8SlaveAddr << 1u) | 0x01u));  /* Write SLA+R */
+            }
+            break;
+
+        case 0x10u:                                         /* Repeated START has been transmitted */
+            I2C_SET_DATA(i2c, (uint8_t)((psXfer->u8SlaveAddr << 1u) | 0x01u));      /* Write SLA+R */
+            break;
+
+        case 0x18u:                                         /* SLA+W has been transmitted and ACK has been received */
+        case 0x28u:                                         /* DATA has been transmitted and ACK has been received */
+            if(psXfer->u32TxCnt < psXfer->u32TxLen)
+            {
+                I2C_SET_DATA(i2c, psXfer->pu8TxBuf[psXfer->u32TxCnt++]);
+            }
+            else if(psXfer->u32RxLen != 0UL)
+            {
+                u32Ctrl = I2C_CTL_STA_SI;                   /* Send repeated START */
+            }
+            else
+            {
+                I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_OK, I2C_CTL_STO_SI);
+                return;
+            }
+            break;
+
+        case 0x40u:                                         /* SLA+R has been transmitted and ACK has been received */
+            u32Ctrl = (psXfer->u32RxLen > 1UL) ? I2C_CTL_SI_AA : I2C_CTL_SI;
+            break;
+
+        case 0x50u:                                         /* DATA has been received and ACK has been returned */
+            psXfer->pu8RxBuf[psXfer->u32RxCnt++] = (uint8_t)I2C_GET_DATA(i2c);
+            u32Ctrl = (psXfer->u32RxCnt < (psXfer->u32RxLen - 1UL)) ? I2C_CTL_SI_AA : I2C_CTL_SI;
+            break;
+
+        case 0x58u:                                         /* DATA has been received and NACK has been returned */
+            psXfer->pu8RxBuf[psXfer->u32RxCnt++] = (uint8_t)I2C_GET_DATA(i2c);
+            I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_OK, I2C_CTL_STO_SI);
+            return;
+
+        case 0x20u:                                         /* SLA+W has been transmitted and NACK has been received */
+        case 0x30u:                                         /* DATA has been transmitted and NACK has been received */
+        case 0x48u:                                         /* SLA+R has been transmitted and NACK has been received */
+            I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_ERR_NACK, I2C_CTL_STO_SI);
+            return;
+
+        case 0x38u:                                         /* Arbitration lost, the controller is a not addressed slave */
+            if(psXfer->u32Retry < I2C_XFER_ARB_RETRY)
+            {
+                psXfer->u32Retry++;
+                psXfer->u32TxCnt = 0UL;
+                psXfer->u32RxCnt = 0UL;
+                u32Ctrl = I2C_CTL_STA_SI;                   /* START again when the bus is free */
+            }
+            else
+            {
+                I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_ERR_ARB_LOST, I2C_CTL_SI);
+                return;
+            }
+            break;
+
+        case 0x00u:                                         /* Bus error, STO and SI recover the controller */
+            I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_ERR_BUS, I2C_CTL_STO_SI);
+            return;
+
+        default:                                            /* Unexpected status, e.g. addressed as a slave */
+            I2C_XferFinish(i2c, (uint32_t)i32Port, I2C_ERR_FAIL, I2C_CTL_STO_SI);
+            return;
+    }
+
+    I2C_SET_CONTROL_REG(i2c, u32Ctrl);
+}
 
 /*@}*/ /* end of group I2C_EXPORTED_FUNCTIONS */
 
+/**
+ * @brief      Get the transaction engine index of an I2C port, -1 if the port is not supported
+ */
+static int32_t I2C_XferPort(I2C_T *i2c)
+{
+    if(i2c == I2C0)
+    {
+        return 0L;
+    }
+    else if(i2c == I2C1)
+    {
+        return 1L;
+    }
+    else if(i2c == I2C2)
+    {
+        return 2L;
+    }
+
+    return -1L;
+}
+
+/**
+ * @brief      Get the PDMA request source of an I2C port, -1 if the port is not supported
+ */
+static int32_t I2C_PDMAReq(I2C_T *i2c, uint32_t u32Rx)
+{
+    int32_t i32Port = I2C_XferPort(i2c);
+
+    if(i32Port < 0)
+    {
+        return -1L;
+    }
+
+    return (int32_t)(PDMA_I2C0_TX + ((uint32_t)i32Port * 2UL) + u32Rx);
+}
+
+/**
+ * @brief      Start a 8-bit payload descriptor on a PDMA channel, it moves on the I2C request
+ */
+static int32_t I2C_PDMAStart(PDMA_T *pdma, uint32_t u32Ch, I2C_PDMA_STATE_T *psPdma, uint32_t u32Req, uint32_t u32SrcAddr, uint32_t u32SrcCtrl, uint32_t u32DstAddr, uint32_t u32DstCtrl, uint32_t u32Len)
+{
+    psPdma->u32Event = 0UL;
+
+    if(PDMA_DescInit(&psPdma->sDesc, PDMA_WIDTH_8, u32SrcAddr, u32SrcCtrl, u32DstAddr, u32DstCtrl, u32Len, PDMA_REQ_SINGLE) != 0)
+    {
+        return -1L;
+    }
+
+    PDMA_SetCallback(pdma, u32Ch, I2C_PDMADone, psPdma);
+
+    return PDMA_StartChain(pdma, u32Ch, u32Req, &psPdma->sDesc);
+}
+
+/**
+ * @brief      PDMA channel callback of the payload, the transfer loop polls the events
+ */
+static void I2C_PDMADone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    (void)u32Ch;
+
+    ((I2C_PDMA_STATE_T *)pvUserData)->u32Event |= u32Event;
+}
+
+/**
+ * @brief      Master transmit with PDMA payload
+ *
+ * @details    SLA+W and the register address bytes are written by the CPU. At the ACK of the last of them,
+ *             PDMA takes over the data bytes and PDMASTR holds SCL after the last one until the CPU sends STOP.
+ *             The CPU waits for SI or PDMA done, so a NACK in the middle of the payload is seen at once.
+ */
+static uint32_t I2C_PDMAWrite(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, const uint8_t au8Reg[], uint32_t u32RegLen, uint8_t data[], uint32_t u32wLen)
+{
+    uint8_t u8Xfering = 1u, u8Err = 0u, u8Ctrl = 0u, u8Pdma = 0u;
+    uint32_t u32Ch, u32RegCnt = 0u, u32txLen = 0u, u32TimeOutCount = 0u;
+    int32_t i32Ch, i32Req = I2C_PDMAReq(i2c, 0u);
+    I2C_PDMA_STATE_T *psPdma;
+
+    g_I2C_i32ErrCode = 0;
+
+    if((i32Req < 0) || (pdma == NULL) || (data == NULL) || (u32wLen == 0u) || (u32wLen > PDMA_TXCNT_MAX))
+    {
+        g_I2C_i32ErrCode = I2C_ERR_FAIL;
+        return 0u;
+    }
+
+    i32Ch = PDMA_RequestChannel(pdma, 0u);
+
+    if(i32Ch < 0)
+    {
+        g_I2C_i32ErrCode = I2C_ERR_FAIL;
+        return 0u;
+    }
+
+    u32Ch = (uint32_t)i32Ch;
+    psPdma = &s_asI2CPdma[I2C_XferPort(i2c)];
+
+    I2C_START(i2c);                                                      /* Send START */
+    while(u8Xfering && (u8Err == 0u))
+    {
+        u32TimeOutCount = I2C_TIMEOUT;
+        while(1)
+        {
+            if((u8Pdma == 1u) && (psPdma->u32Event != 0u))
+            {
+                if(psPdma->u32Event & PDMA_EVT_ABORT)
+                {
+                    g_I2C_i32ErrCode = I2C_ERR_FAIL;
+                    u8Err = 1u;
+                    break;
+                }
+
+                i2c->CTL1 &= ~I2C_CTL1_TXPDMAEN_Msk;                        /* Payload is in I2C, wait for its ACK */
+                u8Pdma = 2u;
+            }
+
+            if(i2c->CTL0 & I2C_CTL0_SI_Msk)
+            {
+                break;
+            }
+
+            if(--u32TimeOutCount == 0u)
+            {
+                g_I2C_i32ErrCode = I2C_ERR_TIMEOUT;
+                u8Err = 1u;
+                break;
+            }
+        }
+
+        if(u8Err)
+        {
+            break;
+        }
+
+        switch(I2C_GET_STATUS(i2c))
+        {
+        case 0x08u:
+            I2C_SET_DATA(i2c, (uint8_t)(u8SlaveAddr << 1u | 0x00u));     /* Write SLA+W to Register I2CDAT */
+            u8Ctrl = I2C_CTL_SI;                                         /* Clear SI */
+            break;
+        case 0x18u:                                                      /* Slave Address ACK */
+        case 0x28u:                                                      /* Master transmit data ACK */
+            if(u32RegCnt < u32RegLen)
+            {
+                I2C_SET_DATA(i2c, au8Reg[u32RegCnt++]);                  /* Write register address */
+                u8Ctrl = I2C_CTL_SI;
+            }
+            else if(u8Pdma == 0u)
+            {
+                if(I2C_PDMAStart(pdma, u32Ch, psPdma, (uint32_t)i32Req, (uint32_t)data, PDMA_SAR_INC,
+                                 (uint32_t)&i2c->DAT, PDMA_DAR_FIX, u32wLen) != 0)
+                {
+                    g_I2C_i32ErrCode = I2C_ERR_FAIL;
+                    u8Ctrl = I2C_CTL_STO_SI;                             /* Descriptor is out of the SCATBA window */
+                    u8Err = 1u;
+                    break;
+                }
+
+                i2c->CTL1 |= (I2C_CTL1_TXPDMAEN_Msk | I2C_CTL1_PDMASTR_Msk);
+                u8Pdma = 1u;
+                u8Ctrl = I2C_CTL_SI;                                     /* PDMA writes the data bytes */
+            }
+            else if(u8Pdma == 2u)
+            {
+                u32txLen = u32wLen;
+                u8Ctrl = I2C_CTL_STO_SI;                                 /* Clear SI and send STOP */
+                u8Xfering = 0u;
+            }
+            else
+            {
+                u8Ctrl = I2C_CTL_STO_SI;                                 /* Payload is not complete */
+                u8Err = 1u;
+            }
+            break;
+        case 0x20u:                                                      /* Slave Address NACK */
+        case 0x30u:                                                      /* Master transmit data NACK */
+            u8Ctrl = I2C_CTL_STO_SI;                                     /* Clear SI and send STOP */
+            u8Err = 1u;
+            break;
+        case 0x38u:                                                      /* Arbitration Lost */
+        default:                                                         /* Unknow status */
+            I2C_SET_CONTROL_REG(i2c, I2C_CTL_STO_SI);                    /* Clear SI and send STOP */
+            u8Ctrl = I2C_CTL_SI;
+            u8Err = 1u;
+            break;
+        }
+        I2C_SET_CONTROL_REG(i2c, u8Ctrl);                                /* Write controlbit to I2C_CTL register */
+    }
+
+    i2c->CTL1 &= ~(I2C_CTL1_TXPDMAEN_Msk | I2C_CTL1_PDMASTR_Msk);
+
+    PDMA_ReleaseChannel(pdma, u32Ch);                                    /* Also drops the rest of the payload */
+
+    u32TimeOutCount = I2C_TIMEOUT;
+    while ((i2c)->CTL0 & I2C_CTL0_STO_Msk)
+    {
+        if(--u32TimeOutCount == 0)
+        {
+            g_I2C_i32ErrCode = I2C_ERR_TIMEOUT;
+            u32txLen = 0u;
+            break;
+        }
+    }
+
+    return u32txLen;                                                     /* Return bytes length that have been transmitted */
+}
+
+/**
+ * @brief      Master receive with PDMA payload
+ *
+ * @details    The register address bytes and SLA+R are written by the CPU. At the ACK of SLA+R, PDMA stores
+ *             u32rLen - 1 bytes with ACK and PDMASTR holds SCL after them. The CPU returns NACK for the last
+ *             byte, reads it and sends STOP.
+ */
+static uint32_t I2C_PDMARead(I2C_T *i2c, PDMA_T *pdma, uint8_t u8SlaveAddr, const uint8_t au8Reg[], uint32_t u32RegLen, uint8_t rdata[], uint32_t u32rLen)
+{
+    uint8_t u8Xfering = 1u, u8Err = 0u, u8Ctrl = 0u, u8Pdma = 0u;
+    uint32_t u32Ch, u32RegCnt = 0u, u32rxLen = 0u, u32TimeOutCount = 0u;
+    int32_t i32Ch, i32Req = I2C_PDMAReq(i2c, 1u);
+    I2C_PDMA_STATE_T *psPdma;
+
+    g_I2C_i32ErrCode = 0;
+
+    if((i32Req < 0) || (pdma == NULL) || (rdata == NULL) || (u32rLen == 0u) || ((u32rLen - 1u) > PDMA_TXCNT_MAX))
+    {
+        g_I2C_i32ErrCode = I2C_ERR_FAIL;
+        return 0u;
+    }
+
+    i32Ch = PDMA_RequestChannel(pdma, 0u);
+
+    if(i32Ch < 0)
+    {
+        g_I2C_i32ErrCode = I2C_ERR_FAIL;
+        return 0u;
+    }
+
+    u32Ch = (uint32_t)i32Ch;
+    psPdma = &s_asI2CPdma[I2C_XferPort(i2c)];
+
+    I2C_START(i2c);                                                      /* Send START */
+    while(u8Xfering && (u8Err == 0u))
+    {
+        u32TimeOutCount = I2C_TIMEOUT;
+        while(1)
+        {
+            if((u8Pdma == 1u) && (psPdma->u32Event != 0u))
+            {
+                if(psPdma->u32Event & PDMA_EVT_ABORT)
+                {
+                    g_I2C_i32ErrCode = I2C_ERR_FAIL;
+                    u8Err = 1u;
+                    break;
+                }
+
+                i2c->CTL1 &= ~I2C_CTL1_RXPDMAEN_Msk;                        /* All but the last byte are stored */
+                u8Pdma = 2u;
+            }
+
+            if(i2c->CTL0 & I2C_CTL0_SI_Msk)
+            {
+                break;
+            }
+
+            if(--u32TimeOutCount == 0u)
+            {
+                g_I2C_i32ErrCode = I2C_ERR_TIMEOUT;
+                u8Err = 1u;
+                break;
+            }
+        }
+
+        if(u8Err)
+        {
+            break;
+        }
+
+        switch(I2C_GET_STATUS(i2c))
+        {
+        case 0x08u:
+            if(u32RegLen != 0u)
+            {
+                I2C_SET_DATA(i2c, (uint8_t)(u8SlaveAddr << 1u | 0x00u)); /* Write SLA+W to Register I2CDAT */
+            }
+            else
+            {
+                I2C_SET_DATA(i2c, (uint8_t)(u8SlaveAddr << 1u | 0x01u)); /* Write SLA+R to Register I2CDAT */
+            }
+            u8Ctrl = I2C_CTL_SI;                                         /* Clear SI */
+            break;
+        case 0x18u:                                                      /* Slave Address ACK */
+        case 0x28u:                                                      /* Master transmit data ACK */
+            if(u32RegCnt < u32RegLen)
+            {
+                I2C_SET_DATA(i2c, au8Reg[u32RegCnt++]);                  /* Write register address */
+                u8Ctrl = I2C_CTL_SI;
+            }
+            else
+            {
+                u8Ctrl = I2C_CTL_STA_SI;                                 /* Send repeat START */
+            }
+            break;
+        case 0x10u:
+            I2C_SET_DATA(i2c, (uint8_t)(u8SlaveAddr << 1u | 0x01u));     /* Write SLA+R to Register I2CDAT */
+            u8Ctrl = I2C_CTL_SI;                                         /* Clear SI */
+            break;
+        case 0x40u:                                                      /* Slave Address ACK */
+            if(u32rLen > 1u)
+            {
+                if(I2C_PDMAStart(pdma, u32Ch, psPdma, (uint32_t)i32Req, (uint32_t)&i2c->DAT, PDMA_SAR_FIX,
+                                 (uint32_t)rdata, PDMA_DAR_INC, u32rLen - 1u) != 0)
+                {
+                    g_I2C_i32ErrCode = I2C_ERR_FAIL;
+                    u8Ctrl = I2C_CTL_STO_SI;                             /* Descriptor is out of the SCATBA window */
+                    u8Err = 1u;
+                    break;
+                }
+
+                i2c->CTL1 |= (I2C_CTL1_RXPDMAEN_Msk | I2C_CTL1_PDMASTR_Msk);
+                u8Pdma = 1u;
+                u8Ctrl = I2C_CTL_SI_AA;                                  /* PDMA reads the data bytes */
+            }
+            else
+            {
+                u8Ctrl = I2C_CTL_SI;                                     /* Clear SI, NACK the only byte */
+            }
+            break;
+        case 0x50u:                                                      /* Master receive data ACK */
+            if(u8Pdma == 2u)
+            {
+                u8Ctrl = I2C_CTL_SI;                                     /* PDMA stored the byte, NACK the next one */
+            }
+            else
+            {
+                u8Ctrl = I2C_CTL_STO_SI;                                 /* Payload is not complete */
+                u8Err = 1u;
+            }
+            break;
+        case 0x58u:
+            rdata[u32rLen - 1u] = (uint8_t) I2C_GET_DATA(i2c);           /* Receive the last byte */
+            u32rxLen = u32rLen;
+            u8Ctrl = I2C_CTL_STO_SI;                                     /* Clear SI and send STOP */
+            u8Xfering = 0u;
+            break;
+        case 0x20u:                                                      /* Slave Address NACK */
+        case 0x30u:                                                      /* Master transmit data NACK */
+        case 0x48u:                                                      /* Slave Address NACK */
+            u8Ctrl = I2C_CTL_STO_SI;                                     /* Clear SI and send STOP */
+            u8Err = 1u;
+            break;
+        case 0x38u:                                                      /* Arbitration Lost */
+        default:                                                         /* Unknow status */
+            I2C_SET_CONTROL_REG(i2c, I2C_CTL_STO_SI);                    /* Clear SI and send STOP */
+            u8Ctrl = I2C_CTL_SI;
+            u8Err = 1u;
+            break;
+        }
+        I2C_SET_CONTROL_REG(i2c, u8Ctrl);                                /* Write controlbit to I2C_CTL register */
+    }
+
+    i2c->CTL1 &= ~(I2C_CTL1_RXPDMAEN_Msk | I2C_CTL1_PDMASTR_Msk);
+
+    PDMA_ReleaseChannel(pdma, u32Ch);                                    /* Also drops the rest of the payload */
+
+    u32TimeOutCount = I2C_TIMEOUT;
+    while ((i2c)->CTL0 & I2C_CTL0_STO_Msk)
+    {
+        if(--u32TimeOutCount == 0)
+        {
+            g_I2C_i32ErrCode = I2C_ERR_TIMEOUT;
+            u32rxLen = 0u;
+            break;
+        }
+    }
+
+    return u32rxLen;                                                     /* Return bytes length that have been received */
+}
+
+/**
+ * @brief      Send the START of a transaction
+ */
+static void I2C_XferStart(I2C_T *i2c, I2C_XFER_T *psXfer)
+{
+    psXfer->u32TxCnt = 0UL;
+    psXfer->u32RxCnt = 0UL;
+
+    I2C_ClearTimeoutFlag(i2c);
+    I2C_EnableTimeout(i2c, 1u);
+    I2C_EnableInt(i2c);
+    I2C_SET_CONTROL_REG(i2c, I2C_CTL_STA);
+}
+
+/**
+ * @brief      Complete the transaction in progress with i32Status and start the next queued one
+ *
+ * @details    u32Ctrl is written to I2C_CTL0 to release the bus, 0 if the bus is already released.
+ *             The callback is called last, so it can submit the descriptor again.
+ */
+static void I2C_XferFinish(I2C_T *i2c, uint32_t u32Port, int32_t i32Status, uint32_t u32Ctrl)
+{
+    I2C_XFER_T *psXfer = s_apsXferHead[u32Port];
+    I2C_XFER_T *psNext = psXfer->psNext;
+    uint32_t u32TimeOutCount = I2C_TIMEOUT;
+
+    s_apsXferHead[u32Port] = psNext;
+
+    if(psNext == NULL)
+    {
+        s_apsXferTail[u32Port] = NULL;
+    }
+
+    if(u32Ctrl != 0UL)
+    {
+        I2C_SET_CONTROL_REG(i2c, u32Ctrl);
+
+        /* The STOP must be on the bus before the START of the next transaction */
+        while(i2c->CTL0 & I2C_CTL0_STO_Msk)
+        {
+            if(--u32TimeOutCount == 0UL)
+            {
+                break;
+            }
+        }
+    }
+
+    if(psNext != NULL)
+    {
+        I2C_XferStart(i2c, psNext);
+    }
+    else
+    {
+        I2C_DisableInt(i2c);
+        I2C_DisableTimeout(i2c);
+    }
+
+    psXfer->psNext = NULL;
+    psXfer->i32Status = i32Status;
+
+    if(psXfer->pfnCallback != NULL)
+    {
+        psXfer->pfnCallback(psXfer);
+    }
+}
+
+
 /*@}*/ /* end of group I2C_Driver */
 
 /*@}*/ /* end of group Standard_Driver */
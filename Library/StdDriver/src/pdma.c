@@ -6,10 +6,16 @@
  * SPDX-License-Identifier: Apache-2.0
  * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
 *****************************************************************************/
+#include <string.h>
 #include "NuMicro.h"
 
 
 static uint8_t u8ChSelect[PDMA_CH_MAX];
+static uint32_t s_u32ChAlloc = 0UL;
+static PDMA_CALLBACK_T s_apfnCallback[PDMA_CH_MAX];
+static void *s_apvUserData[PDMA_CH_MAX];
+static uint32_t s_au32MemPattern[PDMA_CH_MAX];
+static uint32_t s_u32MemThreshold = PDMA_MEM_CPU_THRESHOLD;
 
 /** @addtogroup Standard_Driver Standard Driver
   @{
@@ -24,6 +30,10 @@ static uint8_t u8ChSelect[PDMA_CH_MAX];
   @{
 */
 
+static int32_t PDMA_MemStart(PDMA_T * pdma, uint32_t u32Ch, uint32_t u32DstAddr, uint32_t u32SrcAddr, uint32_t u32SrcCtrl, uint32_t u32Width, uint32_t u32TransCount);
+static int32_t PDMA_MemWait(PDMA_T * pdma, uint32_t u32Ch);
+static uint32_t PDMA_MemWidth(uint32_t u32DstAddr, uint32_t u32SrcAddr, uint32_t *pu32Head);
+
 /**
  * @brief       PDMA Open
  *
@@ -378,6 +388,711 @@ void PDMA_DisableInt(PDMA_T * pdma,uint32_t u32Ch, uint32_t u32Mask)
     }
 }
 
+/**
+ * @brief       Request a free PDMA channel
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Mask         Acceptable channel bits. 0 means any channel.
+ *                              E.g. (1 << 0) requests channel 0 which is the only channel with time-out function.
+ *
+ * @return      Allocated channel number, or \ref PDMA_ERR_NO_CH if all acceptable channels are in use.
+ *
+ * @details     This function finds the lowest free channel in u32Mask, marks it as used and enables it by
+ *              PDMA_Open(). The allocation is protected against interrupts so drivers can share channels
+ *              from both thread and interrupt context.
+ */
+int32_t PDMA_RequestChannel(PDMA_T * pdma, uint32_t u32Mask)
+{
+    uint32_t u32Ch, u32PriMask;
+    int32_t i32Ret = PDMA_ERR_NO_CH;
+
+    if(u32Mask == 0UL)
+    {
+        u32Mask = (1UL << PDMA_CH_MAX) - 1UL;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    for(u32Ch = 0UL; u32Ch < PDMA_CH_MAX; u32Ch++)
+    {
+        if((u32Mask & (1UL << u32Ch)) && ((s_u32ChAlloc & (1UL << u32Ch)) == 0UL))
+        {
+            s_u32ChAlloc |= (1UL << u32Ch);
+            i32Ret = (int32_t)u32Ch;
+            break;
+        }
+    }
+
+    __set_PRIMASK(u32PriMask);
+
+    if(i32Ret >= 0)
+    {
+        s_apfnCallback[u32Ch] = NULL;
+        s_apvUserData[u32Ch] = NULL;
+        PDMA_Open(pdma, 1UL << u32Ch);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief       Release a PDMA channel
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The channel got from PDMA_RequestChannel()
+ *
+ * @return      None
+ *
+ * @details     This function stops and disables the channel, disables its interrupts, removes its callback
+ *              and returns it to the free pool. Other channels are not affected.
+ */
+void PDMA_ReleaseChannel(PDMA_T * pdma, uint32_t u32Ch)
+{
+    uint32_t u32PriMask;
+
+    if(u32Ch >= PDMA_CH_MAX)
+    {
+        return;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    pdma->INTEN &= ~(1UL << u32Ch);
+    pdma->TOUTIEN &= ~(1UL << u32Ch);
+    pdma->CHCTL &= ~(1UL << u32Ch);
+    PDMA_RESET(pdma, u32Ch);
+    s_apfnCallback[u32Ch] = NULL;
+    s_apvUserData[u32Ch] = NULL;
+    s_u32ChAlloc &= ~(1UL << u32Ch);
+
+    __set_PRIMASK(u32PriMask);
+}
+
+/**
+ * @brief       Initialize a scatter-gather descriptor
+ *
+ * @param[out]  psDesc          The descriptor. It must be word aligned and located in the 64KB window addressed by SCATBA.
+ * @param[in]   u32Width        Data width. Valid values are
+ *                - \ref PDMA_WIDTH_8
+ *                - \ref PDMA_WIDTH_16
+ *                - \ref PDMA_WIDTH_32
+ * @param[in]   u32SrcAddr      Source address. It must be aligned to the data width.
+ * @param[in]   u32SrcCtrl      Source control attribute. Valid values are
+ *                - \ref PDMA_SAR_INC
+ *                - \ref PDMA_SAR_FIX
+ * @param[in]   u32DstAddr      Destination address. It must be aligned to the data width.
+ * @param[in]   u32DstCtrl      Destination control attribute. Valid values are
+ *                - \ref PDMA_DAR_INC
+ *                - \ref PDMA_DAR_FIX
+ * @param[in]   u32TransCount   Transfer count. Valid range is 1 ~ \ref PDMA_TXCNT_MAX.
+ * @param[in]   u32Burst        Request type and burst size, e.g. \ref PDMA_REQ_SINGLE or (\ref PDMA_REQ_BURST | \ref PDMA_BURST_4).
+ *
+ * @retval      0               Success
+ * @retval      PDMA_ERR_PARAM  Invalid descriptor address, width, alignment or transfer count
+ *
+ * @details     The descriptor is initialized as the last one of a chain (basic mode with transfer done interrupt).
+ *              Use PDMA_DescLink() to link it to the next descriptor.
+ */
+int32_t PDMA_DescInit(DSCT_T *psDesc, uint32_t u32Width, uint32_t u32SrcAddr, uint32_t u32SrcCtrl, uint32_t u32DstAddr, uint32_t u32DstCtrl, uint32_t u32TransCount, uint32_t u32Burst)
+{
+    uint32_t u32AlignMsk;
+
+    if((psDesc == NULL) || ((uint32_t)psDesc & 0x3UL))
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if(u32Width == PDMA_WIDTH_8)
+    {
+        u32AlignMsk = 0x0UL;
+    }
+    else if(u32Width == PDMA_WIDTH_16)
+    {
+        u32AlignMsk = 0x1UL;
+    }
+    else if(u32Width == PDMA_WIDTH_32)
+    {
+        u32AlignMsk = 0x3UL;
+    }
+    else
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if(((u32SrcAddr | u32DstAddr) & u32AlignMsk) ||
+            (u32TransCount == 0UL) || (u32TransCount > PDMA_TXCNT_MAX) ||
+            (u32SrcCtrl & ~PDMA_DSCT_CTL_SAINC_Msk) || (u32DstCtrl & ~PDMA_DSCT_CTL_DAINC_Msk) ||
+            (u32Burst & ~(PDMA_DSCT_CTL_TXTYPE_Msk | PDMA_DSCT_CTL_BURSIZE_Msk)))
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    psDesc->CTL = ((u32TransCount - 1UL) << PDMA_DSCT_CTL_TXCNT_Pos) |
+                  u32Width | u32SrcCtrl | u32DstCtrl | u32Burst |
+                  PDMA_TBINTDIS_ENABLE | PDMA_OP_BASIC;
+    psDesc->SA = u32SrcAddr;
+    psDesc->DA = u32DstAddr;
+    psDesc->NEXT = 0UL;
+
+    return 0;
+}
+
+/**
+ * @brief       Link a descriptor to the next one
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   psDesc          The descriptor initialized by PDMA_DescInit()
+ * @param[in]   psNext          The next descriptor. NULL makes psDesc the last descriptor of the chain.
+ *                              A descriptor earlier in the chain makes a loop that runs until the channel is stopped.
+ * @param[in]   u32TableInt     Generate transfer done interrupt when psDesc is finished. It is ignored if psNext is NULL,
+ *                              the last descriptor always generates transfer done interrupt.
+ *
+ * @retval      0                   Success
+ * @retval      PDMA_ERR_PARAM      Invalid descriptor address
+ * @retval      PDMA_ERR_SCATBA     psNext can not be addressed by SCATBA
+ *
+ * @details     This function sets psDesc to scatter-gather mode and fills the NEXT offset relative to SCATBA.
+ */
+int32_t PDMA_DescLink(PDMA_T * pdma, DSCT_T *psDesc, DSCT_T *psNext, uint32_t u32TableInt)
+{
+    uint32_t u32Offset;
+
+    if((psDesc == NULL) || ((uint32_t)psDesc & 0x3UL))
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if(psNext == NULL)
+    {
+        psDesc->NEXT = 0UL;
+        psDesc->CTL = (psDesc->CTL & ~(PDMA_DSCT_CTL_OPMODE_Msk | PDMA_DSCT_CTL_TBINTDIS_Msk)) |
+                      PDMA_TBINTDIS_ENABLE | PDMA_OP_BASIC;
+        return 0;
+    }
+
+    u32Offset = (uint32_t)psNext - pdma->SCATBA;
+
+    if(((uint32_t)psNext & 0x3UL) || ((uint32_t)psNext < pdma->SCATBA) ||
+            (u32Offset > PDMA_DSCT_NEXT_NEXT_Msk))
+    {
+        return PDMA_ERR_SCATBA;
+    }
+
+    psDesc->NEXT = u32Offset;
+    psDesc->CTL = (psDesc->CTL & ~(PDMA_DSCT_CTL_OPMODE_Msk | PDMA_DSCT_CTL_TBINTDIS_Msk)) |
+                  (u32TableInt ? PDMA_TBINTDIS_ENABLE : PDMA_TBINTDIS_DISABLE) | PDMA_OP_SCATTER;
+
+    return 0;
+}
+
+/**
+ * @brief       Start a descriptor chain
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The selected channel
+ * @param[in]   u32Peripheral   The selected peripheral, e.g. \ref PDMA_MEM, \ref PDMA_SPI0_TX.
+ * @param[in]   psFirst         The first descriptor of the chain
+ *
+ * @retval      0                   Success
+ * @retval      PDMA_ERR_PARAM      Invalid channel or descriptor address
+ * @retval      PDMA_ERR_SCATBA     psFirst can not be addressed by SCATBA
+ *
+ * @details     This function loads the chain to the channel in scatter-gather mode. A memory to memory chain is
+ *              triggered by software request immediately, a peripheral chain starts when the peripheral requests.
+ */
+int32_t PDMA_StartChain(PDMA_T * pdma, uint32_t u32Ch, uint32_t u32Peripheral, DSCT_T *psFirst)
+{
+    if((u32Ch >= PDMA_CH_MAX) || (psFirst == NULL) || ((uint32_t)psFirst & 0x3UL))
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if(((uint32_t)psFirst < pdma->SCATBA) || (((uint32_t)psFirst - pdma->SCATBA) > PDMA_DSCT_NEXT_NEXT_Msk))
+    {
+        return PDMA_ERR_SCATBA;
+    }
+
+    pdma->DSCT[u32Ch].CTL = 0UL;
+    PDMA_SetTransferMode(pdma, u32Ch, u32Peripheral, TRUE, (uint32_t)psFirst);
+    PDMA_Trigger(pdma, u32Ch);
+
+    return 0;
+}
+
+/**
+ * @brief       Install channel callback
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The selected channel
+ * @param[in]   pfnCallback     Callback function. NULL removes the callback.
+ * @param[in]   pvUserData      User data passed to the callback
+ *
+ * @return      None
+ *
+ * @details     This function installs the callback and enables (or disables) the transfer done interrupt of the
+ *              channel. Channel 0 also gets time-out interrupt if PDMA_SetTimeOut() is used.
+ *              Application must call PDMA_IRQHandler() in PDMA0_IRQHandler and enable PDMA0_IRQn.
+ */
+void PDMA_SetCallback(PDMA_T * pdma, uint32_t u32Ch, PDMA_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    if(u32Ch >= PDMA_CH_MAX)
+    {
+        return;
+    }
+
+    s_apvUserData[u32Ch] = pvUserData;
+    s_apfnCallback[u32Ch] = pfnCallback;
+
+    if(pfnCallback != NULL)
+    {
+        pdma->INTEN |= (1UL << u32Ch);
+    }
+    else
+    {
+        pdma->INTEN &= ~(1UL << u32Ch);
+    }
+}
+
+/**
+ * @brief       PDMA interrupt service
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ *
+ * @return      None
+ *
+ * @details     Call this function from PDMA0_IRQHandler. It clears the flags of channels which have a callback
+ *              and calls each callback once with all of its events. Flags of channels without callback are kept,
+ *              so a driver can still poll its own channel status.
+ */
+void PDMA_IRQHandler(PDMA_T * pdma)
+{
+    uint32_t u32IntSts = pdma->INTSTS;
+    uint32_t u32CbMask = 0UL;
+    uint32_t u32Abort = 0UL, u32Done = 0UL, u32TimeOut = 0UL;
+    uint32_t u32Ch, u32Event;
+
+    for(u32Ch = 0UL; u32Ch < PDMA_CH_MAX; u32Ch++)
+    {
+        if(s_apfnCallback[u32Ch] != NULL)
+        {
+            u32CbMask |= (1UL << u32Ch);
+        }
+    }
+
+    if(u32IntSts & PDMA_INTSTS_ABTIF_Msk)
+    {
+        u32Abort = pdma->ABTSTS & u32CbMask;
+        pdma->ABTSTS = u32Abort;
+    }
+
+    if(u32IntSts & PDMA_INTSTS_TDIF_Msk)
+    {
+        u32Done = pdma->TDSTS & u32CbMask;
+        pdma->TDSTS = u32Done;
+    }
+
+    if((u32IntSts & PDMA_INTSTS_REQTOF0_Msk) && (u32CbMask & 0x1UL))
+    {
+        u32TimeOut = 0x1UL;
+        pdma->INTSTS = PDMA_INTSTS_REQTOF0_Msk;
+    }
+
+    for(u32Ch = 0UL; u32Ch < PDMA_CH_MAX; u32Ch++)
+    {
+        u32Event = 0UL;
+
+        if(u32Done & (1UL << u32Ch))
+        {
+            u32Event |= PDMA_EVT_TRANS_DONE;
+        }
+
+        if(u32Abort & (1UL << u32Ch))
+        {
+            u32Event |= PDMA_EVT_ABORT;
+        }
+
+        if(u32TimeOut & (1UL << u32Ch))
+        {
+            u32Event |= PDMA_EVT_TIMEOUT;
+        }
+
+        if(u32Event != 0UL)
+        {
+            s_apfnCallback[u32Ch](u32Ch, u32Event, s_apvUserData[u32Ch]);
+        }
+    }
+}
+
+/**
+ * @brief       Set memory copy/set CPU fallback threshold
+ *
+ * @param[in]   u32Bytes        Requests shorter than this byte count are done by CPU.
+ *
+ * @return      None
+ *
+ * @details     The default value is \ref PDMA_MEM_CPU_THRESHOLD. The PDMA_Memcpy sample measures the crossover
+ *              point between CPU and PDMA copy on the target and can feed it to this function.
+ */
+void PDMA_SetMemThreshold(uint32_t u32Bytes)
+{
+    s_u32MemThreshold = u32Bytes;
+}
+
+/**
+ * @brief       Get memory copy/set CPU fallback threshold
+ *
+ * @return      Current threshold in bytes
+ */
+uint32_t PDMA_GetMemThreshold(void)
+{
+    return s_u32MemThreshold;
+}
+
+/**
+ * @brief       Select the widest PDMA width for a memory copy
+ *
+ * @param[in]   u32DstAddr      Destination address
+ * @param[in]   u32SrcAddr      Source address
+ * @param[out]  pu32Head        Byte number to be copied by CPU before both addresses are aligned to the width
+ *
+ * @return      PDMA_WIDTH_32, PDMA_WIDTH_16 or PDMA_WIDTH_8
+ */
+static uint32_t PDMA_MemWidth(uint32_t u32DstAddr, uint32_t u32SrcAddr, uint32_t *pu32Head)
+{
+    uint32_t u32Diff = u32DstAddr ^ u32SrcAddr;
+
+    if((u32Diff & 0x3UL) == 0UL)
+    {
+        *pu32Head = (4UL - (u32DstAddr & 0x3UL)) & 0x3UL;
+        return PDMA_WIDTH_32;
+    }
+    else if((u32Diff & 0x1UL) == 0UL)
+    {
+        *pu32Head = u32DstAddr & 0x1UL;
+        return PDMA_WIDTH_16;
+    }
+    else
+    {
+        *pu32Head = 0UL;
+        return PDMA_WIDTH_8;
+    }
+}
+
+/**
+ * @brief       Start a memory to memory basic mode transfer
+ */
+static int32_t PDMA_MemStart(PDMA_T * pdma, uint32_t u32Ch, uint32_t u32DstAddr, uint32_t u32SrcAddr, uint32_t u32SrcCtrl, uint32_t u32Width, uint32_t u32TransCount)
+{
+    if((u32Ch >= PDMA_CH_MAX) || (u32TransCount == 0UL) || (u32TransCount > PDMA_TXCNT_MAX))
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    u8ChSelect[u32Ch] = PDMA_MEM;
+    PDMA_SET_REQ_SRC(pdma, u32Ch, PDMA_MEM);
+
+    pdma->DSCT[u32Ch].SA = u32SrcAddr;
+    pdma->DSCT[u32Ch].DA = u32DstAddr;
+    pdma->DSCT[u32Ch].CTL = ((u32TransCount - 1UL) << PDMA_DSCT_CTL_TXCNT_Pos) |
+                            u32Width | u32SrcCtrl | PDMA_DAR_INC |
+                            PDMA_REQ_BURST | PDMA_BURST_128 | PDMA_OP_BASIC;
+    pdma->SWREQ = (1UL << u32Ch);
+
+    return 0;
+}
+
+/**
+ * @brief       Wait a memory transfer and clear its flags
+ */
+static int32_t PDMA_MemWait(PDMA_T * pdma, uint32_t u32Ch)
+{
+    uint32_t u32ChMsk = (1UL << u32Ch);
+    int32_t i32Ret = 0;
+
+    while(PDMA_IS_CH_BUSY(pdma, u32Ch)) {}
+
+    if(pdma->ABTSTS & u32ChMsk)
+    {
+        pdma->ABTSTS = u32ChMsk;
+        i32Ret = PDMA_ERR_ABORT;
+    }
+
+    pdma->TDSTS = u32ChMsk;
+
+    return i32Ret;
+}
+
+/**
+ * @brief       Copy memory by PDMA and wait until done
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The channel to use. It must be enabled, e.g. got from PDMA_RequestChannel().
+ * @param[out]  pvDst           Destination address
+ * @param[in]   pvSrc           Source address
+ * @param[in]   u32Len          Byte count. Any length is accepted.
+ *
+ * @retval      0               Success
+ * @retval      PDMA_ERR_PARAM  Invalid channel
+ * @retval      PDMA_ERR_ABORT  PDMA target abort
+ *
+ * @details     Requests shorter than the threshold set by PDMA_SetMemThreshold() are copied by CPU.
+ *              Otherwise the widest width allowed by the relative alignment of pvDst and pvSrc is used with
+ *              128-transfer bursts, and the misaligned head and tail bytes are copied by CPU.
+ *              The transfer done interrupt of the channel is masked while waiting so a callback is not called.
+ */
+int32_t PDMA_Memcpy(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, const void *pvSrc, uint32_t u32Len)
+{
+    uint8_t *pu8Dst = (uint8_t *)pvDst;
+    const uint8_t *pu8Src = (const uint8_t *)pvSrc;
+    uint32_t u32Width, u32Head, u32Shift, u32Count, u32IntEn;
+    int32_t i32Ret = 0;
+
+    if(u32Ch >= PDMA_CH_MAX)
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if((u32Len < s_u32MemThreshold) || (u32Len < 4UL))
+    {
+        memcpy(pvDst, pvSrc, u32Len);
+        return 0;
+    }
+
+    u32Width = PDMA_MemWidth((uint32_t)pu8Dst, (uint32_t)pu8Src, &u32Head);
+    u32Shift = u32Width >> PDMA_DSCT_CTL_TXWIDTH_Pos;
+
+    for(; u32Head != 0UL; u32Head--, u32Len--)
+    {
+        *pu8Dst++ = *pu8Src++;
+    }
+
+    u32IntEn = pdma->INTEN & (1UL << u32Ch);
+    pdma->INTEN &= ~(1UL << u32Ch);
+
+    while((u32Len >> u32Shift) != 0UL)
+    {
+        u32Count = u32Len >> u32Shift;
+
+        if(u32Count > PDMA_TXCNT_MAX)
+        {
+            u32Count = PDMA_TXCNT_MAX;
+        }
+
+        PDMA_MemStart(pdma, u32Ch, (uint32_t)pu8Dst, (uint32_t)pu8Src, PDMA_SAR_INC, u32Width, u32Count);
+        i32Ret = PDMA_MemWait(pdma, u32Ch);
+
+        if(i32Ret != 0)
+        {
+            break;
+        }
+
+        pu8Dst += (u32Count << u32Shift);
+        pu8Src += (u32Count << u32Shift);
+        u32Len -= (u32Count << u32Shift);
+    }
+
+    pdma->INTEN |= u32IntEn;
+
+    if(i32Ret == 0)
+    {
+        while(u32Len-- != 0UL)
+        {
+            *pu8Dst++ = *pu8Src++;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief       Start copying memory by PDMA without waiting
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The channel to use. It must be enabled, e.g. got from PDMA_RequestChannel().
+ * @param[out]  pvDst           Destination address
+ * @param[in]   pvSrc           Source address
+ * @param[in]   u32Len          Byte count. The PDMA part can not exceed \ref PDMA_TXCNT_MAX transfers.
+ *
+ * @retval      0                       PDMA transfer is started
+ * @retval      PDMA_MEM_DONE_BY_CPU    The request was short and has been copied by CPU
+ * @retval      PDMA_ERR_PARAM          Invalid channel or too long request
+ *
+ * @details     Head and tail bytes are copied by CPU before the function returns. The completion of the PDMA part
+ *              is reported by \ref PDMA_EVT_TRANS_DONE to the channel callback, or can be polled by PDMA_IS_CH_BUSY().
+ *              The source and destination buffers must not be used until then.
+ */
+int32_t PDMA_MemcpyAsync(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, const void *pvSrc, uint32_t u32Len)
+{
+    uint8_t *pu8Dst = (uint8_t *)pvDst;
+    const uint8_t *pu8Src = (const uint8_t *)pvSrc;
+    uint32_t u32Width, u32Head, u32Shift, u32Count, u32Tail;
+
+    if(u32Ch >= PDMA_CH_MAX)
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if((u32Len < s_u32MemThreshold) || (u32Len < 4UL))
+    {
+        memcpy(pvDst, pvSrc, u32Len);
+        return PDMA_MEM_DONE_BY_CPU;
+    }
+
+    u32Width = PDMA_MemWidth((uint32_t)pu8Dst, (uint32_t)pu8Src, &u32Head);
+    u32Shift = u32Width >> PDMA_DSCT_CTL_TXWIDTH_Pos;
+    u32Count = (u32Len - u32Head) >> u32Shift;
+    u32Tail = (u32Len - u32Head) - (u32Count << u32Shift);
+
+    if(u32Count > PDMA_TXCNT_MAX)
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    /* Head and tail do not overlap the PDMA part, so they are copied now */
+    memcpy(pu8Dst, pu8Src, u32Head);
+    memcpy(&pu8Dst[u32Len - u32Tail], &pu8Src[u32Len - u32Tail], u32Tail);
+
+    if(u32Count == 0UL)
+    {
+        return PDMA_MEM_DONE_BY_CPU;
+    }
+
+    return PDMA_MemStart(pdma, u32Ch, (uint32_t)&pu8Dst[u32Head], (uint32_t)&pu8Src[u32Head],
+                         PDMA_SAR_INC, u32Width, u32Count);
+}
+
+/**
+ * @brief       Fill memory by PDMA and wait until done
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The channel to use. It must be enabled, e.g. got from PDMA_RequestChannel().
+ * @param[out]  pvDst           Destination address
+ * @param[in]   u8Value         Fill value
+ * @param[in]   u32Len          Byte count. Any length is accepted.
+ *
+ * @retval      0               Success
+ * @retval      PDMA_ERR_PARAM  Invalid channel
+ * @retval      PDMA_ERR_ABORT  PDMA target abort
+ *
+ * @details     PDMA reads a word pattern from a fixed source address and writes words to the word aligned part
+ *              of pvDst. The head and tail bytes are filled by CPU. Requests shorter than the threshold are
+ *              done by CPU.
+ */
+int32_t PDMA_Memset(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, uint8_t u8Value, uint32_t u32Len)
+{
+    uint8_t *pu8Dst = (uint8_t *)pvDst;
+    uint32_t u32Head, u32Count, u32IntEn;
+    int32_t i32Ret = 0;
+
+    if(u32Ch >= PDMA_CH_MAX)
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if((u32Len < s_u32MemThreshold) || (u32Len < 4UL))
+    {
+        memset(pvDst, u8Value, u32Len);
+        return 0;
+    }
+
+    u32Head = (4UL - ((uint32_t)pu8Dst & 0x3UL)) & 0x3UL;
+    memset(pu8Dst, u8Value, u32Head);
+    pu8Dst += u32Head;
+    u32Len -= u32Head;
+
+    s_au32MemPattern[u32Ch] = (uint32_t)u8Value * 0x01010101UL;
+
+    u32IntEn = pdma->INTEN & (1UL << u32Ch);
+    pdma->INTEN &= ~(1UL << u32Ch);
+
+    while((u32Len >> 2) != 0UL)
+    {
+        u32Count = u32Len >> 2;
+
+        if(u32Count > PDMA_TXCNT_MAX)
+        {
+            u32Count = PDMA_TXCNT_MAX;
+        }
+
+        PDMA_MemStart(pdma, u32Ch, (uint32_t)pu8Dst, (uint32_t)&s_au32MemPattern[u32Ch], PDMA_SAR_FIX, PDMA_WIDTH_32, u32Count);
+        i32Ret = PDMA_MemWait(pdma, u32Ch);
+
+        if(i32Ret != 0)
+        {
+            break;
+        }
+
+        pu8Dst += (u32Count << 2);
+        u32Len -= (u32Count << 2);
+    }
+
+    pdma->INTEN |= u32IntEn;
+
+    if(i32Ret == 0)
+    {
+        memset(pu8Dst, u8Value, u32Len);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief       Start filling memory by PDMA without waiting
+ *
+ * @param[in]   pdma            The pointer of the specified PDMA module
+ * @param[in]   u32Ch           The channel to use. It must be enabled, e.g. got from PDMA_RequestChannel().
+ * @param[out]  pvDst           Destination address
+ * @param[in]   u8Value         Fill value
+ * @param[in]   u32Len          Byte count. The PDMA part can not exceed \ref PDMA_TXCNT_MAX words.
+ *
+ * @retval      0                       PDMA transfer is started
+ * @retval      PDMA_MEM_DONE_BY_CPU    The request was short and has been filled by CPU
+ * @retval      PDMA_ERR_PARAM          Invalid channel or too long request
+ *
+ * @details     The fill pattern is kept in a per-channel driver variable, so it stays valid until the transfer ends.
+ *              Completion is reported as PDMA_MemcpyAsync().
+ */
+int32_t PDMA_MemsetAsync(PDMA_T * pdma, uint32_t u32Ch, void *pvDst, uint8_t u8Value, uint32_t u32Len)
+{
+    uint8_t *pu8Dst = (uint8_t *)pvDst;
+    uint32_t u32Head, u32Count, u32Tail;
+
+    if(u32Ch >= PDMA_CH_MAX)
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    if((u32Len < s_u32MemThreshold) || (u32Len < 4UL))
+    {
+        memset(pvDst, u8Value, u32Len);
+        return PDMA_MEM_DONE_BY_CPU;
+    }
+
+    u32Head = (4UL - ((uint32_t)pu8Dst & 0x3UL)) & 0x3UL;
+    u32Count = (u32Len - u32Head) >> 2;
+    u32Tail = (u32Len - u32Head) & 0x3UL;
+
+    if(u32Count > PDMA_TXCNT_MAX)
+    {
+        return PDMA_ERR_PARAM;
+    }
+
+    memset(pu8Dst, u8Value, u32Head);
+    memset(&pu8Dst[u32Len - u32Tail], u8Value, u32Tail);
+
+    if(u32Count == 0UL)
+    {
+        return PDMA_MEM_DONE_BY_CPU;
+    }
+
+    s_au32MemPattern[u32Ch] = (uint32_t)u8Value * 0x01010101UL;
+
+    return PDMA_MemStart(pdma, u32Ch, (uint32_t)&pu8Dst[u32Head], (uint32_t)&s_au32MemPattern[u32Ch],
+                         PDMA_SAR_FIX, PDMA_WIDTH_32, u32Count);
+}
+
 /*@}*/ /* end of group PDMA_EXPORTED_FUNCTIONS */
 
 /*@}*/ /* end of group PDMA_Driver */
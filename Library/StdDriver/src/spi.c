@@ -16,6 +16,54 @@
   @{
 */
 
+#define SPI_XFER_PORT_NUM   3U
+
+/* Transfer state of a SPI module */
+typedef struct
+{
+    DSCT_T sTxDesc;                     /* PDMA descriptor feeding SPI_TX */
+    DSCT_T sRxDesc;                     /* PDMA descriptor draining SPI_RX */
+    PDMA_T *pdma;                       /* PDMA module of long transfers, NULL if all transfers use the FIFO path */
+    uint32_t u32TxCh;                   /* PDMA channel feeding SPI_TX, requested by SPI_TransferSetPDMA() */
+    uint32_t u32RxCh;                   /* PDMA channel draining SPI_RX, requested by SPI_TransferSetPDMA() */
+    uint32_t u32Threshold;              /* Transfers of at least this many data units use PDMA */
+    const uint8_t *pu8Tx;               /* Transmit buffer, NULL sends 0 */
+    uint8_t *pu8Rx;                     /* Receive buffer, NULL drops the received data */
+    uint32_t u32Len;                    /* Data units of the transfer */
+    uint32_t u32TxCnt;                  /* Data units written to SPI_TX */
+    uint32_t u32RxCnt;                  /* Data units read from SPI_RX */
+    uint32_t u32Width;                  /* Bytes per data unit, 1, 2 or 4 */
+    uint32_t u32Pdma;                   /* The transfer uses PDMA */
+    uint32_t u32Async;                  /* The transfer completes in interrupt */
+    uint32_t u32RxTh;                   /* RXTH setting restored at the end of an asynchronous FIFO transfer */
+    SPI_XFER_CALLBACK_T pfnCallback;
+    void *pvUserData;
+    volatile uint32_t u32Busy;
+} SPI_XFER_STATE_T;
+
+static SPI_XFER_STATE_T s_asSpiXfer[SPI_XFER_PORT_NUM];
+static uint32_t s_u32SpiTxZero = 0U;    /* PDMA source of RX-only transfers */
+static uint32_t s_u32SpiRxSink;         /* PDMA destination of TX-only transfers */
+
+static int32_t SPI_XferPort(SPI_T *spi);
+static int32_t SPI_XferStart(SPI_T *spi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, uint32_t u32Async, SPI_XFER_CALLBACK_T pfnCallback, void *pvUserData);
+static int32_t SPI_XferStartPDMA(SPI_T *spi, SPI_XFER_STATE_T *psXfer, uint32_t u32Port);
+static void SPI_XferPdmaDone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData);
+static uint32_t SPI_XferPump(SPI_T *spi, SPI_XFER_STATE_T *psXfer);
+static void SPI_XferSetRxTh(SPI_T *spi, SPI_XFER_STATE_T *psXfer);
+static void SPI_XferEnd(SPI_T *spi, SPI_XFER_STATE_T *psXfer, int32_t i32Status);
+static void SPI_XferDone(SPI_T *spi, SPI_XFER_STATE_T *psXfer, int32_t i32Status);
+
+/* Bus manager state of a SPI module */
+static SPI_DEV_T *s_apsBusDev[SPI_XFER_PORT_NUM];           /* Device whose register images are loaded */
+static SPI_BUS_XFER_T *s_apsBusHead[SPI_XFER_PORT_NUM];     /* Transaction in progress */
+static SPI_BUS_XFER_T *s_apsBusTail[SPI_XFER_PORT_NUM];
+
+static uint32_t SPI_BusClkSrc(SPI_T *spi);
+static int32_t SPI_BusStart(SPI_BUS_XFER_T *psXfer);
+static void SPI_BusDone(SPI_T *spi, int32_t i32Status, void *pvUserData);
+static void SPI_BusCsRelease(SPI_DEV_T *psDev);
+
 /** @addtogroup SPI_EXPORTED_FUNCTIONS SPI Exported Functions
   @{
 */
@@ -928,8 +976,778 @@ uint32_t SPI_GetStatus(SPI_T *spi, uint32_t u32Mask)
     return u32Flag;
 }
 
+/**
+  * @brief  Configure the PDMA path of SPI transfers.
+  * @param[in]  spi The pointer of the specified SPI module.
+  * @param[in]  pdma The pointer of the PDMA module. NULL releases the channels and makes all transfers use the FIFO path.
+  * @param[in]  u32Threshold Transfers of at least u32Threshold data units use PDMA, shorter ones use the FIFO path.
+  * @retval SPI_XFER_OK The PDMA path is configured.
+  * @retval SPI_XFER_ERR_PARAM Invalid SPI module.
+  * @retval SPI_XFER_ERR_BUSY A transfer is in progress.
+  * @retval SPI_XFER_ERR_NO_CH PDMA_RequestChannel() found no free channel, all transfers use the FIFO path.
+  * @details The TX and RX channels are requested by PDMA_RequestChannel() and kept until the next call. PDMA clock must
+  *          be enabled. Asynchronous PDMA transfers complete in the channel callback, so PDMA0_IRQHandler must call
+  *          PDMA_IRQHandler() and PDMA0_IRQn must be enabled.
+  */
+int32_t SPI_TransferSetPDMA(SPI_T *spi, PDMA_T *pdma, uint32_t u32Threshold)
+{
+    int32_t i32Port = SPI_XferPort(spi);
+    int32_t i32TxCh, i32RxCh;
+    SPI_XFER_STATE_T *psXfer;
+
+    if(i32Port < 0)
+    {
+        return SPI_XFER_ERR_PARAM;
+    }
+
+    psXfer = &s_asSpiXfer[i32Port];
+
+    if(psXfer->u32Busy)
+    {
+        return SPI_XFER_ERR_BUSY;
+    }
+
+    if(psXfer->pdma != NULL)
+    {
+        PDMA_ReleaseChannel(psXfer->pdma, psXfer->u32TxCh);
+        PDMA_ReleaseChannel(psXfer->pdma, psXfer->u32RxCh);
+        psXfer->pdma = NULL;
+    }
+
+    if(pdma == NULL)
+    {
+        return SPI_XFER_OK;
+    }
+
+    i32TxCh = PDMA_RequestChannel(pdma, 0U);
+    i32RxCh = (i32TxCh >= 0) ? PDMA_RequestChannel(pdma, 0U) : PDMA_ERR_NO_CH;
+
+    if(i32RxCh < 0)
+    {
+        if(i32TxCh >= 0)
+        {
+            PDMA_ReleaseChannel(pdma, (uint32_t)i32TxCh);
+        }
+
+        return SPI_XFER_ERR_NO_CH;
+    }
+
+    psXfer->u32TxCh = (uint32_t)i32TxCh;
+    psXfer->u32RxCh = (uint32_t)i32RxCh;
+    psXfer->u32Threshold = u32Threshold;
+    psXfer->pdma = pdma;
+
+    return SPI_XFER_OK;
+}
+
+/**
+  * @brief  Full-duplex transfer in master mode.
+  * @param[in]  spi The pointer of the specified SPI module.
+  * @param[in]  pvTxBuf Data to send. NULL sends 0 (RX-only).
+  * @param[out] pvRxBuf Buffer of the received data. NULL drops the received data (TX-only).
+  * @param[in]  u32Len Number of data units. A data unit is 1, 2 or 4 bytes for a data width of 8, 16 or 32 bits.
+  * @retval SPI_XFER_OK Transfer completed.
+  * @retval SPI_XFER_ERR_PARAM Invalid SPI module, length, or the buffers are not aligned to the data unit.
+  * @retval SPI_XFER_ERR_BUSY An asynchronous transfer is in progress.
+  * @retval SPI_XFER_ERR_TIMEOUT No data unit moved for SPI_TIMEOUT loops.
+  * @retval SPI_XFER_ERR_ABORT PDMA target abort.
+  * @details The data width is the one set by SPI_Open() or SPI_SET_DATA_WIDTH(). Transfers shorter than the threshold
+  *          of SPI_TransferSetPDMA() are polled through the FIFO, the others are moved by PDMA.
+  *          The RX FIFO is cleared first. The function does not use interrupts.
+  */
+int32_t SPI_Transfer(SPI_T *spi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len)
+{
+    SPI_XFER_STATE_T *psXfer;
+    uint32_t u32TimeOutCount, u32Progress, u32Last = 0xFFFFFFFFU;
+    int32_t i32Ret;
+
+    i32Ret = SPI_XferStart(spi, pvTxBuf, pvRxBuf, u32Len, 0U, NULL, NULL);
+
+    if(i32Ret != SPI_XFER_OK)
+    {
+        return i32Ret;
+    }
+
+    psXfer = &s_asSpiXfer[SPI_XferPort(spi)];
+    u32TimeOutCount = SPI_TIMEOUT;
+
+    while(1)
+    {
+        if(psXfer->u32Pdma)
+        {
+            if(PDMA_GET_ABORT_STS(psXfer->pdma) & ((1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh)))
+            {
+                i32Ret = SPI_XFER_ERR_ABORT;
+                break;
+            }
+
+            if(PDMA_GET_TD_STS(psXfer->pdma) & (1UL << psXfer->u32RxCh))
+            {
+                break;
+            }
+
+            u32Progress = psXfer->pdma->DSCT[psXfer->u32RxCh].CTL & PDMA_DSCT_CTL_TXCNT_Msk;
+        }
+        else
+        {
+            if(SPI_XferPump(spi, psXfer))
+            {
+                break;
+            }
+
+            u32Progress = psXfer->u32RxCnt;
+        }
+
+        /* Time-out counts the loops without progress */
+        if(u32Progress != u32Last)
+        {
+            u32Last = u32Progress;
+            u32TimeOutCount = SPI_TIMEOUT;
+        }
+        else if(--u32TimeOutCount == 0U)
+        {
+            i32Ret = SPI_XFER_ERR_TIMEOUT;
+            break;
+        }
+    }
+
+    SPI_XferEnd(spi, psXfer, i32Ret);
+
+    return i32Ret;
+}
+
+/**
+  * @brief  Start a full-duplex transfer in master mode and return at once.
+  * @param[in]  spi The pointer of the specified SPI module.
+  * @param[in]  pvTxBuf Data to send. NULL sends 0 (RX-only).
+  * @param[out] pvRxBuf Buffer of the received data. NULL drops the received data (TX-only).
+  * @param[in]  u32Len Number of data units, see SPI_Transfer().
+  * @param[in]  pfnCallback Completion callback. NULL if the application polls SPI_TransferIsBusy().
+  * @param[in]  pvUserData User data of the callback.
+  * @retval SPI_XFER_OK Transfer started.
+  * @retval SPI_XFER_ERR_PARAM Invalid SPI module, length, or the buffers are not aligned to the data unit.
+  * @retval SPI_XFER_ERR_BUSY A transfer is in progress.
+  * @details Short transfers refill the TX FIFO in the RX FIFO threshold interrupt, the threshold follows the data
+  *          in flight so the last data units also raise it. Long transfers are moved by PDMA and complete in the RX
+  *          channel callback. SPIn_IRQHandler must call SPI_TransferIRQHandler(), PDMA0_IRQHandler must call
+  *          PDMA_IRQHandler() for the PDMA path, and the interrupts must be enabled in NVIC.
+  *          The buffers must stay valid until completion.
+  */
+int32_t SPI_TransferAsync(SPI_T *spi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, SPI_XFER_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    return SPI_XferStart(spi, pvTxBuf, pvRxBuf, u32Len, 1U, pfnCallback, pvUserData);
+}
+
+/**
+  * @brief  Check if a transfer is in progress.
+  * @param[in]  spi The pointer of the specified SPI module.
+  * @retval 0 No transfer is in progress.
+  * @retval 1 A transfer is in progress.
+  */
+uint32_t SPI_TransferIsBusy(SPI_T *spi)
+{
+    int32_t i32Port = SPI_XferPort(spi);
+
+    return ((i32Port >= 0) && s_asSpiXfer[i32Port].u32Busy) ? 1U : 0U;
+}
+
+/**
+  * @brief  Asynchronous transfer interrupt service.
+  * @param[in]  spi The pointer of the specified SPI module.
+  * @return None
+  * @details Call this function from SPIn_IRQHandler. It moves the FIFO data and calls the callback when the transfer
+  *          completes. PDMA transfers complete in PDMA_IRQHandler() instead.
+  */
+void SPI_TransferIRQHandler(SPI_T *spi)
+{
+    int32_t i32Port = SPI_XferPort(spi);
+    SPI_XFER_STATE_T *psXfer;
+
+    if(i32Port < 0)
+    {
+        return;
+    }
+
+    psXfer = &s_asSpiXfer[i32Port];
+
+    if((psXfer->u32Busy == 0U) || (psXfer->u32Async == 0U) || psXfer->u32Pdma)
+    {
+        return;
+    }
+
+    if(SPI_XferPump(spi, psXfer) == 0U)
+    {
+        SPI_XferSetRxTh(spi, psXfer);
+        return;
+    }
+
+    SPI_XferDone(spi, psXfer, SPI_XFER_OK);
+}
+
+/**
+  * @brief  Initialize a device of the SPI bus manager.
+  * @param[out] psDev The device.
+  * @param[in]  spi The pointer of the SPI module the device is connected to.
+  * @param[in]  u32SPIMode Transfer timing of the device. (SPI_MODE_0, SPI_MODE_1, SPI_MODE_2, SPI_MODE_3)
+  * @param[in]  u32DataWidth Data width of the device, 8 ~ 32 bits.
+  * @param[in]  u32BusClock The expected frequency of SPI bus clock of the device in Hz.
+  * @param[in]  pu32CsPin GPIO pin data register of the chip select, e.g. &PB1. NULL uses the SPI_SS pin
+  *             with automatic slave selection.
+  * @param[in]  u32ActiveLevel Active level of the chip select. (SPI_SS_ACTIVE_HIGH, SPI_SS_ACTIVE_LOW)
+  * @return Actual frequency of SPI bus clock of the device.
+  * @details The register images are computed once from the current SPI peripheral clock source, which is
+  *          selected by the application and not changed here. A GPIO chip select pin must be configured as
+  *          output by the application, it is driven inactive by this function.
+  */
+uint32_t SPI_DevInit(SPI_DEV_T *psDev, SPI_T *spi, uint32_t u32SPIMode, uint32_t u32DataWidth, uint32_t u32BusClock, volatile uint32_t *pu32CsPin, uint32_t u32ActiveLevel)
+{
+    uint32_t u32ClkSrc, u32Div;
+
+    u32ClkSrc = SPI_BusClkSrc(spi);
+
+    /* f_spi = f_spi_clk_src / (DIVIDER + 1), rounded to the nearest DIVIDER as SPI_SetBusClock() */
+    if((u32BusClock == 0U) || (u32BusClock >= u32ClkSrc))
+    {
+        u32Div = (u32BusClock == 0U) ? 0x1FFU : 0U;
+    }
+    else
+    {
+        u32Div = (((u32ClkSrc * 10U) / u32BusClock + 5U) / 10U) - 1U;
+
+        if(u32Div > 0x1FFU)
+        {
+            u32Div = 0x1FFU;
+        }
+    }
+
+    psDev->spi = spi;
+    psDev->pu32CsPin = pu32CsPin;
+    psDev->u32CsActive = (u32ActiveLevel == SPI_SS_ACTIVE_HIGH) ? 1U : 0U;
+    psDev->u32Ctl = SPI_MASTER | ((u32DataWidth & 0x1FU) << SPI_CTL_DWIDTH_Pos) | u32SPIMode | SPI_CTL_SPIEN_Msk;
+    psDev->u32ClkDiv = u32Div << SPI_CLKDIV_DIVIDER_Pos;
+    psDev->u32SsCtl = (pu32CsPin == NULL) ? (SPI_SS | u32ActiveLevel | SPI_SSCTL_AUTOSS_Msk) : SPI_SS_ACTIVE_LOW;
+
+    if(pu32CsPin != NULL)
+    {
+        SPI_BusCsRelease(psDev);
+    }
+
+    return u32ClkSrc / (u32Div + 1U);
+}
+
+/**
+  * @brief  Queue a transaction on the SPI bus manager.
+  * @param[in]  psXfer The transaction. It is started at once if the bus is idle.
+  * @retval SPI_XFER_OK The transaction is queued or started.
+  * @retval SPI_XFER_ERR_PARAM Invalid device, length, or the buffers are not aligned to the data unit of the device.
+  * @retval SPI_XFER_ERR_BUSY The descriptor is already queued, or SPI_Transfer() or SPI_TransferAsync() is in progress
+  *         on the idle bus.
+  * @details Transactions run in submit order. On completion SPI_TransferIRQHandler() releases the chip select, starts the
+  *          next transaction and then calls the callback, so back-to-back transactions to different devices are separated
+  *          only by the register images switch. The function can be called from thread and interrupt context.
+  *          SPIn_IRQHandler must call SPI_TransferIRQHandler(), and PDMA0_IRQHandler must call PDMA_IRQHandler() for the
+  *          PDMA path. The bus manager owns the register images of the module, do not call SPI_Open(), SPI_SetBusClock() or
+  *          SPI_EnableAutoSS() on it while devices are in use.
+  */
+int32_t SPI_BusSubmit(SPI_BUS_XFER_T *psXfer)
+{
+    int32_t i32Port, i32Ret = SPI_XFER_OK;
+    uint32_t u32Width, u32PriMask;
+
+    if((psXfer == NULL) || (psXfer->psDev == NULL) || (psXfer->u32Len == 0U))
+    {
+        return SPI_XFER_ERR_PARAM;
+    }
+
+    i32Port = SPI_XferPort(psXfer->psDev->spi);
+
+    /* DWIDTH 0 means 32 bits */
+    u32Width = (psXfer->psDev->u32Ctl & SPI_CTL_DWIDTH_Msk) >> SPI_CTL_DWIDTH_Pos;
+    u32Width = (u32Width == 0U) ? 4U : ((u32Width <= 8U) ? 1U : ((u32Width <= 16U) ? 2U : 4U));
+
+    if((i32Port < 0) || ((((uint32_t)psXfer->pvTxBuf | (uint32_t)psXfer->pvRxBuf) & (u32Width - 1U)) != 0U))
+    {
+        return SPI_XFER_ERR_PARAM;
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1U);
+
+    if(psXfer->i32Status == SPI_XFER_PENDING)
+    {
+        __set_PRIMASK(u32PriMask);
+        return SPI_XFER_ERR_BUSY;
+    }
+
+    psXfer->i32Status = SPI_XFER_PENDING;
+    psXfer->psNext = NULL;
+
+    if(s_apsBusHead[i32Port] == NULL)
+    {
+        s_apsBusHead[i32Port] = psXfer;
+        s_apsBusTail[i32Port] = psXfer;
+        i32Ret = SPI_BusStart(psXfer);
+
+        if(i32Ret != SPI_XFER_OK)
+        {
+            s_apsBusHead[i32Port] = NULL;
+            psXfer->i32Status = i32Ret;
+        }
+    }
+    else
+    {
+        s_apsBusTail[i32Port]->psNext = psXfer;
+        s_apsBusTail[i32Port] = psXfer;
+    }
+
+    __set_PRIMASK(u32PriMask);
+
+    return i32Ret;
+}
+
+/**
+  * @brief  Check if the SPI bus manager has queued transactions.
+  * @param[in]  spi The pointer of the specified SPI module.
+  * @retval 0 The bus is idle.
+  * @retval 1 A transaction is in progress.
+  */
+uint32_t SPI_BusIsBusy(SPI_T *spi)
+{
+    int32_t i32Port = SPI_XferPort(spi);
+
+    return ((i32Port >= 0) && (s_apsBusHead[i32Port] != NULL)) ? 1U : 0U;
+}
+
 /*@}*/ /* end of group SPI_EXPORTED_FUNCTIONS */
 
+/**
+  * @brief  Get the frequency of the SPI peripheral clock source.
+  */
+static uint32_t SPI_BusClkSrc(SPI_T *spi)
+{
+    uint32_t u32Sel;
+
+    if(spi == SPI0)
+    {
+        u32Sel = (CLK->CLKSEL2 & CLK_CLKSEL2_SPI0SEL_Msk) >> CLK_CLKSEL2_SPI0SEL_Pos;
+    }
+    else if(spi == SPI1)
+    {
+        u32Sel = (CLK->CLKSEL2 & CLK_CLKSEL2_SPI1SEL_Msk) >> CLK_CLKSEL2_SPI1SEL_Pos;
+    }
+    else
+    {
+        u32Sel = (CLK->CLKSEL2 & CLK_CLKSEL2_SPI2SEL_Msk) >> CLK_CLKSEL2_SPI2SEL_Pos;
+    }
+
+    if(u32Sel == 0U)
+    {
+        /* SPI1 is on PCLK0, SPI0 and SPI2 are on PCLK1 */
+        return (spi == SPI1) ? CLK_GetPCLK0Freq() : CLK_GetPCLK1Freq();
+    }
+    else if(u32Sel == 1U)
+    {
+        return __MIRC;
+    }
+    else if(u32Sel == 2U)
+    {
+        return __HIRC;
+    }
+
+    return 0U;
+}
+
+/**
+  * @brief  Load the register images of the device if another one was loaded, select it and start the transfer.
+  * @details Called with interrupts disabled.
+  */
+static int32_t SPI_BusStart(SPI_BUS_XFER_T *psXfer)
+{
+    SPI_DEV_T *psDev = psXfer->psDev;
+    SPI_T *spi = psDev->spi;
+    int32_t i32Port = SPI_XferPort(spi);
+    int32_t i32Ret;
+
+    if(SPI_TransferIsBusy(spi))
+    {
+        return SPI_XFER_ERR_BUSY;
+    }
+
+    if(s_apsBusDev[i32Port] != psDev)
+    {
+        spi->CTL = psDev->u32Ctl;
+        spi->CLKDIV = psDev->u32ClkDiv;
+        spi->SSCTL = psDev->u32SsCtl;
+        s_apsBusDev[i32Port] = psDev;
+    }
+
+    if(psDev->pu32CsPin != NULL)
+    {
+        *psDev->pu32CsPin = psDev->u32CsActive;
+    }
+
+    i32Ret = SPI_TransferAsync(spi, psXfer->pvTxBuf, psXfer->pvRxBuf, psXfer->u32Len, SPI_BusDone, psXfer);
+
+    if((i32Ret != SPI_XFER_OK) && (psDev->pu32CsPin != NULL))
+    {
+        SPI_BusCsRelease(psDev);
+    }
+
+    return i32Ret;
+}
+
+/**
+  * @brief  Transfer completion of the bus manager: release the chip select, start the next transaction, then call the callback.
+  */
+static void SPI_BusDone(SPI_T *spi, int32_t i32Status, void *pvUserData)
+{
+    SPI_BUS_XFER_T *psXfer = (SPI_BUS_XFER_T *)pvUserData;
+    SPI_BUS_XFER_T *psFailed = NULL, *psFailedTail = NULL, *psNext;
+    int32_t i32Port = SPI_XferPort(spi);
+    int32_t i32Ret, i32Fail = SPI_XFER_OK;
+    uint32_t u32PriMask;
+
+    if(psXfer->psDev->pu32CsPin != NULL)
+    {
+        SPI_BusCsRelease(psXfer->psDev);
+    }
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1U);
+
+    psNext = psXfer->psNext;
+    psXfer->i32Status = i32Status;
+
+    /* A transaction that cannot start completes with its error after this one. Its status stays pending until
+       then, so it cannot be re-submitted while it is on the failed list. */
+    while(psNext != NULL)
+    {
+        i32Ret = SPI_BusStart(psNext);
+
+        if(i32Ret == SPI_XFER_OK)
+        {
+            break;
+        }
+
+        i32Fail = i32Ret;
+
+        if(psFailed == NULL)
+        {
+            psFailed = psNext;
+        }
+        else
+        {
+            psFailedTail->psNext = psNext;
+        }
+
+        psFailedTail = psNext;
+        psNext = psNext->psNext;
+        psFailedTail->psNext = NULL;
+    }
+
+    s_apsBusHead[i32Port] = psNext;
+
+    __set_PRIMASK(u32PriMask);
+
+    if(psXfer->pfnCallback != NULL)
+    {
+        psXfer->pfnCallback(psXfer);
+    }
+
+    while(psFailed != NULL)
+    {
+        psNext = psFailed->psNext;
+        psFailed->i32Status = i32Fail;
+
+        if(psFailed->pfnCallback != NULL)
+        {
+            psFailed->pfnCallback(psFailed);
+        }
+
+        psFailed = psNext;
+    }
+}
+
+/**
+  * @brief  Drive the GPIO chip select of the device inactive.
+  */
+static void SPI_BusCsRelease(SPI_DEV_T *psDev)
+{
+    *psDev->pu32CsPin = psDev->u32CsActive ^ 1U;
+}
+
+/**
+  * @brief  Get the transfer state index of a SPI module, -1 if the module is not supported.
+  */
+static int32_t SPI_XferPort(SPI_T *spi)
+{
+    if(spi == SPI0)
+    {
+        return 0;
+    }
+    else if(spi == SPI1)
+    {
+        return 1;
+    }
+    else if(spi == SPI2)
+    {
+        return 2;
+    }
+
+    return -1;
+}
+
+/**
+  * @brief  Check the parameters, take the transfer state and start the FIFO or PDMA path.
+  */
+static int32_t SPI_XferStart(SPI_T *spi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, uint32_t u32Async, SPI_XFER_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    int32_t i32Port = SPI_XferPort(spi);
+    SPI_XFER_STATE_T *psXfer;
+    uint32_t u32Bits, u32Width, u32PriMask;
+
+    if((i32Port < 0) || (u32Len == 0U))
+    {
+        return SPI_XFER_ERR_PARAM;
+    }
+
+    /* DWIDTH 0 means 32 bits */
+    u32Bits = (spi->CTL & SPI_CTL_DWIDTH_Msk) >> SPI_CTL_DWIDTH_Pos;
+    u32Width = ((u32Bits != 0U) && (u32Bits <= 8U)) ? 1U : (((u32Bits != 0U) && (u32Bits <= 16U)) ? 2U : 4U);
+
+    if((((uint32_t)pvTxBuf | (uint32_t)pvRxBuf) & (u32Width - 1U)) != 0U)
+    {
+        return SPI_XFER_ERR_PARAM;
+    }
+
+    psXfer = &s_asSpiXfer[i32Port];
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1U);
+
+    if(psXfer->u32Busy)
+    {
+        __set_PRIMASK(u32PriMask);
+        return SPI_XFER_ERR_BUSY;
+    }
+
+    psXfer->u32Busy = 1U;
+    __set_PRIMASK(u32PriMask);
+
+    psXfer->pu8Tx = (const uint8_t *)pvTxBuf;
+    psXfer->pu8Rx = (uint8_t *)pvRxBuf;
+    psXfer->u32Len = u32Len;
+    psXfer->u32TxCnt = 0U;
+    psXfer->u32RxCnt = 0U;
+    psXfer->u32Width = u32Width;
+    psXfer->u32Async = u32Async;
+    psXfer->pfnCallback = pfnCallback;
+    psXfer->pvUserData = pvUserData;
+    psXfer->u32Pdma = ((psXfer->pdma != NULL) && (u32Len >= psXfer->u32Threshold) && (u32Len <= PDMA_TXCNT_MAX)) ? 1U : 0U;
+
+    /* Data left from an earlier access would be counted as received by either path */
+    SPI_ClearRxFIFO(spi);
+
+    if(psXfer->u32Pdma && (SPI_XferStartPDMA(spi, psXfer, (uint32_t)i32Port) != 0))
+    {
+        /* The descriptors are out of the PDMA SCATBA window */
+        psXfer->u32Pdma = 0U;
+    }
+
+    if((psXfer->u32Pdma == 0U) && u32Async)
+    {
+        psXfer->u32RxTh = spi->FIFOCTL & SPI_FIFOCTL_RXTH_Msk;
+        SPI_XferPump(spi, psXfer);
+        SPI_XferSetRxTh(spi, psXfer);
+        spi->FIFOCTL |= SPI_FIFOCTL_RXTHIEN_Msk;
+    }
+
+    return SPI_XFER_OK;
+}
+
+/**
+  * @brief  Start the RX and TX PDMA descriptors and enable SPI PDMA, RX first so no received data is lost.
+  * @details Return non-zero if the descriptors cannot be addressed by PDMA SCATBA, nothing is started then.
+  */
+static int32_t SPI_XferStartPDMA(SPI_T *spi, SPI_XFER_STATE_T *psXfer, uint32_t u32Port)
+{
+    PDMA_T *pdma = psXfer->pdma;
+    uint32_t u32Width, u32TxReq = PDMA_SPI0_TX + (u32Port * 2U);
+    uint32_t u32Mask = (1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh);
+
+    u32Width = (psXfer->u32Width == 1U) ? PDMA_WIDTH_8 : ((psXfer->u32Width == 2U) ? PDMA_WIDTH_16 : PDMA_WIDTH_32);
+
+    /* SPI_XferStart() checked the buffer alignment and the length */
+    PDMA_DescInit(&psXfer->sRxDesc, u32Width, (uint32_t)&spi->RX, PDMA_SAR_FIX,
+                  (psXfer->pu8Rx != NULL) ? (uint32_t)psXfer->pu8Rx : (uint32_t)&s_u32SpiRxSink,
+                  (psXfer->pu8Rx != NULL) ? PDMA_DAR_INC : PDMA_DAR_FIX, psXfer->u32Len, PDMA_REQ_SINGLE);
+    PDMA_DescInit(&psXfer->sTxDesc, u32Width,
+                  (psXfer->pu8Tx != NULL) ? (uint32_t)psXfer->pu8Tx : (uint32_t)&s_u32SpiTxZero,
+                  (psXfer->pu8Tx != NULL) ? PDMA_SAR_INC : PDMA_SAR_FIX, (uint32_t)&spi->TX, PDMA_DAR_FIX,
+                  psXfer->u32Len, PDMA_REQ_SINGLE);
+
+    PDMA_Open(pdma, u32Mask);
+    PDMA_CLR_TD_FLAG(pdma, u32Mask);
+    PDMA_CLR_ABORT_FLAG(pdma, u32Mask);
+
+    /* The RX channel completes the transfer, its callback is needed by the asynchronous path only */
+    PDMA_SetCallback(pdma, psXfer->u32RxCh, psXfer->u32Async ? SPI_XferPdmaDone : NULL, spi);
+
+    if(PDMA_StartChain(pdma, psXfer->u32RxCh, u32TxReq + 1U, &psXfer->sRxDesc) != 0)
+    {
+        PDMA_SetCallback(pdma, psXfer->u32RxCh, NULL, NULL);
+        return -1;
+    }
+
+    /* Both descriptors are in the same state, TX cannot fail if RX did not */
+    PDMA_StartChain(pdma, psXfer->u32TxCh, u32TxReq, &psXfer->sTxDesc);
+
+    SPI_TRIGGER_RX_PDMA(spi);
+    SPI_TRIGGER_TX_PDMA(spi);
+
+    return 0;
+}
+
+/**
+  * @brief  PDMA RX channel callback of asynchronous transfers.
+  */
+static void SPI_XferPdmaDone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    SPI_T *spi = (SPI_T *)pvUserData;
+    SPI_XFER_STATE_T *psXfer = &s_asSpiXfer[SPI_XferPort(spi)];
+
+    (void)u32Ch;
+
+    if((psXfer->u32Busy == 0U) || (psXfer->u32Pdma == 0U))
+    {
+        return;
+    }
+
+    SPI_XferDone(spi, psXfer, (u32Event & PDMA_EVT_ABORT) ? SPI_XFER_ERR_ABORT : SPI_XFER_OK);
+}
+
+/**
+  * @brief  Drain the RX FIFO and refill the TX FIFO, return 1 when all data units are received.
+  * @details No more data units than the FIFO depth are in flight, so the RX FIFO never overruns.
+  */
+static uint32_t SPI_XferPump(SPI_T *spi, SPI_XFER_STATE_T *psXfer)
+{
+    uint32_t u32Depth = (psXfer->u32Width == 4U) ? 4U : 8U;
+    uint32_t u32Data;
+
+    while(((spi->STATUS & SPI_STATUS_RXEMPTY_Msk) == 0U) && (psXfer->u32RxCnt < psXfer->u32Len))
+    {
+        u32Data = spi->RX;
+
+        if(psXfer->pu8Rx != NULL)
+        {
+            if(psXfer->u32Width == 1U)
+            {
+                psXfer->pu8Rx[psXfer->u32RxCnt] = (uint8_t)u32Data;
+            }
+            else if(psXfer->u32Width == 2U)
+            {
+                ((uint16_t *)(void *)psXfer->pu8Rx)[psXfer->u32RxCnt] = (uint16_t)u32Data;
+            }
+            else
+            {
+                ((uint32_t *)(void *)psXfer->pu8Rx)[psXfer->u32RxCnt] = u32Data;
+            }
+        }
+
+        psXfer->u32RxCnt++;
+    }
+
+    while((psXfer->u32TxCnt < psXfer->u32Len) && ((psXfer->u32TxCnt - psXfer->u32RxCnt) < u32Depth) &&
+            ((spi->STATUS & SPI_STATUS_TXFULL_Msk) == 0U))
+    {
+        if(psXfer->pu8Tx == NULL)
+        {
+            u32Data = 0U;
+        }
+        else if(psXfer->u32Width == 1U)
+        {
+            u32Data = psXfer->pu8Tx[psXfer->u32TxCnt];
+        }
+        else if(psXfer->u32Width == 2U)
+        {
+            u32Data = ((const uint16_t *)(const void *)psXfer->pu8Tx)[psXfer->u32TxCnt];
+        }
+        else
+        {
+            u32Data = ((const uint32_t *)(const void *)psXfer->pu8Tx)[psXfer->u32TxCnt];
+        }
+
+        spi->TX = u32Data;
+        psXfer->u32TxCnt++;
+    }
+
+    return (psXfer->u32RxCnt == psXfer->u32Len) ? 1U : 0U;
+}
+
+/**
+  * @brief  Set RX FIFO threshold to half FIFO, or lower if fewer data units are in flight.
+  * @details RXTHIF is set when the RX FIFO holds more than RXTH data units.
+  */
+static void SPI_XferSetRxTh(SPI_T *spi, SPI_XFER_STATE_T *psXfer)
+{
+    uint32_t u32InFlight = psXfer->u32TxCnt - psXfer->u32RxCnt;
+    uint32_t u32Th = (psXfer->u32Width == 4U) ? 2U : 4U;
+
+    if(u32InFlight < u32Th)
+    {
+        u32Th = u32InFlight;
+    }
+
+    spi->FIFOCTL = (spi->FIFOCTL & ~SPI_FIFOCTL_RXTH_Msk) | ((u32Th - 1U) << SPI_FIFOCTL_RXTH_Pos);
+}
+
+/**
+  * @brief  Release the PDMA channels or the RX threshold interrupt and the transfer state.
+  */
+static void SPI_XferEnd(SPI_T *spi, SPI_XFER_STATE_T *psXfer, int32_t i32Status)
+{
+    if(psXfer->u32Pdma)
+    {
+        SPI_DISABLE_TX_RX_PDMA(spi);
+        PDMA_SetCallback(psXfer->pdma, psXfer->u32RxCh, NULL, NULL);
+
+        if(i32Status != SPI_XFER_OK)
+        {
+            PDMA_RESET(psXfer->pdma, psXfer->u32TxCh);
+            PDMA_RESET(psXfer->pdma, psXfer->u32RxCh);
+        }
+
+        PDMA_CLR_TD_FLAG(psXfer->pdma, (1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh));
+        PDMA_CLR_ABORT_FLAG(psXfer->pdma, (1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh));
+    }
+    else if(psXfer->u32Async)
+    {
+        spi->FIFOCTL = (spi->FIFOCTL & ~(SPI_FIFOCTL_RXTHIEN_Msk | SPI_FIFOCTL_RXTH_Msk)) | psXfer->u32RxTh;
+    }
+
+    if(i32Status != SPI_XFER_OK)
+    {
+        SPI_ClearTxFIFO(spi);
+        SPI_ClearRxFIFO(spi);
+    }
+
+    psXfer->u32Busy = 0U;
+}
+
+/**
+  * @brief  Complete an asynchronous transfer and call its callback.
+  */
+static void SPI_XferDone(SPI_T *spi, SPI_XFER_STATE_T *psXfer, int32_t i32Status)
+{
+    SPI_XferEnd(spi, psXfer, i32Status);
+
+    if(psXfer->pfnCallback != NULL)
+    {
+        psXfer->pfnCallback(spi, i32Status, psXfer->pvUserData);
+    }
+}
+
 /*@}*/ /* end of group SPI_Driver */
 
 /*@}*/ /* end of group Standard_Driver */
@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 #include <stdio.h>
+#include <string.h>
 #include "NuMicro.h"
 
 /** @addtogroup Standard_Driver Standard Driver
@@ -594,6 +595,602 @@ void UART_SelectSingleWireMode(UART_T *uart)
 }
 
 
+/**
+ *    @brief        Initialize interrupt-driven ring buffer on UART
+ *
+ *    @param[in]    psBuf       The pointer of the UART ring buffer control block.
+ *    @param[in]    uart        The pointer of the specified UART module. It must be opened by UART_Open() first.
+ *    @param[in]    pu8TxBuf    Transmit ring storage.
+ *    @param[in]    u32TxSize   Transmit ring size in bytes. It must be a power of two.
+ *    @param[in]    pu8RxBuf    Receive ring storage.
+ *    @param[in]    u32RxSize   Receive ring size in bytes. It must be a power of two.
+ *
+ *    @retval       0                   Success
+ *    @retval       UART_BUF_ERR_PARAM  Invalid buffer pointer or size
+ *
+ *    @details      The function sets RX FIFO trigger level to 8 bytes, enables the RX time-out counter so that the
+ *                  tail of a burst is flushed, and enables RDA, RXTO, RLS and buffer error interrupts.
+ *                  THRE interrupt is enabled on demand by UART_WriteAsync() and UART_CommitTx().
+ *                  User must enable the UART IRQ in NVIC and call UART_BufIRQHandler() from the UART IRQ handler.
+ */
+int32_t UART_BufInit(UART_BUF_T *psBuf, UART_T *uart, uint8_t pu8TxBuf[], uint32_t u32TxSize, uint8_t pu8RxBuf[], uint32_t u32RxSize)
+{
+    if((psBuf == NULL) || (pu8TxBuf == NULL) || (pu8RxBuf == NULL) ||
+            (u32TxSize == 0ul) || ((u32TxSize & (u32TxSize - 1ul)) != 0ul) ||
+            (u32RxSize == 0ul) || ((u32RxSize & (u32RxSize - 1ul)) != 0ul))
+    {
+        return UART_BUF_ERR_PARAM;
+    }
+
+    psBuf->uart           = uart;
+    psBuf->pu8TxBuf       = pu8TxBuf;
+    psBuf->u32TxSize      = u32TxSize;
+    psBuf->u32TxHead      = 0ul;
+    psBuf->u32TxTail      = 0ul;
+    psBuf->pu8RxBuf       = pu8RxBuf;
+    psBuf->u32RxSize      = u32RxSize;
+    psBuf->u32RxHead      = 0ul;
+    psBuf->u32RxTail      = 0ul;
+    psBuf->u32RxOverflow  = 0ul;
+    psBuf->u32TxOverflow  = 0ul;
+    psBuf->u32FifoOverrun = 0ul;
+
+    /* Interrupt at half FIFO so that 8 bytes of head-room remain for interrupt latency */
+    uart->FIFO = (uart->FIFO & (~UART_FIFO_RFITL_Msk)) | UART_FIFO_RFITL_8BYTES;
+
+    /* Flush bytes left below the trigger level after 40 idle bit times (about 4 characters) */
+    UART_SetTimeoutCnt(uart, 40ul);
+
+    uart->INTEN = (uart->INTEN & (~UART_INTEN_THREIEN_Msk)) | UART_BUF_RX_INT;
+
+    return 0;
+}
+
+
+/**
+ *    @brief        Stop interrupt-driven ring buffer on UART
+ *
+ *    @param[in]    psBuf   The pointer of the UART ring buffer control block.
+ *
+ *    @return       None
+ *
+ *    @details      The function disables the interrupts used by the ring buffer. Data left in the rings is kept.
+ */
+void UART_BufClose(UART_BUF_T *psBuf)
+{
+    UART_DISABLE_INT(psBuf->uart, (UART_BUF_RX_INT | UART_INTEN_THREIEN_Msk));
+}
+
+
+/**
+ *    @brief        UART ring buffer interrupt service
+ *
+ *    @param[in]    psBuf   The pointer of the UART ring buffer control block.
+ *
+ *    @return       None
+ *
+ *    @details      Call this function from the UART IRQ handler. It drains RX FIFO into the receive ring on RDA or RX
+ *                  time-out, refills TX FIFO from the transmit ring on THRE, and counts and clears line status and
+ *                  buffer error events. THRE interrupt is disabled once the transmit ring becomes empty.
+ */
+void UART_BufIRQHandler(UART_BUF_T *psBuf)
+{
+    UART_T *uart = psBuf->uart;
+    uint32_t u32IntSts = uart->INTSTS;
+    uint32_t u32Idx;
+    uint8_t u8Data;
+
+    if(u32IntSts & (UART_INTSTS_RDAINT_Msk | UART_INTSTS_RXTOINT_Msk))
+    {
+        u32Idx = psBuf->u32RxHead;
+
+        /* Drain RX FIFO completely, it also clears RDAIF and RXTOIF */
+        while((uart->FIFOSTS & UART_FIFOSTS_RXEMPTY_Msk) == 0ul)
+        {
+            u8Data = (uint8_t)uart->DAT;
+
+            if((u32Idx - psBuf->u32RxTail) < psBuf->u32RxSize)
+            {
+                psBuf->pu8RxBuf[u32Idx & (psBuf->u32RxSize - 1ul)] = u8Data;
+                u32Idx++;
+            }
+            else
+            {
+                psBuf->u32RxOverflow++;
+            }
+        }
+
+        psBuf->u32RxHead = u32Idx;
+    }
+
+    if(u32IntSts & UART_INTSTS_THREINT_Msk)
+    {
+        u32Idx = psBuf->u32TxTail;
+
+        while((u32Idx != psBuf->u32TxHead) && ((uart->FIFOSTS & UART_FIFOSTS_TXFULL_Msk) == 0ul))
+        {
+            uart->DAT = psBuf->pu8TxBuf[u32Idx & (psBuf->u32TxSize - 1ul)];
+            u32Idx++;
+        }
+
+        psBuf->u32TxTail = u32Idx;
+
+        if(u32Idx == psBuf->u32TxHead)
+        {
+            UART_DISABLE_INT(uart, UART_INTEN_THREIEN_Msk);
+        }
+    }
+
+    if(u32IntSts & UART_INTSTS_RLSINT_Msk)
+    {
+        UART_ClearIntFlag(uart, UART_INTSTS_RLSINT_Msk);
+    }
+
+    if(u32IntSts & UART_INTSTS_BUFERRINT_Msk)
+    {
+        if(uart->FIFOSTS & UART_FIFOSTS_RXOVIF_Msk)
+        {
+            psBuf->u32FifoOverrun++;
+        }
+
+        UART_ClearIntFlag(uart, UART_INTSTS_BUFERRINT_Msk);
+    }
+}
+
+
+/**
+ *    @brief        Queue data to UART transmit ring without blocking
+ *
+ *    @param[in]    psBuf           The pointer of the UART ring buffer control block.
+ *    @param[in]    pu8TxData       The buffer to send the data to UART transmission FIFO.
+ *    @param[in]    u32WriteBytes   The byte number of data.
+ *
+ *    @return       Byte number queued. Bytes that do not fit are counted in u32TxOverflow.
+ *
+ *    @details      The function copies as much data as fits into the transmit ring and enables THRE interrupt.
+ */
+uint32_t UART_WriteAsync(UART_BUF_T *psBuf, const uint8_t pu8TxData[], uint32_t u32WriteBytes)
+{
+    uint32_t u32Head = psBuf->u32TxHead;
+    uint32_t u32Free = psBuf->u32TxSize - (u32Head - psBuf->u32TxTail);
+    uint32_t u32Idx = u32Head & (psBuf->u32TxSize - 1ul);
+    uint32_t u32Span;
+
+    if(u32WriteBytes > u32Free)
+    {
+        psBuf->u32TxOverflow += (u32WriteBytes - u32Free);
+        u32WriteBytes = u32Free;
+    }
+
+    if(u32WriteBytes == 0ul)
+    {
+        return 0ul;
+    }
+
+    /* Copy in at most two contiguous spans */
+    u32Span = psBuf->u32TxSize - u32Idx;
+    if(u32Span > u32WriteBytes)
+    {
+        u32Span = u32WriteBytes;
+    }
+    memcpy(&psBuf->pu8TxBuf[u32Idx], pu8TxData, u32Span);
+    memcpy(psBuf->pu8TxBuf, &pu8TxData[u32Span], u32WriteBytes - u32Span);
+
+    psBuf->u32TxHead = u32Head + u32WriteBytes;
+
+    UART_ENABLE_INT(psBuf->uart, UART_INTEN_THREIEN_Msk);
+
+    return u32WriteBytes;
+}
+
+
+/**
+ *    @brief        Read received data from UART receive ring without blocking
+ *
+ *    @param[in]    psBuf           The pointer of the UART ring buffer control block.
+ *    @param[out]   pu8RxData       The buffer to receive the data.
+ *    @param[in]    u32ReadBytes    The maximum byte number to read.
+ *
+ *    @return       Byte number copied. It is 0 if nothing has been received.
+ *
+ *    @details      The function copies the data already received and returns immediately.
+ */
+uint32_t UART_ReadAvailable(UART_BUF_T *psBuf, uint8_t pu8RxData[], uint32_t u32ReadBytes)
+{
+    uint32_t u32Tail = psBuf->u32RxTail;
+    uint32_t u32Count = psBuf->u32RxHead - u32Tail;
+    uint32_t u32Idx = u32Tail & (psBuf->u32RxSize - 1ul);
+    uint32_t u32Span;
+
+    if(u32ReadBytes > u32Count)
+    {
+        u32ReadBytes = u32Count;
+    }
+
+    /* Copy out in at most two contiguous spans */
+    u32Span = psBuf->u32RxSize - u32Idx;
+    if(u32Span > u32ReadBytes)
+    {
+        u32Span = u32ReadBytes;
+    }
+    memcpy(pu8RxData, &psBuf->pu8RxBuf[u32Idx], u32Span);
+    memcpy(&pu8RxData[u32Span], psBuf->pu8RxBuf, u32ReadBytes - u32Span);
+
+    psBuf->u32RxTail = u32Tail + u32ReadBytes;
+
+    return u32ReadBytes;
+}
+
+
+/**
+ *    @brief        Get the first contiguous span of received data
+ *
+ *    @param[in]    psBuf       The pointer of the UART ring buffer control block.
+ *    @param[out]   ppu8Data    Start address of the span inside the receive ring.
+ *
+ *    @return       Byte number of the contiguous span. It is 0 if nothing has been received.
+ *
+ *    @details      The data is not copied and stays valid until it is released by UART_ConsumeRx().
+ *                  When received data wraps around the ring, call it again after UART_ConsumeRx() to get the rest.
+ */
+uint32_t UART_PeekRx(UART_BUF_T *psBuf, uint8_t **ppu8Data)
+{
+    uint32_t u32Tail = psBuf->u32RxTail;
+    uint32_t u32Count = psBuf->u32RxHead - u32Tail;
+    uint32_t u32Idx = u32Tail & (psBuf->u32RxSize - 1ul);
+
+    if(u32Count > (psBuf->u32RxSize - u32Idx))
+    {
+        u32Count = psBuf->u32RxSize - u32Idx;
+    }
+
+    *ppu8Data = &psBuf->pu8RxBuf[u32Idx];
+
+    return u32Count;
+}
+
+
+/**
+ *    @brief        Release received data from UART receive ring
+ *
+ *    @param[in]    psBuf       The pointer of the UART ring buffer control block.
+ *    @param[in]    u32Bytes    Byte number to release. It is limited to the received byte number.
+ *
+ *    @return       None
+ *
+ *    @details      The function frees space returned by UART_PeekRx() for the interrupt handler.
+ */
+void UART_ConsumeRx(UART_BUF_T *psBuf, uint32_t u32Bytes)
+{
+    uint32_t u32Tail = psBuf->u32RxTail;
+    uint32_t u32Count = psBuf->u32RxHead - u32Tail;
+
+    if(u32Bytes > u32Count)
+    {
+        u32Bytes = u32Count;
+    }
+
+    psBuf->u32RxTail = u32Tail + u32Bytes;
+}
+
+
+/**
+ *    @brief        Get the first contiguous free span of UART transmit ring
+ *
+ *    @param[in]    psBuf       The pointer of the UART ring buffer control block.
+ *    @param[out]   ppu8Data    Start address of the free span inside the transmit ring.
+ *
+ *    @return       Byte number of the contiguous free span. It is 0 if the transmit ring is full.
+ *
+ *    @details      User can build a frame directly in the transmit ring and queue it by UART_CommitTx().
+ */
+uint32_t UART_ReserveTx(UART_BUF_T *psBuf, uint8_t **ppu8Data)
+{
+    uint32_t u32Head = psBuf->u32TxHead;
+    uint32_t u32Free = psBuf->u32TxSize - (u32Head - psBuf->u32TxTail);
+    uint32_t u32Idx = u32Head & (psBuf->u32TxSize - 1ul);
+
+    if(u32Free > (psBuf->u32TxSize - u32Idx))
+    {
+        u32Free = psBuf->u32TxSize - u32Idx;
+    }
+
+    *ppu8Data = &psBuf->pu8TxBuf[u32Idx];
+
+    return u32Free;
+}
+
+
+/**
+ *    @brief        Queue data written in place by UART_ReserveTx()
+ *
+ *    @param[in]    psBuf       The pointer of the UART ring buffer control block.
+ *    @param[in]    u32Bytes    Byte number to queue. It is limited to the free space of transmit ring.
+ *
+ *    @return       None
+ *
+ *    @details      The function publishes the data to the interrupt handler and enables THRE interrupt.
+ */
+void UART_CommitTx(UART_BUF_T *psBuf, uint32_t u32Bytes)
+{
+    uint32_t u32Head = psBuf->u32TxHead;
+    uint32_t u32Free = psBuf->u32TxSize - (u32Head - psBuf->u32TxTail);
+
+    if(u32Bytes > u32Free)
+    {
+        u32Bytes = u32Free;
+    }
+
+    if(u32Bytes != 0ul)
+    {
+        psBuf->u32TxHead = u32Head + u32Bytes;
+        UART_ENABLE_INT(psBuf->uart, UART_INTEN_THREIEN_Msk);
+    }
+}
+
+
+/**
+ *    @brief        Start PDMA circular receive on UART
+ *
+ *    @param[in]    psRx        The pointer of the PDMA circular receive control block. It must be located in SRAM.
+ *    @param[in]    uart        The pointer of the specified UART module. Only UART0, UART1 and UART2 are supported.
+ *    @param[in]    pdma        The pointer of the specified PDMA module.
+ *    @param[in]    u32Ch       The PDMA channel used for receiving.
+ *    @param[in]    pu8Buf      Receive ring storage.
+ *    @param[in]    u32Size     Receive ring size in bytes. It must be a multiple of UART_PDMA_RX_SEG_NUM and each
+ *                              segment can not exceed 65536 bytes.
+ *
+ *    @retval       0                       Success
+ *    @retval       UART_PDMA_RX_ERR_PARAM  Invalid UART module, channel or ring size
+ *
+ *    @details      The function links UART_PDMA_RX_SEG_NUM scatter-gather descriptors into a loop over the ring and
+ *                  starts the channel on the UART RX request, then enables UART RX PDMA, RX time-out and buffer error
+ *                  interrupts. User must enable PDMA clock, the channel in PDMA CHCTL is enabled by this function.
+ *                  Call UART_PDMARxIRQHandler() from the UART IRQ handler to get idle-line frame boundaries.
+ */
+int32_t UART_PDMARxStart(UART_PDMA_RX_T *psRx, UART_T *uart, PDMA_T *pdma, uint32_t u32Ch, uint8_t pu8Buf[], uint32_t u32Size)
+{
+    uint32_t u32Peripheral, u32SegSize, i;
+
+    if(uart == UART0)
+    {
+        u32Peripheral = PDMA_UART0_RX;
+    }
+    else if(uart == UART1)
+    {
+        u32Peripheral = PDMA_UART1_RX;
+    }
+    else if(uart == UART2)
+    {
+        u32Peripheral = PDMA_UART2_RX;
+    }
+    else
+    {
+        return UART_PDMA_RX_ERR_PARAM;
+    }
+
+    u32SegSize = u32Size / UART_PDMA_RX_SEG_NUM;
+
+    if((psRx == NULL) || (pu8Buf == NULL) || (u32Ch >= PDMA_CH_MAX) || (u32SegSize == 0ul) ||
+            ((u32SegSize * UART_PDMA_RX_SEG_NUM) != u32Size) || (u32SegSize > 65536ul))
+    {
+        return UART_PDMA_RX_ERR_PARAM;
+    }
+
+    psRx->uart           = uart;
+    psRx->pdma           = pdma;
+    psRx->u32Ch          = u32Ch;
+    psRx->pu8Buf         = pu8Buf;
+    psRx->u32Size        = u32Size;
+    psRx->u32SegSize     = u32SegSize;
+    psRx->u32ReadPos     = 0ul;
+    psRx->u32FramePos    = 0ul;
+    psRx->u32FrameCount  = 0ul;
+    psRx->u32FifoOverrun = 0ul;
+
+    /* Each descriptor fills one segment and links to the next one, the last one links back to the first.
+       The descriptors in SRAM are never modified by PDMA, so the loop runs without any reload. */
+    for(i = 0ul; i < UART_PDMA_RX_SEG_NUM; i++)
+    {
+        psRx->asDesc[i].CTL = ((u32SegSize - 1ul) << PDMA_DSCT_CTL_TXCNT_Pos) |
+                              PDMA_WIDTH_8 | PDMA_SAR_FIX | PDMA_DAR_INC |
+                              PDMA_REQ_SINGLE | PDMA_TBINTDIS_DISABLE | PDMA_OP_SCATTER;
+        psRx->asDesc[i].SA   = (uint32_t)&uart->DAT;
+        psRx->asDesc[i].DA   = (uint32_t)&pu8Buf[i * u32SegSize];
+        psRx->asDesc[i].NEXT = (uint32_t)&psRx->asDesc[(i + 1ul) % UART_PDMA_RX_SEG_NUM] - pdma->SCATBA;
+    }
+
+    pdma->DSCT[u32Ch].CTL = 0ul;
+    pdma->CHCTL |= (1ul << u32Ch);
+    PDMA_SET_REQ_SRC(pdma, u32Ch, u32Peripheral);
+
+    /* NEXT must be ready before OPMODE is set to scatter-gather mode */
+    pdma->DSCT[u32Ch].NEXT = (uint32_t)&psRx->asDesc[0] - pdma->SCATBA;
+    pdma->DSCT[u32Ch].CTL = PDMA_OP_SCATTER;
+
+    /* Idle line of UART_PDMA_RX_TOIC bit times closes a frame */
+    UART_SetTimeoutCnt(uart, UART_PDMA_RX_TOIC);
+
+    uart->INTEN |= (UART_INTEN_RXTOIEN_Msk | UART_INTEN_BUFERRIEN_Msk | UART_INTEN_RXPDMAEN_Msk);
+
+    return 0;
+}
+
+
+/**
+ *    @brief        Stop PDMA circular receive on UART
+ *
+ *    @param[in]    psRx    The pointer of the PDMA circular receive control block.
+ *
+ *    @return       None
+ *
+ *    @details      The function disables UART RX PDMA and the related interrupts, then stops and resets the channel.
+ *                  Data already in the ring can still be read.
+ */
+void UART_PDMARxStop(UART_PDMA_RX_T *psRx)
+{
+    psRx->uart->INTEN &= ~(UART_INTEN_RXPDMAEN_Msk | UART_INTEN_RXTOIEN_Msk | UART_INTEN_BUFERRIEN_Msk);
+    psRx->pdma->CHCTL &= ~(1ul << psRx->u32Ch);
+    PDMA_RESET(psRx->pdma, psRx->u32Ch);
+}
+
+
+/**
+ *    @brief        Get the current PDMA write position in the receive ring
+ *
+ *    @param[in]    psRx    The pointer of the PDMA circular receive control block.
+ *
+ *    @return       Ring offset of the next byte PDMA will write
+ *
+ *    @details      The position is computed from the descriptor PDMA is working on (CURSCAT) and its remaining
+ *                  transfer count. CURSCAT is sampled before and after TXCNT so that a segment switch in between
+ *                  is detected. The result never runs ahead of the data really written to SRAM.
+ */
+uint32_t UART_PDMARxGetWritePos(UART_PDMA_RX_T *psRx)
+{
+    PDMA_T *pdma = psRx->pdma;
+    uint32_t u32Ch = psRx->u32Ch;
+    uint32_t u32Desc, u32Ctl, u32Seg;
+
+    do
+    {
+        u32Desc = pdma->CURSCAT[u32Ch];
+        u32Ctl  = pdma->DSCT[u32Ch].CTL;
+    }
+    while(u32Desc != pdma->CURSCAT[u32Ch]);
+
+    for(u32Seg = 0ul; u32Seg < UART_PDMA_RX_SEG_NUM; u32Seg++)
+    {
+        if(u32Desc == (uint32_t)&psRx->asDesc[u32Seg])
+        {
+            break;
+        }
+    }
+
+    if((u32Seg == UART_PDMA_RX_SEG_NUM) || ((u32Ctl & PDMA_DSCT_CTL_OPMODE_Msk) == PDMA_OP_STOP))
+    {
+        /* First descriptor not fetched yet: nothing has been received */
+        return (u32Seg == UART_PDMA_RX_SEG_NUM) ? 0ul : (u32Seg * psRx->u32SegSize);
+    }
+
+    return (u32Seg * psRx->u32SegSize) + psRx->u32SegSize -
+           (((u32Ctl & PDMA_DSCT_CTL_TXCNT_Msk) >> PDMA_DSCT_CTL_TXCNT_Pos) + 1ul);
+}
+
+
+/**
+ *    @brief        UART PDMA circular receive interrupt service
+ *
+ *    @param[in]    psRx    The pointer of the PDMA circular receive control block.
+ *
+ *    @retval       0   No frame boundary
+ *    @retval       1   RX line became idle, u32FramePos holds the write position at the end of the frame
+ *
+ *    @details      Call this function from the UART IRQ handler. The PDMA mode RX time-out flag is cleared by a dummy
+ *                  read of UART_DAT only when RX FIFO is empty, so it never steals a byte from PDMA; if PDMA has not
+ *                  drained the FIFO yet the interrupt simply enters again.
+ */
+uint32_t UART_PDMARxIRQHandler(UART_PDMA_RX_T *psRx)
+{
+    UART_T *uart = psRx->uart;
+    uint32_t u32IntSts = uart->INTSTS;
+    uint32_t u32Frame = 0ul;
+
+    if(u32IntSts & UART_INTSTS_HWTOINT_Msk)
+    {
+        if(uart->FIFOSTS & UART_FIFOSTS_RXEMPTY_Msk)
+        {
+            (void)uart->DAT;
+
+            psRx->u32FramePos = UART_PDMARxGetWritePos(psRx);
+            psRx->u32FrameCount++;
+            u32Frame = 1ul;
+        }
+    }
+
+    if(u32IntSts & UART_INTSTS_HWBUFEINT_Msk)
+    {
+        if(uart->FIFOSTS & UART_FIFOSTS_RXOVIF_Msk)
+        {
+            psRx->u32FifoOverrun++;
+        }
+
+        UART_ClearIntFlag(uart, UART_INTSTS_BUFERRINT_Msk);
+    }
+
+    return u32Frame;
+}
+
+
+/**
+ *    @brief        Get the number of received bytes not consumed yet
+ *
+ *    @param[in]    psRx    The pointer of the PDMA circular receive control block.
+ *
+ *    @return       Byte number waiting in the receive ring
+ *
+ *    @details      PDMA keeps writing when the ring is full, so the application must consume data before a whole
+ *                  ring size is received.
+ */
+uint32_t UART_PDMARxGetCount(UART_PDMA_RX_T *psRx)
+{
+    uint32_t u32WritePos = UART_PDMARxGetWritePos(psRx);
+    uint32_t u32ReadPos = psRx->u32ReadPos;
+
+    return (u32WritePos >= u32ReadPos) ? (u32WritePos - u32ReadPos) : (psRx->u32Size - u32ReadPos + u32WritePos);
+}
+
+
+/**
+ *    @brief        Get the first contiguous span of received data
+ *
+ *    @param[in]    psRx        The pointer of the PDMA circular receive control block.
+ *    @param[out]   ppu8Data    Start address of the span inside the receive ring.
+ *
+ *    @return       Byte number of the contiguous span
+ *
+ *    @details      The data is not copied. Release it by UART_PDMARxConsume().
+ */
+uint32_t UART_PDMARxPeek(UART_PDMA_RX_T *psRx, uint8_t **ppu8Data)
+{
+    uint32_t u32WritePos = UART_PDMARxGetWritePos(psRx);
+    uint32_t u32ReadPos = psRx->u32ReadPos;
+
+    *ppu8Data = &psRx->pu8Buf[u32ReadPos];
+
+    return (u32WritePos >= u32ReadPos) ? (u32WritePos - u32ReadPos) : (psRx->u32Size - u32ReadPos);
+}
+
+
+/**
+ *    @brief        Release received data from the PDMA receive ring
+ *
+ *    @param[in]    psRx        The pointer of the PDMA circular receive control block.
+ *    @param[in]    u32Bytes    Byte number to release. It is limited to the received byte number.
+ *
+ *    @return       None
+ */
+void UART_PDMARxConsume(UART_PDMA_RX_T *psRx, uint32_t u32Bytes)
+{
+    uint32_t u32Count = UART_PDMARxGetCount(psRx);
+    uint32_t u32ReadPos;
+
+    if(u32Bytes > u32Count)
+    {
+        u32Bytes = u32Count;
+    }
+
+    u32ReadPos = psRx->u32ReadPos + u32Bytes;
+
+    if(u32ReadPos >= psRx->u32Size)
+    {
+        u32ReadPos -= psRx->u32Size;
+    }
+
+    psRx->u32ReadPos = u32ReadPos;
+}
+
+
 /**@}*/ /* end of group UART_EXPORTED_FUNCTIONS */
 
 /**@}*/ /* end of group UART_Driver */
@@ -16,6 +16,43 @@
   @{
 */
 
+#define USPI_XFER_PORT_NUM  1U
+#define USPI_XFER_DEPTH     2U          /* TX buffer and shifter, or the 2-level RX buffer */
+
+/* Transfer state of a USCI_SPI module */
+typedef struct
+{
+    DSCT_T sTxDesc;                     /* PDMA descriptor feeding USPI_TXDAT */
+    DSCT_T sRxDesc;                     /* PDMA descriptor draining USPI_RXDAT */
+    PDMA_T *pdma;                       /* PDMA module of long transfers, NULL if all transfers use the buffer path */
+    uint32_t u32TxCh;                   /* PDMA channel feeding USPI_TXDAT, requested by USPI_TransferSetPDMA() */
+    uint32_t u32RxCh;                   /* PDMA channel draining USPI_RXDAT, requested by USPI_TransferSetPDMA() */
+    uint32_t u32Threshold;              /* Transfers of at least this many data units use PDMA */
+    const uint8_t *pu8Tx;               /* Transmit buffer, NULL sends 0 */
+    uint8_t *pu8Rx;                     /* Receive buffer, NULL drops the received data */
+    uint32_t u32Len;                    /* Data units of the transfer */
+    uint32_t u32TxCnt;                  /* Data units written to USPI_TXDAT */
+    uint32_t u32RxCnt;                  /* Data units read from USPI_RXDAT */
+    uint32_t u32Width;                  /* Bytes per data unit, 1 or 2 */
+    uint32_t u32Pdma;                   /* The transfer uses PDMA */
+    uint32_t u32Async;                  /* The transfer completes in interrupt */
+    USPI_XFER_CALLBACK_T pfnCallback;
+    void *pvUserData;
+    volatile uint32_t u32Busy;
+} USPI_XFER_STATE_T;
+
+static USPI_XFER_STATE_T s_asUspiXfer[USPI_XFER_PORT_NUM];
+static uint32_t s_u32UspiTxZero = 0UL;  /* PDMA source of RX-only transfers */
+static uint32_t s_u32UspiRxSink;        /* PDMA destination of TX-only transfers */
+
+static int32_t USPI_XferPort(USPI_T *uspi);
+static int32_t USPI_XferStart(USPI_T *uspi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, uint32_t u32Async, USPI_XFER_CALLBACK_T pfnCallback, void *pvUserData);
+static int32_t USPI_XferStartPDMA(USPI_T *uspi, USPI_XFER_STATE_T *psXfer, uint32_t u32Port);
+static void USPI_XferPdmaDone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData);
+static uint32_t USPI_XferPump(USPI_T *uspi, USPI_XFER_STATE_T *psXfer);
+static void USPI_XferEnd(USPI_T *uspi, USPI_XFER_STATE_T *psXfer, int32_t i32Status);
+static void USPI_XferDone(USPI_T *uspi, USPI_XFER_STATE_T *psXfer, int32_t i32Status);
+
 
 /** @addtogroup USCI_SPI_EXPORTED_FUNCTIONS USCI_SPI Exported Functions
   @{
@@ -661,8 +698,448 @@ void USPI_DisableWakeup(USPI_T *uspi)
     uspi->WKCTL &= ~USPI_WKCTL_WKEN_Msk;
 }
 
+/**
+  * @brief Configure the PDMA path of USCI_SPI transfers.
+  * @param[in]  uspi The pointer of the specified USCI_SPI module.
+  * @param[in]  pdma The pointer of the PDMA module. NULL releases the channels and makes all transfers use the buffer path.
+  * @param[in]  u32Threshold Transfers of at least u32Threshold data units use PDMA, shorter ones use the buffer path.
+  * @retval USPI_XFER_OK The PDMA path is configured.
+  * @retval USPI_XFER_ERR_PARAM Invalid USCI_SPI module.
+  * @retval USPI_XFER_ERR_BUSY A transfer is in progress.
+  * @retval USPI_XFER_ERR_NO_CH PDMA_RequestChannel() found no free channel, all transfers use the buffer path.
+  * @details The TX and RX channels are requested by PDMA_RequestChannel() and kept until the next call. PDMA clock must
+  *          be enabled. Asynchronous PDMA transfers complete in the channel callback, so PDMA0_IRQHandler must call
+  *          PDMA_IRQHandler() and PDMA0_IRQn must be enabled.
+  */
+int32_t USPI_TransferSetPDMA(USPI_T *uspi, PDMA_T *pdma, uint32_t u32Threshold)
+{
+    int32_t i32Port = USPI_XferPort(uspi);
+    int32_t i32TxCh, i32RxCh;
+    USPI_XFER_STATE_T *psXfer;
+
+    if(i32Port < 0)
+    {
+        return USPI_XFER_ERR_PARAM;
+    }
+
+    psXfer = &s_asUspiXfer[i32Port];
+
+    if(psXfer->u32Busy)
+    {
+        return USPI_XFER_ERR_BUSY;
+    }
+
+    if(psXfer->pdma != NULL)
+    {
+        PDMA_ReleaseChannel(psXfer->pdma, psXfer->u32TxCh);
+        PDMA_ReleaseChannel(psXfer->pdma, psXfer->u32RxCh);
+        psXfer->pdma = NULL;
+    }
+
+    if(pdma == NULL)
+    {
+        return USPI_XFER_OK;
+    }
+
+    i32TxCh = PDMA_RequestChannel(pdma, 0UL);
+    i32RxCh = (i32TxCh >= 0) ? PDMA_RequestChannel(pdma, 0UL) : PDMA_ERR_NO_CH;
+
+    if(i32RxCh < 0)
+    {
+        if(i32TxCh >= 0)
+        {
+            PDMA_ReleaseChannel(pdma, (uint32_t)i32TxCh);
+        }
+
+        return USPI_XFER_ERR_NO_CH;
+    }
+
+    psXfer->u32TxCh = (uint32_t)i32TxCh;
+    psXfer->u32RxCh = (uint32_t)i32RxCh;
+    psXfer->u32Threshold = u32Threshold;
+    psXfer->pdma = pdma;
+
+    return USPI_XFER_OK;
+}
+
+/**
+  * @brief Full-duplex transfer in master mode.
+  * @param[in]  uspi The pointer of the specified USCI_SPI module.
+  * @param[in]  pvTxBuf Data to send. NULL sends 0 (RX-only).
+  * @param[out] pvRxBuf Buffer of the received data. NULL drops the received data (TX-only).
+  * @param[in]  u32Len Number of data units. A data unit is 1 byte for a data width up to 8 bits, 2 bytes otherwise.
+  * @retval USPI_XFER_OK Transfer completed.
+  * @retval USPI_XFER_ERR_PARAM Invalid USCI_SPI module, length, or the buffers are not aligned to the data unit.
+  * @retval USPI_XFER_ERR_BUSY An asynchronous transfer is in progress.
+  * @retval USPI_XFER_ERR_TIMEOUT No data unit moved for USPI_TIMEOUT loops.
+  * @retval USPI_XFER_ERR_ABORT PDMA target abort.
+  * @details Transfers shorter than the threshold of USPI_TransferSetPDMA() are polled through the TX/RX buffers,
+  *          the others are moved by PDMA. The RX buffer is cleared first. The function does not use interrupts.
+  */
+int32_t USPI_Transfer(USPI_T *uspi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len)
+{
+    USPI_XFER_STATE_T *psXfer;
+    uint32_t u32TimeOutCount, u32Progress, u32Last = 0xFFFFFFFFUL;
+    int32_t i32Ret;
+
+    i32Ret = USPI_XferStart(uspi, pvTxBuf, pvRxBuf, u32Len, 0UL, NULL, NULL);
+
+    if(i32Ret != USPI_XFER_OK)
+    {
+        return i32Ret;
+    }
+
+    psXfer = &s_asUspiXfer[USPI_XferPort(uspi)];
+    u32TimeOutCount = USPI_TIMEOUT;
+
+    while(1)
+    {
+        if(psXfer->u32Pdma)
+        {
+            if(PDMA_GET_ABORT_STS(psXfer->pdma) & ((1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh)))
+            {
+                i32Ret = USPI_XFER_ERR_ABORT;
+                break;
+            }
+
+            if(PDMA_GET_TD_STS(psXfer->pdma) & (1UL << psXfer->u32RxCh))
+            {
+                break;
+            }
+
+            u32Progress = psXfer->pdma->DSCT[psXfer->u32RxCh].CTL & PDMA_DSCT_CTL_TXCNT_Msk;
+        }
+        else
+        {
+            if(USPI_XferPump(uspi, psXfer))
+            {
+                break;
+            }
+
+            u32Progress = psXfer->u32RxCnt;
+        }
+
+        /* Time-out counts the loops without progress */
+        if(u32Progress != u32Last)
+        {
+            u32Last = u32Progress;
+            u32TimeOutCount = USPI_TIMEOUT;
+        }
+        else if(--u32TimeOutCount == 0UL)
+        {
+            i32Ret = USPI_XFER_ERR_TIMEOUT;
+            break;
+        }
+    }
+
+    USPI_XferEnd(uspi, psXfer, i32Ret);
+
+    return i32Ret;
+}
+
+/**
+  * @brief Start a full-duplex transfer in master mode and return at once.
+  * @param[in]  uspi The pointer of the specified USCI_SPI module.
+  * @param[in]  pvTxBuf Data to send. NULL sends 0 (RX-only).
+  * @param[out] pvRxBuf Buffer of the received data. NULL drops the received data (TX-only).
+  * @param[in]  u32Len Number of data units, see USPI_Transfer().
+  * @param[in]  pfnCallback Completion callback. NULL if the application polls USPI_TransferIsBusy().
+  * @param[in]  pvUserData User data of the callback.
+  * @retval USPI_XFER_OK Transfer started.
+  * @retval USPI_XFER_ERR_PARAM Invalid USCI_SPI module, length, or the buffers are not aligned to the data unit.
+  * @retval USPI_XFER_ERR_BUSY A transfer is in progress.
+  * @details USCI_SPI has no FIFO threshold, short transfers refill the TX buffer in the receive end interrupt with
+  *          at most 2 data units in flight. Long transfers are moved by PDMA and complete in the RX channel callback.
+  *          USCI0_IRQHandler must call USPI_TransferIRQHandler(), PDMA0_IRQHandler must call PDMA_IRQHandler() for
+  *          the PDMA path, and the interrupts must be enabled in NVIC. The buffers must stay valid until completion.
+  */
+int32_t USPI_TransferAsync(USPI_T *uspi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, USPI_XFER_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    return USPI_XferStart(uspi, pvTxBuf, pvRxBuf, u32Len, 1UL, pfnCallback, pvUserData);
+}
+
+/**
+  * @brief Check if a transfer is in progress.
+  * @param[in]  uspi The pointer of the specified USCI_SPI module.
+  * @retval 0 No transfer is in progress.
+  * @retval 1 A transfer is in progress.
+  */
+uint32_t USPI_TransferIsBusy(USPI_T *uspi)
+{
+    int32_t i32Port = USPI_XferPort(uspi);
+
+    return ((i32Port >= 0) && s_asUspiXfer[i32Port].u32Busy) ? 1UL : 0UL;
+}
+
+/**
+  * @brief Asynchronous transfer interrupt service.
+  * @param[in]  uspi The pointer of the specified USCI_SPI module.
+  * @return None
+  * @details Call this function from USCI0_IRQHandler. It moves the buffer data and calls the callback when the
+  *          transfer completes. PDMA transfers complete in PDMA_IRQHandler() instead.
+  */
+void USPI_TransferIRQHandler(USPI_T *uspi)
+{
+    int32_t i32Port = USPI_XferPort(uspi);
+    USPI_XFER_STATE_T *psXfer;
+
+    if(i32Port < 0)
+    {
+        return;
+    }
+
+    psXfer = &s_asUspiXfer[i32Port];
+
+    if((psXfer->u32Busy == 0UL) || (psXfer->u32Async == 0UL) || psXfer->u32Pdma)
+    {
+        return;
+    }
+
+    uspi->PROTSTS = USPI_PROTSTS_RXENDIF_Msk;
+
+    if(USPI_XferPump(uspi, psXfer) == 0UL)
+    {
+        return;
+    }
+
+    USPI_XferDone(uspi, psXfer, USPI_XFER_OK);
+}
+
 /*@}*/ /* end of group USCI_SPI_EXPORTED_FUNCTIONS */
 
+/**
+  * @brief Get the transfer state index of a USCI_SPI module, -1 if the module is not supported.
+  */
+static int32_t USPI_XferPort(USPI_T *uspi)
+{
+    return (uspi == USPI0) ? 0 : -1;
+}
+
+/**
+  * @brief Check the parameters, take the transfer state and start the buffer or PDMA path.
+  */
+static int32_t USPI_XferStart(USPI_T *uspi, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len, uint32_t u32Async, USPI_XFER_CALLBACK_T pfnCallback, void *pvUserData)
+{
+    int32_t i32Port = USPI_XferPort(uspi);
+    USPI_XFER_STATE_T *psXfer;
+    uint32_t u32Bits, u32Width, u32PriMask;
+
+    if((i32Port < 0) || (u32Len == 0UL))
+    {
+        return USPI_XFER_ERR_PARAM;
+    }
+
+    /* DWIDTH 0 means 16 bits */
+    u32Bits = (uspi->LINECTL & USPI_LINECTL_DWIDTH_Msk) >> USPI_LINECTL_DWIDTH_Pos;
+    u32Width = ((u32Bits != 0UL) && (u32Bits <= 8UL)) ? 1UL : 2UL;
+
+    if((((uint32_t)pvTxBuf | (uint32_t)pvRxBuf) & (u32Width - 1UL)) != 0UL)
+    {
+        return USPI_XFER_ERR_PARAM;
+    }
+
+    psXfer = &s_asUspiXfer[i32Port];
+
+    u32PriMask = __get_PRIMASK();
+    __set_PRIMASK(1UL);
+
+    if(psXfer->u32Busy)
+    {
+        __set_PRIMASK(u32PriMask);
+        return USPI_XFER_ERR_BUSY;
+    }
+
+    psXfer->u32Busy = 1UL;
+    __set_PRIMASK(u32PriMask);
+
+    psXfer->pu8Tx = (const uint8_t *)pvTxBuf;
+    psXfer->pu8Rx = (uint8_t *)pvRxBuf;
+    psXfer->u32Len = u32Len;
+    psXfer->u32TxCnt = 0UL;
+    psXfer->u32RxCnt = 0UL;
+    psXfer->u32Width = u32Width;
+    psXfer->u32Async = u32Async;
+    psXfer->pfnCallback = pfnCallback;
+    psXfer->pvUserData = pvUserData;
+    psXfer->u32Pdma = ((psXfer->pdma != NULL) && (u32Len >= psXfer->u32Threshold) && (u32Len <= PDMA_TXCNT_MAX)) ? 1UL : 0UL;
+
+    /* Data left from an earlier access would be counted as received by either path */
+    USPI_ClearRxBuf(uspi);
+
+    if(psXfer->u32Pdma && (USPI_XferStartPDMA(uspi, psXfer, (uint32_t)i32Port) != 0))
+    {
+        /* The descriptors are out of the PDMA SCATBA window */
+        psXfer->u32Pdma = 0UL;
+    }
+
+    if((psXfer->u32Pdma == 0UL) && u32Async)
+    {
+        uspi->PROTSTS = USPI_PROTSTS_RXENDIF_Msk;
+        uspi->INTEN |= USPI_INTEN_RXENDIEN_Msk;
+        USPI_XferPump(uspi, psXfer);
+    }
+
+    return USPI_XFER_OK;
+}
+
+/**
+  * @brief Start the RX and TX PDMA descriptors and enable USCI_SPI PDMA, RX first so no received data is lost.
+  * @details Return non-zero if the descriptors cannot be addressed by PDMA SCATBA, nothing is started then.
+  */
+static int32_t USPI_XferStartPDMA(USPI_T *uspi, USPI_XFER_STATE_T *psXfer, uint32_t u32Port)
+{
+    PDMA_T *pdma = psXfer->pdma;
+    uint32_t u32Width, u32TxReq = PDMA_USCI0_TX + (u32Port * 2UL);
+    uint32_t u32Mask = (1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh);
+
+    u32Width = (psXfer->u32Width == 1UL) ? PDMA_WIDTH_8 : PDMA_WIDTH_16;
+
+    /* USPI_XferStart() checked the buffer alignment and the length */
+    PDMA_DescInit(&psXfer->sRxDesc, u32Width, (uint32_t)&uspi->RXDAT, PDMA_SAR_FIX,
+                  (psXfer->pu8Rx != NULL) ? (uint32_t)psXfer->pu8Rx : (uint32_t)&s_u32UspiRxSink,
+                  (psXfer->pu8Rx != NULL) ? PDMA_DAR_INC : PDMA_DAR_FIX, psXfer->u32Len, PDMA_REQ_SINGLE);
+    PDMA_DescInit(&psXfer->sTxDesc, u32Width,
+                  (psXfer->pu8Tx != NULL) ? (uint32_t)psXfer->pu8Tx : (uint32_t)&s_u32UspiTxZero,
+                  (psXfer->pu8Tx != NULL) ? PDMA_SAR_INC : PDMA_SAR_FIX, (uint32_t)&uspi->TXDAT, PDMA_DAR_FIX,
+                  psXfer->u32Len, PDMA_REQ_SINGLE);
+
+    PDMA_Open(pdma, u32Mask);
+    PDMA_CLR_TD_FLAG(pdma, u32Mask);
+    PDMA_CLR_ABORT_FLAG(pdma, u32Mask);
+
+    /* The RX channel completes the transfer, its callback is needed by the asynchronous path only */
+    PDMA_SetCallback(pdma, psXfer->u32RxCh, psXfer->u32Async ? USPI_XferPdmaDone : NULL, uspi);
+
+    if(PDMA_StartChain(pdma, psXfer->u32RxCh, u32TxReq + 1UL, &psXfer->sRxDesc) != 0)
+    {
+        PDMA_SetCallback(pdma, psXfer->u32RxCh, NULL, NULL);
+        return -1;
+    }
+
+    /* Both descriptors are in the same state, TX cannot fail if RX did not */
+    PDMA_StartChain(pdma, psXfer->u32TxCh, u32TxReq, &psXfer->sTxDesc);
+
+    USPI_TRIGGER_RX_PDMA(uspi);
+    USPI_TRIGGER_TX_PDMA(uspi);
+
+    return 0;
+}
+
+/**
+  * @brief PDMA RX channel callback of asynchronous transfers.
+  */
+static void USPI_XferPdmaDone(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    USPI_T *uspi = (USPI_T *)pvUserData;
+    USPI_XFER_STATE_T *psXfer = &s_asUspiXfer[USPI_XferPort(uspi)];
+
+    (void)u32Ch;
+
+    if((psXfer->u32Busy == 0UL) || (psXfer->u32Pdma == 0UL))
+    {
+        return;
+    }
+
+    USPI_XferDone(uspi, psXfer, (u32Event & PDMA_EVT_ABORT) ? USPI_XFER_ERR_ABORT : USPI_XFER_OK);
+}
+
+/**
+  * @brief Drain the RX buffer and refill the TX buffer, return 1 when all data units are received.
+  * @details No more than USPI_XFER_DEPTH data units are in flight, so the 2-level RX buffer never overruns.
+  */
+static uint32_t USPI_XferPump(USPI_T *uspi, USPI_XFER_STATE_T *psXfer)
+{
+    uint32_t u32Data;
+
+    while(((uspi->BUFSTS & USPI_BUFSTS_RXEMPTY_Msk) == 0UL) && (psXfer->u32RxCnt < psXfer->u32Len))
+    {
+        u32Data = uspi->RXDAT;
+
+        if(psXfer->pu8Rx != NULL)
+        {
+            if(psXfer->u32Width == 1UL)
+            {
+                psXfer->pu8Rx[psXfer->u32RxCnt] = (uint8_t)u32Data;
+            }
+            else
+            {
+                ((uint16_t *)(void *)psXfer->pu8Rx)[psXfer->u32RxCnt] = (uint16_t)u32Data;
+            }
+        }
+
+        psXfer->u32RxCnt++;
+    }
+
+    while((psXfer->u32TxCnt < psXfer->u32Len) && ((psXfer->u32TxCnt - psXfer->u32RxCnt) < USPI_XFER_DEPTH) &&
+            ((uspi->BUFSTS & USPI_BUFSTS_TXFULL_Msk) == 0UL))
+    {
+        if(psXfer->pu8Tx == NULL)
+        {
+            u32Data = 0UL;
+        }
+        else if(psXfer->u32Width == 1UL)
+        {
+            u32Data = psXfer->pu8Tx[psXfer->u32TxCnt];
+        }
+        else
+        {
+            u32Data = ((const uint16_t *)(const void *)psXfer->pu8Tx)[psXfer->u32TxCnt];
+        }
+
+        uspi->TXDAT = u32Data;
+        psXfer->u32TxCnt++;
+    }
+
+    return (psXfer->u32RxCnt == psXfer->u32Len) ? 1UL : 0UL;
+}
+
+/**
+  * @brief Release the PDMA channels or the receive end interrupt and the transfer state.
+  */
+static void USPI_XferEnd(USPI_T *uspi, USPI_XFER_STATE_T *psXfer, int32_t i32Status)
+{
+    if(psXfer->u32Pdma)
+    {
+        USPI_DISABLE_TX_RX_PDMA(uspi);
+        PDMA_SetCallback(psXfer->pdma, psXfer->u32RxCh, NULL, NULL);
+
+        if(i32Status != USPI_XFER_OK)
+        {
+            PDMA_RESET(psXfer->pdma, psXfer->u32TxCh);
+            PDMA_RESET(psXfer->pdma, psXfer->u32RxCh);
+        }
+
+        PDMA_CLR_TD_FLAG(psXfer->pdma, (1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh));
+        PDMA_CLR_ABORT_FLAG(psXfer->pdma, (1UL << psXfer->u32TxCh) | (1UL << psXfer->u32RxCh));
+    }
+    else if(psXfer->u32Async)
+    {
+        uspi->INTEN &= ~USPI_INTEN_RXENDIEN_Msk;
+        uspi->PROTSTS = USPI_PROTSTS_RXENDIF_Msk;
+    }
+
+    if(i32Status != USPI_XFER_OK)
+    {
+        USPI_ClearTxBuf(uspi);
+        USPI_ClearRxBuf(uspi);
+    }
+
+    psXfer->u32Busy = 0UL;
+}
+
+/**
+  * @brief Complete an asynchronous transfer and call its callback.
+  */
+static void USPI_XferDone(USPI_T *uspi, USPI_XFER_STATE_T *psXfer, int32_t i32Status)
+{
+    USPI_XferEnd(uspi, psXfer, i32Status);
+
+    if(psXfer->pfnCallback != NULL)
+    {
+        psXfer->pfnCallback(uspi, i32Status, psXfer->pvUserData);
+    }
+}
+
 /*@}*/ /* end of group USCI_SPI_Driver */
 
 /*@}*/ /* end of group Standard_Driver */
@@ -0,0 +1,29 @@
+/**************************************************************************//**
+ * @file     host_main.c
+ * @version  V1.00
+ * @brief    Run the CMSIS-DSP, FFT, software CRC and CMAC/CCM benchmark suites
+ *           natively on the host. The exit status is the number of failed cases, so a
+ *           kernel regression fails the build script.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "bench_suites.h"
+
+int main(void)
+{
+    uint32_t u32Fail;
+
+    BENCH_Init();
+    BENCH_PrintHeader();
+
+    u32Fail = BenchCrc_Run(BENCH_CALLS);
+    u32Fail += BenchAuth_Run(BENCH_CALLS);
+    u32Fail += BenchDsp_Run(BENCH_CALLS);
+    u32Fail += BenchFft_Run(BENCH_CALLS);
+
+    printf("# failed cases,%u\n", (unsigned int)u32Fail);
+
+    return (u32Fail != 0);
+}
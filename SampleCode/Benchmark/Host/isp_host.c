@@ -0,0 +1,603 @@
+/**************************************************************************//**
+ * @file     isp_host.c
+ * @version  V1.00
+ * @brief    Protocol test of the UART ISP APROM loader on the host flash simulator.
+ *
+ * @details
+ *           isp_user.c is built as the ISP_UART_APROM loader and driven with the
+ *           packets of the host tool: the legacy CMD_UPDATE_APROM, a differential
+ *           update generated from the page checksums of the device, the extended
+ *           protocol negotiation, windowed erase/write/verify with corrupt, lost
+ *           and resent packets, accesses to the loader region, and secure updates
+ *           encrypted and signed by the host with AuthLib, genuine and forged. The
+ *           exit status is the number of failures.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "isp_user.h"
+#include "authlib.h"
+
+#define ISP_LEGACY_PKT_SIZE     64
+#define ISP_IMAGE_ADDR          (ISP_APP_BASE + 0x4000)
+#define ISP_IMAGE_SIZE          (6 * FMC_FLASH_PAGE_SIZE)
+#define ISP_LOADER_MARK         0x5A
+#define ISP_DIFF_PAGES          24
+#define ISP_SEC_SIZE            (3 * FMC_FLASH_PAGE_SIZE + 48)
+
+typedef struct
+{
+    uint32_t u32Len;            /* Acknowledgement length, 0 if none */
+    uint32_t u32Status;
+    uint32_t u32Seq;            /* Next expected seq */
+    uint32_t u32Value;
+} ISP_ACK_T;
+
+static uint8_t s_au8Pkt[EXT_PKT_SIZE(EXT_MAX_PAYLOAD)] __attribute__((aligned(4)));
+static uint8_t s_au8Image[ISP_DIFF_PAGES * FMC_FLASH_PAGE_SIZE];
+static uint8_t s_au8New[ISP_DIFF_PAGES * FMC_FLASH_PAGE_SIZE];
+static const uint32_t s_au32EncKey[4] = ISP_SEC_ENC_KEY;
+static const uint32_t s_au32MacKey[4] = ISP_SEC_MAC_KEY;
+static const uint8_t s_au8Nonce[12] = { 0x3C, 0x81, 0x07, 0xE2, 0x55, 0x9A, 0x10, 0x6F, 0xD4, 0x28, 0xB3, 0x01 };
+static uint32_t s_u32Rand = 1;
+static uint32_t s_u32Fail;
+
+static uint32_t Isp_Rand(void)
+{
+    s_u32Rand = s_u32Rand * 1664525UL + 1013904223UL;
+    return s_u32Rand >> 8;
+}
+
+static void Isp_Fail(const char *pcMsg, uint32_t u32Arg)
+{
+    printf("# isp fail,%s,%u\n", pcMsg, (unsigned int)u32Arg);
+    s_u32Fail++;
+}
+
+/* CRC-32 of the host tool, as zlib */
+static uint32_t Isp_Crc32(const uint8_t *pu8Buf, uint32_t u32Len)
+{
+    uint32_t u32Crc = 0xFFFFFFFFUL, i;
+
+    while (u32Len--)
+    {
+        u32Crc ^= *pu8Buf++;
+
+        for (i = 0; i < 8; i++)
+            u32Crc = (u32Crc >> 1) ^ ((u32Crc & 1UL) ? 0xEDB88320UL : 0);
+    }
+
+    return ~u32Crc;
+}
+
+static void Isp_Put32(uint8_t *pu8Buf, uint32_t u32Value)
+{
+    pu8Buf[0] = (uint8_t)u32Value;
+    pu8Buf[1] = (uint8_t)(u32Value >> 8);
+    pu8Buf[2] = (uint8_t)(u32Value >> 16);
+    pu8Buf[3] = (uint8_t)(u32Value >> 24);
+}
+
+static uint32_t Isp_Get32(const uint8_t *pu8Buf)
+{
+    return pu8Buf[0] | ((uint32_t)pu8Buf[1] << 8) | ((uint32_t)pu8Buf[2] << 16) | ((uint32_t)pu8Buf[3] << 24);
+}
+
+/* Fresh device: blank APROM with a marked loader region, connected by the legacy protocol */
+static void Isp_PowerOn(void)
+{
+    IspSim_Reset();
+    memset(IspSim_Ptr(FMC_APROM_BASE), ISP_LOADER_MARK, ISP_APP_BASE - FMC_APROM_BASE);
+    g_apromSize = GetApromSize();
+    GetDataFlashInfo(&g_dataFlashAddr, &g_dataFlashSize);
+    g_u32ExtWindow = 0;
+}
+
+static uint32_t Isp_LoaderIntact(void)
+{
+    uint32_t i;
+
+    for (i = FMC_APROM_BASE; i < ISP_APP_BASE; i += FMC_FLASH_PAGE_SIZE)
+    {
+        if ((IspSim_GetEraseCount(i) != 0) || (*IspSim_Ptr(i) != ISP_LOADER_MARK))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Legacy 64-byte packet, pu8Data (up to 56 bytes) at offset 8. Return 0 if the response is valid. */
+static int32_t Isp_Legacy(uint32_t u32Cmd, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    static uint32_t s_u32PackNo = 1;
+    uint8_t au8Cmd[ISP_LEGACY_PKT_SIZE] __attribute__((aligned(4)));
+    uint32_t i;
+    uint16_t u16Sum = 0;
+
+    memset(au8Cmd, 0, sizeof(au8Cmd));
+    Isp_Put32(au8Cmd, u32Cmd);
+
+    if (u32Cmd == CMD_CONNECT)
+        s_u32PackNo = 1;
+
+    Isp_Put32(au8Cmd + 4, s_u32PackNo);
+
+    if (pu8Data != NULL)
+        memcpy(au8Cmd + 8, pu8Data, u32Len);
+
+    for (i = 0; i < ISP_LEGACY_PKT_SIZE; i++)
+        u16Sum += au8Cmd[i];
+
+    ParseCmd(au8Cmd, ISP_LEGACY_PKT_SIZE);
+    s_u32PackNo += 2;
+
+    return ((response_buff[0] | (response_buff[1] << 8)) == u16Sum) && (Isp_Get32(response_buff + 4) == s_u32PackNo - 1) ? 0 : -1;
+}
+
+static void Isp_Negotiate(uint32_t u32Payload, uint32_t u32Window)
+{
+    uint8_t au8Req[8];
+
+    Isp_Put32(au8Req, u32Payload);
+    Isp_Put32(au8Req + 4, u32Window);
+
+    if ((Isp_Legacy(CMD_CONNECT, NULL, 0) != 0) || (Isp_Legacy(CMD_EXT_NEGOTIATE, au8Req, sizeof(au8Req)) != 0))
+        Isp_Fail("negotiate response", u32Payload);
+}
+
+/* Send an extended packet, u32Corrupt flips a payload bit after the CRC */
+static void Isp_Ext(uint32_t u32Cmd, uint32_t u32Seq, uint32_t u32Addr, uint32_t u32Len, const uint8_t *pu8Data,
+                    uint32_t u32Corrupt, ISP_ACK_T *psAck)
+{
+    uint32_t u32CrcOfs = EXT_HDR_SIZE + g_u32ExtPayload;
+
+    memset(s_au8Pkt, 0, sizeof(s_au8Pkt));
+    Isp_Put32(s_au8Pkt, u32Cmd);
+    Isp_Put32(s_au8Pkt + 4, u32Seq);
+    Isp_Put32(s_au8Pkt + 8, u32Addr);
+    Isp_Put32(s_au8Pkt + 12, u32Len);
+
+    if (pu8Data != NULL)
+        memcpy(s_au8Pkt + EXT_HDR_SIZE, pu8Data, (u32Len < g_u32ExtPayload) ? u32Len : g_u32ExtPayload);
+
+    Isp_Put32(s_au8Pkt + u32CrcOfs, Isp_Crc32(s_au8Pkt, u32CrcOfs));
+
+    if (u32Corrupt)
+        s_au8Pkt[EXT_HDR_SIZE + 5] ^= 0x10;
+
+    memset(psAck, 0, sizeof(*psAck));
+    psAck->u32Len = ParseExtCmd(s_au8Pkt);
+
+    if (psAck->u32Len == 0)
+        return;
+
+    if ((psAck->u32Len != EXT_ACK_SIZE) || ((Isp_Get32(response_buff) & 0xFF) != CMD_EXT_ACK) ||
+            (Isp_Get32(response_buff + 12) != Isp_Crc32(response_buff, 12)))
+        Isp_Fail("ack format", u32Seq);
+
+    psAck->u32Status = (Isp_Get32(response_buff) >> 8) & 0xFF;
+    psAck->u32Seq = Isp_Get32(response_buff + 4);
+    psAck->u32Value = Isp_Get32(response_buff + 8);
+}
+
+static void Isp_ExpectAck(const ISP_ACK_T *psAck, uint32_t u32Status, uint32_t u32Seq, const char *pcMsg)
+{
+    if ((psAck->u32Len == 0) || (psAck->u32Status != u32Status) || (psAck->u32Seq != u32Seq))
+        Isp_Fail(pcMsg, u32Seq);
+}
+
+static void Isp_ExpectDrop(const ISP_ACK_T *psAck, const char *pcMsg, uint32_t u32Seq)
+{
+    if (psAck->u32Len != 0)
+        Isp_Fail(pcMsg, u32Seq);
+}
+
+/* Update command with its address and length, followed by data packets */
+static void Isp_LegacyUpdate(uint32_t u32Cmd, uint32_t u32Addr, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint8_t au8Data[56];
+    uint32_t u32Sent, u32Chunk;
+
+    u32Chunk = (u32Len < 48) ? u32Len : 48;
+    Isp_Put32(au8Data, u32Addr);
+    Isp_Put32(au8Data + 4, u32Len);
+    memcpy(au8Data + 8, pu8Data, u32Chunk);
+
+    if (Isp_Legacy(u32Cmd, au8Data, 8 + u32Chunk) != 0)
+        Isp_Fail("update", u32Cmd);
+
+    for (u32Sent = u32Chunk; u32Sent < u32Len; u32Sent += u32Chunk)
+    {
+        u32Chunk = (u32Len - u32Sent < 56) ? (u32Len - u32Sent) : 56;
+
+        if (Isp_Legacy(0, pu8Data + u32Sent, u32Chunk) != 0)
+            Isp_Fail("update data", u32Sent);
+    }
+}
+
+/*
+ * Patch generator of the host tool. The page checksums of the device are compared with the
+ * CRC32 of the new image pages, padded with 0xFF, and each run of changed pages is sent with
+ * CMD_UPDATE_PAGES. Return the number of pages sent.
+ */
+static uint32_t Isp_DiffPatch(const uint8_t *pu8Image, uint32_t u32Len)
+{
+    uint8_t au8Page[FMC_FLASH_PAGE_SIZE], au8Changed[ISP_DIFF_PAGES], au8Addr[4];
+    uint32_t u32PageNum = (u32Len + FMC_FLASH_PAGE_SIZE - 1) / FMC_FLASH_PAGE_SIZE, u32Start, u32End, i, j;
+
+    for (i = 0; i < u32PageNum; i += PAGE_CHKSUM_NUM)
+    {
+        Isp_Put32(au8Addr, ISP_APP_BASE + i * FMC_FLASH_PAGE_SIZE);
+
+        if (Isp_Legacy(CMD_GET_PAGE_CHKSUM, au8Addr, sizeof(au8Addr)) != 0)
+            Isp_Fail("page checksum", i);
+
+        for (j = i; (j < u32PageNum) && (j < i + PAGE_CHKSUM_NUM); j++)
+        {
+            memset(au8Page, 0xFF, sizeof(au8Page));
+            memcpy(au8Page, pu8Image + j * FMC_FLASH_PAGE_SIZE,
+                   (u32Len - j * FMC_FLASH_PAGE_SIZE < FMC_FLASH_PAGE_SIZE) ? (u32Len - j * FMC_FLASH_PAGE_SIZE) : FMC_FLASH_PAGE_SIZE);
+            au8Changed[j] = (Isp_Get32(response_buff + 8 + (j - i) * 4) != Isp_Crc32(au8Page, FMC_FLASH_PAGE_SIZE));
+        }
+    }
+
+    for (i = 0, j = 0; i < u32PageNum; i = u32End)
+    {
+        for (u32End = i + 1; (u32End < u32PageNum) && (au8Changed[u32End] == au8Changed[i]); u32End++);
+
+        if (!au8Changed[i])
+            continue;
+
+        u32Start = i * FMC_FLASH_PAGE_SIZE;
+        Isp_LegacyUpdate(CMD_UPDATE_PAGES, ISP_APP_BASE + u32Start, pu8Image + u32Start,
+                         ((u32End * FMC_FLASH_PAGE_SIZE < u32Len) ? (u32End * FMC_FLASH_PAGE_SIZE) : u32Len) - u32Start);
+        j += u32End - i;
+    }
+
+    return j;
+}
+
+/* The legacy update programs the image after the loader, which is left as is */
+static void IspTest_Legacy(void)
+{
+    uint32_t u32Len = 200;
+
+    Isp_PowerOn();
+
+    if (Isp_Legacy(CMD_CONNECT, NULL, 0) != 0)
+        Isp_Fail("connect", 0);
+
+    Isp_LegacyUpdate(CMD_UPDATE_APROM, 0, s_au8Image, u32Len);
+
+    if (memcmp(IspSim_Ptr(ISP_APP_BASE), s_au8Image, u32Len) != 0)
+        Isp_Fail("legacy image", u32Len);
+
+    if (!Isp_LoaderIntact())
+        Isp_Fail("legacy loader", 0);
+}
+
+/*
+ * Differential update of an image with changed pages, a partial last page and a new blank page.
+ * Only the changed pages are sent and erased, a second pass finds nothing to send.
+ */
+static void IspTest_Diff(void)
+{
+    static const uint32_t s_au32Patch[] = { 1, 2, 9, 20 };
+    uint32_t u32OldLen = 23 * FMC_FLASH_PAGE_SIZE - 100, u32NewLen = 24 * FMC_FLASH_PAGE_SIZE - 40, i, u32Erase;
+    uint32_t au32Config[2] = { 0xFFFFFFFD, 0xFFFFFFFF };    /* CONFIG0 LOCK bit cleared */
+    uint8_t au8Addr[4];
+
+    Isp_PowerOn();
+    memcpy(IspSim_Ptr(ISP_APP_BASE), s_au8Image, u32OldLen);
+    memcpy(s_au8New, s_au8Image, u32NewLen);
+
+    for (i = 0; i < sizeof(s_au32Patch) / sizeof(s_au32Patch[0]); i++)
+        s_au8New[s_au32Patch[i] * FMC_FLASH_PAGE_SIZE + 77] ^= 0x01;
+
+    if (Isp_Legacy(CMD_CONNECT, NULL, 0) != 0)
+        Isp_Fail("connect", 0);
+
+    /* Pages 1, 2, 9 and 20, page 22 with the new tail and the blank page 23 */
+    if ((Isp_DiffPatch(s_au8New, u32NewLen) != 6) || (memcmp(IspSim_Ptr(ISP_APP_BASE), s_au8New, u32NewLen) != 0))
+        Isp_Fail("diff image", 0);
+
+    for (i = 0; i < ISP_DIFF_PAGES; i++)
+    {
+        u32Erase = (i == 1) || (i == 2) || (i == 9) || (i == 20) || (i == 22);
+
+        if (IspSim_GetEraseCount(ISP_APP_BASE + i * FMC_FLASH_PAGE_SIZE) != u32Erase)
+            Isp_Fail("diff erase", i);
+    }
+
+    if ((Isp_DiffPatch(s_au8New, u32NewLen) != 0) || !Isp_LoaderIntact())
+        Isp_Fail("diff second pass", 0);
+
+    /* The loader pages are not reported nor updated */
+    Isp_Put32(au8Addr, FMC_APROM_BASE);
+    Isp_Legacy(CMD_GET_PAGE_CHKSUM, au8Addr, sizeof(au8Addr));
+
+    for (i = 0; i < PAGE_CHKSUM_NUM; i++)
+    {
+        if (Isp_Get32(response_buff + 8 + i * 4) != 0xFFFFFFFF)
+            Isp_Fail("diff loader checksum", i);
+    }
+
+    Isp_LegacyUpdate(CMD_UPDATE_PAGES, ISP_APP_BASE - FMC_FLASH_PAGE_SIZE, s_au8New, 2 * FMC_FLASH_PAGE_SIZE);
+
+    if (!Isp_LoaderIntact() || (memcmp(IspSim_Ptr(ISP_APP_BASE), s_au8New, u32NewLen) != 0))
+        Isp_Fail("diff loader update", 0);
+
+    /* A locked chip reports no checksum and refuses the partial update */
+    UpdateConfig(au32Config, NULL);
+
+    if (Isp_DiffPatch(s_au8Image, u32OldLen) != 23)
+        Isp_Fail("diff locked checksum", 0);
+
+    if (memcmp(IspSim_Ptr(ISP_APP_BASE), s_au8New, u32NewLen) != 0)
+        Isp_Fail("diff locked update", 0);
+}
+
+/* Host tool side of the secure update: AES-128-CTR encryption of the image and its CMAC with pu32MacKey */
+static void Isp_SecSign(const uint8_t *pu8Plain, uint32_t u32Len, const uint32_t *pu32MacKey, uint8_t *pu8Cipher, uint8_t au8Tag[16])
+{
+    AUTHLIB_CMAC_T sCmac;
+    uint8_t au8Ctr[16], au8Ks[16];
+    uint32_t i, j;
+
+    for (i = 0; i < u32Len; i += 16)
+    {
+        memcpy(au8Ctr, s_au8Nonce, sizeof(s_au8Nonce));
+        au8Ctr[12] = (uint8_t)((i / 16) >> 24);
+        au8Ctr[13] = (uint8_t)((i / 16) >> 16);
+        au8Ctr[14] = (uint8_t)((i / 16) >> 8);
+        au8Ctr[15] = (uint8_t)(i / 16);
+        AesSim_Encrypt(s_au32EncKey, AES_KEY_SIZE_128, au8Ctr, au8Ks);
+
+        for (j = 0; j < 16; j++)
+            pu8Cipher[i + j] = pu8Plain[i + j] ^ au8Ks[j];
+    }
+
+    if ((AUTHLIB_CmacInit(&sCmac, pu32MacKey, AES_KEY_SIZE_128) != 0) || (AUTHLIB_CmacUpdate(&sCmac, pu8Plain, u32Len) != 0) ||
+            (AUTHLIB_CmacFinal(&sCmac, au8Tag) != 0))
+        Isp_Fail("cmac", u32Len);
+}
+
+/*
+ * Send a secure image to ISP_APP_BASE, page by page, and return the status of the verify.
+ * The first page must stay blank until the verify.
+ */
+static uint32_t Isp_SecUpdate(const uint8_t *pu8Cipher, uint32_t u32Len, uint32_t u32Type, const uint8_t *pu8Expect)
+{
+    ISP_ACK_T sAck;
+    uint8_t au8Payload[FMC_FLASH_PAGE_SIZE];
+    uint32_t u32Seq = 0, u32Ofs, u32Chunk;
+
+    Isp_PowerOn();
+    Isp_Negotiate(FMC_FLASH_PAGE_SIZE, EXT_MAX_WINDOW);
+
+    memset(au8Payload, 0, sizeof(au8Payload));
+    memcpy(au8Payload, s_au8Nonce, sizeof(s_au8Nonce));
+    Isp_Put32(au8Payload + 12, u32Type);
+    Isp_Ext(CMD_EXT_SEC_BEGIN | CMD_EXT_ACK_REQ, u32Seq, ISP_APP_BASE, u32Len, au8Payload, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_OK, ++u32Seq, "sec begin");
+
+    Isp_Ext(CMD_EXT_ERASE | CMD_EXT_ACK_REQ, u32Seq, ISP_APP_BASE + FMC_FLASH_PAGE_SIZE,
+            (u32Len + FMC_FLASH_PAGE_SIZE - 1) / FMC_FLASH_PAGE_SIZE * FMC_FLASH_PAGE_SIZE - FMC_FLASH_PAGE_SIZE, NULL, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_OK, ++u32Seq, "sec erase");
+
+    for (u32Ofs = 0; u32Ofs < u32Len; u32Ofs += u32Chunk)
+    {
+        u32Chunk = (u32Len - u32Ofs < FMC_FLASH_PAGE_SIZE) ? (u32Len - u32Ofs) : FMC_FLASH_PAGE_SIZE;
+        Isp_Ext(CMD_EXT_SEC_WRITE | CMD_EXT_ACK_REQ, u32Seq, ISP_APP_BASE + u32Ofs, u32Chunk, pu8Cipher + u32Ofs, 0, &sAck);
+        Isp_ExpectAck(&sAck, EXT_STS_OK, ++u32Seq, "sec write");
+    }
+
+    if (inpw(IspSim_Ptr(ISP_APP_BASE)) != 0xFFFFFFFF)
+        Isp_Fail("sec first page before verify", 0);
+
+    Isp_Ext(CMD_EXT_SEC_VERIFY, u32Seq, 0, 16, pu8Expect, 0, &sAck);
+
+    if ((sAck.u32Len == 0) || (sAck.u32Seq != u32Seq + (sAck.u32Status == EXT_STS_OK)) || !Isp_LoaderIntact())
+        Isp_Fail("sec verify ack", u32Seq);
+
+    return sAck.u32Status;
+}
+
+/* Genuine images are programmed, forged ones are rejected and leave nothing to boot */
+static void IspTest_Sec(void)
+{
+    static const uint32_t s_au32ForgeKey[4] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+    uint8_t au8Cipher[ISP_SEC_SIZE], au8Tag[16], au8Crc[16] = {0};
+    ISP_ACK_T sAck;
+
+    Isp_PowerOn();
+    Isp_Negotiate(FMC_FLASH_PAGE_SIZE, EXT_MAX_WINDOW);
+
+    /* No write nor verify without a begin, and only at ISP_APP_BASE */
+    Isp_Ext(CMD_EXT_SEC_WRITE, 0, ISP_APP_BASE, 16, s_au8Image, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_PARAM, 0, "sec write first");
+    Isp_Ext(CMD_EXT_SEC_VERIFY, 0, 0, 16, au8Crc, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_PARAM, 0, "sec verify first");
+    Isp_Ext(CMD_EXT_SEC_BEGIN, 0, ISP_APP_BASE + FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE, au8Crc, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_PARAM, 0, "sec begin address");
+    Isp_Ext(CMD_EXT_SEC_BEGIN, 0, FMC_APROM_BASE, FMC_FLASH_PAGE_SIZE, au8Crc, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_PARAM, 0, "sec begin loader");
+
+    Isp_SecSign(s_au8Image, ISP_SEC_SIZE, s_au32MacKey, au8Cipher, au8Tag);
+
+    if ((Isp_SecUpdate(au8Cipher, ISP_SEC_SIZE, SEC_VERIFY_CMAC, au8Tag) != EXT_STS_OK) ||
+            (memcmp(IspSim_Ptr(ISP_APP_BASE), s_au8Image, ISP_SEC_SIZE) != 0))
+        Isp_Fail("sec cmac image", 0);
+
+    Isp_Put32(au8Crc, Isp_Crc32(s_au8Image, ISP_SEC_SIZE));
+
+    if ((Isp_SecUpdate(au8Cipher, ISP_SEC_SIZE, SEC_VERIFY_CRC32, au8Crc) != EXT_STS_OK) ||
+            (memcmp(IspSim_Ptr(ISP_APP_BASE), s_au8Image, ISP_SEC_SIZE) != 0))
+        Isp_Fail("sec crc32 image", 0);
+
+    /* Tampered cipher text with the genuine tag */
+    au8Cipher[2 * FMC_FLASH_PAGE_SIZE + 9] ^= 0x40;
+
+    if ((Isp_SecUpdate(au8Cipher, ISP_SEC_SIZE, SEC_VERIFY_CMAC, au8Tag) != EXT_STS_AUTH) ||
+            (inpw(IspSim_Ptr(ISP_APP_BASE)) != 0xFFFFFFFF))
+        Isp_Fail("sec tampered image", 0);
+
+    /* Image signed with another key */
+    Isp_SecSign(s_au8Image, ISP_SEC_SIZE, s_au32ForgeKey, au8Cipher, au8Tag);
+
+    if ((Isp_SecUpdate(au8Cipher, ISP_SEC_SIZE, SEC_VERIFY_CMAC, au8Tag) != EXT_STS_AUTH) ||
+            (inpw(IspSim_Ptr(ISP_APP_BASE)) != 0xFFFFFFFF))
+        Isp_Fail("sec forged image", 0);
+}
+
+static void IspTest_Negotiate(void)
+{
+    static const uint32_t s_au32Case[][4] =
+    {
+        /* Requested payload and window, accepted payload and window */
+        { FMC_FLASH_PAGE_SIZE, EXT_MAX_WINDOW, FMC_FLASH_PAGE_SIZE, EXT_MAX_WINDOW },
+        { 4096, 16, EXT_MAX_PAYLOAD, EXT_MAX_WINDOW },
+        { 300, 2, 256, 2 },
+        { 100, 4, 0, 0 },
+    };
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_au32Case) / sizeof(s_au32Case[0]); i++)
+    {
+        Isp_PowerOn();
+        Isp_Negotiate(s_au32Case[i][0], s_au32Case[i][1]);
+
+        if ((g_u32ExtPayload != s_au32Case[i][2]) || (g_u32ExtWindow != s_au32Case[i][3]) ||
+                (Isp_Get32(response_buff + 8) != s_au32Case[i][2]) || (Isp_Get32(response_buff + 12) != s_au32Case[i][3]) ||
+                (Isp_Get32(response_buff + 16) != EXT_VERSION))
+            Isp_Fail("negotiate", i);
+    }
+}
+
+/*
+ * Windowed transfer. Packet 3 is corrupt, then resent corrupt once more, packet 6 is lost.
+ * The device reports each failing packet at the expected seq and drops the packets in flight.
+ */
+static void IspTest_Window(void)
+{
+    ISP_ACK_T sAck;
+    uint32_t u32Seq, u32Blk;
+
+    Isp_PowerOn();
+    Isp_Negotiate(FMC_FLASH_PAGE_SIZE, EXT_MAX_WINDOW);
+
+    Isp_Ext(CMD_EXT_ERASE | CMD_EXT_ACK_REQ, 0, ISP_IMAGE_ADDR, ISP_IMAGE_SIZE, NULL, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_OK, 1, "erase");
+
+    /* Packet seq n writes block n - 1. Acknowledged by (window + 1) / 2 = 2 packets. */
+    for (u32Seq = 1; u32Seq < 3; u32Seq++)
+    {
+        Isp_Ext(CMD_EXT_WRITE, u32Seq, ISP_IMAGE_ADDR + (u32Seq - 1) * FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE,
+                s_au8Image + (u32Seq - 1) * FMC_FLASH_PAGE_SIZE, 0, &sAck);
+
+        if (u32Seq & 1)
+            Isp_ExpectAck(&sAck, EXT_STS_OK, u32Seq + 1, "window ack");
+        else
+            Isp_ExpectDrop(&sAck, "window no ack", u32Seq);
+    }
+
+    Isp_Ext(CMD_EXT_WRITE, 3, ISP_IMAGE_ADDR + 2 * FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE, s_au8Image + 2 * FMC_FLASH_PAGE_SIZE, 1, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_CRC, 3, "corrupt nak");
+
+    for (u32Seq = 4; u32Seq < 6; u32Seq++)
+    {
+        Isp_Ext(CMD_EXT_WRITE, u32Seq, ISP_IMAGE_ADDR + (u32Seq - 1) * FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE,
+                s_au8Image + (u32Seq - 1) * FMC_FLASH_PAGE_SIZE, 0, &sAck);
+        Isp_ExpectDrop(&sAck, "in flight drop", u32Seq);
+    }
+
+    /* The resent packet is corrupt again: reported again, not dropped */
+    Isp_Ext(CMD_EXT_WRITE, 3, ISP_IMAGE_ADDR + 2 * FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE, s_au8Image + 2 * FMC_FLASH_PAGE_SIZE, 1, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_CRC, 3, "corrupt resend nak");
+
+    /* Go back to seq 3, packet 6 is lost */
+    for (u32Seq = 3; u32Seq < 6; u32Seq++)
+    {
+        Isp_Ext(CMD_EXT_WRITE, u32Seq, ISP_IMAGE_ADDR + (u32Seq - 1) * FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE,
+                s_au8Image + (u32Seq - 1) * FMC_FLASH_PAGE_SIZE, 0, &sAck);
+
+        if (u32Seq & 1)
+            Isp_ExpectAck(&sAck, EXT_STS_OK, u32Seq + 1, "resend ack");
+        else
+            Isp_ExpectDrop(&sAck, "resend no ack", u32Seq);
+    }
+
+    /* The next packet of the host, a verify, comes first */
+    Isp_Ext(CMD_EXT_VERIFY, 7, ISP_IMAGE_ADDR, ISP_IMAGE_SIZE, NULL, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_SEQ, 6, "lost nak");
+
+    u32Blk = ISP_IMAGE_SIZE / FMC_FLASH_PAGE_SIZE - 1;
+    Isp_Ext(CMD_EXT_WRITE | CMD_EXT_ACK_REQ, 6, ISP_IMAGE_ADDR + u32Blk * FMC_FLASH_PAGE_SIZE, FMC_FLASH_PAGE_SIZE,
+            s_au8Image + u32Blk * FMC_FLASH_PAGE_SIZE, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_OK, 7, "lost resend");
+
+    Isp_Ext(CMD_EXT_VERIFY, 7, ISP_IMAGE_ADDR, ISP_IMAGE_SIZE, NULL, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_OK, 8, "verify");
+
+    if ((sAck.u32Value != Isp_Crc32(s_au8Image, ISP_IMAGE_SIZE)) || (memcmp(IspSim_Ptr(ISP_IMAGE_ADDR), s_au8Image, ISP_IMAGE_SIZE) != 0))
+        Isp_Fail("window image", 0);
+
+    Isp_Ext(CMD_EXT_EXIT, 8, 0, 0, NULL, 0, &sAck);
+    Isp_ExpectAck(&sAck, EXT_STS_OK, 9, "exit");
+
+    if ((g_u32ExtWindow != 0) || !Isp_LoaderIntact())
+        Isp_Fail("exit", g_u32ExtWindow);
+}
+
+/* Erase, write and verify requests which reach the loader or leave APROM are rejected */
+static void IspTest_Range(void)
+{
+    static const uint32_t s_au32Case[][3] =
+    {
+        { CMD_EXT_ERASE, FMC_APROM_BASE, FMC_FLASH_PAGE_SIZE },
+        { CMD_EXT_ERASE, ISP_APP_BASE - FMC_FLASH_PAGE_SIZE, 2 * FMC_FLASH_PAGE_SIZE },
+        { CMD_EXT_ERASE, ISP_APP_BASE + 4, FMC_FLASH_PAGE_SIZE },
+        { CMD_EXT_WRITE, ISP_APP_BASE - FMC_MULTI_WORD_PROG_LEN, FMC_MULTI_WORD_PROG_LEN },
+        { CMD_EXT_WRITE, ISP_APP_BASE + 4, FMC_MULTI_WORD_PROG_LEN },
+        { CMD_EXT_WRITE, ISP_SIM_APROM_SIZE - FMC_MULTI_WORD_PROG_LEN, 2 * FMC_MULTI_WORD_PROG_LEN },
+        { CMD_EXT_VERIFY, FMC_APROM_BASE, 4 },
+        { 0x000000DF, ISP_APP_BASE, 4 },
+    };
+    ISP_ACK_T sAck;
+    uint32_t i;
+
+    Isp_PowerOn();
+    Isp_Negotiate(FMC_FLASH_PAGE_SIZE, EXT_MAX_WINDOW);
+
+    for (i = 0; i < sizeof(s_au32Case) / sizeof(s_au32Case[0]); i++)
+    {
+        Isp_Ext(s_au32Case[i][0], 0, s_au32Case[i][1], s_au32Case[i][2], s_au8Image, 0, &sAck);
+        Isp_ExpectAck(&sAck, EXT_STS_PARAM, 0, "range");
+    }
+
+    if (!Isp_LoaderIntact())
+        Isp_Fail("range loader", 0);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_au8Image); i++)
+        s_au8Image[i] = (uint8_t)Isp_Rand();
+
+    IspTest_Legacy();
+    IspTest_Diff();
+    IspTest_Negotiate();
+    IspTest_Window();
+    IspTest_Range();
+    IspTest_Sec();
+
+    printf("# isp failures,%u\n", (unsigned int)s_u32Fail);
+
+    return (s_u32Fail != 0);
+}
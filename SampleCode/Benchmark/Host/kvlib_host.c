@@ -0,0 +1,299 @@
+/**************************************************************************//**
+ * @file     kvlib_host.c
+ * @version  V1.00
+ * @brief    Power loss test of the key/value store library on the host flash simulator.
+ *
+ * @details
+ *           Random Set/Delete sequences run against a RAM model of the keys,
+ *           with values large enough to fill the store. Every operation is
+ *           replayed from the same flash content with a power loss injected at
+ *           each of its flash operations, then the mount is replayed with a
+ *           power loss at each of its own flash operations. After the next
+ *           mount, the key of the operation must hold the old or the new value
+ *           and all other keys their model value. A deletion must never fail
+ *           with KVLIB_ERR_FULL. The exit status is the number of failures.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "kvlib.h"
+
+#define KV_KEY_NUM          12
+#define KV_IDX_SIZE         16
+#define KV_VALUE_BUF_LEN    KVLIB_VALUE_MAX_LEN(1)
+
+typedef struct
+{
+    uint32_t u32PageNum;        /* Pages of the store */
+    uint32_t u32ValueMaxLen;    /* Longest random value */
+    uint32_t u32OpNum;          /* Random operations */
+    uint32_t u32Seed;
+} KV_CONFIG_T;
+
+typedef struct
+{
+    int32_t  i32Len;            /* Value length, -1 if the key is not stored */
+    uint8_t  au8Value[KV_VALUE_BUF_LEN];
+} KV_MODEL_T;
+
+static const KV_CONFIG_T s_asConfig[] =
+{
+    /* Nearly full stores: the keys hold several times the capacity */
+    { 3, 200, 200, 1 },
+    { 4, 200, 200, 2 },
+    { 6, 320, 150, 3 },
+    /* Records of up to a page */
+    { 4, KV_VALUE_BUF_LEN - 8, 150, 4 },
+    /* Mostly small values in a larger store */
+    { 8, 48, 150, 5 },
+};
+
+static KVLIB_T s_sKV;
+static KVLIB_IDX_T s_asIdx[KV_IDX_SIZE];
+static KV_MODEL_T s_asModel[KV_KEY_NUM];
+static uint8_t s_au8State[FLASH_SIM_SIZE];     /* Flash content before the operation */
+static uint8_t s_au8Lost[FLASH_SIM_SIZE];      /* Flash content after the power loss */
+static uint8_t s_au8Value[KV_VALUE_BUF_LEN];
+static uint32_t s_u32Rand;
+static uint32_t s_u32Fail;
+
+static uint32_t KV_Rand(void)
+{
+    s_u32Rand = s_u32Rand * 1664525UL + 1013904223UL;
+    return s_u32Rand >> 8;
+}
+
+/* Keys of 1 to 12 bytes */
+static uint32_t KV_Key(uint32_t u32Key, char *pcKey)
+{
+    static const char s_acName[] = "abcdefghijkl";
+    uint32_t u32Len = u32Key + 1;
+
+    memcpy(pcKey, s_acName, u32Len);
+    pcKey[0] = (char)('A' + u32Key);
+
+    return u32Len;
+}
+
+static void KV_Fail(const char *pcMsg, uint32_t u32Op, uint32_t u32Loss, uint32_t u32MountLoss)
+{
+    if (s_u32Fail < 20)
+        printf("# kvlib fail,%s,page %u,op %u,loss %u,mount loss %u\n", pcMsg, (unsigned int)s_sKV.u32PageNum,
+               (unsigned int)u32Op, (unsigned int)u32Loss, (unsigned int)u32MountLoss);
+
+    s_u32Fail++;
+}
+
+/* Return 1 if the key holds the model value */
+static int32_t KV_Match(uint32_t u32Key, const KV_MODEL_T *psModel)
+{
+    char acKey[KV_KEY_NUM];
+    uint32_t u32KeyLen = KV_Key(u32Key, acKey);
+    int32_t i32Len = KVLIB_Get(&s_sKV, acKey, u32KeyLen, s_au8Value, sizeof(s_au8Value));
+
+    if (psModel->i32Len < 0)
+        return (i32Len == KVLIB_ERR_NOT_FOUND);
+
+    return (i32Len == psModel->i32Len) && (memcmp(s_au8Value, psModel->au8Value, (uint32_t)i32Len) == 0);
+}
+
+/* Check all keys but u32Skip against the model, and the live size of the store */
+static int32_t KV_Check(uint32_t u32Skip)
+{
+    char acKey[KV_KEY_NUM];
+    uint32_t i, u32Live = 0, u32Count = 0;
+
+    for (i = 0; i < KV_KEY_NUM; i++)
+    {
+        if ((i != u32Skip) && !KV_Match(i, &s_asModel[i]))
+            return 0;
+    }
+
+    for (i = 0; i < KV_KEY_NUM; i++)
+    {
+        int32_t i32Len = KVLIB_Get(&s_sKV, acKey, KV_Key(i, acKey), NULL, 0);
+
+        if (i32Len >= 0)
+        {
+            u32Live += KVLIB_REC_SIZE_OF(i + 1, (uint32_t)i32Len);
+            u32Count++;
+        }
+    }
+
+    return (u32Live == s_sKV.u32LiveSize) && (u32Count == s_sKV.u32Count) && (u32Live <= KVLIB_CAPACITY(s_sKV.u32PageNum));
+}
+
+static int32_t KV_Mount(uint32_t u32PageNum)
+{
+    return KVLIB_Init(&s_sKV, FLASH_SIM_BASE, u32PageNum, s_asIdx, KV_IDX_SIZE);
+}
+
+/* Run operation u32Key/psNew: 1 stores the value, 0 deletes the key */
+static int32_t KV_Op(uint32_t u32Key, const KV_MODEL_T *psNew)
+{
+    char acKey[KV_KEY_NUM];
+    uint32_t u32KeyLen = KV_Key(u32Key, acKey);
+
+    if (psNew->i32Len < 0)
+        return KVLIB_Delete(&s_sKV, acKey, u32KeyLen);
+
+    return KVLIB_Set(&s_sKV, acKey, u32KeyLen, psNew->au8Value, (uint32_t)psNew->i32Len);
+}
+
+/* Mount after the power loss, with a power loss at each flash operation of the mount itself */
+static void KV_Recover(const KV_CONFIG_T *psCfg, uint32_t u32Op, uint32_t u32Loss, uint32_t u32Key, const KV_MODEL_T *psNew)
+{
+    uint32_t u32MountLoss, i;
+    char acKey[KV_KEY_NUM];
+    int32_t i32Ret;
+
+    FlashSim_Save(s_au8Lost);
+
+    for (u32MountLoss = 1; ; u32MountLoss++)
+    {
+        FlashSim_Load(s_au8Lost);
+        FlashSim_PowerOn();
+        FlashSim_SetPowerLoss(u32MountLoss, u32Op * 977UL + u32Loss * 31UL + u32MountLoss);
+        i32Ret = KV_Mount(psCfg->u32PageNum);
+
+        if (!FlashSim_IsPowerLost())
+        {
+            FlashSim_SetPowerLoss(0, 0);
+            break;
+        }
+
+        FlashSim_PowerOn();
+
+        if (KV_Mount(psCfg->u32PageNum) != 0)
+        {
+            KV_Fail("mount after mount loss", u32Op, u32Loss, u32MountLoss);
+            return;
+        }
+
+        if (!KV_Check(u32Key) || (!KV_Match(u32Key, &s_asModel[u32Key]) && !KV_Match(u32Key, psNew)))
+            KV_Fail("value after mount loss", u32Op, u32Loss, u32MountLoss);
+    }
+
+    if (i32Ret != 0)
+    {
+        KV_Fail("mount", u32Op, u32Loss, 0);
+    }
+    else if (!KV_Check(u32Key) || (!KV_Match(u32Key, &s_asModel[u32Key]) && !KV_Match(u32Key, psNew)))
+    {
+        KV_Fail("value after loss", u32Op, u32Loss, 0);
+    }
+    else
+    {
+        /* The store keeps working: every key can be deleted */
+        for (i = 0; i < KV_KEY_NUM; i++)
+        {
+            i32Ret = KVLIB_Delete(&s_sKV, acKey, KV_Key(i, acKey));
+
+            if ((i32Ret != 0) && (i32Ret != KVLIB_ERR_NOT_FOUND))
+                KV_Fail("delete after loss", u32Op, u32Loss, i);
+        }
+    }
+}
+
+static void KV_Run(const KV_CONFIG_T *psCfg)
+{
+    static KV_MODEL_T s_sNew;
+    uint32_t u32Op, u32Loss, u32Key, i, u32Full = 0;
+    char acKey[KV_KEY_NUM];
+    int32_t i32Ret;
+
+    s_u32Rand = psCfg->u32Seed;
+    FlashSim_Reset();
+
+    for (i = 0; i < KV_KEY_NUM; i++)
+        s_asModel[i].i32Len = -1;
+
+    if (KV_Mount(psCfg->u32PageNum) != 0)
+    {
+        KV_Fail("format", 0, 0, 0);
+        return;
+    }
+
+    for (u32Op = 0; u32Op < psCfg->u32OpNum; u32Op++)
+    {
+        u32Key = KV_Rand() % KV_KEY_NUM;
+
+        /* One operation in four is a deletion */
+        if ((s_asModel[u32Key].i32Len >= 0) && ((KV_Rand() & 3UL) == 0))
+        {
+            s_sNew.i32Len = -1;
+        }
+        else
+        {
+            s_sNew.i32Len = (int32_t)(KV_Rand() % (psCfg->u32ValueMaxLen + 1));
+
+            for (i = 0; i < (uint32_t)s_sNew.i32Len; i++)
+                s_sNew.au8Value[i] = (uint8_t)KV_Rand();
+        }
+
+        FlashSim_Save(s_au8State);
+
+        for (u32Loss = 1; ; u32Loss++)
+        {
+            FlashSim_Load(s_au8State);
+            FlashSim_PowerOn();
+
+            if (KV_Mount(psCfg->u32PageNum) != 0)
+            {
+                KV_Fail("replay mount", u32Op, u32Loss, 0);
+                return;
+            }
+
+            FlashSim_SetPowerLoss(u32Loss, u32Op * 7919UL + u32Loss);
+            i32Ret = KV_Op(u32Key, &s_sNew);
+
+            if (!FlashSim_IsPowerLost())
+                break;
+
+            KV_Recover(psCfg, u32Op, u32Loss, u32Key, &s_sNew);
+        }
+
+        /* The operation completed without power loss */
+        FlashSim_SetPowerLoss(0, 0);
+
+        if (i32Ret == 0)
+            s_asModel[u32Key] = s_sNew;
+        else if ((i32Ret != KVLIB_ERR_FULL) || (s_sNew.i32Len < 0))
+            KV_Fail("operation", u32Op, 0, 0);
+        else
+            u32Full++;
+
+        if (!KV_Check(KV_KEY_NUM) || (KV_Mount(psCfg->u32PageNum) != 0) || !KV_Check(KV_KEY_NUM))
+            KV_Fail("model", u32Op, 0, 0);
+    }
+
+    /* Deleting every key frees the whole store */
+    for (i = 0; i < KV_KEY_NUM; i++)
+    {
+        if ((s_asModel[i].i32Len >= 0) && (KVLIB_Delete(&s_sKV, acKey, KV_Key(i, acKey)) != 0))
+            KV_Fail("delete all", i, 0, 0);
+    }
+
+    if ((KV_Mount(psCfg->u32PageNum) != 0) || (s_sKV.u32Count != 0) ||
+            (KVLIB_Set(&s_sKV, acKey, KV_Key(0, acKey), s_au8Value, KVLIB_VALUE_MAX_LEN(1)) != 0))
+        KV_Fail("empty store", psCfg->u32OpNum, 0, 0);
+
+    printf("# kvlib pages,%u,value max,%u,ops,%u,full,%u\n", (unsigned int)psCfg->u32PageNum,
+           (unsigned int)psCfg->u32ValueMaxLen, (unsigned int)psCfg->u32OpNum, (unsigned int)u32Full);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_asConfig) / sizeof(s_asConfig[0]); i++)
+        KV_Run(&s_asConfig[i]);
+
+    printf("# kvlib failures,%u\n", (unsigned int)s_u32Fail);
+
+    return (s_u32Fail != 0);
+}
@@ -0,0 +1,298 @@
+/**************************************************************************//**
+ * @file     bench_auth.c
+ * @version  V1.00
+ * @brief    Benchmark suite of the AES-CMAC and AES-CCM library. The NIST
+ *           SP 800-38B and SP 800-38C examples are checked on the host with
+ *           the software AES stand-in and on the target with the AES engine.
+ *           On the target raw AES-CBC by AES_Update() is the reference for
+ *           the MAC throughput.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "authlib.h"
+#include "bench_suites.h"
+
+#define AUTH_BUF_SIZE       1024
+#define AUTH_AAD_LEN        16
+#define AUTH_TAG_LEN        16
+
+/* NIST SP 800-38B examples, AES-128 and AES-256 */
+static const uint32_t s_au32CmacKey128[4] = {0x2B7E1516, 0x28AED2A6, 0xABF71588, 0x09CF4F3C};
+static const uint32_t s_au32CmacKey256[8] = {0x603DEB10, 0x15CA71BE, 0x2B73AEF0, 0x857D7781,
+                                             0x1F352C07, 0x3B6108D7, 0x2D9810A3, 0x0914DFF4
+                                            };
+static const uint8_t s_au8CmacMsg[64] =
+{
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+};
+
+typedef struct
+{
+    const uint32_t *pu32Key;
+    uint32_t u32KeySize;
+    uint32_t u32MsgLen;
+    uint8_t au8Tag[16];
+} CMAC_VECTOR_T;
+
+static const CMAC_VECTOR_T s_asCmacVector[] =
+{
+    {s_au32CmacKey128, AES_KEY_SIZE_128,  0, {0xBB, 0x1D, 0x69, 0x29, 0xE9, 0x59, 0x37, 0x28, 0x7F, 0xA3, 0x7D, 0x12, 0x9B, 0x75, 0x67, 0x46}},
+    {s_au32CmacKey128, AES_KEY_SIZE_128, 16, {0x07, 0x0A, 0x16, 0xB4, 0x6B, 0x4D, 0x41, 0x44, 0xF7, 0x9B, 0xDD, 0x9D, 0xD0, 0x4A, 0x28, 0x7C}},
+    {s_au32CmacKey128, AES_KEY_SIZE_128, 40, {0xDF, 0xA6, 0x67, 0x47, 0xDE, 0x9A, 0xE6, 0x30, 0x30, 0xCA, 0x32, 0x61, 0x14, 0x97, 0xC8, 0x27}},
+    {s_au32CmacKey128, AES_KEY_SIZE_128, 64, {0x51, 0xF0, 0xBE, 0xBF, 0x7E, 0x3B, 0x9D, 0x92, 0xFC, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3C, 0xFE}},
+    {s_au32CmacKey256, AES_KEY_SIZE_256,  0, {0x02, 0x89, 0x62, 0xF6, 0x1B, 0x7B, 0xF8, 0x9E, 0xFC, 0x6B, 0x55, 0x1F, 0x46, 0x67, 0xD9, 0x83}},
+    {s_au32CmacKey256, AES_KEY_SIZE_256, 64, {0xE1, 0x99, 0x21, 0x90, 0x54, 0x9F, 0x6E, 0xD5, 0x69, 0x6A, 0x2C, 0x05, 0x6C, 0x31, 0x54, 0x10}},
+};
+
+/* NIST SP 800-38C examples 1 ~ 3: N = 10 11 12 .., A = 00 01 02 .., P = 20 21 22 .. */
+static const uint32_t s_au32CcmKey[4] = {0x40414243, 0x44454647, 0x48494A4B, 0x4C4D4E4F};
+
+typedef struct
+{
+    uint32_t u32NonceLen;
+    uint32_t u32AadLen;
+    uint32_t u32DataLen;
+    uint32_t u32TagLen;
+    uint8_t au8CipherTag[32];   /* Cipher text followed by the tag */
+} CCM_VECTOR_T;
+
+static const CCM_VECTOR_T s_asCcmVector[] =
+{
+    {7, 8, 4, 4, {0x71, 0x62, 0x01, 0x5B, 0x4D, 0xAC, 0x25, 0x5D}},
+    {
+        8, 16, 16, 6,
+        {
+            0xD2, 0xA1, 0xF0, 0xE0, 0x51, 0xEA, 0x5F, 0x62, 0x08, 0x1A, 0x77, 0x92, 0x07, 0x3D, 0x59, 0x3D,
+            0x1F, 0xC6, 0x4F, 0xBF, 0xAC, 0xCD
+        }
+    },
+    {
+        12, 20, 24, 8,
+        {
+            0xE3, 0xB2, 0x01, 0xA9, 0xF5, 0xB7, 0x1A, 0x7A, 0x9B, 0x1C, 0xEA, 0xEC, 0xCD, 0x97, 0xE7, 0x0B,
+            0x61, 0x76, 0xAA, 0xD9, 0xA4, 0x42, 0x8A, 0xA5, 0x48, 0x43, 0x92, 0xFB, 0xC1, 0xB0, 0x99, 0x51
+        }
+    },
+};
+
+/* One byte offset, the library must handle an unaligned buffer */
+static uint8_t s_au8Buf[AUTH_BUF_SIZE + 1];
+static uint8_t s_au8Out[AUTH_BUF_SIZE + 1];
+static uint8_t s_au8Tag[AUTH_TAG_LEN];
+static const uint32_t s_au32Key[4] = {0x00010203, 0x04050607, 0x08090A0B, 0x0C0D0E0F};
+static const uint8_t s_au8Nonce[12] = {0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B};
+static const uint8_t s_au8Aad[AUTH_AAD_LEN] = {0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+                                               0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F};
+static int32_t s_i32Result;
+
+static int32_t CmacNist(void *pvArg)
+{
+    const CMAC_VECTOR_T *psVec;
+    AUTHLIB_CMAC_T sCmac;
+    uint8_t au8Tag[16];
+    uint32_t i;
+
+    (void)pvArg;
+    s_i32Result = 0;
+
+    for (i = 0; i < sizeof(s_asCmacVector) / sizeof(s_asCmacVector[0]); i++)
+    {
+        psVec = &s_asCmacVector[i];
+
+        if ((AUTHLIB_CmacInit(&sCmac, psVec->pu32Key, psVec->u32KeySize) != 0) ||
+                (AUTHLIB_CmacUpdate(&sCmac, s_au8CmacMsg, psVec->u32MsgLen) != 0) ||
+                (AUTHLIB_CmacFinal(&sCmac, au8Tag) != 0) ||
+                (memcmp(au8Tag, psVec->au8Tag, 16) != 0))
+            s_i32Result = -1;
+    }
+
+    return 0;
+}
+
+static int32_t CcmNist(void *pvArg)
+{
+    const CCM_VECTOR_T *psVec;
+    AUTHLIB_CCM_T sCcm;
+    uint8_t au8Nonce[13], au8Aad[20], au8Plain[24], au8Data[24], au8Tag[16];
+    uint32_t i;
+
+    (void)pvArg;
+    s_i32Result = 0;
+
+    for (i = 0; i < sizeof(au8Plain); i++)
+    {
+        if (i < sizeof(au8Nonce))
+            au8Nonce[i] = (uint8_t)(0x10 + i);
+
+        if (i < sizeof(au8Aad))
+            au8Aad[i] = (uint8_t)i;
+
+        au8Plain[i] = (uint8_t)(0x20 + i);
+    }
+
+    for (psVec = s_asCcmVector; psVec < &s_asCcmVector[sizeof(s_asCcmVector) / sizeof(s_asCcmVector[0])]; psVec++)
+    {
+        /* Encrypt in place */
+        memcpy(au8Data, au8Plain, sizeof(au8Data));
+
+        if ((AUTHLIB_CcmInit(&sCcm, 1, s_au32CcmKey, AES_KEY_SIZE_128, au8Nonce, psVec->u32NonceLen,
+                             psVec->u32AadLen, psVec->u32DataLen, psVec->u32TagLen) != 0) ||
+                (AUTHLIB_CcmAad(&sCcm, au8Aad, psVec->u32AadLen) != 0) ||
+                (AUTHLIB_CcmUpdate(&sCcm, au8Data, au8Data, psVec->u32DataLen) != 0) ||
+                (AUTHLIB_CcmFinal(&sCcm, au8Tag) != 0) ||
+                (memcmp(au8Data, psVec->au8CipherTag, psVec->u32DataLen) != 0) ||
+                (memcmp(au8Tag, &psVec->au8CipherTag[psVec->u32DataLen], psVec->u32TagLen) != 0))
+            s_i32Result = -1;
+
+        /* Decrypt in place and verify the tag */
+        if ((AUTHLIB_CcmInit(&sCcm, 0, s_au32CcmKey, AES_KEY_SIZE_128, au8Nonce, psVec->u32NonceLen,
+                             psVec->u32AadLen, psVec->u32DataLen, psVec->u32TagLen) != 0) ||
+                (AUTHLIB_CcmAad(&sCcm, au8Aad, psVec->u32AadLen) != 0) ||
+                (AUTHLIB_CcmUpdate(&sCcm, au8Data, au8Data, psVec->u32DataLen) != 0) ||
+                (AUTHLIB_CcmFinal(&sCcm, au8Tag) != 0) ||
+                (memcmp(au8Data, au8Plain, psVec->u32DataLen) != 0))
+            s_i32Result = -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckResult(void *pvArg)
+{
+    (void)pvArg;
+
+    return s_i32Result;
+}
+
+static int32_t Cmac1K(void *pvArg)
+{
+    AUTHLIB_CMAC_T sCmac;
+    int32_t i32Ret;
+
+    (void)pvArg;
+
+    i32Ret = AUTHLIB_CmacInit(&sCmac, s_au32Key, AES_KEY_SIZE_128);
+
+    if (i32Ret == 0)
+        i32Ret = AUTHLIB_CmacUpdate(&sCmac, &s_au8Buf[1], AUTH_BUF_SIZE);
+
+    if (i32Ret == 0)
+        i32Ret = AUTHLIB_CmacFinal(&sCmac, s_au8Tag);
+
+    return i32Ret;
+}
+
+/* The same MAC fed in 7 bytes pieces */
+static int32_t CheckCmac1K(void *pvArg)
+{
+    AUTHLIB_CMAC_T sCmac;
+    uint8_t au8Tag[16];
+    uint32_t i, u32Len;
+
+    (void)pvArg;
+
+    AUTHLIB_CmacInit(&sCmac, s_au32Key, AES_KEY_SIZE_128);
+
+    for (i = 0; i < AUTH_BUF_SIZE; i += u32Len)
+    {
+        u32Len = (AUTH_BUF_SIZE - i < 7) ? (AUTH_BUF_SIZE - i) : 7;
+
+        if (AUTHLIB_CmacUpdate(&sCmac, &s_au8Buf[1 + i], u32Len) != 0)
+            return -1;
+    }
+
+    if (AUTHLIB_CmacFinal(&sCmac, au8Tag) != 0)
+        return -1;
+
+    return (memcmp(au8Tag, s_au8Tag, 16) == 0) ? 0 : -1;
+}
+
+static int32_t CcmEnc1K(void *pvArg)
+{
+    AUTHLIB_CCM_T sCcm;
+    int32_t i32Ret;
+
+    (void)pvArg;
+
+    i32Ret = AUTHLIB_CcmInit(&sCcm, 1, s_au32Key, AES_KEY_SIZE_128, s_au8Nonce, sizeof(s_au8Nonce),
+                             AUTH_AAD_LEN, AUTH_BUF_SIZE, AUTH_TAG_LEN);
+
+    if (i32Ret == 0)
+        i32Ret = AUTHLIB_CcmAad(&sCcm, s_au8Aad, AUTH_AAD_LEN);
+
+    if (i32Ret == 0)
+        i32Ret = AUTHLIB_CcmUpdate(&sCcm, &s_au8Buf[1], &s_au8Out[1], AUTH_BUF_SIZE);
+
+    if (i32Ret == 0)
+        i32Ret = AUTHLIB_CcmFinal(&sCcm, s_au8Tag);
+
+    return i32Ret;
+}
+
+/* Decrypt in place and verify the tag, the plain text must come back */
+static int32_t CheckCcm1K(void *pvArg)
+{
+    AUTHLIB_CCM_T sCcm;
+
+    (void)pvArg;
+
+    if ((AUTHLIB_CcmInit(&sCcm, 0, s_au32Key, AES_KEY_SIZE_128, s_au8Nonce, sizeof(s_au8Nonce),
+                         AUTH_AAD_LEN, AUTH_BUF_SIZE, AUTH_TAG_LEN) != 0) ||
+            (AUTHLIB_CcmAad(&sCcm, s_au8Aad, AUTH_AAD_LEN) != 0) ||
+            (AUTHLIB_CcmUpdate(&sCcm, &s_au8Out[1], &s_au8Out[1], AUTH_BUF_SIZE) != 0) ||
+            (AUTHLIB_CcmFinal(&sCcm, s_au8Tag) != 0))
+        return -1;
+
+    return (memcmp(&s_au8Out[1], &s_au8Buf[1], AUTH_BUF_SIZE) == 0) ? 0 : -1;
+}
+
+#ifndef BENCH_HOST
+/* Raw AES-CBC of the same buffer, the throughput reference of the CBC-MAC */
+static int32_t AesCbc1K(void *pvArg)
+{
+    static AES_CONTEXT_T s_sAes;
+    static const uint32_t s_au32IV[4] = {0};
+
+    (void)pvArg;
+
+    if (AES_Init(&s_sAes, 1, AES_MODE_CBC, AES_KEY_SIZE_128, s_au32Key, s_au32IV) != AES_OK)
+        return -1;
+
+    return AES_Final(CRPT, &s_sAes, &s_au8Buf[1], &s_au8Out[1], AUTH_BUF_SIZE, NULL, NULL);
+}
+#endif
+
+static const BENCH_CASE_T s_asAuthCase[] =
+{
+    {"cmac_nist",   CmacNist, CheckResult, NULL, 0,             0},
+    {"ccm_nist",    CcmNist,  CheckResult, NULL, 0,             0},
+    {"cmac_1k",     Cmac1K,   CheckCmac1K, NULL, AUTH_BUF_SIZE, 0},
+    {"ccm_enc_1k",  CcmEnc1K, CheckCcm1K,  NULL, AUTH_BUF_SIZE, 0},
+#ifndef BENCH_HOST
+    {"aes_cbc_1k",  AesCbc1K, NULL,        NULL, AUTH_BUF_SIZE, 0},
+#endif
+};
+
+/**
+ * @brief       Run the CMAC and CCM suite
+ *
+ * @param[in]   u32Calls    Number of timed calls per case
+ *
+ * @return      Number of failed cases
+ *
+ * @details     On the target the CRYPTO clock must be enabled.
+ */
+uint32_t BenchAuth_Run(uint32_t u32Calls)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_au8Buf); i++)
+        s_au8Buf[i] = (uint8_t)(i * 29 + (i >> 6));
+
+    return BENCH_RunSuite("auth", s_asAuthCase, sizeof(s_asAuthCase) / sizeof(s_asAuthCase[0]), u32Calls);
+}
@@ -0,0 +1,180 @@
+/**************************************************************************//**
+ * @file     bench_crc.c
+ * @version  V1.00
+ * @brief    Benchmark suite of the software CRC library against the CRC
+ *           controller. The software cases are checked with a bitwise
+ *           reference on the host, the hardware cases must give the same
+ *           checksum as the software library on the target.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "crclib.h"
+#include "bench_suites.h"
+
+#define CRC_BUF_SIZE        1024
+#define CRC_SEED            0xFFFFFFFFUL
+#define CRC32_ATTR          (CRC_WDATA_RVS | CRC_CHECKSUM_RVS | CRC_CHECKSUM_COM)
+
+/* Mode and attributes of one case */
+typedef struct
+{
+    uint32_t u32Mode;
+    uint32_t u32Attr;
+} CRC_CASE_ARG_T;
+
+static const CRC_CASE_ARG_T s_sArgCrc8  = {CRC_8,     0};
+static const CRC_CASE_ARG_T s_sArgCrc16 = {CRC_16,    CRC_WDATA_RVS | CRC_CHECKSUM_RVS};
+static const CRC_CASE_ARG_T s_sArgCcitt = {CRC_CCITT, 0};
+static const CRC_CASE_ARG_T s_sArgCrc32 = {CRC_32,    CRC32_ATTR};
+
+/* One byte offset, the hardware and software paths must handle an unaligned buffer */
+static uint8_t s_au8Buf[CRC_BUF_SIZE + 1];
+static uint32_t s_u32Crc;
+
+/* Bitwise reference, 8 shifts per byte */
+static uint32_t RefCrc(const CRC_CASE_ARG_T *psArg, const uint8_t *pu8Buf, uint32_t u32Len)
+{
+    uint32_t u32Bits, u32Poly, u32Mask, u32State, u32Byte, u32Sum, i;
+
+    if (psArg->u32Mode == CRC_8)
+    {
+        u32Bits = 8;
+        u32Poly = 0x07;
+    }
+    else if (psArg->u32Mode == CRC_16)
+    {
+        u32Bits = 16;
+        u32Poly = 0x8005;
+    }
+    else if (psArg->u32Mode == CRC_32)
+    {
+        u32Bits = 32;
+        u32Poly = 0x04C11DB7;
+    }
+    else
+    {
+        u32Bits = 16;
+        u32Poly = 0x1021;
+    }
+
+    u32Mask = 0xFFFFFFFFUL >> (32 - u32Bits);
+    u32State = CRC_SEED & u32Mask;
+
+    while (u32Len--)
+    {
+        u32Byte = *pu8Buf++;
+
+        if (psArg->u32Attr & CRC_WDATA_RVS)
+        {
+            for (u32Sum = 0, i = 0; i < 8; i++)
+                u32Sum |= ((u32Byte >> i) & 1UL) << (7 - i);
+
+            u32Byte = u32Sum;
+        }
+
+        if (psArg->u32Attr & CRC_WDATA_COM)
+            u32Byte ^= 0xFF;
+
+        u32State ^= u32Byte << (u32Bits - 8);
+
+        for (i = 0; i < 8; i++)
+            u32State = ((u32State >> (u32Bits - 1)) & 1UL) ? (((u32State << 1) ^ u32Poly) & u32Mask) : ((u32State << 1) & u32Mask);
+    }
+
+    u32Sum = u32State;
+
+    if (psArg->u32Attr & CRC_CHECKSUM_RVS)
+    {
+        for (u32Sum = 0, i = 0; i < u32Bits; i++)
+            u32Sum |= ((u32State >> i) & 1UL) << (u32Bits - 1 - i);
+    }
+
+    if (psArg->u32Attr & CRC_CHECKSUM_COM)
+        u32Sum ^= u32Mask;
+
+    return u32Sum;
+}
+
+static int32_t SwCrc(void *pvArg)
+{
+    const CRC_CASE_ARG_T *psArg = (const CRC_CASE_ARG_T *)pvArg;
+    CRCLIB_T sCrc;
+
+    CRCLIB_Open(&sCrc, psArg->u32Mode, psArg->u32Attr, CRC_SEED);
+    CRCLIB_Update(&sCrc, &s_au8Buf[1], CRC_BUF_SIZE);
+    s_u32Crc = CRCLIB_GetChecksum(&sCrc);
+    return 0;
+}
+
+static int32_t CheckSw(void *pvArg)
+{
+    return (s_u32Crc == RefCrc((const CRC_CASE_ARG_T *)pvArg, &s_au8Buf[1], CRC_BUF_SIZE)) ? 0 : -1;
+}
+
+#ifndef BENCH_HOST
+static int32_t HwCrc(void *pvArg)
+{
+    const CRC_CASE_ARG_T *psArg = (const CRC_CASE_ARG_T *)pvArg;
+
+    CRC_Open(psArg->u32Mode, psArg->u32Attr, CRC_SEED, CRC_CPU_WDATA_32);
+    CRC_Update(&s_au8Buf[1], CRC_BUF_SIZE);
+    s_u32Crc = CRC_GetChecksum();
+    return 0;
+}
+
+static int32_t HwCrcPdma(void *pvArg)
+{
+    const CRC_CASE_ARG_T *psArg = (const CRC_CASE_ARG_T *)pvArg;
+    int32_t i32Ret;
+
+    CRC_Open(psArg->u32Mode, psArg->u32Attr, CRC_SEED, CRC_CPU_WDATA_32);
+    i32Ret = CRC_UpdateDMA(PDMA0, &s_au8Buf[1], CRC_BUF_SIZE, NULL, NULL);
+    s_u32Crc = CRC_GetChecksum();
+    return i32Ret;
+}
+
+/* The hardware checksum must be bit-exact with the software library */
+static int32_t CheckHw(void *pvArg)
+{
+    uint32_t u32Crc = s_u32Crc;
+
+    SwCrc(pvArg);
+    return (u32Crc == s_u32Crc) ? 0 : -1;
+}
+#endif
+
+static const BENCH_CASE_T s_asCrcCase[] =
+{
+    {"crc8_sw",       SwCrc,     CheckSw, (void *)&s_sArgCrc8,  CRC_BUF_SIZE, 0},
+    {"crc16_sw",      SwCrc,     CheckSw, (void *)&s_sArgCrc16, CRC_BUF_SIZE, 0},
+    {"ccitt_sw",      SwCrc,     CheckSw, (void *)&s_sArgCcitt, CRC_BUF_SIZE, 0},
+    {"crc32_sw",      SwCrc,     CheckSw, (void *)&s_sArgCrc32, CRC_BUF_SIZE, 0},
+#ifndef BENCH_HOST
+    {"crc8_hw",       HwCrc,     CheckHw, (void *)&s_sArgCrc8,  CRC_BUF_SIZE, 0},
+    {"crc16_hw",      HwCrc,     CheckHw, (void *)&s_sArgCrc16, CRC_BUF_SIZE, 0},
+    {"ccitt_hw",      HwCrc,     CheckHw, (void *)&s_sArgCcitt, CRC_BUF_SIZE, 0},
+    {"crc32_hw",      HwCrc,     CheckHw, (void *)&s_sArgCrc32, CRC_BUF_SIZE, 0},
+    {"crc32_hw_pdma", HwCrcPdma, CheckHw, (void *)&s_sArgCrc32, CRC_BUF_SIZE, 0},
+#endif
+};
+
+/**
+ * @brief       Run the CRC suite
+ *
+ * @param[in]   u32Calls    Number of timed calls per case
+ *
+ * @return      Number of failed cases
+ *
+ * @details     On the target the CRC and PDMA0 clocks must be enabled.
+ */
+uint32_t BenchCrc_Run(uint32_t u32Calls)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_au8Buf); i++)
+        s_au8Buf[i] = (uint8_t)(i * 13 + (i >> 7));
+
+    return BENCH_RunSuite("crc", s_asCrcCase, sizeof(s_asCrcCase) / sizeof(s_asCrcCase[0]), u32Calls);
+}
@@ -0,0 +1,139 @@
+/**************************************************************************//**
+ * @file     bench_drv.c
+ * @version  V1.00
+ * @brief    Benchmark suite of StdDriver transfer functions against the CPU.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "NuMicro.h"
+#include "bench_suites.h"
+
+#define DRV_BUF_SIZE        1024
+
+#ifdef __ICCARM__
+#pragma data_alignment=4
+static uint8_t s_au8Src[DRV_BUF_SIZE];
+#pragma data_alignment=4
+static uint8_t s_au8Dst[DRV_BUF_SIZE];
+#else
+static uint8_t s_au8Src[DRV_BUF_SIZE] __attribute__((aligned(4)));
+static uint8_t s_au8Dst[DRV_BUF_SIZE] __attribute__((aligned(4)));
+#endif
+
+static uint32_t s_u32PdmaCh;
+static uint32_t s_u32Crc;
+
+static int32_t CpuMemcpy(void *pvArg)
+{
+    (void)pvArg;
+    memcpy(s_au8Dst, s_au8Src, DRV_BUF_SIZE);
+    return 0;
+}
+
+static int32_t CpuMemset(void *pvArg)
+{
+    (void)pvArg;
+    memset(s_au8Dst, 0x5A, DRV_BUF_SIZE);
+    return 0;
+}
+
+static int32_t PdmaMemcpy(void *pvArg)
+{
+    (void)pvArg;
+    return PDMA_Memcpy(PDMA0, s_u32PdmaCh, s_au8Dst, s_au8Src, DRV_BUF_SIZE);
+}
+
+static int32_t PdmaMemset(void *pvArg)
+{
+    (void)pvArg;
+    return PDMA_Memset(PDMA0, s_u32PdmaCh, s_au8Dst, 0x5A, DRV_BUF_SIZE);
+}
+
+static int32_t CheckCopy(void *pvArg)
+{
+    (void)pvArg;
+    return memcmp(s_au8Dst, s_au8Src, DRV_BUF_SIZE);
+}
+
+static int32_t CheckSet(void *pvArg)
+{
+    (void)pvArg;
+    return ((s_au8Dst[0] == 0x5A) && (s_au8Dst[DRV_BUF_SIZE - 1] == 0x5A)) ? 0 : -1;
+}
+
+/* CRC32 with 32-bit CPU writes */
+static int32_t CrcCpu32(void *pvArg)
+{
+    uint32_t i;
+    const uint32_t *pu32Src = (const uint32_t *)s_au8Src;
+
+    (void)pvArg;
+    CRC_Open(CRC_32, (CRC_WDATA_RVS | CRC_CHECKSUM_RVS | CRC_CHECKSUM_COM), 0xFFFFFFFF, CRC_CPU_WDATA_32);
+
+    for (i = 0; i < DRV_BUF_SIZE / 4; i++)
+        CRC_WRITE_DATA(pu32Src[i]);
+
+    s_u32Crc = CRC_GetChecksum();
+    return 0;
+}
+
+/* CRC32 of the same data must not change between calls */
+static int32_t CheckCrc(void *pvArg)
+{
+    uint32_t u32Crc = s_u32Crc;
+
+    CrcCpu32(pvArg);
+    return (u32Crc == s_u32Crc) ? 0 : -1;
+}
+
+/* FMC hardware CRC32 of one flash page */
+static int32_t FmcChkSum(void *pvArg)
+{
+    (void)pvArg;
+    return (FMC_GetChkSum(FMC_APROM_BASE, FMC_FLASH_PAGE_SIZE) == 0xFFFFFFFF) ? -1 : 0;
+}
+
+static const BENCH_CASE_T s_asDrvCase[] =
+{
+    {"cpu_memcpy",    CpuMemcpy,  CheckCopy, NULL, DRV_BUF_SIZE,        0},
+    {"pdma_memcpy",   PdmaMemcpy, CheckCopy, NULL, DRV_BUF_SIZE,        0},
+    {"cpu_memset",    CpuMemset,  CheckSet,  NULL, DRV_BUF_SIZE,        0},
+    {"pdma_memset",   PdmaMemset, CheckSet,  NULL, DRV_BUF_SIZE,        0},
+    {"crc32_cpu",     CrcCpu32,   CheckCrc,  NULL, DRV_BUF_SIZE,        0},
+    {"fmc_chksum",    FmcChkSum,  NULL,      NULL, FMC_FLASH_PAGE_SIZE, 0},
+};
+
+/**
+ * @brief       Run the StdDriver suite
+ *
+ * @param[in]   u32Calls    Number of timed calls per case
+ *
+ * @return      Number of failed cases
+ *
+ * @details     PDMA0, CRC and ISP clocks must be enabled. FMC must be opened.
+ */
+uint32_t BenchDrv_Run(uint32_t u32Calls)
+{
+    uint32_t i, u32Fail;
+    int32_t i32Ch;
+
+    for (i = 0; i < DRV_BUF_SIZE; i++)
+        s_au8Src[i] = (uint8_t)(i * 7 + 1);
+
+    i32Ch = PDMA_RequestChannel(PDMA0, 0);
+
+    if (i32Ch < 0)
+        return sizeof(s_asDrvCase) / sizeof(s_asDrvCase[0]);
+
+    s_u32PdmaCh = (uint32_t)i32Ch;
+
+    /* Always use PDMA, the CPU cases are measured on their own */
+    PDMA_SetMemThreshold(0);
+    u32Fail = BENCH_RunSuite("drv", s_asDrvCase, sizeof(s_asDrvCase) / sizeof(s_asDrvCase[0]), u32Calls);
+    PDMA_SetMemThreshold(PDMA_MEM_CPU_THRESHOLD);
+    PDMA_ReleaseChannel(PDMA0, s_u32PdmaCh);
+
+    return u32Fail;
+}
@@ -0,0 +1,690 @@
+/**************************************************************************//**
+ * @file     bench_dsp.c
+ * @version  V1.00
+ * @brief    Benchmark suite of the CMSIS-DSP kernels in this tree. Every case
+ *           checks its result, so the suite also catches regressions when it
+ *           is built on the host.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include "arm_math.h"
+#include "bench_suites.h"
+
+#define DSP_BLOCK_SIZE      256
+#define DSP_WINDOW_SIZE     16
+#define DSP_FIR_TAPS        32
+#define DSP_DECIMATE_M      4
+#define DSP_BIQUAD_STAGES   2
+
+static q7_t s_aq7Src[DSP_BLOCK_SIZE], s_aq7Dst[DSP_BLOCK_SIZE];
+static q15_t s_aq15Src[DSP_BLOCK_SIZE], s_aq15Dst[DSP_BLOCK_SIZE];
+static q31_t s_aq31Src[DSP_BLOCK_SIZE], s_aq31Dst[DSP_BLOCK_SIZE];
+static float32_t s_af32Src[DSP_BLOCK_SIZE], s_af32Dst[DSP_BLOCK_SIZE];
+
+static arm_sort_instance_q7 s_sSortQ7Quick, s_sSortQ7Heap, s_sSortQ7Insertion, s_sSortQ7Radix;
+static arm_sort_instance_q15 s_sSortQ15Quick, s_sSortQ15Heap, s_sSortQ15Insertion, s_sSortQ15Radix;
+static arm_sort_instance_q31 s_sSortQ31Quick, s_sSortQ31Heap;
+static arm_sort_instance_f32 s_sSortF32Quick, s_sSortF32Heap;
+/* Radix sort working copy of the q15 source, and the f32 reference of the sort checks */
+static q15_t s_aq15SortWork[DSP_BLOCK_SIZE];
+static float32_t s_af32SortRef[DSP_BLOCK_SIZE], s_af32SortVal[DSP_BLOCK_SIZE];
+
+static q15_t s_aq15Result[4];
+static q31_t s_aq31Result[4];
+static q15_t s_aq15WinVal[2 * DSP_WINDOW_SIZE];
+static q31_t s_aq31WinVal[2 * DSP_WINDOW_SIZE];
+static uint32_t s_au32WinIdx[2 * DSP_WINDOW_SIZE];
+
+static arm_fir_instance_q15 s_sFirQ15;
+static arm_fir_instance_q31 s_sFirQ31;
+static arm_fir_decimate_instance_q15 s_sDecimateQ15;
+static arm_fir_decimate_instance_q31 s_sDecimateQ31;
+static arm_biquad_casd_df1_inst_q15 s_sBiquadQ15;
+static arm_biquad_casd_df1_inst_q31 s_sBiquadQ31;
+/* The FIR and the decimator share their state, the checks reinitialize both */
+static q15_t s_aq15Coeffs[DSP_FIR_TAPS], s_aq15FirState[DSP_FIR_TAPS + DSP_BLOCK_SIZE - 1];
+static q31_t s_aq31Coeffs[DSP_FIR_TAPS], s_aq31FirState[DSP_FIR_TAPS + DSP_BLOCK_SIZE - 1];
+static q15_t s_aq15BiquadState[4 * DSP_BIQUAD_STAGES];
+static q31_t s_aq31BiquadState[4 * DSP_BIQUAD_STAGES];
+
+/* Butterworth low pass at fs / 10 in 2.14 and 2.30, {b0, 0, b1, b2, a1, a2} and {b0, b1, b2, a1, a2} per stage */
+static const q15_t s_aq15BiquadCoeffs[6 * DSP_BIQUAD_STAGES] =
+{
+    1105, 0, 2210, 1105, 18727, -6763,
+    1105, 0, 2210, 1105, 18727, -6763,
+};
+
+static const q31_t s_aq31BiquadCoeffs[5 * DSP_BIQUAD_STAGES] =
+{
+    72429549, 144859098, 72429549, 1227265970, -443242341,
+    72429549, 144859098, 72429549, 1227265970, -443242341,
+};
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Sorting: q7/q15/q31 integer compare against f32 compare, which is a library call without FPU           */
+/*---------------------------------------------------------------------------------------------------------*/
+static int32_t SortQ7(void *pvArg)
+{
+    arm_sort_q7((const arm_sort_instance_q7 *)pvArg, s_aq7Src, s_aq7Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t SortQ15(void *pvArg)
+{
+    arm_sort_q15((const arm_sort_instance_q15 *)pvArg, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+/* The radix sort uses pSrc as working buffer, every call sorts a fresh copy of the source */
+static int32_t SortQ15Radix(void *pvArg)
+{
+    memcpy(s_aq15SortWork, s_aq15Src, sizeof(s_aq15SortWork));
+    arm_sort_q15((const arm_sort_instance_q15 *)pvArg, s_aq15SortWork, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t SortQ31(void *pvArg)
+{
+    arm_sort_q31((const arm_sort_instance_q31 *)pvArg, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t SortF32(void *pvArg)
+{
+    arm_sort_f32((const arm_sort_instance_f32 *)pvArg, s_af32Src, s_af32Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+/* The source sorted in f32 is the reference: the sorted block must match it value for value */
+static int32_t CheckSortRef(void)
+{
+    uint32_t i;
+
+    arm_sort_f32(&s_sSortF32Quick, s_af32SortRef, s_af32SortRef, DSP_BLOCK_SIZE);
+
+    for (i = 0; i < DSP_BLOCK_SIZE; i++)
+    {
+        if (s_af32SortVal[i] != s_af32SortRef[i])
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckSortQ7(void *pvArg)
+{
+    (void)pvArg;
+    arm_q7_to_float(s_aq7Src, s_af32SortRef, DSP_BLOCK_SIZE);
+    arm_q7_to_float(s_aq7Dst, s_af32SortVal, DSP_BLOCK_SIZE);
+    return CheckSortRef();
+}
+
+static int32_t CheckSortQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_q15_to_float(s_aq15Src, s_af32SortRef, DSP_BLOCK_SIZE);
+    arm_q15_to_float(s_aq15Dst, s_af32SortVal, DSP_BLOCK_SIZE);
+    return CheckSortRef();
+}
+
+/* The working copy given as pSrc no longer holds the source, as documented */
+static int32_t CheckSortQ15Radix(void *pvArg)
+{
+    if (memcmp(s_aq15SortWork, s_aq15Src, sizeof(s_aq15SortWork)) == 0)
+        return -1;
+
+    return CheckSortQ15(pvArg);
+}
+
+static int32_t CheckSortQ31(void *pvArg)
+{
+    uint32_t i;
+
+    (void)pvArg;
+
+    for (i = 1; i < DSP_BLOCK_SIZE; i++)
+    {
+        if (s_aq31Dst[i - 1] > s_aq31Dst[i])
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckSortF32(void *pvArg)
+{
+    uint32_t i;
+
+    (void)pvArg;
+
+    for (i = 1; i < DSP_BLOCK_SIZE; i++)
+    {
+        if (s_af32Dst[i - 1] > s_af32Dst[i])
+            return -1;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Statistics: block functions against the streaming ones, which must give the same result                */
+/*---------------------------------------------------------------------------------------------------------*/
+static int32_t MeanVarQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_mean_q15(s_aq15Src, DSP_BLOCK_SIZE, &s_aq15Result[0]);
+    arm_var_q15(s_aq15Src, DSP_BLOCK_SIZE, &s_aq15Result[1]);
+    return 0;
+}
+
+static int32_t RunningStatsQ15(void *pvArg)
+{
+    arm_running_stats_instance_q15 sStats;
+
+    (void)pvArg;
+    arm_running_stats_init_q15(&sStats);
+    arm_running_stats_update_q15(&sStats, s_aq15Src, DSP_BLOCK_SIZE);
+    arm_running_stats_mean_q15(&sStats, &s_aq15Result[2]);
+    arm_running_stats_var_q15(&sStats, &s_aq15Result[3]);
+    return 0;
+}
+
+static int32_t CheckStatsQ15(void *pvArg)
+{
+    (void)pvArg;
+    MeanVarQ15(NULL);
+    return ((s_aq15Result[0] == s_aq15Result[2]) && (s_aq15Result[1] == s_aq15Result[3])) ? 0 : -1;
+}
+
+static int32_t MeanVarQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_mean_q31(s_aq31Src, DSP_BLOCK_SIZE, &s_aq31Result[0]);
+    arm_var_q31(s_aq31Src, DSP_BLOCK_SIZE, &s_aq31Result[1]);
+    return 0;
+}
+
+static int32_t RunningStatsQ31(void *pvArg)
+{
+    arm_running_stats_instance_q31 sStats;
+
+    (void)pvArg;
+    arm_running_stats_init_q31(&sStats);
+    arm_running_stats_update_q31(&sStats, s_aq31Src, DSP_BLOCK_SIZE);
+    arm_running_stats_mean_q31(&sStats, &s_aq31Result[2]);
+    arm_running_stats_var_q31(&sStats, &s_aq31Result[3]);
+    return 0;
+}
+
+static int32_t CheckStatsQ31(void *pvArg)
+{
+    (void)pvArg;
+    MeanVarQ31(NULL);
+    return ((s_aq31Result[0] == s_aq31Result[2]) && (s_aq31Result[1] == s_aq31Result[3])) ? 0 : -1;
+}
+
+static int32_t SlidingMinMaxQ15(void *pvArg)
+{
+    arm_sliding_minmax_instance_q15 sWin;
+
+    (void)pvArg;
+    arm_sliding_minmax_init_q15(&sWin, DSP_WINDOW_SIZE, s_aq15WinVal, s_au32WinIdx);
+    arm_sliding_minmax_update_q15(&sWin, s_aq15Src, DSP_BLOCK_SIZE);
+    arm_sliding_minmax_get_q15(&sWin, &s_aq15Result[0], &s_aq15Result[1]);
+    return 0;
+}
+
+static int32_t CheckMinMaxQ15(void *pvArg)
+{
+    uint32_t i;
+    q15_t q15Min = s_aq15Src[DSP_BLOCK_SIZE - 1], q15Max = q15Min;
+
+    (void)pvArg;
+
+    for (i = DSP_BLOCK_SIZE - DSP_WINDOW_SIZE; i < DSP_BLOCK_SIZE; i++)
+    {
+        q15Min = (s_aq15Src[i] < q15Min) ? s_aq15Src[i] : q15Min;
+        q15Max = (s_aq15Src[i] > q15Max) ? s_aq15Src[i] : q15Max;
+    }
+
+    return ((s_aq15Result[0] == q15Min) && (s_aq15Result[1] == q15Max)) ? 0 : -1;
+}
+
+static int32_t SlidingMinMaxQ31(void *pvArg)
+{
+    arm_sliding_minmax_instance_q31 sWin;
+
+    (void)pvArg;
+    arm_sliding_minmax_init_q31(&sWin, DSP_WINDOW_SIZE, s_aq31WinVal, s_au32WinIdx);
+    arm_sliding_minmax_update_q31(&sWin, s_aq31Src, DSP_BLOCK_SIZE);
+    arm_sliding_minmax_get_q31(&sWin, &s_aq31Result[0], &s_aq31Result[1]);
+    return 0;
+}
+
+static int32_t CheckMinMaxQ31(void *pvArg)
+{
+    uint32_t i;
+    q31_t q31Min = s_aq31Src[DSP_BLOCK_SIZE - 1], q31Max = q31Min;
+
+    (void)pvArg;
+
+    for (i = DSP_BLOCK_SIZE - DSP_WINDOW_SIZE; i < DSP_BLOCK_SIZE; i++)
+    {
+        q31Min = (s_aq31Src[i] < q31Min) ? s_aq31Src[i] : q31Min;
+        q31Max = (s_aq31Src[i] > q31Max) ? s_aq31Src[i] : q31Max;
+    }
+
+    return ((s_aq31Result[0] == q31Min) && (s_aq31Result[1] == q31Max)) ? 0 : -1;
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Complex math: DSP_BLOCK_SIZE / 2 complex samples                                                       */
+/*---------------------------------------------------------------------------------------------------------*/
+static int32_t CmplxMagSquaredQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_cmplx_mag_squared_q15(s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE / 2);
+    return 0;
+}
+
+static int32_t CmplxMagSquaredQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_cmplx_mag_squared_q31(s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE / 2);
+    return 0;
+}
+
+static int32_t CmplxMagSquaredF32(void *pvArg)
+{
+    (void)pvArg;
+    arm_cmplx_mag_squared_f32(s_af32Src, s_af32Dst, DSP_BLOCK_SIZE / 2);
+    return 0;
+}
+
+static int32_t CheckMagSquaredQ15(void *pvArg)
+{
+    uint32_t i;
+    q31_t q31Re, q31Im;
+
+    (void)pvArg;
+
+    /* 1.15 x 1.15 = 2.30, shifted to 3.13 */
+    for (i = 0; i < DSP_BLOCK_SIZE / 2; i++)
+    {
+        q31Re = s_aq15Src[2 * i];
+        q31Im = s_aq15Src[2 * i + 1];
+
+        if (s_aq15Dst[i] != (q15_t)(((q63_t)(q31Re * q31Re) + (q31Im * q31Im)) >> 17))
+            return -1;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Filtering: per_sample is per tap and sample. The fast variants keep a 32-bit accumulator; the q15 FIR  */
+/*  and biquad coefficients leave enough headroom for it to give the same result as the q63 one.           */
+/*---------------------------------------------------------------------------------------------------------*/
+static int32_t FirQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_q15(&s_sFirQ15, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t FirFastQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_fast_q15(&s_sFirQ15, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t FirQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_q31(&s_sFirQ31, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t FirFastQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_fast_q31(&s_sFirQ31, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t BiquadQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_biquad_cascade_df1_q15(&s_sBiquadQ15, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t BiquadFastQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_biquad_cascade_df1_fast_q15(&s_sBiquadQ15, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t BiquadQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_biquad_cascade_df1_q31(&s_sBiquadQ31, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t BiquadFastQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_biquad_cascade_df1_fast_q31(&s_sBiquadQ31, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t DecimateQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_decimate_q15(&s_sDecimateQ15, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t DecimateFastQ15(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_decimate_fast_q15(&s_sDecimateQ15, s_aq15Src, s_aq15Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t DecimateQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_decimate_q31(&s_sDecimateQ31, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static int32_t DecimateFastQ31(void *pvArg)
+{
+    (void)pvArg;
+    arm_fir_decimate_fast_q31(&s_sDecimateQ31, s_aq31Src, s_aq31Dst, DSP_BLOCK_SIZE);
+    return 0;
+}
+
+static void InitFilters(void)
+{
+    arm_fir_init_q15(&s_sFirQ15, DSP_FIR_TAPS, s_aq15Coeffs, s_aq15FirState, DSP_BLOCK_SIZE);
+    arm_fir_init_q31(&s_sFirQ31, DSP_FIR_TAPS, s_aq31Coeffs, s_aq31FirState, DSP_BLOCK_SIZE);
+    arm_biquad_cascade_df1_init_q15(&s_sBiquadQ15, DSP_BIQUAD_STAGES, s_aq15BiquadCoeffs, s_aq15BiquadState, 1);
+    arm_biquad_cascade_df1_init_q31(&s_sBiquadQ31, DSP_BIQUAD_STAGES, s_aq31BiquadCoeffs, s_aq31BiquadState, 1);
+    arm_fir_decimate_init_q15(&s_sDecimateQ15, DSP_FIR_TAPS, DSP_DECIMATE_M, s_aq15Coeffs, s_aq15FirState, DSP_BLOCK_SIZE);
+    arm_fir_decimate_init_q31(&s_sDecimateQ31, DSP_FIR_TAPS, DSP_DECIMATE_M, s_aq31Coeffs, s_aq31FirState, DSP_BLOCK_SIZE);
+}
+
+/* Output n of the FIR from zero history, the coefficients are stored time reversed */
+static q63_t FirRefQ15(uint32_t n)
+{
+    uint32_t k;
+    q63_t q63Acc = 0;
+
+    for (k = 0; (k < DSP_FIR_TAPS) && (k <= n); k++)
+        q63Acc += (q31_t)s_aq15Coeffs[DSP_FIR_TAPS - 1 - k] * s_aq15Src[n - k];
+
+    return q63Acc;
+}
+
+static q63_t FirRefQ31(uint32_t n, uint32_t u32Fast)
+{
+    uint32_t k;
+    q63_t q63Acc = 0, q63Prod;
+
+    for (k = 0; (k < DSP_FIR_TAPS) && (k <= n); k++)
+    {
+        q63Prod = (q63_t)s_aq31Coeffs[DSP_FIR_TAPS - 1 - k] * s_aq31Src[n - k];
+        /* The fast variant keeps the rounded upper 32 bits of every product */
+        q63Acc += u32Fast ? (q63_t)(q31_t)((q63Prod + 0x80000000LL) >> 32) : q63Prod;
+    }
+
+    return q63Acc;
+}
+
+/* pvArg selects the decimator, whose output m is the FIR output at input m * DSP_DECIMATE_M */
+static int32_t CheckFirQ15(void *pvArg)
+{
+    uint32_t i, u32Step = (pvArg != NULL) ? DSP_DECIMATE_M : 1;
+
+    /* Rerun once from zero history: the timed calls continue the same stream */
+    InitFilters();
+
+    if (pvArg == NULL)
+        FirQ15(NULL);
+    else
+        DecimateQ15(NULL);
+
+    for (i = 0; i < DSP_BLOCK_SIZE / u32Step; i++)
+    {
+        if (s_aq15Dst[i] != (q15_t)__SSAT((q31_t)(FirRefQ15(i * u32Step) >> 15), 16))
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckFirFastQ15(void *pvArg)
+{
+    uint32_t i, u32Step = (pvArg != NULL) ? DSP_DECIMATE_M : 1;
+
+    InitFilters();
+
+    if (pvArg == NULL)
+        FirFastQ15(NULL);
+    else
+        DecimateFastQ15(NULL);
+
+    for (i = 0; i < DSP_BLOCK_SIZE / u32Step; i++)
+    {
+        if (s_aq15Dst[i] != (q15_t)__SSAT((q31_t)(FirRefQ15(i * u32Step) >> 15), 16))
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckFirQ31(void *pvArg)
+{
+    uint32_t i, u32Step = (pvArg != NULL) ? DSP_DECIMATE_M : 1;
+
+    InitFilters();
+
+    if (pvArg == NULL)
+        FirQ31(NULL);
+    else
+        DecimateQ31(NULL);
+
+    for (i = 0; i < DSP_BLOCK_SIZE / u32Step; i++)
+    {
+        if (s_aq31Dst[i] != (q31_t)(FirRefQ31(i * u32Step, 0) >> 31))
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckFirFastQ31(void *pvArg)
+{
+    uint32_t i, u32Step = (pvArg != NULL) ? DSP_DECIMATE_M : 1;
+
+    InitFilters();
+
+    if (pvArg == NULL)
+        FirFastQ31(NULL);
+    else
+        DecimateFastQ31(NULL);
+
+    for (i = 0; i < DSP_BLOCK_SIZE / u32Step; i++)
+    {
+        if (s_aq31Dst[i] != (q31_t)((uint32_t)FirRefQ31(i * u32Step, 1) << 1))
+            return -1;
+    }
+
+    return 0;
+}
+
+/* Direct form I with postShift 1 against a straight q63 implementation, pvArg selects the fast q15 variant */
+static int32_t CheckBiquadQ15(void *pvArg)
+{
+    uint32_t i, u32Stage;
+    q31_t aq31X[DSP_BIQUAD_STAGES + 1][3] = {{0}}, aq31Y;
+    const q15_t *pq15B;
+    q63_t q63Acc;
+
+    InitFilters();
+
+    if (pvArg == NULL)
+        BiquadQ15(NULL);
+    else
+        BiquadFastQ15(NULL);
+
+    for (i = 0; i < DSP_BLOCK_SIZE; i++)
+    {
+        aq31Y = s_aq15Src[i];
+
+        for (u32Stage = 0; u32Stage < DSP_BIQUAD_STAGES; u32Stage++)
+        {
+            pq15B = &s_aq15BiquadCoeffs[6 * u32Stage];
+            aq31X[u32Stage][2] = aq31X[u32Stage][1];
+            aq31X[u32Stage][1] = aq31X[u32Stage][0];
+            aq31X[u32Stage][0] = aq31Y;
+            q63Acc = (q63_t)pq15B[0] * aq31X[u32Stage][0] + (q63_t)pq15B[2] * aq31X[u32Stage][1] + (q63_t)pq15B[3] * aq31X[u32Stage][2] +
+                     (q63_t)pq15B[4] * aq31X[u32Stage + 1][0] + (q63_t)pq15B[5] * aq31X[u32Stage + 1][1];
+            aq31Y = __SSAT((q31_t)(q63Acc >> 14), 16);
+        }
+
+        aq31X[DSP_BIQUAD_STAGES][1] = aq31X[DSP_BIQUAD_STAGES][0];
+        aq31X[DSP_BIQUAD_STAGES][0] = aq31Y;
+
+        if (s_aq15Dst[i] != (q15_t)aq31Y)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckBiquadQ31(void *pvArg)
+{
+    uint32_t i, u32Stage;
+    q31_t aq31X[DSP_BIQUAD_STAGES + 1][3] = {{0}}, aq31Y;
+    const q31_t *pq31B;
+    q63_t q63Acc;
+
+    (void)pvArg;
+    InitFilters();
+    BiquadQ31(NULL);
+
+    for (i = 0; i < DSP_BLOCK_SIZE; i++)
+    {
+        aq31Y = s_aq31Src[i];
+
+        for (u32Stage = 0; u32Stage < DSP_BIQUAD_STAGES; u32Stage++)
+        {
+            pq31B = &s_aq31BiquadCoeffs[5 * u32Stage];
+            aq31X[u32Stage][2] = aq31X[u32Stage][1];
+            aq31X[u32Stage][1] = aq31X[u32Stage][0];
+            aq31X[u32Stage][0] = aq31Y;
+            q63Acc = (q63_t)pq31B[0] * aq31X[u32Stage][0] + (q63_t)pq31B[1] * aq31X[u32Stage][1] + (q63_t)pq31B[2] * aq31X[u32Stage][2] +
+                     (q63_t)pq31B[3] * aq31X[u32Stage + 1][0] + (q63_t)pq31B[4] * aq31X[u32Stage + 1][1];
+            aq31Y = (q31_t)(q63Acc >> 30);
+        }
+
+        aq31X[DSP_BIQUAD_STAGES][1] = aq31X[DSP_BIQUAD_STAGES][0];
+        aq31X[DSP_BIQUAD_STAGES][0] = aq31Y;
+
+        if (s_aq31Dst[i] != aq31Y)
+            return -1;
+    }
+
+    return 0;
+}
+
+static const BENCH_CASE_T s_asDspCase[] =
+{
+    {"sort_q7_quick",        SortQ7,             CheckSortQ7,        &s_sSortQ7Quick,      DSP_BLOCK_SIZE * sizeof(q7_t),      DSP_BLOCK_SIZE},
+    {"sort_q7_heap",         SortQ7,             CheckSortQ7,        &s_sSortQ7Heap,       DSP_BLOCK_SIZE * sizeof(q7_t),      DSP_BLOCK_SIZE},
+    {"sort_q7_insertion",    SortQ7,             CheckSortQ7,        &s_sSortQ7Insertion,  DSP_BLOCK_SIZE * sizeof(q7_t),      DSP_BLOCK_SIZE},
+    {"sort_q7_radix",        SortQ7,             CheckSortQ7,        &s_sSortQ7Radix,      DSP_BLOCK_SIZE * sizeof(q7_t),      DSP_BLOCK_SIZE},
+    {"sort_q15_quick",       SortQ15,            CheckSortQ15,       &s_sSortQ15Quick,     DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"sort_q15_heap",        SortQ15,            CheckSortQ15,       &s_sSortQ15Heap,      DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"sort_q15_insertion",   SortQ15,            CheckSortQ15,       &s_sSortQ15Insertion, DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"sort_q15_radix",       SortQ15Radix,       CheckSortQ15Radix,  &s_sSortQ15Radix,     DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"sort_q31_quick",       SortQ31,            CheckSortQ31,       &s_sSortQ31Quick,     DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE},
+    {"sort_q31_heap",        SortQ31,            CheckSortQ31,       &s_sSortQ31Heap,      DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE},
+    {"sort_f32_quick",       SortF32,            CheckSortF32,       &s_sSortF32Quick,     DSP_BLOCK_SIZE * sizeof(float32_t), DSP_BLOCK_SIZE},
+    {"sort_f32_heap",        SortF32,            CheckSortF32,       &s_sSortF32Heap,      DSP_BLOCK_SIZE * sizeof(float32_t), DSP_BLOCK_SIZE},
+    {"mean_var_q15",         MeanVarQ15,         NULL,               NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"running_stats_q15",    RunningStatsQ15,    CheckStatsQ15,      NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"mean_var_q31",         MeanVarQ31,         NULL,               NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE},
+    {"running_stats_q31",    RunningStatsQ31,    CheckStatsQ31,      NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE},
+    {"sliding_minmax_q15",   SlidingMinMaxQ15,   CheckMinMaxQ15,     NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE},
+    {"sliding_minmax_q31",   SlidingMinMaxQ31,   CheckMinMaxQ31,     NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE},
+    {"cmplx_mag_sq_q15",     CmplxMagSquaredQ15, CheckMagSquaredQ15, NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE / 2},
+    {"cmplx_mag_sq_q31",     CmplxMagSquaredQ31, NULL,               NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE / 2},
+    {"cmplx_mag_sq_f32",     CmplxMagSquaredF32, NULL,               NULL,                 DSP_BLOCK_SIZE * sizeof(float32_t), DSP_BLOCK_SIZE / 2},
+    {"fir_q15",              FirQ15,             CheckFirQ15,        NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE * DSP_FIR_TAPS},
+    {"fir_fast_q15",         FirFastQ15,         CheckFirFastQ15,    NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE * DSP_FIR_TAPS},
+    {"fir_q31",              FirQ31,             CheckFirQ31,        NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE * DSP_FIR_TAPS},
+    {"fir_fast_q31",         FirFastQ31,         CheckFirFastQ31,    NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE * DSP_FIR_TAPS},
+    {"biquad_df1_q15",       BiquadQ15,          CheckBiquadQ15,     NULL,                 DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE * DSP_BIQUAD_STAGES * 5},
+    {"biquad_df1_fast_q15",  BiquadFastQ15,      CheckBiquadQ15,     &s_sBiquadQ15,        DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE * DSP_BIQUAD_STAGES * 5},
+    {"biquad_df1_q31",       BiquadQ31,          CheckBiquadQ31,     NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE * DSP_BIQUAD_STAGES * 5},
+    {"biquad_df1_fast_q31",  BiquadFastQ31,      NULL,               NULL,                 DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE * DSP_BIQUAD_STAGES * 5},
+    {"fir_decimate_q15",     DecimateQ15,        CheckFirQ15,        &s_sDecimateQ15,      DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE / DSP_DECIMATE_M * DSP_FIR_TAPS},
+    {"fir_decimate_fast_q15", DecimateFastQ15,   CheckFirFastQ15,    &s_sDecimateQ15,      DSP_BLOCK_SIZE * sizeof(q15_t),     DSP_BLOCK_SIZE / DSP_DECIMATE_M * DSP_FIR_TAPS},
+    {"fir_decimate_q31",     DecimateQ31,        CheckFirQ31,        &s_sDecimateQ31,      DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE / DSP_DECIMATE_M * DSP_FIR_TAPS},
+    {"fir_decimate_fast_q31", DecimateFastQ31,   CheckFirFastQ31,    &s_sDecimateQ31,      DSP_BLOCK_SIZE * sizeof(q31_t),     DSP_BLOCK_SIZE / DSP_DECIMATE_M * DSP_FIR_TAPS},
+};
+
+/**
+ * @brief       Run the CMSIS-DSP suite
+ *
+ * @param[in]   u32Calls    Number of timed calls per case
+ *
+ * @return      Number of failed cases
+ */
+uint32_t BenchDsp_Run(uint32_t u32Calls)
+{
+    uint32_t i, u32Seed = 0x12345678;
+
+    /* Same pseudo-random values in all formats */
+    for (i = 0; i < DSP_BLOCK_SIZE; i++)
+    {
+        u32Seed = u32Seed * 1664525UL + 1013904223UL;
+        s_aq31Src[i] = (q31_t)u32Seed;
+        s_aq15Src[i] = (q15_t)(u32Seed >> 16);
+        s_aq7Src[i] = (q7_t)(u32Seed >> 24);
+        s_af32Src[i] = (float32_t)s_aq31Src[i] / 2147483648.0f;
+    }
+
+    /* Scaled down by the tap count, so the fast FIR never wraps its 32-bit accumulator */
+    for (i = 0; i < DSP_FIR_TAPS; i++)
+    {
+        s_aq15Coeffs[i] = s_aq15Src[i] / DSP_FIR_TAPS;
+        s_aq31Coeffs[i] = s_aq31Src[i] / DSP_FIR_TAPS;
+    }
+
+    InitFilters();
+
+    arm_sort_init_q7(&s_sSortQ7Quick, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+    arm_sort_init_q7(&s_sSortQ7Heap, ARM_SORT_HEAP, ARM_SORT_ASCENDING);
+    arm_sort_init_q7(&s_sSortQ7Insertion, ARM_SORT_INSERTION, ARM_SORT_ASCENDING);
+    arm_sort_init_q7(&s_sSortQ7Radix, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+    arm_sort_init_q15(&s_sSortQ15Quick, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+    arm_sort_init_q15(&s_sSortQ15Heap, ARM_SORT_HEAP, ARM_SORT_ASCENDING);
+    arm_sort_init_q15(&s_sSortQ15Insertion, ARM_SORT_INSERTION, ARM_SORT_ASCENDING);
+    arm_sort_init_q15(&s_sSortQ15Radix, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+    arm_sort_init_q31(&s_sSortQ31Quick, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+    arm_sort_init_q31(&s_sSortQ31Heap, ARM_SORT_HEAP, ARM_SORT_ASCENDING);
+    arm_sort_init_f32(&s_sSortF32Quick, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+    arm_sort_init_f32(&s_sSortF32Heap, ARM_SORT_HEAP, ARM_SORT_ASCENDING);
+
+    return BENCH_RunSuite("dsp", s_asDspCase, sizeof(s_asDspCase) / sizeof(s_asDspCase[0]), u32Calls);
+}
@@ -0,0 +1,691 @@
+/**************************************************************************//**
+ * @file     bench_fft.c
+ * @version  V1.00
+ * @brief    Benchmark suite of the Q15/Q31 FFT: the CMSIS-DSP
+ *           arm_cfft_q15/q31 against the constant plan path for the
+ *           Cortex-M23, and the in-place real FFT with its fused squared
+ *           magnitude against the two pass rfft + arm_cmplx_mag_squared.
+ *           Every transform checks its signal to noise ratio against a
+ *           double precision FFT, and the ratios are printed after the
+ *           suite. The Goertzel and sliding DFT detectors then run on 1,
+ *           4 and 16 bins, and the bin count where they cost as much as
+ *           the fused real FFT power spectrum is printed.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <math.h>
+#include "arm_math.h"
+#include "bench_fft_tables.h"
+#include "bench_suites.h"
+
+#define FFT_MAX_LEN         256
+#define TONE_LEN            256     /* Frame of the detectors, the length of the real FFT they compete with */
+#define TONE_MAX_BINS       16
+#define CROSSOVER_ROUNDS    32      /* Interleaved timing rounds of the detector crossovers */
+
+/* Transform of one case, the result of its check in 0.1 dB */
+typedef struct
+{
+    const void *pvInst;         /* arm_cfft_instance_qxx, arm_cfft_plan_qxx or arm_rfft_plan_qxx */
+    uint32_t u32Len;            /* complex samples of a CFFT, real samples of a RFFT */
+    uint32_t u32Plan;           /* 1: pvInst is a Cortex-M23 plan */
+    int32_t i32MinSnr;          /* dB, 0 if the case checks no SNR */
+    int32_t i32Snr;
+} FFT_CASE_ARG_T;
+
+static FFT_CASE_ARG_T s_asFftArg[] =
+{
+    {&arm_cfft_sR_q15_len128,   128, 0, 45,  0},
+    {&arm_cfft_plan_q15_len128, 128, 1, 45,  0},
+    {&arm_cfft_sR_q15_len256,   256, 0, 45,  0},
+    {&arm_cfft_plan_q15_len256, 256, 1, 45,  0},
+    {&arm_cfft_sR_q31_len128,   128, 0, 135, 0},
+    {&arm_cfft_plan_q31_len128, 128, 1, 135, 0},
+    {&arm_cfft_sR_q31_len256,   256, 0, 135, 0},
+    {&arm_cfft_plan_q31_len256, 256, 1, 135, 0},
+    {&arm_rfft_plan_q15_len256, 256, 1, 45,  0},
+    {&arm_rfft_plan_q15_len256, 256, 1, 0,   0},
+    {&arm_rfft_plan_q15_len256, 256, 1, 0,   0},
+    {&arm_rfft_plan_q31_len256, 256, 1, 135, 0},
+    {&arm_rfft_plan_q31_len256, 256, 1, 0,   0},
+    {&arm_rfft_plan_q31_len256, 256, 1, 0,   0},
+};
+
+static q31_t s_aq31Sig[2 * FFT_MAX_LEN];
+static q15_t s_aq15Buf[2 * FFT_MAX_LEN];
+static q31_t s_aq31Buf[2 * FFT_MAX_LEN];
+static double s_adRef[2 * FFT_MAX_LEN];
+static q15_t s_aq15Mag[FFT_MAX_LEN / 2 + 1];
+static q31_t s_aq31Mag[FFT_MAX_LEN / 2 + 1];
+
+/* Bins of the detectors, the signal has a tone on the first four */
+static const uint16_t s_au16ToneBin[TONE_MAX_BINS] = {8, 21, 40, 77, 3, 12, 30, 50, 64, 90, 100, 110, 115, 120, 125, 127};
+
+/* Detector of one case, the result of its check in 0.1 dB */
+typedef struct
+{
+    void *pvInst;               /* arm_goertzel_instance_qxx or arm_sdft_instance_qxx */
+    uint32_t u32Bins;
+    int32_t i32MinSnr;          /* dB */
+    int32_t i32Snr;
+} TONE_CASE_ARG_T;
+
+static arm_goertzel_instance_q15 s_asGoertzelQ15[3];
+static arm_goertzel_instance_q31 s_asGoertzelQ31[3];
+static arm_sdft_instance_q15 s_asSdftQ15[3];
+static arm_sdft_instance_q31 s_asSdftQ31[3];
+
+static TONE_CASE_ARG_T s_asToneArg[] =
+{
+    {&s_asGoertzelQ15[0], 1,  30,  0},
+    {&s_asGoertzelQ15[1], 4,  30,  0},
+    {&s_asGoertzelQ15[2], 16, 30,  0},
+    {&s_asSdftQ15[0],     1,  30,  0},
+    {&s_asSdftQ15[1],     4,  30,  0},
+    {&s_asSdftQ15[2],     16, 30,  0},
+    {&s_asGoertzelQ31[0], 1,  90,  0},
+    {&s_asGoertzelQ31[1], 4,  90,  0},
+    {&s_asGoertzelQ31[2], 16, 90,  0},
+    {&s_asSdftQ31[0],     1,  120, 0},
+    {&s_asSdftQ31[1],     4,  120, 0},
+    {&s_asSdftQ31[2],     16, 120, 0},
+};
+
+/* The instances of one type share their state and window buffers, a check initializes its instance again */
+static q31_t s_aq31GoertzelState[2 * TONE_MAX_BINS];
+static q31_t s_aq31SdftStateQ15[2 * TONE_MAX_BINS];
+static q63_t s_aq63SdftStateQ31[2 * TONE_MAX_BINS];
+static q15_t s_aq15SdftDelay[TONE_LEN];
+static q31_t s_aq31SdftDelay[TONE_LEN];
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  The timed calls transform the previous result again, the kernels take the same time on any data        */
+/*---------------------------------------------------------------------------------------------------------*/
+static int32_t CfftQ15(void *pvArg)
+{
+    const FFT_CASE_ARG_T *psArg = (const FFT_CASE_ARG_T *)pvArg;
+
+    if (psArg->u32Plan)
+        arm_cfft_m23_q15((const arm_cfft_plan_q15 *)psArg->pvInst, s_aq15Buf, 0, 1);
+    else
+        arm_cfft_q15((const arm_cfft_instance_q15 *)psArg->pvInst, s_aq15Buf, 0, 1);
+
+    return 0;
+}
+
+static int32_t CfftQ31(void *pvArg)
+{
+    const FFT_CASE_ARG_T *psArg = (const FFT_CASE_ARG_T *)pvArg;
+
+    if (psArg->u32Plan)
+        arm_cfft_m23_q31((const arm_cfft_plan_q31 *)psArg->pvInst, s_aq31Buf, 0, 1);
+    else
+        arm_cfft_q31((const arm_cfft_instance_q31 *)psArg->pvInst, s_aq31Buf, 0, 1);
+
+    return 0;
+}
+
+/* The RFFT works in place on the real samples */
+static int32_t RfftQ15(void *pvArg)
+{
+    arm_rfft_m23_q15((const arm_rfft_plan_q15 *)((const FFT_CASE_ARG_T *)pvArg)->pvInst, s_aq15Buf, 0);
+
+    return 0;
+}
+
+static int32_t RfftQ31(void *pvArg)
+{
+    arm_rfft_m23_q31((const arm_rfft_plan_q31 *)((const FFT_CASE_ARG_T *)pvArg)->pvInst, s_aq31Buf, 0);
+
+    return 0;
+}
+
+/* Power spectrum in two passes: packed RFFT, then the squared magnitude of bins 1 to N/2 - 1 and of DC and Nyquist */
+static int32_t RfftMag2PassQ15(void *pvArg)
+{
+    uint32_t u32Half = ((const FFT_CASE_ARG_T *)pvArg)->u32Len / 2;
+
+    RfftQ15(pvArg);
+    arm_cmplx_mag_squared_q15(&s_aq15Buf[2], &s_aq15Mag[1], u32Half - 1);
+    s_aq15Mag[0] = (q15_t)((s_aq15Buf[0] * s_aq15Buf[0]) >> 17);
+    s_aq15Mag[u32Half] = (q15_t)((s_aq15Buf[1] * s_aq15Buf[1]) >> 17);
+
+    return 0;
+}
+
+static int32_t RfftMag2PassQ31(void *pvArg)
+{
+    uint32_t u32Half = ((const FFT_CASE_ARG_T *)pvArg)->u32Len / 2;
+
+    RfftQ31(pvArg);
+    arm_cmplx_mag_squared_q31(&s_aq31Buf[2], &s_aq31Mag[1], u32Half - 1);
+    s_aq31Mag[0] = (q31_t)(((q63_t)s_aq31Buf[0] * s_aq31Buf[0]) >> 33);
+    s_aq31Mag[u32Half] = (q31_t)(((q63_t)s_aq31Buf[1] * s_aq31Buf[1]) >> 33);
+
+    return 0;
+}
+
+/* Power spectrum with the squared magnitude fused into the split stage of the RFFT */
+static int32_t RfftMagQ15(void *pvArg)
+{
+    arm_rfft_m23_mag_squared_q15((const arm_rfft_plan_q15 *)((const FFT_CASE_ARG_T *)pvArg)->pvInst, s_aq15Buf, s_aq15Mag);
+
+    return 0;
+}
+
+static int32_t RfftMagQ31(void *pvArg)
+{
+    arm_rfft_m23_mag_squared_q31((const arm_rfft_plan_q31 *)((const FFT_CASE_ARG_T *)pvArg)->pvInst, s_aq31Buf, s_aq31Mag);
+
+    return 0;
+}
+
+/* Radix-2 FFT of s_adRef in double precision, scaled down by the length like the fixed-point ones */
+static void RefFft(uint32_t u32Len)
+{
+    uint32_t i, j, k, m;
+    double dWr, dWi, dTr, dTi;
+
+    for (i = 1, j = 0; i < u32Len; i++)
+    {
+        for (k = u32Len >> 1; j & k; k >>= 1)
+            j ^= k;
+
+        j |= k;
+
+        if (i < j)
+        {
+            dTr = s_adRef[2 * i];
+            dTi = s_adRef[2 * i + 1];
+            s_adRef[2 * i] = s_adRef[2 * j];
+            s_adRef[2 * i + 1] = s_adRef[2 * j + 1];
+            s_adRef[2 * j] = dTr;
+            s_adRef[2 * j + 1] = dTi;
+        }
+    }
+
+    for (m = 2; m <= u32Len; m <<= 1)
+    {
+        for (k = 0; k < m / 2; k++)
+        {
+            dWr = cos(6.283185307179586 * k / m);
+            dWi = -sin(6.283185307179586 * k / m);
+
+            for (i = k; i < u32Len; i += m)
+            {
+                j = i + m / 2;
+                dTr = s_adRef[2 * j] * dWr - s_adRef[2 * j + 1] * dWi;
+                dTi = s_adRef[2 * j] * dWi + s_adRef[2 * j + 1] * dWr;
+                s_adRef[2 * j] = s_adRef[2 * i] - dTr;
+                s_adRef[2 * j + 1] = s_adRef[2 * i + 1] - dTi;
+                s_adRef[2 * i] += dTr;
+                s_adRef[2 * i + 1] += dTi;
+            }
+        }
+    }
+
+    for (i = 0; i < 2 * u32Len; i++)
+        s_adRef[i] /= u32Len;
+}
+
+/* Signal to noise ratio against s_adRef in 0.1 dB, the case fails below its minimum */
+static int32_t CheckSnr(FFT_CASE_ARG_T *psArg, double dSig, double dErr)
+{
+    psArg->i32Snr = (dErr > 0.0) ? (int32_t)(100.0 * log10(dSig / dErr)) : 9999;
+
+    return (psArg->i32Snr >= 10 * psArg->i32MinSnr) ? 0 : -1;
+}
+
+static int32_t CheckCfftQ15(void *pvArg)
+{
+    FFT_CASE_ARG_T *psArg = (FFT_CASE_ARG_T *)pvArg;
+    uint32_t i;
+    double dSig = 0.0, dErr = 0.0, dOut;
+
+    for (i = 0; i < 2 * psArg->u32Len; i++)
+    {
+        s_aq15Buf[i] = (q15_t)(s_aq31Sig[i] >> 16);
+        s_adRef[i] = s_aq15Buf[i] / 32768.0;
+    }
+
+    RefFft(psArg->u32Len);
+    CfftQ15(pvArg);
+
+    for (i = 0; i < 2 * psArg->u32Len; i++)
+    {
+        dOut = s_aq15Buf[i] / 32768.0;
+        dSig += s_adRef[i] * s_adRef[i];
+        dErr += (dOut - s_adRef[i]) * (dOut - s_adRef[i]);
+    }
+
+    return CheckSnr(psArg, dSig, dErr);
+}
+
+static int32_t CheckCfftQ31(void *pvArg)
+{
+    FFT_CASE_ARG_T *psArg = (FFT_CASE_ARG_T *)pvArg;
+    uint32_t i;
+    double dSig = 0.0, dErr = 0.0, dOut;
+
+    for (i = 0; i < 2 * psArg->u32Len; i++)
+    {
+        s_aq31Buf[i] = s_aq31Sig[i];
+        s_adRef[i] = s_aq31Buf[i] / 2147483648.0;
+    }
+
+    RefFft(psArg->u32Len);
+    CfftQ31(pvArg);
+
+    for (i = 0; i < 2 * psArg->u32Len; i++)
+    {
+        dOut = s_aq31Buf[i] / 2147483648.0;
+        dSig += s_adRef[i] * s_adRef[i];
+        dErr += (dOut - s_adRef[i]) * (dOut - s_adRef[i]);
+    }
+
+    return CheckSnr(psArg, dSig, dErr);
+}
+
+/* Packed spectrum of the real samples in s_aq15Buf against s_adRef: DC and Nyquist share the first entry */
+static void RfftErr(uint32_t u32Len, uint32_t u32Bin, double dOutR, double dOutI, double *pdSig, double *pdErr)
+{
+    double dRefR = s_adRef[2 * u32Bin], dRefI = s_adRef[2 * u32Bin + 1];
+
+    if (u32Bin == 0)
+    {
+        dRefI = s_adRef[u32Len];
+    }
+
+    *pdSig += dRefR * dRefR + dRefI * dRefI;
+    *pdErr += (dOutR - dRefR) * (dOutR - dRefR) + (dOutI - dRefI) * (dOutI - dRefI);
+}
+
+static int32_t CheckRfftQ15(void *pvArg)
+{
+    FFT_CASE_ARG_T *psArg = (FFT_CASE_ARG_T *)pvArg;
+    uint32_t i;
+    double dSig = 0.0, dErr = 0.0;
+
+    for (i = 0; i < psArg->u32Len; i++)
+    {
+        s_aq15Buf[i] = (q15_t)(s_aq31Sig[i] >> 16);
+        s_adRef[2 * i] = s_aq15Buf[i] / 32768.0;
+        s_adRef[2 * i + 1] = 0.0;
+    }
+
+    RefFft(psArg->u32Len);
+    RfftQ15(pvArg);
+
+    for (i = 0; i < psArg->u32Len / 2; i++)
+        RfftErr(psArg->u32Len, i, s_aq15Buf[2 * i] / 32768.0, s_aq15Buf[2 * i + 1] / 32768.0, &dSig, &dErr);
+
+    return CheckSnr(psArg, dSig, dErr);
+}
+
+static int32_t CheckRfftQ31(void *pvArg)
+{
+    FFT_CASE_ARG_T *psArg = (FFT_CASE_ARG_T *)pvArg;
+    uint32_t i;
+    double dSig = 0.0, dErr = 0.0;
+
+    for (i = 0; i < psArg->u32Len; i++)
+    {
+        s_aq31Buf[i] = s_aq31Sig[i];
+        s_adRef[2 * i] = s_aq31Buf[i] / 2147483648.0;
+        s_adRef[2 * i + 1] = 0.0;
+    }
+
+    RefFft(psArg->u32Len);
+    RfftQ31(pvArg);
+
+    for (i = 0; i < psArg->u32Len / 2; i++)
+        RfftErr(psArg->u32Len, i, s_aq31Buf[2 * i] / 2147483648.0, s_aq31Buf[2 * i + 1] / 2147483648.0, &dSig, &dErr);
+
+    return CheckSnr(psArg, dSig, dErr);
+}
+
+/* Squared magnitudes of one power spectrum path against those of the packed spectrum, 2 LSB apart in Q31 */
+static int32_t CheckMagQ15(FFT_CASE_ARG_T *psArg, BENCH_FUNC_T pfnRun)
+{
+    uint32_t i, u32Half = psArg->u32Len / 2;
+    int32_t i32Re, i32Im;
+
+    for (i = 0; i < psArg->u32Len; i++)
+        s_aq15Buf[i] = (q15_t)(s_aq31Sig[i] >> 16);
+
+    pfnRun(psArg);
+
+    for (i = 0; i < psArg->u32Len; i++)
+        s_aq15Buf[i] = (q15_t)(s_aq31Sig[i] >> 16);
+
+    RfftQ15(psArg);
+
+    for (i = 0; i <= u32Half; i++)
+    {
+        i32Re = (i == u32Half) ? s_aq15Buf[1] : s_aq15Buf[2 * i];
+        i32Im = ((i == 0) || (i == u32Half)) ? 0 : s_aq15Buf[2 * i + 1];
+
+        if (s_aq15Mag[i] != (q15_t)(((uint32_t)(i32Re * i32Re) + (uint32_t)(i32Im * i32Im)) >> 17))
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckMagQ31(FFT_CASE_ARG_T *psArg, BENCH_FUNC_T pfnRun)
+{
+    uint32_t i, u32Half = psArg->u32Len / 2;
+    q63_t i64Re, i64Im, i64Mag;
+
+    for (i = 0; i < psArg->u32Len; i++)
+        s_aq31Buf[i] = s_aq31Sig[i];
+
+    pfnRun(psArg);
+
+    for (i = 0; i < psArg->u32Len; i++)
+        s_aq31Buf[i] = s_aq31Sig[i];
+
+    RfftQ31(psArg);
+
+    for (i = 0; i <= u32Half; i++)
+    {
+        i64Re = (i == u32Half) ? s_aq31Buf[1] : s_aq31Buf[2 * i];
+        i64Im = ((i == 0) || (i == u32Half)) ? 0 : s_aq31Buf[2 * i + 1];
+        i64Mag = ((i64Re * i64Re) >> 33) + ((i64Im * i64Im) >> 33);
+
+        if ((s_aq31Mag[i] > i64Mag + 2) || (s_aq31Mag[i] < i64Mag - 2))
+            return -1;
+    }
+
+    return 0;
+}
+
+static int32_t CheckRfftMag2PassQ15(void *pvArg)
+{
+    return CheckMagQ15((FFT_CASE_ARG_T *)pvArg, RfftMag2PassQ15);
+}
+
+static int32_t CheckRfftMagQ15(void *pvArg)
+{
+    return CheckMagQ15((FFT_CASE_ARG_T *)pvArg, RfftMagQ15);
+}
+
+static int32_t CheckRfftMag2PassQ31(void *pvArg)
+{
+    return CheckMagQ31((FFT_CASE_ARG_T *)pvArg, RfftMag2PassQ31);
+}
+
+static int32_t CheckRfftMagQ31(void *pvArg)
+{
+    return CheckMagQ31((FFT_CASE_ARG_T *)pvArg, RfftMagQ31);
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  The detectors take one frame of the tone signal in s_aq15Buf/s_aq31Buf per call, with the power of      */
+/*  the tracked bins at the end of it                                                                      */
+/*---------------------------------------------------------------------------------------------------------*/
+static int32_t GoertzelQ15(void *pvArg)
+{
+    return (arm_goertzel_q15((arm_goertzel_instance_q15 *)((TONE_CASE_ARG_T *)pvArg)->pvInst, s_aq15Buf, s_aq15Mag, TONE_LEN) == 1) ? 0 : -1;
+}
+
+static int32_t GoertzelQ31(void *pvArg)
+{
+    return (arm_goertzel_q31((arm_goertzel_instance_q31 *)((TONE_CASE_ARG_T *)pvArg)->pvInst, s_aq31Buf, s_aq31Mag, TONE_LEN) == 1) ? 0 : -1;
+}
+
+static int32_t SdftQ15(void *pvArg)
+{
+    arm_sdft_instance_q15 *psInst = (arm_sdft_instance_q15 *)((TONE_CASE_ARG_T *)pvArg)->pvInst;
+
+    arm_sdft_q15(psInst, s_aq15Buf, TONE_LEN);
+    arm_sdft_power_q15(psInst, s_aq15Mag);
+
+    return 0;
+}
+
+static int32_t SdftQ31(void *pvArg)
+{
+    arm_sdft_instance_q31 *psInst = (arm_sdft_instance_q31 *)((TONE_CASE_ARG_T *)pvArg)->pvInst;
+
+    arm_sdft_q31(psInst, s_aq31Buf, TONE_LEN);
+    arm_sdft_power_q31(psInst, s_aq31Mag);
+
+    return 0;
+}
+
+static void ToneInit(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < 3; i++)
+    {
+        arm_goertzel_init_q15(&s_asGoertzelQ15[i], (uint16_t)s_asToneArg[i].u32Bins, TONE_LEN, goertzelCoef_q15_256, s_aq31GoertzelState);
+        arm_sdft_init_q15(&s_asSdftQ15[i], (uint16_t)s_asToneArg[3 + i].u32Bins, TONE_LEN, s_au16ToneBin,
+                          arm_cfft_plan_q15_len256.pTwiddle, arm_cfft_plan_q15_len256.twidStride, s_aq15SdftDelay, s_aq31SdftStateQ15);
+        arm_goertzel_init_q31(&s_asGoertzelQ31[i], (uint16_t)s_asToneArg[6 + i].u32Bins, TONE_LEN, goertzelCoef_q31_256, s_aq31GoertzelState);
+        arm_sdft_init_q31(&s_asSdftQ31[i], (uint16_t)s_asToneArg[9 + i].u32Bins, TONE_LEN, s_au16ToneBin,
+                          arm_cfft_plan_q31_len256.pTwiddle, arm_cfft_plan_q31_len256.twidStride, s_aq31SdftDelay, s_aq63SdftStateQ31);
+    }
+}
+
+/* Power of the tracked bins against a double precision DFT of the frame, scaled down by the frame length */
+static int32_t CheckTone(TONE_CASE_ARG_T *psArg, const void *pvSig, const void *pvPower, uint32_t u32Q31)
+{
+    uint32_t i, n;
+    double dX, dRe, dIm, dRef, dOut, dSig = 0.0, dErr = 0.0;
+
+    for (i = 0; i < psArg->u32Bins; i++)
+    {
+        dRe = 0.0;
+        dIm = 0.0;
+
+        for (n = 0; n < TONE_LEN; n++)
+        {
+            dX = u32Q31 ? ((const q31_t *)pvSig)[n] / 2147483648.0 : ((const q15_t *)pvSig)[n] / 32768.0;
+            dRe += dX * cos(2.0 * PI * s_au16ToneBin[i] * n / TONE_LEN);
+            dIm -= dX * sin(2.0 * PI * s_au16ToneBin[i] * n / TONE_LEN);
+        }
+
+        dRef = (dRe * dRe + dIm * dIm) / ((double)TONE_LEN * TONE_LEN);
+        dOut = u32Q31 ? ((const q31_t *)pvPower)[i] / 536870912.0 : ((const q15_t *)pvPower)[i] / 8192.0;
+        dSig += dRef * dRef;
+        dErr += (dOut - dRef) * (dOut - dRef);
+    }
+
+    psArg->i32Snr = (dErr > 0.0) ? (int32_t)(100.0 * log10(dSig / dErr)) : 9999;
+
+    return (psArg->i32Snr >= 10 * psArg->i32MinSnr) ? 0 : -1;
+}
+
+static int32_t CheckGoertzelQ15(void *pvArg)
+{
+    TONE_CASE_ARG_T *psArg = (TONE_CASE_ARG_T *)pvArg;
+
+    arm_goertzel_init_q15((arm_goertzel_instance_q15 *)psArg->pvInst, (uint16_t)psArg->u32Bins, TONE_LEN, goertzelCoef_q15_256, s_aq31GoertzelState);
+
+    if (GoertzelQ15(pvArg) != 0)
+        return -1;
+
+    return CheckTone(psArg, s_aq15Buf, s_aq15Mag, 0);
+}
+
+static int32_t CheckGoertzelQ31(void *pvArg)
+{
+    TONE_CASE_ARG_T *psArg = (TONE_CASE_ARG_T *)pvArg;
+
+    arm_goertzel_init_q31((arm_goertzel_instance_q31 *)psArg->pvInst, (uint16_t)psArg->u32Bins, TONE_LEN, goertzelCoef_q31_256, s_aq31GoertzelState);
+
+    if (GoertzelQ31(pvArg) != 0)
+        return -1;
+
+    return CheckTone(psArg, s_aq31Buf, s_aq31Mag, 1);
+}
+
+static int32_t CheckSdftQ15(void *pvArg)
+{
+    TONE_CASE_ARG_T *psArg = (TONE_CASE_ARG_T *)pvArg;
+
+    arm_sdft_init_q15((arm_sdft_instance_q15 *)psArg->pvInst, (uint16_t)psArg->u32Bins, TONE_LEN, s_au16ToneBin,
+                      arm_cfft_plan_q15_len256.pTwiddle, arm_cfft_plan_q15_len256.twidStride, s_aq15SdftDelay, s_aq31SdftStateQ15);
+    SdftQ15(pvArg);
+
+    return CheckTone(psArg, s_aq15Buf, s_aq15Mag, 0);
+}
+
+static int32_t CheckSdftQ31(void *pvArg)
+{
+    TONE_CASE_ARG_T *psArg = (TONE_CASE_ARG_T *)pvArg;
+
+    arm_sdft_init_q31((arm_sdft_instance_q31 *)psArg->pvInst, (uint16_t)psArg->u32Bins, TONE_LEN, s_au16ToneBin,
+                      arm_cfft_plan_q31_len256.pTwiddle, arm_cfft_plan_q31_len256.twidStride, s_aq31SdftDelay, s_aq63SdftStateQ31);
+    SdftQ31(pvArg);
+
+    return CheckTone(psArg, s_aq31Buf, s_aq31Mag, 1);
+}
+
+static const BENCH_CASE_T s_asFftCase[] =
+{
+    {"cfft_q15_128",         CfftQ15,            CheckCfftQ15,       &s_asFftArg[0],       128 * 2 * sizeof(q15_t),            128},
+    {"cfft_m23_q15_128",     CfftQ15,            CheckCfftQ15,       &s_asFftArg[1],       128 * 2 * sizeof(q15_t),            128},
+    {"cfft_q15_256",         CfftQ15,            CheckCfftQ15,       &s_asFftArg[2],       256 * 2 * sizeof(q15_t),            256},
+    {"cfft_m23_q15_256",     CfftQ15,            CheckCfftQ15,       &s_asFftArg[3],       256 * 2 * sizeof(q15_t),            256},
+    {"cfft_q31_128",         CfftQ31,            CheckCfftQ31,       &s_asFftArg[4],       128 * 2 * sizeof(q31_t),            128},
+    {"cfft_m23_q31_128",     CfftQ31,            CheckCfftQ31,       &s_asFftArg[5],       128 * 2 * sizeof(q31_t),            128},
+    {"cfft_q31_256",         CfftQ31,            CheckCfftQ31,       &s_asFftArg[6],       256 * 2 * sizeof(q31_t),            256},
+    {"cfft_m23_q31_256",     CfftQ31,            CheckCfftQ31,       &s_asFftArg[7],       256 * 2 * sizeof(q31_t),            256},
+    {"rfft_m23_q15_256",     RfftQ15,            CheckRfftQ15,       &s_asFftArg[8],       256 * sizeof(q15_t),                256},
+    {"rfft_mag_2pass_q15_256", RfftMag2PassQ15,  CheckRfftMag2PassQ15, &s_asFftArg[9],     256 * sizeof(q15_t),                256},
+    {"rfft_mag_m23_q15_256", RfftMagQ15,         CheckRfftMagQ15,    &s_asFftArg[10],      256 * sizeof(q15_t),                256},
+    {"rfft_m23_q31_256",     RfftQ31,            CheckRfftQ31,       &s_asFftArg[11],      256 * sizeof(q31_t),                256},
+    {"rfft_mag_2pass_q31_256", RfftMag2PassQ31,  CheckRfftMag2PassQ31, &s_asFftArg[12],    256 * sizeof(q31_t),                256},
+    {"rfft_mag_m23_q31_256", RfftMagQ31,         CheckRfftMagQ31,    &s_asFftArg[13],      256 * sizeof(q31_t),                256},
+};
+
+static const BENCH_CASE_T s_asToneCase[] =
+{
+    {"goertzel_q15_256_1",   GoertzelQ15,        CheckGoertzelQ15,   &s_asToneArg[0],      TONE_LEN * sizeof(q15_t),           TONE_LEN},
+    {"goertzel_q15_256_4",   GoertzelQ15,        CheckGoertzelQ15,   &s_asToneArg[1],      TONE_LEN * sizeof(q15_t),           TONE_LEN},
+    {"goertzel_q15_256_16",  GoertzelQ15,        CheckGoertzelQ15,   &s_asToneArg[2],      TONE_LEN * sizeof(q15_t),           TONE_LEN},
+    {"sdft_q15_256_1",       SdftQ15,            CheckSdftQ15,       &s_asToneArg[3],      TONE_LEN * sizeof(q15_t),           TONE_LEN},
+    {"sdft_q15_256_4",       SdftQ15,            CheckSdftQ15,       &s_asToneArg[4],      TONE_LEN * sizeof(q15_t),           TONE_LEN},
+    {"sdft_q15_256_16",      SdftQ15,            CheckSdftQ15,       &s_asToneArg[5],      TONE_LEN * sizeof(q15_t),           TONE_LEN},
+    {"goertzel_q31_256_1",   GoertzelQ31,        CheckGoertzelQ31,   &s_asToneArg[6],      TONE_LEN * sizeof(q31_t),           TONE_LEN},
+    {"goertzel_q31_256_4",   GoertzelQ31,        CheckGoertzelQ31,   &s_asToneArg[7],      TONE_LEN * sizeof(q31_t),           TONE_LEN},
+    {"goertzel_q31_256_16",  GoertzelQ31,        CheckGoertzelQ31,   &s_asToneArg[8],      TONE_LEN * sizeof(q31_t),           TONE_LEN},
+    {"sdft_q31_256_1",       SdftQ31,            CheckSdftQ31,       &s_asToneArg[9],      TONE_LEN * sizeof(q31_t),           TONE_LEN},
+    {"sdft_q31_256_4",       SdftQ31,            CheckSdftQ31,       &s_asToneArg[10],     TONE_LEN * sizeof(q31_t),           TONE_LEN},
+    {"sdft_q31_256_16",      SdftQ31,            CheckSdftQ31,       &s_asToneArg[11],     TONE_LEN * sizeof(q31_t),           TONE_LEN},
+};
+
+/* Fastest of u32Calls calls without the result check */
+static uint32_t FastestCall(const BENCH_CASE_T *psCase, uint32_t u32Calls)
+{
+    BENCH_CASE_T sCase = *psCase;
+    BENCH_RESULT_T sResult;
+
+    sCase.pfnCheck = NULL;
+
+    if (BENCH_Run(&sCase, u32Calls, &sResult) != 0)
+        return 0;
+
+    return sResult.u32Min;
+}
+
+/*
+ * Bins where a detector costs as much as the power spectrum, from its cost on 1 and 16 bins.
+ * The three cases are timed in interleaved rounds and the fastest call of each case is kept:
+ * host scheduling only adds time, and a change of load or clock hits all three cases alike.
+ * The real FFT works in place on the input of the detectors, whose cost does not depend on the data.
+ */
+static void PrintCrossover(const char *pcName, const BENCH_CASE_T *psBin1, const BENCH_CASE_T *psBin16,
+                           const BENCH_CASE_T *psFft, uint32_t u32Calls)
+{
+    uint32_t u32Bin1 = UINT32_MAX, u32Bin16 = UINT32_MAX, u32Fft = UINT32_MAX, u32Ticks, u32Bins = 0, i;
+    int64_t i64Num;
+
+    for (i = 0; i < CROSSOVER_ROUNDS; i++)
+    {
+        u32Ticks = FastestCall(psBin1, u32Calls);
+        u32Bin1 = (u32Ticks < u32Bin1) ? u32Ticks : u32Bin1;
+        u32Ticks = FastestCall(psBin16, u32Calls);
+        u32Bin16 = (u32Ticks < u32Bin16) ? u32Ticks : u32Bin16;
+        u32Ticks = FastestCall(psFft, u32Calls);
+        u32Fft = (u32Ticks < u32Fft) ? u32Ticks : u32Fft;
+    }
+
+    /* 1 + (TONE_MAX_BINS - 1) * (fft - bin1) / (bin16 - bin1), in tenths and rounded */
+    i64Num = 10 * ((int64_t)u32Bin16 - u32Bin1) + 10 * (TONE_MAX_BINS - 1) * ((int64_t)u32Fft - u32Bin1);
+
+    if ((u32Bin16 > u32Bin1) && (i64Num > 0))
+        u32Bins = (uint32_t)((i64Num + (u32Bin16 - u32Bin1) / 2) / (u32Bin16 - u32Bin1));
+
+    printf("# crossover_bins,fft,%s,%u.%u\n", pcName, (unsigned)(u32Bins / 10), (unsigned)(u32Bins % 10));
+}
+
+/**
+ * @brief       Run the FFT suite
+ *
+ * @param[in]   u32Calls    Number of timed calls per case
+ *
+ * @return      Number of failed cases
+ *
+ * @details     The signal to noise ratio of every transform and detector
+ *              follows the suite as a comment line of the CSV output. The power
+ *              spectrum cases check exact magnitudes and print no ratio. The
+ *              detector crossovers are printed against rfft_mag_m23_qxx_256,
+ *              in tenths of a bin, from CROSSOVER_ROUNDS more timing rounds.
+ */
+uint32_t BenchFft_Run(uint32_t u32Calls)
+{
+    uint32_t i, b, u32Fail, u32Seed = 0x2468ACE1;
+    double dX;
+
+    /* Noise at half scale, the complex magnitude stays below 1 */
+    for (i = 0; i < 2 * FFT_MAX_LEN; i++)
+    {
+        u32Seed = u32Seed * 1664525UL + 1013904223UL;
+        s_aq31Sig[i] = (q31_t)u32Seed >> 1;
+    }
+
+    u32Fail = BENCH_RunSuite("fft", s_asFftCase, sizeof(s_asFftCase) / sizeof(s_asFftCase[0]), u32Calls);
+
+    /* Tones of amplitude 0.2 on four bins over noise at 1/32 scale */
+    for (i = 0; i < TONE_LEN; i++)
+    {
+        dX = s_aq31Sig[i] / (16.0 * 2147483648.0);
+
+        for (b = 0; b < 4; b++)
+            dX += 0.2 * cos(2.0 * PI * s_au16ToneBin[b] * i / TONE_LEN + b);
+
+        s_aq31Buf[i] = (q31_t)floor(dX * 2147483648.0 + 0.5);
+        s_aq15Buf[i] = (q15_t)(s_aq31Buf[i] >> 16);
+    }
+
+    ToneInit();
+    u32Fail += BENCH_RunSuite("fft", s_asToneCase, sizeof(s_asToneCase) / sizeof(s_asToneCase[0]), u32Calls);
+
+    for (i = 0; i < sizeof(s_asFftCase) / sizeof(s_asFftCase[0]); i++)
+    {
+        if (s_asFftArg[i].i32MinSnr == 0)
+            continue;
+
+        printf("# snr_db,fft,%s,%d.%d\n", s_asFftCase[i].pcName,
+               (int)(s_asFftArg[i].i32Snr / 10), (int)(s_asFftArg[i].i32Snr % 10));
+    }
+
+    for (i = 0; i < sizeof(s_asToneCase) / sizeof(s_asToneCase[0]); i++)
+    {
+        printf("# snr_db,fft,%s,%d.%d\n", s_asToneCase[i].pcName,
+               (int)(s_asToneArg[i].i32Snr / 10), (int)(s_asToneArg[i].i32Snr % 10));
+    }
+
+    PrintCrossover("goertzel_q15_256", &s_asToneCase[0], &s_asToneCase[2], &s_asFftCase[10], u32Calls);
+    PrintCrossover("sdft_q15_256", &s_asToneCase[3], &s_asToneCase[5], &s_asFftCase[10], u32Calls);
+    PrintCrossover("goertzel_q31_256", &s_asToneCase[6], &s_asToneCase[8], &s_asFftCase[13], u32Calls);
+    PrintCrossover("sdft_q31_256", &s_asToneCase[9], &s_asToneCase[11], &s_asFftCase[13], u32Calls);
+
+    return u32Fail;
+}
@@ -0,0 +1,414 @@
+/**************************************************************************//**
+ * @file     bench_fft_tables.c
+ * @version  V1.00
+ * @brief    FFT and window tables listed in fft_tables.cfg, 7360 bytes of flash:
+ *             twiddleCoef_128_q15                     384 bytes
+ *             twiddleCoef_256_q15                     768 bytes
+ *             twiddleCoef_128_q31                     768 bytes
+ *             twiddleCoef_256_q31                    1536 bytes
+ *             armBitRevIndexTable_fixed_128           224 bytes
+ *             armBitRevIndexTable_fixed_256           480 bytes
+ *             armBitRevPairsM23_128                   224 bytes
+ *             armBitRevPairsM23_256                   480 bytes
+ *             twiddleCoefM23_q15                      768 bytes
+ *             twiddleCoefM23_q31                     1536 bytes
+ *             goertzelCoef_q15_256                     64 bytes
+ *             goertzelCoef_q31_256                    128 bytes
+ *           Generated by Library/CMSIS/DSP/Scripts/gen_fft_tables.py, do not edit.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include "bench_fft_tables.h"
+
+const q15_t twiddleCoef_128_q15[192] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FD9, (q15_t)0x0648, (q15_t)0x7F62, (q15_t)0x0C8C, (q15_t)0x7E9D, (q15_t)0x12C8,
+    (q15_t)0x7D8A, (q15_t)0x18F9, (q15_t)0x7C2A, (q15_t)0x1F1A, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7885, (q15_t)0x2B1F,
+    (q15_t)0x7642, (q15_t)0x30FC, (q15_t)0x73B6, (q15_t)0x36BA, (q15_t)0x70E3, (q15_t)0x3C57, (q15_t)0x6DCA, (q15_t)0x41CE,
+    (q15_t)0x6A6E, (q15_t)0x471D, (q15_t)0x66D0, (q15_t)0x4C40, (q15_t)0x62F2, (q15_t)0x5134, (q15_t)0x5ED7, (q15_t)0x55F6,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x55F6, (q15_t)0x5ED7, (q15_t)0x5134, (q15_t)0x62F2, (q15_t)0x4C40, (q15_t)0x66D0,
+    (q15_t)0x471D, (q15_t)0x6A6E, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x3C57, (q15_t)0x70E3, (q15_t)0x36BA, (q15_t)0x73B6,
+    (q15_t)0x30FC, (q15_t)0x7642, (q15_t)0x2B1F, (q15_t)0x7885, (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x1F1A, (q15_t)0x7C2A,
+    (q15_t)0x18F9, (q15_t)0x7D8A, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x0C8C, (q15_t)0x7F62, (q15_t)0x0648, (q15_t)0x7FD9,
+    (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xF9B8, (q15_t)0x7FD9, (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0xED38, (q15_t)0x7E9D,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0xE0E6, (q15_t)0x7C2A, (q15_t)0xDAD8, (q15_t)0x7A7D, (q15_t)0xD4E1, (q15_t)0x7885,
+    (q15_t)0xCF04, (q15_t)0x7642, (q15_t)0xC946, (q15_t)0x73B6, (q15_t)0xC3A9, (q15_t)0x70E3, (q15_t)0xBE32, (q15_t)0x6DCA,
+    (q15_t)0xB8E3, (q15_t)0x6A6E, (q15_t)0xB3C0, (q15_t)0x66D0, (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0xAA0A, (q15_t)0x5ED7,
+    (q15_t)0xA57E, (q15_t)0x5A82, (q15_t)0xA129, (q15_t)0x55F6, (q15_t)0x9D0E, (q15_t)0x5134, (q15_t)0x9930, (q15_t)0x4C40,
+    (q15_t)0x9592, (q15_t)0x471D, (q15_t)0x9236, (q15_t)0x41CE, (q15_t)0x8F1D, (q15_t)0x3C57, (q15_t)0x8C4A, (q15_t)0x36BA,
+    (q15_t)0x89BE, (q15_t)0x30FC, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x8583, (q15_t)0x2528, (q15_t)0x83D6, (q15_t)0x1F1A,
+    (q15_t)0x8276, (q15_t)0x18F9, (q15_t)0x8163, (q15_t)0x12C8, (q15_t)0x809E, (q15_t)0x0C8C, (q15_t)0x8027, (q15_t)0x0648,
+    (q15_t)0x8000, (q15_t)0x0000, (q15_t)0x8027, (q15_t)0xF9B8, (q15_t)0x809E, (q15_t)0xF374, (q15_t)0x8163, (q15_t)0xED38,
+    (q15_t)0x8276, (q15_t)0xE707, (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x8583, (q15_t)0xDAD8, (q15_t)0x877B, (q15_t)0xD4E1,
+    (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x8C4A, (q15_t)0xC946, (q15_t)0x8F1D, (q15_t)0xC3A9, (q15_t)0x9236, (q15_t)0xBE32,
+    (q15_t)0x9592, (q15_t)0xB8E3, (q15_t)0x9930, (q15_t)0xB3C0, (q15_t)0x9D0E, (q15_t)0xAECC, (q15_t)0xA129, (q15_t)0xAA0A,
+    (q15_t)0xA57E, (q15_t)0xA57E, (q15_t)0xAA0A, (q15_t)0xA129, (q15_t)0xAECC, (q15_t)0x9D0E, (q15_t)0xB3C0, (q15_t)0x9930,
+    (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0xBE32, (q15_t)0x9236, (q15_t)0xC3A9, (q15_t)0x8F1D, (q15_t)0xC946, (q15_t)0x8C4A,
+    (q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xD4E1, (q15_t)0x877B, (q15_t)0xDAD8, (q15_t)0x8583, (q15_t)0xE0E6, (q15_t)0x83D6,
+    (q15_t)0xE707, (q15_t)0x8276, (q15_t)0xED38, (q15_t)0x8163, (q15_t)0xF374, (q15_t)0x809E, (q15_t)0xF9B8, (q15_t)0x8027
+};
+
+const q15_t twiddleCoef_256_q15[384] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FD9, (q15_t)0x0648, (q15_t)0x7FA7, (q15_t)0x096B,
+    (q15_t)0x7F62, (q15_t)0x0C8C, (q15_t)0x7F0A, (q15_t)0x0FAB, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7E1E, (q15_t)0x15E2,
+    (q15_t)0x7D8A, (q15_t)0x18F9, (q15_t)0x7CE4, (q15_t)0x1C0C, (q15_t)0x7C2A, (q15_t)0x1F1A, (q15_t)0x7B5D, (q15_t)0x2224,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x798A, (q15_t)0x2827, (q15_t)0x7885, (q15_t)0x2B1F, (q15_t)0x776C, (q15_t)0x2E11,
+    (q15_t)0x7642, (q15_t)0x30FC, (q15_t)0x7505, (q15_t)0x33DF, (q15_t)0x73B6, (q15_t)0x36BA, (q15_t)0x7255, (q15_t)0x398D,
+    (q15_t)0x70E3, (q15_t)0x3C57, (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x6C24, (q15_t)0x447B,
+    (q15_t)0x6A6E, (q15_t)0x471D, (q15_t)0x68A7, (q15_t)0x49B4, (q15_t)0x66D0, (q15_t)0x4C40, (q15_t)0x64E9, (q15_t)0x4EC0,
+    (q15_t)0x62F2, (q15_t)0x5134, (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x5ED7, (q15_t)0x55F6, (q15_t)0x5CB4, (q15_t)0x5843,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x5843, (q15_t)0x5CB4, (q15_t)0x55F6, (q15_t)0x5ED7, (q15_t)0x539B, (q15_t)0x60EC,
+    (q15_t)0x5134, (q15_t)0x62F2, (q15_t)0x4EC0, (q15_t)0x64E9, (q15_t)0x4C40, (q15_t)0x66D0, (q15_t)0x49B4, (q15_t)0x68A7,
+    (q15_t)0x471D, (q15_t)0x6A6E, (q15_t)0x447B, (q15_t)0x6C24, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x3F17, (q15_t)0x6F5F,
+    (q15_t)0x3C57, (q15_t)0x70E3, (q15_t)0x398D, (q15_t)0x7255, (q15_t)0x36BA, (q15_t)0x73B6, (q15_t)0x33DF, (q15_t)0x7505,
+    (q15_t)0x30FC, (q15_t)0x7642, (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0x2B1F, (q15_t)0x7885, (q15_t)0x2827, (q15_t)0x798A,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x2224, (q15_t)0x7B5D, (q15_t)0x1F1A, (q15_t)0x7C2A, (q15_t)0x1C0C, (q15_t)0x7CE4,
+    (q15_t)0x18F9, (q15_t)0x7D8A, (q15_t)0x15E2, (q15_t)0x7E1E, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x0FAB, (q15_t)0x7F0A,
+    (q15_t)0x0C8C, (q15_t)0x7F62, (q15_t)0x096B, (q15_t)0x7FA7, (q15_t)0x0648, (q15_t)0x7FD9, (q15_t)0x0324, (q15_t)0x7FF6,
+    (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xFCDC, (q15_t)0x7FF6, (q15_t)0xF9B8, (q15_t)0x7FD9, (q15_t)0xF695, (q15_t)0x7FA7,
+    (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0xF055, (q15_t)0x7F0A, (q15_t)0xED38, (q15_t)0x7E9D, (q15_t)0xEA1E, (q15_t)0x7E1E,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0xE3F4, (q15_t)0x7CE4, (q15_t)0xE0E6, (q15_t)0x7C2A, (q15_t)0xDDDC, (q15_t)0x7B5D,
+    (q15_t)0xDAD8, (q15_t)0x7A7D, (q15_t)0xD7D9, (q15_t)0x798A, (q15_t)0xD4E1, (q15_t)0x7885, (q15_t)0xD1EF, (q15_t)0x776C,
+    (q15_t)0xCF04, (q15_t)0x7642, (q15_t)0xCC21, (q15_t)0x7505, (q15_t)0xC946, (q15_t)0x73B6, (q15_t)0xC673, (q15_t)0x7255,
+    (q15_t)0xC3A9, (q15_t)0x70E3, (q15_t)0xC0E9, (q15_t)0x6F5F, (q15_t)0xBE32, (q15_t)0x6DCA, (q15_t)0xBB85, (q15_t)0x6C24,
+    (q15_t)0xB8E3, (q15_t)0x6A6E, (q15_t)0xB64C, (q15_t)0x68A7, (q15_t)0xB3C0, (q15_t)0x66D0, (q15_t)0xB140, (q15_t)0x64E9,
+    (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0xAC65, (q15_t)0x60EC, (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0xA7BD, (q15_t)0x5CB4,
+    (q15_t)0xA57E, (q15_t)0x5A82, (q15_t)0xA34C, (q15_t)0x5843, (q15_t)0xA129, (q15_t)0x55F6, (q15_t)0x9F14, (q15_t)0x539B,
+    (q15_t)0x9D0E, (q15_t)0x5134, (q15_t)0x9B17, (q15_t)0x4EC0, (q15_t)0x9930, (q15_t)0x4C40, (q15_t)0x9759, (q15_t)0x49B4,
+    (q15_t)0x9592, (q15_t)0x471D, (q15_t)0x93DC, (q15_t)0x447B, (q15_t)0x9236, (q15_t)0x41CE, (q15_t)0x90A1, (q15_t)0x3F17,
+    (q15_t)0x8F1D, (q15_t)0x3C57, (q15_t)0x8DAB, (q15_t)0x398D, (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0x8AFB, (q15_t)0x33DF,
+    (q15_t)0x89BE, (q15_t)0x30FC, (q15_t)0x8894, (q15_t)0x2E11, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x8676, (q15_t)0x2827,
+    (q15_t)0x8583, (q15_t)0x2528, (q15_t)0x84A3, (q15_t)0x2224, (q15_t)0x83D6, (q15_t)0x1F1A, (q15_t)0x831C, (q15_t)0x1C0C,
+    (q15_t)0x8276, (q15_t)0x18F9, (q15_t)0x81E2, (q15_t)0x15E2, (q15_t)0x8163, (q15_t)0x12C8, (q15_t)0x80F6, (q15_t)0x0FAB,
+    (q15_t)0x809E, (q15_t)0x0C8C, (q15_t)0x8059, (q15_t)0x096B, (q15_t)0x8027, (q15_t)0x0648, (q15_t)0x800A, (q15_t)0x0324,
+    (q15_t)0x8000, (q15_t)0x0000, (q15_t)0x800A, (q15_t)0xFCDC, (q15_t)0x8027, (q15_t)0xF9B8, (q15_t)0x8059, (q15_t)0xF695,
+    (q15_t)0x809E, (q15_t)0xF374, (q15_t)0x80F6, (q15_t)0xF055, (q15_t)0x8163, (q15_t)0xED38, (q15_t)0x81E2, (q15_t)0xEA1E,
+    (q15_t)0x8276, (q15_t)0xE707, (q15_t)0x831C, (q15_t)0xE3F4, (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x84A3, (q15_t)0xDDDC,
+    (q15_t)0x8583, (q15_t)0xDAD8, (q15_t)0x8676, (q15_t)0xD7D9, (q15_t)0x877B, (q15_t)0xD4E1, (q15_t)0x8894, (q15_t)0xD1EF,
+    (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x8AFB, (q15_t)0xCC21, (q15_t)0x8C4A, (q15_t)0xC946, (q15_t)0x8DAB, (q15_t)0xC673,
+    (q15_t)0x8F1D, (q15_t)0xC3A9, (q15_t)0x90A1, (q15_t)0xC0E9, (q15_t)0x9236, (q15_t)0xBE32, (q15_t)0x93DC, (q15_t)0xBB85,
+    (q15_t)0x9592, (q15_t)0xB8E3, (q15_t)0x9759, (q15_t)0xB64C, (q15_t)0x9930, (q15_t)0xB3C0, (q15_t)0x9B17, (q15_t)0xB140,
+    (q15_t)0x9D0E, (q15_t)0xAECC, (q15_t)0x9F14, (q15_t)0xAC65, (q15_t)0xA129, (q15_t)0xAA0A, (q15_t)0xA34C, (q15_t)0xA7BD,
+    (q15_t)0xA57E, (q15_t)0xA57E, (q15_t)0xA7BD, (q15_t)0xA34C, (q15_t)0xAA0A, (q15_t)0xA129, (q15_t)0xAC65, (q15_t)0x9F14,
+    (q15_t)0xAECC, (q15_t)0x9D0E, (q15_t)0xB140, (q15_t)0x9B17, (q15_t)0xB3C0, (q15_t)0x9930, (q15_t)0xB64C, (q15_t)0x9759,
+    (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0xBB85, (q15_t)0x93DC, (q15_t)0xBE32, (q15_t)0x9236, (q15_t)0xC0E9, (q15_t)0x90A1,
+    (q15_t)0xC3A9, (q15_t)0x8F1D, (q15_t)0xC673, (q15_t)0x8DAB, (q15_t)0xC946, (q15_t)0x8C4A, (q15_t)0xCC21, (q15_t)0x8AFB,
+    (q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xD1EF, (q15_t)0x8894, (q15_t)0xD4E1, (q15_t)0x877B, (q15_t)0xD7D9, (q15_t)0x8676,
+    (q15_t)0xDAD8, (q15_t)0x8583, (q15_t)0xDDDC, (q15_t)0x84A3, (q15_t)0xE0E6, (q15_t)0x83D6, (q15_t)0xE3F4, (q15_t)0x831C,
+    (q15_t)0xE707, (q15_t)0x8276, (q15_t)0xEA1E, (q15_t)0x81E2, (q15_t)0xED38, (q15_t)0x8163, (q15_t)0xF055, (q15_t)0x80F6,
+    (q15_t)0xF374, (q15_t)0x809E, (q15_t)0xF695, (q15_t)0x8059, (q15_t)0xF9B8, (q15_t)0x8027, (q15_t)0xFCDC, (q15_t)0x800A
+};
+
+const q31_t twiddleCoef_128_q31[192] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    0x7FFFFFFF, 0x00000000, 0x7FD8878E, 0x0647D97C, 0x7F62368F, 0x0C8BD35E, 0x7E9D55FC, 0x12C8106F,
+    0x7D8A5F40, 0x18F8B83C, 0x7C29FBEE, 0x1F19F97B, 0x7A7D055B, 0x25280C5E, 0x78848414, 0x2B1F34EB,
+    0x7641AF3D, 0x30FBC54D, 0x73B5EBD1, 0x36BA2014, 0x70E2CBC6, 0x3C56BA70, 0x6DCA0D14, 0x41CE1E65,
+    0x6A6D98A4, 0x471CECE7, 0x66CF8120, 0x4C3FDFF4, 0x62F201AC, 0x5133CC94, 0x5ED77C8A, 0x55F5A4D2,
+    0x5A82799A, 0x5A82799A, 0x55F5A4D2, 0x5ED77C8A, 0x5133CC94, 0x62F201AC, 0x4C3FDFF4, 0x66CF8120,
+    0x471CECE7, 0x6A6D98A4, 0x41CE1E65, 0x6DCA0D14, 0x3C56BA70, 0x70E2CBC6, 0x36BA2014, 0x73B5EBD1,
+    0x30FBC54D, 0x7641AF3D, 0x2B1F34EB, 0x78848414, 0x25280C5E, 0x7A7D055B, 0x1F19F97B, 0x7C29FBEE,
+    0x18F8B83C, 0x7D8A5F40, 0x12C8106F, 0x7E9D55FC, 0x0C8BD35E, 0x7F62368F, 0x0647D97C, 0x7FD8878E,
+    0x00000000, 0x7FFFFFFF, 0xF9B82684, 0x7FD8878E, 0xF3742CA2, 0x7F62368F, 0xED37EF91, 0x7E9D55FC,
+    0xE70747C4, 0x7D8A5F40, 0xE0E60685, 0x7C29FBEE, 0xDAD7F3A2, 0x7A7D055B, 0xD4E0CB15, 0x78848414,
+    0xCF043AB3, 0x7641AF3D, 0xC945DFEC, 0x73B5EBD1, 0xC3A94590, 0x70E2CBC6, 0xBE31E19B, 0x6DCA0D14,
+    0xB8E31319, 0x6A6D98A4, 0xB3C0200C, 0x66CF8120, 0xAECC336C, 0x62F201AC, 0xAA0A5B2E, 0x5ED77C8A,
+    0xA57D8666, 0x5A82799A, 0xA1288376, 0x55F5A4D2, 0x9D0DFE54, 0x5133CC94, 0x99307EE0, 0x4C3FDFF4,
+    0x9592675C, 0x471CECE7, 0x9235F2EC, 0x41CE1E65, 0x8F1D343A, 0x3C56BA70, 0x8C4A142F, 0x36BA2014,
+    0x89BE50C3, 0x30FBC54D, 0x877B7BEC, 0x2B1F34EB, 0x8582FAA5, 0x25280C5E, 0x83D60412, 0x1F19F97B,
+    0x8275A0C0, 0x18F8B83C, 0x8162AA04, 0x12C8106F, 0x809DC971, 0x0C8BD35E, 0x80277872, 0x0647D97C,
+    0x80000000, 0x00000000, 0x80277872, 0xF9B82684, 0x809DC971, 0xF3742CA2, 0x8162AA04, 0xED37EF91,
+    0x8275A0C0, 0xE70747C4, 0x83D60412, 0xE0E60685, 0x8582FAA5, 0xDAD7F3A2, 0x877B7BEC, 0xD4E0CB15,
+    0x89BE50C3, 0xCF043AB3, 0x8C4A142F, 0xC945DFEC, 0x8F1D343A, 0xC3A94590, 0x9235F2EC, 0xBE31E19B,
+    0x9592675C, 0xB8E31319, 0x99307EE0, 0xB3C0200C, 0x9D0DFE54, 0xAECC336C, 0xA1288376, 0xAA0A5B2E,
+    0xA57D8666, 0xA57D8666, 0xAA0A5B2E, 0xA1288376, 0xAECC336C, 0x9D0DFE54, 0xB3C0200C, 0x99307EE0,
+    0xB8E31319, 0x9592675C, 0xBE31E19B, 0x9235F2EC, 0xC3A94590, 0x8F1D343A, 0xC945DFEC, 0x8C4A142F,
+    0xCF043AB3, 0x89BE50C3, 0xD4E0CB15, 0x877B7BEC, 0xDAD7F3A2, 0x8582FAA5, 0xE0E60685, 0x83D60412,
+    0xE70747C4, 0x8275A0C0, 0xED37EF91, 0x8162AA04, 0xF3742CA2, 0x809DC971, 0xF9B82684, 0x80277872
+};
+
+const q31_t twiddleCoef_256_q31[384] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    0x7FFFFFFF, 0x00000000, 0x7FF62182, 0x03242ABF, 0x7FD8878E, 0x0647D97C, 0x7FA736B4, 0x096A9049,
+    0x7F62368F, 0x0C8BD35E, 0x7F0991C4, 0x0FAB272B, 0x7E9D55FC, 0x12C8106F, 0x7E1D93EA, 0x15E21445,
+    0x7D8A5F40, 0x18F8B83C, 0x7CE3CEB2, 0x1C0B826A, 0x7C29FBEE, 0x1F19F97B, 0x7B5D039E, 0x2223A4C5,
+    0x7A7D055B, 0x25280C5E, 0x798A23B1, 0x2826B928, 0x78848414, 0x2B1F34EB, 0x776C4EDB, 0x2E110A62,
+    0x7641AF3D, 0x30FBC54D, 0x7504D345, 0x33DEF287, 0x73B5EBD1, 0x36BA2014, 0x72552C85, 0x398CDD32,
+    0x70E2CBC6, 0x3C56BA70, 0x6F5F02B2, 0x3F1749B8, 0x6DCA0D14, 0x41CE1E65, 0x6C242960, 0x447ACD50,
+    0x6A6D98A4, 0x471CECE7, 0x68A69E81, 0x49B41533, 0x66CF8120, 0x4C3FDFF4, 0x64E88926, 0x4EBFE8A5,
+    0x62F201AC, 0x5133CC94, 0x60EC3830, 0x539B2AF0, 0x5ED77C8A, 0x55F5A4D2, 0x5CB420E0, 0x5842DD54,
+    0x5A82799A, 0x5A82799A, 0x5842DD54, 0x5CB420E0, 0x55F5A4D2, 0x5ED77C8A, 0x539B2AF0, 0x60EC3830,
+    0x5133CC94, 0x62F201AC, 0x4EBFE8A5, 0x64E88926, 0x4C3FDFF4, 0x66CF8120, 0x49B41533, 0x68A69E81,
+    0x471CECE7, 0x6A6D98A4, 0x447ACD50, 0x6C242960, 0x41CE1E65, 0x6DCA0D14, 0x3F1749B8, 0x6F5F02B2,
+    0x3C56BA70, 0x70E2CBC6, 0x398CDD32, 0x72552C85, 0x36BA2014, 0x73B5EBD1, 0x33DEF287, 0x7504D345,
+    0x30FBC54D, 0x7641AF3D, 0x2E110A62, 0x776C4EDB, 0x2B1F34EB, 0x78848414, 0x2826B928, 0x798A23B1,
+    0x25280C5E, 0x7A7D055B, 0x2223A4C5, 0x7B5D039E, 0x1F19F97B, 0x7C29FBEE, 0x1C0B826A, 0x7CE3CEB2,
+    0x18F8B83C, 0x7D8A5F40, 0x15E21445, 0x7E1D93EA, 0x12C8106F, 0x7E9D55FC, 0x0FAB272B, 0x7F0991C4,
+    0x0C8BD35E, 0x7F62368F, 0x096A9049, 0x7FA736B4, 0x0647D97C, 0x7FD8878E, 0x03242ABF, 0x7FF62182,
+    0x00000000, 0x7FFFFFFF, 0xFCDBD541, 0x7FF62182, 0xF9B82684, 0x7FD8878E, 0xF6956FB7, 0x7FA736B4,
+    0xF3742CA2, 0x7F62368F, 0xF054D8D5, 0x7F0991C4, 0xED37EF91, 0x7E9D55FC, 0xEA1DEBBB, 0x7E1D93EA,
+    0xE70747C4, 0x7D8A5F40, 0xE3F47D96, 0x7CE3CEB2, 0xE0E60685, 0x7C29FBEE, 0xDDDC5B3B, 0x7B5D039E,
+    0xDAD7F3A2, 0x7A7D055B, 0xD7D946D8, 0x798A23B1, 0xD4E0CB15, 0x78848414, 0xD1EEF59E, 0x776C4EDB,
+    0xCF043AB3, 0x7641AF3D, 0xCC210D79, 0x7504D345, 0xC945DFEC, 0x73B5EBD1, 0xC67322CE, 0x72552C85,
+    0xC3A94590, 0x70E2CBC6, 0xC0E8B648, 0x6F5F02B2, 0xBE31E19B, 0x6DCA0D14, 0xBB8532B0, 0x6C242960,
+    0xB8E31319, 0x6A6D98A4, 0xB64BEACD, 0x68A69E81, 0xB3C0200C, 0x66CF8120, 0xB140175B, 0x64E88926,
+    0xAECC336C, 0x62F201AC, 0xAC64D510, 0x60EC3830, 0xAA0A5B2E, 0x5ED77C8A, 0xA7BD22AC, 0x5CB420E0,
+    0xA57D8666, 0x5A82799A, 0xA34BDF20, 0x5842DD54, 0xA1288376, 0x55F5A4D2, 0x9F13C7D0, 0x539B2AF0,
+    0x9D0DFE54, 0x5133CC94, 0x9B1776DA, 0x4EBFE8A5, 0x99307EE0, 0x4C3FDFF4, 0x9759617F, 0x49B41533,
+    0x9592675C, 0x471CECE7, 0x93DBD6A0, 0x447ACD50, 0x9235F2EC, 0x41CE1E65, 0x90A0FD4E, 0x3F1749B8,
+    0x8F1D343A, 0x3C56BA70, 0x8DAAD37B, 0x398CDD32, 0x8C4A142F, 0x36BA2014, 0x8AFB2CBB, 0x33DEF287,
+    0x89BE50C3, 0x30FBC54D, 0x8893B125, 0x2E110A62, 0x877B7BEC, 0x2B1F34EB, 0x8675DC4F, 0x2826B928,
+    0x8582FAA5, 0x25280C5E, 0x84A2FC62, 0x2223A4C5, 0x83D60412, 0x1F19F97B, 0x831C314E, 0x1C0B826A,
+    0x8275A0C0, 0x18F8B83C, 0x81E26C16, 0x15E21445, 0x8162AA04, 0x12C8106F, 0x80F66E3C, 0x0FAB272B,
+    0x809DC971, 0x0C8BD35E, 0x8058C94C, 0x096A9049, 0x80277872, 0x0647D97C, 0x8009DE7E, 0x03242ABF,
+    0x80000000, 0x00000000, 0x8009DE7E, 0xFCDBD541, 0x80277872, 0xF9B82684, 0x8058C94C, 0xF6956FB7,
+    0x809DC971, 0xF3742CA2, 0x80F66E3C, 0xF054D8D5, 0x8162AA04, 0xED37EF91, 0x81E26C16, 0xEA1DEBBB,
+    0x8275A0C0, 0xE70747C4, 0x831C314E, 0xE3F47D96, 0x83D60412, 0xE0E60685, 0x84A2FC62, 0xDDDC5B3B,
+    0x8582FAA5, 0xDAD7F3A2, 0x8675DC4F, 0xD7D946D8, 0x877B7BEC, 0xD4E0CB15, 0x8893B125, 0xD1EEF59E,
+    0x89BE50C3, 0xCF043AB3, 0x8AFB2CBB, 0xCC210D79, 0x8C4A142F, 0xC945DFEC, 0x8DAAD37B, 0xC67322CE,
+    0x8F1D343A, 0xC3A94590, 0x90A0FD4E, 0xC0E8B648, 0x9235F2EC, 0xBE31E19B, 0x93DBD6A0, 0xBB8532B0,
+    0x9592675C, 0xB8E31319, 0x9759617F, 0xB64BEACD, 0x99307EE0, 0xB3C0200C, 0x9B1776DA, 0xB140175B,
+    0x9D0DFE54, 0xAECC336C, 0x9F13C7D0, 0xAC64D510, 0xA1288376, 0xAA0A5B2E, 0xA34BDF20, 0xA7BD22AC,
+    0xA57D8666, 0xA57D8666, 0xA7BD22AC, 0xA34BDF20, 0xAA0A5B2E, 0xA1288376, 0xAC64D510, 0x9F13C7D0,
+    0xAECC336C, 0x9D0DFE54, 0xB140175B, 0x9B1776DA, 0xB3C0200C, 0x99307EE0, 0xB64BEACD, 0x9759617F,
+    0xB8E31319, 0x9592675C, 0xBB8532B0, 0x93DBD6A0, 0xBE31E19B, 0x9235F2EC, 0xC0E8B648, 0x90A0FD4E,
+    0xC3A94590, 0x8F1D343A, 0xC67322CE, 0x8DAAD37B, 0xC945DFEC, 0x8C4A142F, 0xCC210D79, 0x8AFB2CBB,
+    0xCF043AB3, 0x89BE50C3, 0xD1EEF59E, 0x8893B125, 0xD4E0CB15, 0x877B7BEC, 0xD7D946D8, 0x8675DC4F,
+    0xDAD7F3A2, 0x8582FAA5, 0xDDDC5B3B, 0x84A2FC62, 0xE0E60685, 0x83D60412, 0xE3F47D96, 0x831C314E,
+    0xE70747C4, 0x8275A0C0, 0xEA1DEBBB, 0x81E26C16, 0xED37EF91, 0x8162AA04, 0xF054D8D5, 0x80F66E3C,
+    0xF3742CA2, 0x809DC971, 0xF6956FB7, 0x8058C94C, 0xF9B82684, 0x80277872, 0xFCDBD541, 0x8009DE7E
+};
+
+const uint16_t armBitRevIndexTable_fixed_128[112] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       8,  512,   16,  256,   24,  768,   32,  128,   40,  640,   48,  384,   56,  896,   72,  576,
+      80,  320,   88,  832,   96,  192,  104,  704,  112,  448,  120,  960,  136,  544,  144,  288,
+     152,  800,  168,  672,  176,  416,  184,  928,  200,  608,  208,  352,  216,  864,  232,  736,
+     240,  480,  248,  992,  264,  528,  280,  784,  296,  656,  304,  400,  312,  912,  328,  592,
+     344,  848,  360,  720,  368,  464,  376,  976,  392,  560,  408,  816,  424,  688,  440,  944,
+     456,  624,  472,  880,  488,  752,  504, 1008,  536,  776,  552,  648,  568,  904,  600,  840,
+     616,  712,  632,  968,  664,  808,  696,  936,  728,  872,  760, 1000,  824,  920,  888,  984
+};
+
+const uint16_t armBitRevIndexTable_fixed_256[240] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       8, 1024,   16,  512,   24, 1536,   32,  256,   40, 1280,   48,  768,   56, 1792,   64,  128,
+      72, 1152,   80,  640,   88, 1664,   96,  384,  104, 1408,  112,  896,  120, 1920,  136, 1088,
+     144,  576,  152, 1600,  160,  320,  168, 1344,  176,  832,  184, 1856,  200, 1216,  208,  704,
+     216, 1728,  224,  448,  232, 1472,  240,  960,  248, 1984,  264, 1056,  272,  544,  280, 1568,
+     296, 1312,  304,  800,  312, 1824,  328, 1184,  336,  672,  344, 1696,  352,  416,  360, 1440,
+     368,  928,  376, 1952,  392, 1120,  400,  608,  408, 1632,  424, 1376,  432,  864,  440, 1888,
+     456, 1248,  464,  736,  472, 1760,  488, 1504,  496,  992,  504, 2016,  520, 1040,  536, 1552,
+     552, 1296,  560,  784,  568, 1808,  584, 1168,  592,  656,  600, 1680,  616, 1424,  624,  912,
+     632, 1936,  648, 1104,  664, 1616,  680, 1360,  688,  848,  696, 1872,  712, 1232,  728, 1744,
+     744, 1488,  752,  976,  760, 2000,  776, 1072,  792, 1584,  808, 1328,  824, 1840,  840, 1200,
+     856, 1712,  872, 1456,  880,  944,  888, 1968,  904, 1136,  920, 1648,  936, 1392,  952, 1904,
+     968, 1264,  984, 1776, 1000, 1520, 1016, 2032, 1048, 1544, 1064, 1288, 1080, 1800, 1096, 1160,
+    1112, 1672, 1128, 1416, 1144, 1928, 1176, 1608, 1192, 1352, 1208, 1864, 1240, 1736, 1256, 1480,
+    1272, 1992, 1304, 1576, 1336, 1832, 1368, 1704, 1384, 1448, 1400, 1960, 1432, 1640, 1464, 1896,
+    1496, 1768, 1528, 2024, 1592, 1816, 1624, 1688, 1656, 1944, 1720, 1880, 1784, 2008, 1912, 1976
+};
+
+const uint16_t armBitRevPairsM23_128[112] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,   64,    2,   32,    3,   96,    4,   16,    5,   80,    6,   48,    7,  112,    9,   72,
+      10,   40,   11,  104,   12,   24,   13,   88,   14,   56,   15,  120,   17,   68,   18,   36,
+      19,  100,   21,   84,   22,   52,   23,  116,   25,   76,   26,   44,   27,  108,   29,   92,
+      30,   60,   31,  124,   33,   66,   35,   98,   37,   82,   38,   50,   39,  114,   41,   74,
+      43,  106,   45,   90,   46,   58,   47,  122,   49,   70,   51,  102,   53,   86,   55,  118,
+      57,   78,   59,  110,   61,   94,   63,  126,   67,   97,   69,   81,   71,  113,   75,  105,
+      77,   89,   79,  121,   83,  101,   87,  117,   91,  109,   95,  125,  103,  115,  111,  123
+};
+
+const uint16_t armBitRevPairsM23_256[240] ARM_DSP_TABLE_ATTRIBUTE =
+{
+       1,  128,    2,   64,    3,  192,    4,   32,    5,  160,    6,   96,    7,  224,    8,   16,
+       9,  144,   10,   80,   11,  208,   12,   48,   13,  176,   14,  112,   15,  240,   17,  136,
+      18,   72,   19,  200,   20,   40,   21,  168,   22,  104,   23,  232,   25,  152,   26,   88,
+      27,  216,   28,   56,   29,  184,   30,  120,   31,  248,   33,  132,   34,   68,   35,  196,
+      37,  164,   38,  100,   39,  228,   41,  148,   42,   84,   43,  212,   44,   52,   45,  180,
+      46,  116,   47,  244,   49,  140,   50,   76,   51,  204,   53,  172,   54,  108,   55,  236,
+      57,  156,   58,   92,   59,  220,   61,  188,   62,  124,   63,  252,   65,  130,   67,  194,
+      69,  162,   70,   98,   71,  226,   73,  146,   74,   82,   75,  210,   77,  178,   78,  114,
+      79,  242,   81,  138,   83,  202,   85,  170,   86,  106,   87,  234,   89,  154,   91,  218,
+      93,  186,   94,  122,   95,  250,   97,  134,   99,  198,  101,  166,  103,  230,  105,  150,
+     107,  214,  109,  182,  110,  118,  111,  246,  113,  142,  115,  206,  117,  174,  119,  238,
+     121,  158,  123,  222,  125,  190,  127,  254,  131,  193,  133,  161,  135,  225,  137,  145,
+     139,  209,  141,  177,  143,  241,  147,  201,  149,  169,  151,  233,  155,  217,  157,  185,
+     159,  249,  163,  197,  167,  229,  171,  213,  173,  181,  175,  245,  179,  205,  183,  237,
+     187,  221,  191,  253,  199,  227,  203,  211,  207,  243,  215,  235,  223,  251,  239,  247
+};
+
+/* {cos, sin} of 2*pi*k/256 for k < 192, a plan of length N reads every (256 / N)-th entry */
+const q15_t twiddleCoefM23_q15[384] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FD9, (q15_t)0x0648, (q15_t)0x7FA7, (q15_t)0x096B,
+    (q15_t)0x7F62, (q15_t)0x0C8C, (q15_t)0x7F0A, (q15_t)0x0FAB, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7E1E, (q15_t)0x15E2,
+    (q15_t)0x7D8A, (q15_t)0x18F9, (q15_t)0x7CE4, (q15_t)0x1C0C, (q15_t)0x7C2A, (q15_t)0x1F1A, (q15_t)0x7B5D, (q15_t)0x2224,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x798A, (q15_t)0x2827, (q15_t)0x7885, (q15_t)0x2B1F, (q15_t)0x776C, (q15_t)0x2E11,
+    (q15_t)0x7642, (q15_t)0x30FC, (q15_t)0x7505, (q15_t)0x33DF, (q15_t)0x73B6, (q15_t)0x36BA, (q15_t)0x7255, (q15_t)0x398D,
+    (q15_t)0x70E3, (q15_t)0x3C57, (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x6C24, (q15_t)0x447B,
+    (q15_t)0x6A6E, (q15_t)0x471D, (q15_t)0x68A7, (q15_t)0x49B4, (q15_t)0x66D0, (q15_t)0x4C40, (q15_t)0x64E9, (q15_t)0x4EC0,
+    (q15_t)0x62F2, (q15_t)0x5134, (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x5ED7, (q15_t)0x55F6, (q15_t)0x5CB4, (q15_t)0x5843,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x5843, (q15_t)0x5CB4, (q15_t)0x55F6, (q15_t)0x5ED7, (q15_t)0x539B, (q15_t)0x60EC,
+    (q15_t)0x5134, (q15_t)0x62F2, (q15_t)0x4EC0, (q15_t)0x64E9, (q15_t)0x4C40, (q15_t)0x66D0, (q15_t)0x49B4, (q15_t)0x68A7,
+    (q15_t)0x471D, (q15_t)0x6A6E, (q15_t)0x447B, (q15_t)0x6C24, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x3F17, (q15_t)0x6F5F,
+    (q15_t)0x3C57, (q15_t)0x70E3, (q15_t)0x398D, (q15_t)0x7255, (q15_t)0x36BA, (q15_t)0x73B6, (q15_t)0x33DF, (q15_t)0x7505,
+    (q15_t)0x30FC, (q15_t)0x7642, (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0x2B1F, (q15_t)0x7885, (q15_t)0x2827, (q15_t)0x798A,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x2224, (q15_t)0x7B5D, (q15_t)0x1F1A, (q15_t)0x7C2A, (q15_t)0x1C0C, (q15_t)0x7CE4,
+    (q15_t)0x18F9, (q15_t)0x7D8A, (q15_t)0x15E2, (q15_t)0x7E1E, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x0FAB, (q15_t)0x7F0A,
+    (q15_t)0x0C8C, (q15_t)0x7F62, (q15_t)0x096B, (q15_t)0x7FA7, (q15_t)0x0648, (q15_t)0x7FD9, (q15_t)0x0324, (q15_t)0x7FF6,
+    (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xFCDC, (q15_t)0x7FF6, (q15_t)0xF9B8, (q15_t)0x7FD9, (q15_t)0xF695, (q15_t)0x7FA7,
+    (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0xF055, (q15_t)0x7F0A, (q15_t)0xED38, (q15_t)0x7E9D, (q15_t)0xEA1E, (q15_t)0x7E1E,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0xE3F4, (q15_t)0x7CE4, (q15_t)0xE0E6, (q15_t)0x7C2A, (q15_t)0xDDDC, (q15_t)0x7B5D,
+    (q15_t)0xDAD8, (q15_t)0x7A7D, (q15_t)0xD7D9, (q15_t)0x798A, (q15_t)0xD4E1, (q15_t)0x7885, (q15_t)0xD1EF, (q15_t)0x776C,
+    (q15_t)0xCF04, (q15_t)0x7642, (q15_t)0xCC21, (q15_t)0x7505, (q15_t)0xC946, (q15_t)0x73B6, (q15_t)0xC673, (q15_t)0x7255,
+    (q15_t)0xC3A9, (q15_t)0x70E3, (q15_t)0xC0E9, (q15_t)0x6F5F, (q15_t)0xBE32, (q15_t)0x6DCA, (q15_t)0xBB85, (q15_t)0x6C24,
+    (q15_t)0xB8E3, (q15_t)0x6A6E, (q15_t)0xB64C, (q15_t)0x68A7, (q15_t)0xB3C0, (q15_t)0x66D0, (q15_t)0xB140, (q15_t)0x64E9,
+    (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0xAC65, (q15_t)0x60EC, (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0xA7BD, (q15_t)0x5CB4,
+    (q15_t)0xA57E, (q15_t)0x5A82, (q15_t)0xA34C, (q15_t)0x5843, (q15_t)0xA129, (q15_t)0x55F6, (q15_t)0x9F14, (q15_t)0x539B,
+    (q15_t)0x9D0E, (q15_t)0x5134, (q15_t)0x9B17, (q15_t)0x4EC0, (q15_t)0x9930, (q15_t)0x4C40, (q15_t)0x9759, (q15_t)0x49B4,
+    (q15_t)0x9592, (q15_t)0x471D, (q15_t)0x93DC, (q15_t)0x447B, (q15_t)0x9236, (q15_t)0x41CE, (q15_t)0x90A1, (q15_t)0x3F17,
+    (q15_t)0x8F1D, (q15_t)0x3C57, (q15_t)0x8DAB, (q15_t)0x398D, (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0x8AFB, (q15_t)0x33DF,
+    (q15_t)0x89BE, (q15_t)0x30FC, (q15_t)0x8894, (q15_t)0x2E11, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x8676, (q15_t)0x2827,
+    (q15_t)0x8583, (q15_t)0x2528, (q15_t)0x84A3, (q15_t)0x2224, (q15_t)0x83D6, (q15_t)0x1F1A, (q15_t)0x831C, (q15_t)0x1C0C,
+    (q15_t)0x8276, (q15_t)0x18F9, (q15_t)0x81E2, (q15_t)0x15E2, (q15_t)0x8163, (q15_t)0x12C8, (q15_t)0x80F6, (q15_t)0x0FAB,
+    (q15_t)0x809E, (q15_t)0x0C8C, (q15_t)0x8059, (q15_t)0x096B, (q15_t)0x8027, (q15_t)0x0648, (q15_t)0x800A, (q15_t)0x0324,
+    (q15_t)0x8000, (q15_t)0x0000, (q15_t)0x800A, (q15_t)0xFCDC, (q15_t)0x8027, (q15_t)0xF9B8, (q15_t)0x8059, (q15_t)0xF695,
+    (q15_t)0x809E, (q15_t)0xF374, (q15_t)0x80F6, (q15_t)0xF055, (q15_t)0x8163, (q15_t)0xED38, (q15_t)0x81E2, (q15_t)0xEA1E,
+    (q15_t)0x8276, (q15_t)0xE707, (q15_t)0x831C, (q15_t)0xE3F4, (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x84A3, (q15_t)0xDDDC,
+    (q15_t)0x8583, (q15_t)0xDAD8, (q15_t)0x8676, (q15_t)0xD7D9, (q15_t)0x877B, (q15_t)0xD4E1, (q15_t)0x8894, (q15_t)0xD1EF,
+    (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x8AFB, (q15_t)0xCC21, (q15_t)0x8C4A, (q15_t)0xC946, (q15_t)0x8DAB, (q15_t)0xC673,
+    (q15_t)0x8F1D, (q15_t)0xC3A9, (q15_t)0x90A1, (q15_t)0xC0E9, (q15_t)0x9236, (q15_t)0xBE32, (q15_t)0x93DC, (q15_t)0xBB85,
+    (q15_t)0x9592, (q15_t)0xB8E3, (q15_t)0x9759, (q15_t)0xB64C, (q15_t)0x9930, (q15_t)0xB3C0, (q15_t)0x9B17, (q15_t)0xB140,
+    (q15_t)0x9D0E, (q15_t)0xAECC, (q15_t)0x9F14, (q15_t)0xAC65, (q15_t)0xA129, (q15_t)0xAA0A, (q15_t)0xA34C, (q15_t)0xA7BD,
+    (q15_t)0xA57E, (q15_t)0xA57E, (q15_t)0xA7BD, (q15_t)0xA34C, (q15_t)0xAA0A, (q15_t)0xA129, (q15_t)0xAC65, (q15_t)0x9F14,
+    (q15_t)0xAECC, (q15_t)0x9D0E, (q15_t)0xB140, (q15_t)0x9B17, (q15_t)0xB3C0, (q15_t)0x9930, (q15_t)0xB64C, (q15_t)0x9759,
+    (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0xBB85, (q15_t)0x93DC, (q15_t)0xBE32, (q15_t)0x9236, (q15_t)0xC0E9, (q15_t)0x90A1,
+    (q15_t)0xC3A9, (q15_t)0x8F1D, (q15_t)0xC673, (q15_t)0x8DAB, (q15_t)0xC946, (q15_t)0x8C4A, (q15_t)0xCC21, (q15_t)0x8AFB,
+    (q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xD1EF, (q15_t)0x8894, (q15_t)0xD4E1, (q15_t)0x877B, (q15_t)0xD7D9, (q15_t)0x8676,
+    (q15_t)0xDAD8, (q15_t)0x8583, (q15_t)0xDDDC, (q15_t)0x84A3, (q15_t)0xE0E6, (q15_t)0x83D6, (q15_t)0xE3F4, (q15_t)0x831C,
+    (q15_t)0xE707, (q15_t)0x8276, (q15_t)0xEA1E, (q15_t)0x81E2, (q15_t)0xED38, (q15_t)0x8163, (q15_t)0xF055, (q15_t)0x80F6,
+    (q15_t)0xF374, (q15_t)0x809E, (q15_t)0xF695, (q15_t)0x8059, (q15_t)0xF9B8, (q15_t)0x8027, (q15_t)0xFCDC, (q15_t)0x800A
+};
+
+/* {cos, sin} of 2*pi*k/256 for k < 192, a plan of length N reads every (256 / N)-th entry */
+const q31_t twiddleCoefM23_q31[384] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    0x7FFFFFFF, 0x00000000, 0x7FF62182, 0x03242ABF, 0x7FD8878E, 0x0647D97C, 0x7FA736B4, 0x096A9049,
+    0x7F62368F, 0x0C8BD35E, 0x7F0991C4, 0x0FAB272B, 0x7E9D55FC, 0x12C8106F, 0x7E1D93EA, 0x15E21445,
+    0x7D8A5F40, 0x18F8B83C, 0x7CE3CEB2, 0x1C0B826A, 0x7C29FBEE, 0x1F19F97B, 0x7B5D039E, 0x2223A4C5,
+    0x7A7D055B, 0x25280C5E, 0x798A23B1, 0x2826B928, 0x78848414, 0x2B1F34EB, 0x776C4EDB, 0x2E110A62,
+    0x7641AF3D, 0x30FBC54D, 0x7504D345, 0x33DEF287, 0x73B5EBD1, 0x36BA2014, 0x72552C85, 0x398CDD32,
+    0x70E2CBC6, 0x3C56BA70, 0x6F5F02B2, 0x3F1749B8, 0x6DCA0D14, 0x41CE1E65, 0x6C242960, 0x447ACD50,
+    0x6A6D98A4, 0x471CECE7, 0x68A69E81, 0x49B41533, 0x66CF8120, 0x4C3FDFF4, 0x64E88926, 0x4EBFE8A5,
+    0x62F201AC, 0x5133CC94, 0x60EC3830, 0x539B2AF0, 0x5ED77C8A, 0x55F5A4D2, 0x5CB420E0, 0x5842DD54,
+    0x5A82799A, 0x5A82799A, 0x5842DD54, 0x5CB420E0, 0x55F5A4D2, 0x5ED77C8A, 0x539B2AF0, 0x60EC3830,
+    0x5133CC94, 0x62F201AC, 0x4EBFE8A5, 0x64E88926, 0x4C3FDFF4, 0x66CF8120, 0x49B41533, 0x68A69E81,
+    0x471CECE7, 0x6A6D98A4, 0x447ACD50, 0x6C242960, 0x41CE1E65, 0x6DCA0D14, 0x3F1749B8, 0x6F5F02B2,
+    0x3C56BA70, 0x70E2CBC6, 0x398CDD32, 0x72552C85, 0x36BA2014, 0x73B5EBD1, 0x33DEF287, 0x7504D345,
+    0x30FBC54D, 0x7641AF3D, 0x2E110A62, 0x776C4EDB, 0x2B1F34EB, 0x78848414, 0x2826B928, 0x798A23B1,
+    0x25280C5E, 0x7A7D055B, 0x2223A4C5, 0x7B5D039E, 0x1F19F97B, 0x7C29FBEE, 0x1C0B826A, 0x7CE3CEB2,
+    0x18F8B83C, 0x7D8A5F40, 0x15E21445, 0x7E1D93EA, 0x12C8106F, 0x7E9D55FC, 0x0FAB272B, 0x7F0991C4,
+    0x0C8BD35E, 0x7F62368F, 0x096A9049, 0x7FA736B4, 0x0647D97C, 0x7FD8878E, 0x03242ABF, 0x7FF62182,
+    0x00000000, 0x7FFFFFFF, 0xFCDBD541, 0x7FF62182, 0xF9B82684, 0x7FD8878E, 0xF6956FB7, 0x7FA736B4,
+    0xF3742CA2, 0x7F62368F, 0xF054D8D5, 0x7F0991C4, 0xED37EF91, 0x7E9D55FC, 0xEA1DEBBB, 0x7E1D93EA,
+    0xE70747C4, 0x7D8A5F40, 0xE3F47D96, 0x7CE3CEB2, 0xE0E60685, 0x7C29FBEE, 0xDDDC5B3B, 0x7B5D039E,
+    0xDAD7F3A2, 0x7A7D055B, 0xD7D946D8, 0x798A23B1, 0xD4E0CB15, 0x78848414, 0xD1EEF59E, 0x776C4EDB,
+    0xCF043AB3, 0x7641AF3D, 0xCC210D79, 0x7504D345, 0xC945DFEC, 0x73B5EBD1, 0xC67322CE, 0x72552C85,
+    0xC3A94590, 0x70E2CBC6, 0xC0E8B648, 0x6F5F02B2, 0xBE31E19B, 0x6DCA0D14, 0xBB8532B0, 0x6C242960,
+    0xB8E31319, 0x6A6D98A4, 0xB64BEACD, 0x68A69E81, 0xB3C0200C, 0x66CF8120, 0xB140175B, 0x64E88926,
+    0xAECC336C, 0x62F201AC, 0xAC64D510, 0x60EC3830, 0xAA0A5B2E, 0x5ED77C8A, 0xA7BD22AC, 0x5CB420E0,
+    0xA57D8666, 0x5A82799A, 0xA34BDF20, 0x5842DD54, 0xA1288376, 0x55F5A4D2, 0x9F13C7D0, 0x539B2AF0,
+    0x9D0DFE54, 0x5133CC94, 0x9B1776DA, 0x4EBFE8A5, 0x99307EE0, 0x4C3FDFF4, 0x9759617F, 0x49B41533,
+    0x9592675C, 0x471CECE7, 0x93DBD6A0, 0x447ACD50, 0x9235F2EC, 0x41CE1E65, 0x90A0FD4E, 0x3F1749B8,
+    0x8F1D343A, 0x3C56BA70, 0x8DAAD37B, 0x398CDD32, 0x8C4A142F, 0x36BA2014, 0x8AFB2CBB, 0x33DEF287,
+    0x89BE50C3, 0x30FBC54D, 0x8893B125, 0x2E110A62, 0x877B7BEC, 0x2B1F34EB, 0x8675DC4F, 0x2826B928,
+    0x8582FAA5, 0x25280C5E, 0x84A2FC62, 0x2223A4C5, 0x83D60412, 0x1F19F97B, 0x831C314E, 0x1C0B826A,
+    0x8275A0C0, 0x18F8B83C, 0x81E26C16, 0x15E21445, 0x8162AA04, 0x12C8106F, 0x80F66E3C, 0x0FAB272B,
+    0x809DC971, 0x0C8BD35E, 0x8058C94C, 0x096A9049, 0x80277872, 0x0647D97C, 0x8009DE7E, 0x03242ABF,
+    0x80000000, 0x00000000, 0x8009DE7E, 0xFCDBD541, 0x80277872, 0xF9B82684, 0x8058C94C, 0xF6956FB7,
+    0x809DC971, 0xF3742CA2, 0x80F66E3C, 0xF054D8D5, 0x8162AA04, 0xED37EF91, 0x81E26C16, 0xEA1DEBBB,
+    0x8275A0C0, 0xE70747C4, 0x831C314E, 0xE3F47D96, 0x83D60412, 0xE0E60685, 0x84A2FC62, 0xDDDC5B3B,
+    0x8582FAA5, 0xDAD7F3A2, 0x8675DC4F, 0xD7D946D8, 0x877B7BEC, 0xD4E0CB15, 0x8893B125, 0xD1EEF59E,
+    0x89BE50C3, 0xCF043AB3, 0x8AFB2CBB, 0xCC210D79, 0x8C4A142F, 0xC945DFEC, 0x8DAAD37B, 0xC67322CE,
+    0x8F1D343A, 0xC3A94590, 0x90A0FD4E, 0xC0E8B648, 0x9235F2EC, 0xBE31E19B, 0x93DBD6A0, 0xBB8532B0,
+    0x9592675C, 0xB8E31319, 0x9759617F, 0xB64BEACD, 0x99307EE0, 0xB3C0200C, 0x9B1776DA, 0xB140175B,
+    0x9D0DFE54, 0xAECC336C, 0x9F13C7D0, 0xAC64D510, 0xA1288376, 0xAA0A5B2E, 0xA34BDF20, 0xA7BD22AC,
+    0xA57D8666, 0xA57D8666, 0xA7BD22AC, 0xA34BDF20, 0xAA0A5B2E, 0xA1288376, 0xAC64D510, 0x9F13C7D0,
+    0xAECC336C, 0x9D0DFE54, 0xB140175B, 0x9B1776DA, 0xB3C0200C, 0x99307EE0, 0xB64BEACD, 0x9759617F,
+    0xB8E31319, 0x9592675C, 0xBB8532B0, 0x93DBD6A0, 0xBE31E19B, 0x9235F2EC, 0xC0E8B648, 0x90A0FD4E,
+    0xC3A94590, 0x8F1D343A, 0xC67322CE, 0x8DAAD37B, 0xC945DFEC, 0x8C4A142F, 0xCC210D79, 0x8AFB2CBB,
+    0xCF043AB3, 0x89BE50C3, 0xD1EEF59E, 0x8893B125, 0xD4E0CB15, 0x877B7BEC, 0xD7D946D8, 0x8675DC4F,
+    0xDAD7F3A2, 0x8582FAA5, 0xDDDC5B3B, 0x84A2FC62, 0xE0E60685, 0x83D60412, 0xE3F47D96, 0x831C314E,
+    0xE70747C4, 0x8275A0C0, 0xEA1DEBBB, 0x81E26C16, 0xED37EF91, 0x8162AA04, 0xF054D8D5, 0x80F66E3C,
+    0xF3742CA2, 0x809DC971, 0xF6956FB7, 0x8058C94C, 0xF9B82684, 0x80277872, 0xFCDBD541, 0x8009DE7E
+};
+
+const q15_t goertzelCoef_q15_256[32] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    (q15_t)0x7D8A, (q15_t)0x18F9, (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x471D, (q15_t)0x6A6E, (q15_t)0xD7D9, (q15_t)0x798A,
+    (q15_t)0x7FA7, (q15_t)0x096B, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x5ED7, (q15_t)0x55F6, (q15_t)0x2B1F, (q15_t)0x7885,
+    (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xB3C0, (q15_t)0x66D0, (q15_t)0x9D0E, (q15_t)0x5134, (q15_t)0x8C4A, (q15_t)0x36BA,
+    (q15_t)0x8676, (q15_t)0x2827, (q15_t)0x8276, (q15_t)0x18F9, (q15_t)0x8059, (q15_t)0x096B, (q15_t)0x800A, (q15_t)0x0324
+};
+
+const q31_t goertzelCoef_q31_256[32] ARM_DSP_TABLE_ATTRIBUTE =
+{
+    0x7D8A5F40, 0x18F8B83C, 0x6F5F02B2, 0x3F1749B8, 0x471CECE7, 0x6A6D98A4, 0xD7D946D8, 0x798A23B1,
+    0x7FA736B4, 0x096A9049, 0x7A7D055B, 0x25280C5E, 0x5ED77C8A, 0x55F5A4D2, 0x2B1F34EB, 0x78848414,
+    0x00000000, 0x7FFFFFFF, 0xB3C0200C, 0x66CF8120, 0x9D0DFE54, 0x5133CC94, 0x8C4A142F, 0x36BA2014,
+    0x8675DC4F, 0x2826B928, 0x8275A0C0, 0x18F8B83C, 0x8058C94C, 0x096A9049, 0x8009DE7E, 0x03242ABF
+};
+
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    128, twiddleCoef_128_q15, armBitRevIndexTable_fixed_128, 112
+};
+
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    256, twiddleCoef_256_q15, armBitRevIndexTable_fixed_256, 240
+};
+
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    128, twiddleCoef_128_q31, armBitRevIndexTable_fixed_128, 112
+};
+
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    256, twiddleCoef_256_q31, armBitRevIndexTable_fixed_256, 240
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len128 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    128, 2, twiddleCoefM23_q15, armBitRevPairsM23_128, 112
+};
+
+const arm_cfft_plan_q15 arm_cfft_plan_q15_len256 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    256, 1, twiddleCoefM23_q15, armBitRevPairsM23_256, 240
+};
+
+const arm_rfft_plan_q15 arm_rfft_plan_q15_len256 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    &arm_cfft_plan_q15_len128, 256, 1, twiddleCoefM23_q15
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len128 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    128, 2, twiddleCoefM23_q31, armBitRevPairsM23_128, 112
+};
+
+const arm_cfft_plan_q31 arm_cfft_plan_q31_len256 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    256, 1, twiddleCoefM23_q31, armBitRevPairsM23_256, 240
+};
+
+const arm_rfft_plan_q31 arm_rfft_plan_q31_len256 ARM_DSP_TABLE_ATTRIBUTE =
+{
+    &arm_cfft_plan_q31_len128, 256, 1, twiddleCoefM23_q31
+};
@@ -0,0 +1,48 @@
+/**************************************************************************//**
+ * @file     bench_fft_tables.h
+ * @version  V1.00
+ * @brief    FFT and window tables listed in fft_tables.cfg.
+ *           Generated by Library/CMSIS/DSP/Scripts/gen_fft_tables.py, do not edit.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __BENCH_FFT_TABLES_H
+#define __BENCH_FFT_TABLES_H
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+extern const q15_t twiddleCoef_128_q15[192];
+extern const q15_t twiddleCoef_256_q15[384];
+extern const q31_t twiddleCoef_128_q31[192];
+extern const q31_t twiddleCoef_256_q31[384];
+extern const uint16_t armBitRevIndexTable_fixed_128[112];
+extern const uint16_t armBitRevIndexTable_fixed_256[240];
+extern const uint16_t armBitRevPairsM23_128[112];
+extern const uint16_t armBitRevPairsM23_256[240];
+extern const q15_t twiddleCoefM23_q15[];
+extern const q31_t twiddleCoefM23_q31[];
+extern const q15_t goertzelCoef_q15_256[32];
+extern const q31_t goertzelCoef_q31_256[32];
+
+extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len128;
+extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len256;
+extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len128;
+extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len256;
+extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len128;
+extern const arm_cfft_plan_q15 arm_cfft_plan_q15_len256;
+extern const arm_rfft_plan_q15 arm_rfft_plan_q15_len256;
+extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len128;
+extern const arm_cfft_plan_q31 arm_cfft_plan_q31_len256;
+extern const arm_rfft_plan_q31 arm_rfft_plan_q31_len256;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __BENCH_FFT_TABLES_H */
@@ -0,0 +1,31 @@
+/**************************************************************************//**
+ * @file     bench_suites.h
+ * @version  V1.00
+ * @brief    Benchmark suites of the sample
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __BENCH_SUITES_H
+#define __BENCH_SUITES_H
+
+#include "benchlib.h"
+
+#define BENCH_CALLS         16      /* Timed calls per case */
+
+/* CMSIS-DSP kernels, built on target and host */
+uint32_t BenchDsp_Run(uint32_t u32Calls);
+
+/* Q15/Q31 FFT, CMSIS-DSP against the Cortex-M23 plans, and the Goertzel/sliding DFT detectors, built on target and host */
+uint32_t BenchFft_Run(uint32_t u32Calls);
+
+/* StdDriver transfer functions, target only */
+uint32_t BenchDrv_Run(uint32_t u32Calls);
+
+/* Software CRC library, built on target and host, against the CRC controller on target */
+uint32_t BenchCrc_Run(uint32_t u32Calls);
+
+/* AES-CMAC and AES-CCM library, software AES stand-in on host, AES engine on target */
+uint32_t BenchAuth_Run(uint32_t u32Calls);
+
+#endif  /* __BENCH_SUITES_H */
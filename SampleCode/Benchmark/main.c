@@ -0,0 +1,98 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Measure the cycles per call, per byte and per sample of StdDriver
+ *           transfer functions and CMSIS-DSP kernels, and print the results
+ *           as CSV. The DSP and FFT suites also build on the host, see Host/Makefile.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+#include "bench_suites.h"
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC clock */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Wait for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Set core clock as 40MHz from MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART, PDMA, CRC, CRYPTO and ISP clocks */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(PDMA0_MODULE);
+    CLK_EnableModuleClock(CRC_MODULE);
+    CLK_EnableModuleClock(CRPT_MODULE);
+    CLK_EnableModuleClock(ISP_MODULE);
+
+    /*----------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                              */
+    /*----------------------------------------------------------------------*/
+    /* Set multi-function pins for UART0 RXD(PB.12) and TXD(PB.13) */
+    Uart0DefaultMPF();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+/*----------------------------------------------------------------------*/
+/* Init UART0                                                           */
+/*----------------------------------------------------------------------*/
+void UART0_Init(void)
+{
+    /* Reset UART0 */
+    SYS_ResetModule(UART0_RST);
+
+    /* Configure UART0 and set UART0 baud rate */
+    UART_Open(UART0, 115200);
+}
+
+int32_t main(void)
+{
+    uint32_t u32Fail;
+
+    /* Init System, IP clock and multi-function I/O. */
+    SYS_Init();
+
+    /* Init UART0 for printf */
+    UART0_Init();
+
+    /* FMC checksum case needs ISP enabled */
+    SYS_UnlockReg();
+    FMC_Open();
+
+    /* SysTick is the cycle counter from now on */
+    BENCH_Init();
+    BENCH_PrintHeader();
+
+    u32Fail = BenchDrv_Run(BENCH_CALLS);
+    u32Fail += BenchCrc_Run(BENCH_CALLS);
+    u32Fail += BenchAuth_Run(BENCH_CALLS);
+    u32Fail += BenchDsp_Run(BENCH_CALLS);
+    u32Fail += BenchFft_Run(BENCH_CALLS);
+
+    FMC_Close();
+    SYS_LockReg();
+
+    printf("# failed cases,%u\n", (unsigned int)u32Fail);
+
+    while(1);
+}
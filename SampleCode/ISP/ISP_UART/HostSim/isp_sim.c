@@ -0,0 +1,253 @@
+/**************************************************************************//**
+ * @file     isp_sim.c
+ * @version  V1.00
+ * @brief    Host-side flash and CRC simulator for the UART ISP commands
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <string.h>
+#include <stdint.h>
+
+#include "isp_sim.h"
+#include "fmc_user.h"
+#include "aes_sim.h"
+
+#define ISP_SIM_PAGE_NUM        (ISP_SIM_APROM_SIZE / FMC_FLASH_PAGE_SIZE)
+
+ISP_SIM_SYS_T g_sIspSimSys;
+ISP_SIM_FMC_T g_sIspSimFmc;
+ISP_SIM_SCB_T g_sIspSimScb;
+
+static uint8_t s_au8Aprom[ISP_SIM_APROM_SIZE] __attribute__((aligned(4)));
+static uint32_t s_au32Config[ISP_SIM_CONFIG_SIZE / 4];
+static uint32_t s_au32EraseCount[ISP_SIM_PAGE_NUM];
+static uint32_t s_u32Crc;
+
+/* Standard CRC-32 update with a word, least significant byte first */
+static uint32_t IspSim_Crc32(uint32_t u32Crc, uint32_t u32Data)
+{
+    uint32_t i;
+
+    for (i = 0; i < 32; i++, u32Data >>= 1)
+        u32Crc = (u32Crc >> 1) ^ (((u32Crc ^ u32Data) & 1UL) ? 0xEDB88320UL : 0);
+
+    return u32Crc;
+}
+
+/* Word of APROM or CONFIG, NULL outside both */
+static uint32_t *IspSim_Word(uint32_t u32Addr)
+{
+    if (u32Addr & 3UL)
+        return NULL;
+
+    if (u32Addr < ISP_SIM_APROM_SIZE)
+        return (uint32_t *)&s_au8Aprom[u32Addr];
+
+    if ((u32Addr >= FMC_CONFIG_BASE) && (u32Addr - FMC_CONFIG_BASE < ISP_SIM_CONFIG_SIZE))
+        return &s_au32Config[(u32Addr - FMC_CONFIG_BASE) / 4];
+
+    return NULL;
+}
+
+static int32_t IspSim_Erase(uint32_t u32Addr)
+{
+    if (u32Addr == FMC_CONFIG_BASE)
+    {
+        memset(s_au32Config, 0xFF, sizeof(s_au32Config));
+        return 0;
+    }
+
+    if ((u32Addr >= ISP_SIM_APROM_SIZE) || (u32Addr & (FMC_FLASH_PAGE_SIZE - 1UL)))
+        return -1;
+
+    memset(&s_au8Aprom[u32Addr], 0xFF, FMC_FLASH_PAGE_SIZE);
+    s_au32EraseCount[u32Addr / FMC_FLASH_PAGE_SIZE]++;
+    return 0;
+}
+
+/**
+ *  @brief  ISP command loop of fmc_user.c on the simulated flash. ISPFF is reported as -1.
+ */
+int FMC_Proc(uint32_t u32Cmd, uint32_t addr_start, uint32_t addr_end, uint32_t *data)
+{
+    uint32_t u32Addr, *pu32Word;
+
+    for (u32Addr = addr_start; u32Addr < addr_end; data++)
+    {
+        if (u32Cmd == FMC_ISPCMD_PAGE_ERASE)
+        {
+            if (IspSim_Erase(u32Addr) < 0)
+                return -1;
+
+            u32Addr += FMC_FLASH_PAGE_SIZE;
+            continue;
+        }
+
+        if ((pu32Word = IspSim_Word(u32Addr)) == NULL)
+            return -1;
+
+        if (u32Cmd == FMC_ISPCMD_PROGRAM)
+            *pu32Word &= *data;
+        else
+            *data = *pu32Word;
+
+        u32Addr += 4;
+    }
+
+    return 0;
+}
+
+/**
+ *  @brief  Write the CONFIG words as fmc_user.c does.
+ */
+void UpdateConfig(uint32_t *data, uint32_t *res)
+{
+    FMC_Proc(FMC_ISPCMD_PAGE_ERASE, Config0, Config0 + 8, 0);
+    FMC_Proc(FMC_ISPCMD_PROGRAM, Config0, Config0 + CONFIG_SIZE, data);
+
+    if (res)
+        FMC_Proc(FMC_ISPCMD_READ, Config0, Config0 + CONFIG_SIZE, res);
+}
+
+/**
+ *  @brief  Check that [u32addr, u32addr + u32count) of APROM is blank.
+ */
+uint32_t FMC_CheckAllOne(uint32_t u32addr, uint32_t u32count)
+{
+    uint32_t i;
+
+    if ((u32addr >= ISP_SIM_APROM_SIZE) || (u32count > ISP_SIM_APROM_SIZE - u32addr))
+        return READ_ALLONE_CMD_FAIL;
+
+    for (i = 0; i < u32count; i++)
+    {
+        if (s_au8Aprom[u32addr + i] != 0xFF)
+            return READ_ALLONE_NOT;
+    }
+
+    return READ_ALLONE_YES;
+}
+
+/**
+ *  @brief  FMC CRC32 checksum of [u32addr, u32addr + u32count) of APROM, a standard CRC-32.
+ */
+uint32_t FMC_GetChkSum(uint32_t u32addr, uint32_t u32count)
+{
+    uint32_t u32Crc = 0xFFFFFFFFUL, i;
+
+    if ((u32addr >= ISP_SIM_APROM_SIZE) || (u32count > ISP_SIM_APROM_SIZE - u32addr) ||
+            (u32addr & (FMC_FLASH_PAGE_SIZE - 1UL)) || (u32count & (FMC_FLASH_PAGE_SIZE - 1UL)))
+        return 0xFFFFFFFF;
+
+    for (i = 0; i < u32count; i += 4)
+        u32Crc = IspSim_Crc32(u32Crc, *(uint32_t *)&s_au8Aprom[u32addr + i]);
+
+    return ~u32Crc;
+}
+
+/**
+ *  @brief  Program a multi-word block. Like the FMC driver, a full FMC_MULTI_WORD_PROG_LEN block is programmed.
+ */
+int32_t FMC_WriteMultiple(uint32_t u32Addr, uint32_t pu32Buf[], uint32_t u32Len)
+{
+    (void)u32Len;
+
+    if ((u32Addr & 7UL) || (u32Addr >= ISP_SIM_APROM_SIZE) ||
+            (FMC_Proc(FMC_ISPCMD_PROGRAM, u32Addr, u32Addr + FMC_MULTI_WORD_PROG_LEN, pu32Buf) < 0))
+        return -2;
+
+    return FMC_MULTI_WORD_PROG_LEN;
+}
+
+/**
+ *  @brief  Start a standard CRC-32 (as zlib), the setting used by the ISP.
+ */
+void CRC_Open(uint32_t u32Mode, uint32_t u32Attribute, uint32_t u32Seed, uint32_t u32DataLen)
+{
+    (void)u32Mode;
+    (void)u32Attribute;
+    (void)u32DataLen;
+    s_u32Crc = u32Seed;
+}
+
+/**
+ *  @brief  Feed a word, least significant byte first, as the CRC engine with CRC_WDATA_RVS.
+ */
+void IspSim_CrcWrite(uint32_t u32Data)
+{
+    s_u32Crc = IspSim_Crc32(s_u32Crc, u32Data);
+}
+
+uint32_t CRC_GetChecksum(void)
+{
+    return ~s_u32Crc;
+}
+
+/**
+ *  @brief  AES-128 encrypt round of the CRYPTO DMA in place, len a multiple of 16.
+ *  @details The key and IV words are big-endian as the CRYPTO registers with AES_IN_OUT_SWAP.
+ *           pu32IV is replaced by the feedback: the next counter in CTR mode, the last cipher
+ *           block otherwise.
+ */
+int IspSim_Aes(const uint32_t *pu32Key, uint32_t *pu32IV, uint32_t u32OpMode, uint8_t *pu8Buf, uint32_t len)
+{
+    uint8_t au8Iv[16], au8Ks[16];
+    uint32_t i, j;
+
+    for (i = 0; i < 16; i++)
+        au8Iv[i] = (uint8_t)(pu32IV[i / 4] >> (24 - (i % 4) * 8));
+
+    for (i = 0; i < len; i += 16)
+    {
+        if (u32OpMode == AES_MODE_CTR)
+        {
+            AesSim_Encrypt(pu32Key, AES_KEY_SIZE_128, au8Iv, au8Ks);
+
+            for (j = 0; j < 16; j++)
+                pu8Buf[i + j] ^= au8Ks[j];
+
+            for (j = 16; (j-- != 0) && (++au8Iv[j] == 0);)
+                ;
+        }
+        else
+        {
+            for (j = 0; (u32OpMode == AES_MODE_CBC) && (j < 16); j++)
+                pu8Buf[i + j] ^= au8Iv[j];
+
+            AesSim_Encrypt(pu32Key, AES_KEY_SIZE_128, pu8Buf + i, pu8Buf + i);
+            memcpy(au8Iv, pu8Buf + i, 16);
+        }
+    }
+
+    for (i = 0; i < 4; i++)
+        pu32IV[i] = ((uint32_t)au8Iv[i * 4] << 24) | ((uint32_t)au8Iv[i * 4 + 1] << 16) | ((uint32_t)au8Iv[i * 4 + 2] << 8) | au8Iv[i * 4 + 3];
+
+    return 0;
+}
+
+/**
+ *  @brief  Pointer to the simulated APROM content.
+ */
+uint8_t *IspSim_Ptr(uint32_t u32Addr)
+{
+    return &s_au8Aprom[u32Addr];
+}
+
+/**
+ *  @brief  Erase APROM and CONFIG, clear the statistics and the registers.
+ */
+void IspSim_Reset(void)
+{
+    memset(s_au8Aprom, 0xFF, sizeof(s_au8Aprom));
+    memset(s_au32Config, 0xFF, sizeof(s_au32Config));
+    memset(s_au32EraseCount, 0, sizeof(s_au32EraseCount));
+    memset(&g_sIspSimSys, 0, sizeof(g_sIspSimSys));
+    memset(&g_sIspSimFmc, 0, sizeof(g_sIspSimFmc));
+    memset(&g_sIspSimScb, 0, sizeof(g_sIspSimScb));
+}
+
+uint32_t IspSim_GetEraseCount(uint32_t u32PageAddr)
+{
+    return s_au32EraseCount[u32PageAddr / FMC_FLASH_PAGE_SIZE];
+}
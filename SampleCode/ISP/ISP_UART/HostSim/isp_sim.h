@@ -0,0 +1,106 @@
+/**************************************************************************//**
+ * @file     isp_sim.h
+ * @version  V1.00
+ * @brief    Host-side flash and CRC simulator for the UART ISP commands
+ *
+ * @details
+ *           Build isp_user.c and targetdev.c on the host with -DISP_HOST_SIM and
+ *           this directory in the include path: targetdev.h then includes this
+ *           header instead of NuMicro.h. The FMC ISP commands work on a RAM image
+ *           of APROM and CONFIG with NOR flash semantics: erase sets a page to
+ *           0xFF and programming can only clear bits. The CRC engine is a software
+ *           CRC-32 and the registers written by the commands are plain structures.
+ *           The CRYPTO AES rounds of the secure update use the software AES of
+ *           Library/AuthLib/HostSim, built with -DAUTHLIB_HOST.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __ISP_SIM_H
+#define __ISP_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __STATIC_INLINE         static inline
+#define TRUE                    (1UL)
+#define FALSE                   (0UL)
+
+#define outpw(port,value)       (*((volatile unsigned int *)(port))=(value))
+#define inpw(port)              ((*((volatile unsigned int *)(port))))
+#define outps(port,value)       (*((volatile unsigned short *)(port))=(value))
+
+#define ISP_SIM_APROM_SIZE      0x40000UL       /*!< Simulated APROM size (256 KB) */
+#define ISP_SIM_CONFIG_SIZE     16UL            /*!< Simulated CONFIG words */
+
+/* Same values as the FMC driver constants */
+#define FMC_APROM_BASE          0x00000000UL    /*!< APROM base address */
+#define FMC_CONFIG_BASE         0x0F300000UL    /*!< User Configuration address */
+#define FMC_FLASH_PAGE_SIZE     0x200UL         /*!< Flash Page Size (512 bytes) */
+#define FMC_MULTI_WORD_PROG_LEN 128             /*!< The maximum length of a multi-word program. */
+#define FMC_ISPCMD_READ         0x00UL          /*!< ISP Command: Read flash word */
+#define FMC_ISPCMD_PROGRAM      0x21UL          /*!< ISP Command: Write flash word */
+#define FMC_ISPCMD_PAGE_ERASE   0x22UL          /*!< ISP Command: Page Erase Flash */
+#define READ_ALLONE_YES         0xA11FFFFFUL    /*!< Check-all-one result is all one. */
+#define READ_ALLONE_NOT         0xA1100000UL    /*!< Check-all-one result is not all one. */
+#define READ_ALLONE_CMD_FAIL    0xFFFFFFFFUL    /*!< Check-all-one command failed. */
+
+/* Only the standard CRC-32 setting of the ISP is simulated, the attributes are ignored */
+#define CRC_32                  (3UL << 30)     /*!< CRC Polynomial Mode - CRC32 */
+#define CRC_CHECKSUM_COM        (1UL << 27)     /*!< CRC Checksum Complement */
+#define CRC_CHECKSUM_RVS        (1UL << 25)     /*!< CRC Checksum Reverse */
+#define CRC_WDATA_RVS           (1UL << 24)     /*!< CRC Write Data Reverse */
+#define CRC_CPU_WDATA_32        (2UL << 4)      /*!< CRC CPU Write Data length is 32-bit */
+#define CRC_WRITE_DATA(u32Data) IspSim_CrcWrite(u32Data)
+
+/* Same values as the CRYPTO driver constants */
+#define AES_MODE_ECB            (0UL)           /*!< AES select ECB mode */
+#define AES_MODE_CBC            (1UL)           /*!< AES select CBC mode */
+#define AES_MODE_CTR            (4UL)           /*!< AES select CTR mode */
+
+typedef struct
+{
+    uint32_t PDID;
+    uint32_t RSTSTS;
+} ISP_SIM_SYS_T;
+
+typedef struct
+{
+    uint32_t ISPCTL;
+} ISP_SIM_FMC_T;
+
+typedef struct
+{
+    uint32_t AIRCR;
+} ISP_SIM_SCB_T;
+
+extern ISP_SIM_SYS_T g_sIspSimSys;
+extern ISP_SIM_FMC_T g_sIspSimFmc;
+extern ISP_SIM_SCB_T g_sIspSimScb;
+
+#define SYS                     (&g_sIspSimSys)
+#define FMC                     (&g_sIspSimFmc)
+#define SCB                     (&g_sIspSimScb)
+
+uint32_t FMC_CheckAllOne(uint32_t u32addr, uint32_t u32count);
+uint32_t FMC_GetChkSum(uint32_t u32addr, uint32_t u32count);
+int32_t  FMC_WriteMultiple(uint32_t u32Addr, uint32_t pu32Buf[], uint32_t u32Len);
+void     CRC_Open(uint32_t u32Mode, uint32_t u32Attribute, uint32_t u32Seed, uint32_t u32DataLen);
+uint32_t CRC_GetChecksum(void);
+
+void     IspSim_CrcWrite(uint32_t u32Data);
+int      IspSim_Aes(const uint32_t *pu32Key, uint32_t *pu32IV, uint32_t u32OpMode, uint8_t *pu8Buf, uint32_t len);
+uint8_t *IspSim_Ptr(uint32_t u32Addr);
+void     IspSim_Reset(void);
+uint32_t IspSim_GetEraseCount(uint32_t u32PageAddr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __ISP_SIM_H */
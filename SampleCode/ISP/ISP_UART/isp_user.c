@@ -30,6 +30,9 @@ static uint8_t aprom_buf[FMC_FLASH_PAGE_SIZE] __attribute__((aligned(4)));
 
 uint32_t bUpdateApromCmd;
 uint32_t g_apromSize, g_dataFlashAddr, g_dataFlashSize;
+#if ISP_EXT_MODE
+uint32_t g_u32ExtPayload, g_u32ExtWindow;
+#endif
 
 __STATIC_INLINE uint16_t Checksum(unsigned char *buf, int len)
 {
@@ -44,6 +47,429 @@ __STATIC_INLINE uint16_t Checksum(unsigned char *buf, int len)
     return (c);
 }
 
+/* Commands followed by data packets */
+#if ISP_DIFF_MODE
+#define IS_UPDATE_CMD(cmd)  (((cmd) == CMD_UPDATE_APROM) || ((cmd) == CMD_UPDATE_DATAFLASH) || ((cmd) == CMD_UPDATE_PAGES))
+#else
+#define IS_UPDATE_CMD(cmd)  (((cmd) == CMD_UPDATE_APROM) || ((cmd) == CMD_UPDATE_DATAFLASH))
+#endif
+
+#if ISP_DIFF_MODE || ISP_EXT_MODE
+/* Page aligned range inside the application APROM, Data Flash included */
+static uint32_t CheckPageRange(uint32_t u32Addr, uint32_t u32Len)
+{
+    return ((u32Addr % FMC_FLASH_PAGE_SIZE) == 0) && (u32Len != 0) && (u32Addr >= ISP_APP_BASE) &&
+           (u32Addr < g_apromSize) && (u32Len <= g_apromSize - u32Addr);
+}
+
+/* Erase the pages covering [u32Addr, u32Addr + u32Len), the pages already blank are skipped */
+static int ErasePages(uint32_t u32Addr, uint32_t u32Len)
+{
+    uint32_t u32End = u32Addr + u32Len;
+
+    for (; u32Addr < u32End; u32Addr += FMC_FLASH_PAGE_SIZE)
+    {
+        if ((FMC_CheckAllOne(u32Addr, FMC_FLASH_PAGE_SIZE) != READ_ALLONE_YES) && (FMC_Erase_User(u32Addr) < 0))
+        {
+            return (-1);
+        }
+    }
+
+    return (0);
+}
+#endif
+
+#if ISP_EXT_MODE
+static uint32_t s_u32ExtSeq, s_u32ExtNak;
+
+/* Standard CRC-32 (as zlib) of u32Len bytes, u32Len a multiple of 4 */
+static uint32_t ExtCrc32(uint32_t *pu32Buf, uint32_t u32Len)
+{
+    CRC_Open(CRC_32, (CRC_WDATA_RVS | CRC_CHECKSUM_RVS | CRC_CHECKSUM_COM), 0xFFFFFFFF, CRC_CPU_WDATA_32);
+
+    for (; u32Len; u32Len -= 4)
+    {
+        CRC_WRITE_DATA(*pu32Buf++);
+    }
+
+    return CRC_GetChecksum();
+}
+
+static void ExtNegotiate(uint32_t u32Payload, uint32_t u32Window)
+{
+    /* Payload is a whole number of multi-word program blocks, up to one flash page */
+    if (u32Payload > EXT_MAX_PAYLOAD)
+    {
+        u32Payload = EXT_MAX_PAYLOAD;
+    }
+
+    u32Payload -= u32Payload % FMC_MULTI_WORD_PROG_LEN;
+
+    if (u32Window > EXT_MAX_WINDOW)
+    {
+        u32Window = EXT_MAX_WINDOW;
+    }
+
+    if (u32Payload == 0)
+    {
+        u32Window = 0;
+    }
+
+    g_u32ExtPayload = u32Payload;
+    g_u32ExtWindow = u32Window;
+    s_u32ExtSeq = 0;
+    s_u32ExtNak = 0;
+}
+
+static uint32_t ExtCheckRange(uint32_t u32Addr, uint32_t u32Len, uint32_t u32Align)
+{
+    return ((u32Addr % u32Align) == 0) && ((u32Len % 4) == 0) && (u32Len != 0) && (u32Addr >= ISP_APP_BASE) &&
+           (u32Addr < g_apromSize) && (u32Len <= g_apromSize - u32Addr);
+}
+
+/* Program len bytes from pSrc to addr, addr aligned to FMC_MULTI_WORD_PROG_LEN, and read them back */
+static uint32_t ExtProgram(uint32_t addr, unsigned char *pSrc, uint32_t len)
+{
+    uint32_t i, u32Status = EXT_STS_OK;
+
+    /* Multi-word program always writes a full block, 0xFF padding leaves the erased cells unchanged */
+    memset(pSrc + len, 0xFF, (FMC_MULTI_WORD_PROG_LEN - (len % FMC_MULTI_WORD_PROG_LEN)) % FMC_MULTI_WORD_PROG_LEN);
+
+    for (i = 0; i < len; i += FMC_MULTI_WORD_PROG_LEN)
+    {
+        if (FMC_WriteMultiple(addr + i, (uint32_t *)(pSrc + i), FMC_MULTI_WORD_PROG_LEN) < 0)
+        {
+            u32Status = EXT_STS_FLASH;
+        }
+    }
+
+    /* Read back through ISP, as the legacy protocol does */
+    ReadData(addr, addr + len, (uint32_t *)aprom_buf);
+
+    if (memcmp(aprom_buf, pSrc, len) != 0)
+    {
+        u32Status = EXT_STS_FLASH;
+    }
+
+    return u32Status;
+}
+
+#if ISP_SEC_MODE
+#define SEC_BE32(p)     (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | ((uint32_t)(p)[2] << 8) | (p)[3])
+
+static const uint32_t s_au32SecEncKey[4] = ISP_SEC_ENC_KEY;
+static const uint32_t s_au32SecMacKey[4] = ISP_SEC_MAC_KEY;
+static uint32_t s_au32SecNonce[3], s_u32SecAddr, s_u32SecLen, s_u32SecType, s_u32SecPending;
+#ifdef __ICCARM__
+#pragma data_alignment=4
+static uint8_t s_au8SecHold[FMC_FLASH_PAGE_SIZE];     /* First page of the image, programmed after the verify */
+#else
+static uint8_t s_au8SecHold[FMC_FLASH_PAGE_SIZE] __attribute__((aligned(4)));
+#endif
+
+#ifdef ISP_HOST_SIM
+#define SecAes      IspSim_Aes      /* Software AES of the host simulator */
+#else
+/*
+ * One AES-128 encrypt round of the CRYPTO DMA in place, pu8Buf word aligned and len a multiple of 16.
+ * pu32IV is replaced by the feedback, the last cipher block in CBC mode.
+ */
+static int SecAes(const uint32_t *pu32Key, uint32_t *pu32IV, uint32_t u32OpMode, uint8_t *pu8Buf, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        CRPT->AES_KEY[i] = pu32Key[i];
+        CRPT->AES_IV[i] = pu32IV[i];
+    }
+
+    CRPT->AES_SADDR = (uint32_t)pu8Buf;
+    CRPT->AES_DADDR = (uint32_t)pu8Buf;
+    CRPT->AES_CNT = len;
+    CRPT->INTSTS = (CRPT_INTSTS_AESIF_Msk | CRPT_INTSTS_AESEIF_Msk);
+    CRPT->AES_CTL = CRPT_AES_CTL_ENCRPT_Msk | (u32OpMode << CRPT_AES_CTL_OPMODE_Pos) |
+                    (AES_IN_OUT_SWAP << CRPT_AES_CTL_OUTSWAP_Pos) | (CRYPTO_DMA_ONE_SHOT << CRPT_AES_CTL_DMALAST_Pos) |
+                    CRPT_AES_CTL_START_Msk;
+
+    while (((CRPT->INTSTS & CRPT_INTSTS_AESEIF_Msk) == 0) &&
+            (((CRPT->INTSTS & CRPT_INTSTS_AESIF_Msk) == 0) || (CRPT->AES_STS & CRPT_AES_STS_BUSY_Msk)));
+
+    for (i = 0; i < 4; i++)
+    {
+        pu32IV[i] = CRPT->AES_FDBCK[i];
+    }
+
+    return (CRPT->INTSTS & CRPT_INTSTS_AESEIF_Msk) ? (-1) : (0);
+}
+#endif
+
+/* Decrypt a packet of the image in place, keep the part in the first page and program the rest */
+static uint32_t SecWrite(uint32_t addr, unsigned char *pSrc, uint32_t len)
+{
+    uint32_t au32Ctr[4], u32Ofs = addr - s_u32SecAddr, u32Hold = 0;
+
+    au32Ctr[0] = s_au32SecNonce[0];
+    au32Ctr[1] = s_au32SecNonce[1];
+    au32Ctr[2] = s_au32SecNonce[2];
+    au32Ctr[3] = u32Ofs / 16;
+
+    if (SecAes(s_au32SecEncKey, au32Ctr, AES_MODE_CTR, pSrc, len) < 0)
+    {
+        return EXT_STS_FLASH;
+    }
+
+    if (u32Ofs < FMC_FLASH_PAGE_SIZE)
+    {
+        u32Hold = (len < FMC_FLASH_PAGE_SIZE - u32Ofs) ? len : (FMC_FLASH_PAGE_SIZE - u32Ofs);
+        memcpy(&s_au8SecHold[u32Ofs], pSrc, u32Hold);
+    }
+
+    return (len > u32Hold) ? ExtProgram(addr + u32Hold, pSrc + u32Hold, len - u32Hold) : EXT_STS_OK;
+}
+
+/* CRC32 or CMAC of the plain image, the first page from the hold buffer. Return 0 if it matches pu8Expect. */
+static int SecVerify(const uint8_t *pu8Expect)
+{
+    uint32_t au32Mac[4] = {0}, au32K1[4] = {0}, u32End = s_u32SecAddr + s_u32SecLen, addr, len = 0, i;
+    uint8_t *pu8K1 = (uint8_t *)au32K1, u8Msb, u8Diff = 0;
+
+    if (s_u32SecType == SEC_VERIFY_CMAC)
+    {
+        /* The image is whole blocks, the last one is masked with subkey K1 = 2.E(0) */
+        if (SecAes(s_au32SecMacKey, au32Mac, AES_MODE_ECB, pu8K1, 16) < 0)
+        {
+            return (-1);
+        }
+
+        u8Msb = pu8K1[0] >> 7;
+
+        for (i = 0; i < 15; i++)
+        {
+            pu8K1[i] = (uint8_t)((pu8K1[i] << 1) | (pu8K1[i + 1] >> 7));
+        }
+
+        pu8K1[15] = (uint8_t)((pu8K1[15] << 1) ^ (u8Msb ? 0x87 : 0));
+        memset(au32Mac, 0, sizeof(au32Mac));
+    }
+    else
+    {
+        CRC_Open(CRC_32, (CRC_WDATA_RVS | CRC_CHECKSUM_RVS | CRC_CHECKSUM_COM), 0xFFFFFFFF, CRC_CPU_WDATA_32);
+    }
+
+    for (addr = s_u32SecAddr; addr < u32End; addr += len)
+    {
+        len = (u32End - addr < FMC_FLASH_PAGE_SIZE) ? (u32End - addr) : FMC_FLASH_PAGE_SIZE;
+
+        if (addr == s_u32SecAddr)
+        {
+            memcpy(aprom_buf, s_au8SecHold, len);
+        }
+        else
+        {
+            ReadData(addr, addr + len, (uint32_t *)aprom_buf);
+        }
+
+        if (s_u32SecType == SEC_VERIFY_CRC32)
+        {
+            for (i = 0; i < len; i += 4)
+            {
+                CRC_WRITE_DATA(inpw(aprom_buf + i));
+            }
+        }
+        else
+        {
+            if (addr + len == u32End)
+            {
+                for (i = 0; i < 16; i++)
+                {
+                    aprom_buf[len - 16 + i] ^= pu8K1[i];
+                }
+            }
+
+            /* CBC-MAC, the chaining value goes on from the feedback of the previous page */
+            if (SecAes(s_au32SecMacKey, au32Mac, AES_MODE_CBC, aprom_buf, len) < 0)
+            {
+                return (-1);
+            }
+        }
+    }
+
+    if (s_u32SecType == SEC_VERIFY_CRC32)
+    {
+        return (CRC_GetChecksum() == inpw(pu8Expect)) ? (0) : (-1);
+    }
+
+    /* The tag is the last cipher block */
+    for (i = 0; i < 16; i++)
+    {
+        u8Diff |= aprom_buf[len - 16 + i] ^ pu8Expect[i];
+    }
+
+    return u8Diff ? (-1) : (0);
+}
+#endif
+
+/* Process one extended packet. Return the acknowledgement length in response_buff, 0 if none. */
+uint32_t ParseExtCmd(unsigned char *buffer)
+{
+    uint32_t lcmd, seq, addr, len, i, u32Status = EXT_STS_OK, u32Value = 0;
+    uint32_t u32CrcOffset = EXT_HDR_SIZE + g_u32ExtPayload;
+    unsigned char *pSrc = buffer + EXT_HDR_SIZE;
+
+    lcmd = inpw(buffer);
+    seq = inpw(buffer + 4);
+    addr = inpw(buffer + 8);
+    len = inpw(buffer + 12);
+
+    if (ExtCrc32((uint32_t *)buffer, u32CrcOffset) != inpw(buffer + u32CrcOffset))
+    {
+        u32Status = EXT_STS_CRC;
+    }
+    else if (seq != s_u32ExtSeq)
+    {
+        u32Status = EXT_STS_SEQ;
+    }
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_ERASE)
+    {
+        if (!CheckPageRange(addr, len) || (len % FMC_FLASH_PAGE_SIZE))
+        {
+            u32Status = EXT_STS_PARAM;
+        }
+        else if (ErasePages(addr, len) < 0)
+        {
+            u32Status = EXT_STS_FLASH;
+        }
+    }
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_WRITE)
+    {
+        if (!ExtCheckRange(addr, len, FMC_MULTI_WORD_PROG_LEN) || (len > g_u32ExtPayload))
+        {
+            u32Status = EXT_STS_PARAM;
+        }
+        else
+        {
+            u32Status = ExtProgram(addr, pSrc, len);
+        }
+    }
+#if ISP_SEC_MODE
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_SEC_BEGIN)
+    {
+        if ((addr != ISP_APP_BASE) || !CheckPageRange(addr, len) || (len % 16) || (inpw(pSrc + 12) > SEC_VERIFY_CMAC))
+        {
+            u32Status = EXT_STS_PARAM;
+        }
+        else
+        {
+            for (i = 0; i < 3; i++)
+            {
+                s_au32SecNonce[i] = SEC_BE32(pSrc + i * 4);
+            }
+
+            s_u32SecAddr = addr;
+            s_u32SecLen = len;
+            s_u32SecType = inpw(pSrc + 12);
+            s_u32SecPending = 1;
+            memset(s_au8SecHold, 0xFF, FMC_FLASH_PAGE_SIZE);
+
+            /* No old vector table is left under the new image. The host erases the other pages with CMD_EXT_ERASE. */
+            if (ErasePages(addr, FMC_FLASH_PAGE_SIZE) < 0)
+            {
+                u32Status = EXT_STS_FLASH;
+            }
+        }
+    }
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_SEC_WRITE)
+    {
+        if (!s_u32SecPending || !ExtCheckRange(addr, len, FMC_MULTI_WORD_PROG_LEN) || (len > g_u32ExtPayload) ||
+                (len % 16) || (addr < s_u32SecAddr) || (len > s_u32SecLen - (addr - s_u32SecAddr)))
+        {
+            u32Status = EXT_STS_PARAM;
+        }
+        else
+        {
+            u32Status = SecWrite(addr, pSrc, len);
+        }
+    }
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_SEC_VERIFY)
+    {
+        if (!s_u32SecPending)
+        {
+            u32Status = EXT_STS_PARAM;
+        }
+        else if (SecVerify(pSrc) != 0)
+        {
+            u32Status = EXT_STS_AUTH;
+        }
+        else if ((u32Status = ExtProgram(s_u32SecAddr, s_au8SecHold,
+                                         (s_u32SecLen < FMC_FLASH_PAGE_SIZE) ? s_u32SecLen : FMC_FLASH_PAGE_SIZE)) == EXT_STS_OK)
+        {
+            s_u32SecPending = 0;
+        }
+
+        lcmd |= CMD_EXT_ACK_REQ;
+    }
+#endif
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_VERIFY)
+    {
+        if (!ExtCheckRange(addr, len, 4))
+        {
+            u32Status = EXT_STS_PARAM;
+        }
+        else
+        {
+            CRC_Open(CRC_32, (CRC_WDATA_RVS | CRC_CHECKSUM_RVS | CRC_CHECKSUM_COM), 0xFFFFFFFF, CRC_CPU_WDATA_32);
+
+            for (i = addr; i < addr + len; i += 4)
+            {
+                FMC_Read_User(i, &u32Value);
+                CRC_WRITE_DATA(u32Value);
+            }
+
+            u32Value = CRC_GetChecksum();
+        }
+
+        lcmd |= CMD_EXT_ACK_REQ;
+    }
+    else if ((lcmd & ~CMD_EXT_ACK_REQ) == CMD_EXT_EXIT)
+    {
+        g_u32ExtWindow = 0;
+        lcmd |= CMD_EXT_ACK_REQ;
+    }
+    else
+    {
+        u32Status = EXT_STS_PARAM;
+    }
+
+    if (u32Status == EXT_STS_OK)
+    {
+        s_u32ExtSeq++;
+        s_u32ExtNak = 0;
+
+        /* Acknowledge by window, so that the host keeps the remaining packets in flight */
+        if (!(lcmd & CMD_EXT_ACK_REQ) && (g_u32ExtWindow != 0) && ((s_u32ExtSeq % ((g_u32ExtWindow + 1) / 2)) != 0))
+        {
+            return 0;
+        }
+    }
+    else if (s_u32ExtNak && (seq != s_u32ExtSeq))
+    {
+        /* Already reported, drop the packets in flight until the host resends from the expected seq */
+        return 0;
+    }
+    else
+    {
+        s_u32ExtNak = 1;
+    }
+
+    outpw(response_buff, CMD_EXT_ACK | (u32Status << 8));
+    outpw(response_buff + 4, s_u32ExtSeq);
+    outpw(response_buff + 8, u32Value);
+    outpw(response_buff + 12, ExtCrc32((uint32_t *)response_buff, 12));
+    return EXT_ACK_SIZE;
+}
+#endif
+
 int ParseCmd(unsigned char *buffer, uint8_t len)
 {
     static uint32_t StartAddress, TotalLen, LastDataLen, g_packno = 1;
@@ -112,9 +538,34 @@ int ParseCmd(unsigned char *buffer, uint8_t len)
         g_packno = 1;
         goto out;
     }
+#if ISP_DIFF_MODE
+    else if (lcmd == CMD_GET_PAGE_CHKSUM)
+    {
+        uint32_t addr;
+
+        /* FMC CRC32 of PAGE_CHKSUM_NUM pages, 0xFFFFFFFF past the end of APROM or when secured */
+        for (i = 0, addr = inpw(pSrc); i < PAGE_CHKSUM_NUM; i++, addr += FMC_FLASH_PAGE_SIZE)
+        {
+            outpw(response + 8 + i * 4, (security && CheckPageRange(addr, FMC_FLASH_PAGE_SIZE)) ?
+                  FMC_GetChkSum(addr, FMC_FLASH_PAGE_SIZE) : 0xFFFFFFFF);
+        }
+
+        goto out;
+    }
+#endif
+#if ISP_EXT_MODE
+    else if (lcmd == CMD_EXT_NEGOTIATE)
+    {
+        ExtNegotiate(inpw(pSrc), inpw(pSrc + 4));
+        outpw(response + 8, g_u32ExtPayload);
+        outpw(response + 12, g_u32ExtWindow);
+        outpw(response + 16, EXT_VERSION);
+        goto out;
+    }
+#endif
     else if ((lcmd == CMD_UPDATE_APROM) || (lcmd == CMD_ERASE_ALL))
     {
-        EraseAP(FMC_APROM_BASE, (g_apromSize < g_dataFlashAddr) ? g_apromSize : g_dataFlashAddr); /* erase APROM */
+        EraseAP(ISP_APP_BASE, ((g_apromSize < g_dataFlashAddr) ? g_apromSize : g_dataFlashAddr) - ISP_APP_BASE); /* erase APROM */
 
         if (lcmd == CMD_ERASE_ALL)
         {
@@ -126,7 +577,7 @@ int ParseCmd(unsigned char *buffer, uint8_t len)
         bUpdateApromCmd = TRUE;
     }
 
-    if ((lcmd == CMD_UPDATE_APROM) || (lcmd == CMD_UPDATE_DATAFLASH))
+    if (IS_UPDATE_CMD(lcmd))
     {
         if (lcmd == CMD_UPDATE_DATAFLASH)
         {
@@ -141,9 +592,23 @@ int ParseCmd(unsigned char *buffer, uint8_t len)
                 goto out;
             }
         }
+#if ISP_DIFF_MODE
+        else if (lcmd == CMD_UPDATE_PAGES)
+        {
+            StartAddress = inpw(pSrc);
+
+            /* Only the pages sent by the host are erased. A secured chip needs a full CMD_UPDATE_APROM. */
+            if ((security == 0) || !CheckPageRange(StartAddress, inpw(pSrc + 4)) ||
+                    (ErasePages(StartAddress, inpw(pSrc + 4)) < 0))
+            {
+                gcmd = 0;
+                goto out;
+            }
+        }
+#endif
         else
         {
-            StartAddress = 0;
+            StartAddress = ISP_APP_BASE;
         }
 
         TotalLen = inpw(pSrc + 4);
@@ -168,7 +633,7 @@ int ParseCmd(unsigned char *buffer, uint8_t len)
         TotalLen += LastDataLen;
         PageAddress = StartAddress & (0x100000 - FMC_FLASH_PAGE_SIZE);
 
-        if (PageAddress >= Config0)
+        if ((PageAddress >= Config0) || (PageAddress < ISP_APP_BASE))
         {
             goto out;
         }
@@ -185,7 +650,7 @@ int ParseCmd(unsigned char *buffer, uint8_t len)
         goto out;
     }
 
-    if ((gcmd == CMD_UPDATE_APROM) || (gcmd == CMD_UPDATE_DATAFLASH))
+    if (IS_UPDATE_CMD(gcmd))
     {
         if (TotalLen < srclen)
         {
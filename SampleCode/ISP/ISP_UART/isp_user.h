@@ -30,6 +30,144 @@
 #define CMD_UPDATE_DATAFLASH  0x000000C3
 #define CMD_RESEND_PACKET     0x000000FF
 
+/*
+ * APROM loader build (ISP_APROM_LOADER defined by the ISP_UART_APROM projects). The same sources
+ * are linked at APROM 0 into an ISP_LOADER_SIZE region, the linker fails the build if they do not
+ * fit. The application is linked at ISP_APP_BASE and booted through the vector page remap. The
+ * loader never erases nor programs below ISP_APP_BASE. The 4 KB LDROM build keeps the legacy
+ * protocol only, the differential update, the extended protocol and the secure update are
+ * budgeted for the loader.
+ */
+#ifdef ISP_APROM_LOADER
+#define ISP_LOADER_SIZE       0x4000
+#define ISP_APP_BASE          (FMC_APROM_BASE + ISP_LOADER_SIZE)
+#else
+#define ISP_APP_BASE          FMC_APROM_BASE
+#endif
+
+/*
+ * Differential update. CMD_GET_PAGE_CHKSUM returns the FMC CRC32 checksum of PAGE_CHKSUM_NUM
+ * pages from the page address at offset 8. CMD_UPDATE_PAGES works as CMD_UPDATE_APROM with the
+ * page aligned start address at offset 8 and the length at offset 12, but only erases the pages
+ * in that range which are not blank. The host sends the changed pages only. The loader pages
+ * read as 0xFFFFFFFF and cannot be updated.
+ */
+#ifndef ISP_DIFF_MODE
+#ifdef ISP_APROM_LOADER
+#define ISP_DIFF_MODE         1
+#else
+#define ISP_DIFF_MODE         0
+#endif
+#endif
+
+#if ISP_DIFF_MODE && !defined(ISP_APROM_LOADER)
+#error "ISP_DIFF_MODE does not fit the LDROM budget, build the ISP_UART_APROM loader"
+#endif
+
+#define CMD_GET_PAGE_CHKSUM   0x000000C4
+#define CMD_UPDATE_PAGES      0x000000C5
+#define PAGE_CHKSUM_NUM       14
+
+/*
+ * Extended protocol. CMD_EXT_NEGOTIATE is sent as a legacy 64-byte packet, with the requested
+ * payload size and window at offset 8 and 12. The response returns the accepted payload size,
+ * window and extended protocol version at offset 8, 12 and 16. A window of 0 means refused.
+ *
+ * After a successful negotiation both sides exchange fixed-size extended packets:
+ *   cmd | seq | addr | len | payload (negotiated size) | CRC32 of all previous bytes
+ * The device answers with an EXT_ACK_SIZE acknowledgement:
+ *   CMD_EXT_ACK | (status << 8) | next expected seq | value | CRC32 of the previous 12 bytes
+ * Up to "window" packets may be in flight. The device acknowledges every (window + 1) / 2
+ * packets, on CMD_EXT_ACK_REQ and on error. After an error the device drops the packets with
+ * another seq until the host resends from the expected seq (go-back-N), and reports again each
+ * resent packet which fails. The host should keep the line idle for the RX time-out before
+ * resending, so the receiver can resynchronize, and resend after a time-out without answer.
+ */
+#ifndef ISP_EXT_MODE
+#ifdef ISP_APROM_LOADER
+#define ISP_EXT_MODE          1
+#else
+#define ISP_EXT_MODE          0
+#endif
+#endif
+
+#if ISP_EXT_MODE && !defined(ISP_APROM_LOADER)
+#error "ISP_EXT_MODE does not fit the LDROM budget, build the ISP_UART_APROM loader"
+#endif
+
+#define CMD_EXT_NEGOTIATE     0x000000D0
+#define CMD_EXT_ERASE         0x000000D1    /* Erase pages in [addr, addr + len) */
+#define CMD_EXT_WRITE         0x000000D2    /* Program payload to addr, addr aligned to FMC_MULTI_WORD_PROG_LEN */
+#define CMD_EXT_VERIFY        0x000000D3    /* Return CRC32 of flash in [addr, addr + len) as value */
+#define CMD_EXT_EXIT          0x000000D4    /* Return to the legacy protocol */
+#define CMD_EXT_ACK           0x000000D5
+#define CMD_EXT_ACK_REQ       0x80000000    /* Flag in cmd: acknowledge this packet immediately */
+
+#define EXT_VERSION           0x01
+#define EXT_HDR_SIZE          16
+#define EXT_CRC_SIZE          4
+#define EXT_ACK_SIZE          16
+#define EXT_MAX_PAYLOAD       FMC_FLASH_PAGE_SIZE
+#define EXT_MAX_WINDOW        4
+#define EXT_PKT_SIZE(payload) (EXT_HDR_SIZE + (payload) + EXT_CRC_SIZE)
+
+#define EXT_STS_OK            0x00
+#define EXT_STS_CRC           0x01          /* Packet CRC32 mismatch */
+#define EXT_STS_SEQ           0x02          /* Unexpected sequence number */
+#define EXT_STS_PARAM         0x03          /* Bad command, address or length */
+#define EXT_STS_FLASH         0x04          /* Erase, program or verify failed */
+#define EXT_STS_AUTH          0x05          /* Secure image CRC32 or CMAC mismatch */
+
+/*
+ * Secure update, extended packets only. The host encrypts the image with AES-128-CTR, counter
+ * block = nonce (12 bytes) | big-endian block index from the image start, and pads it with 0xFF
+ * to a multiple of 16 bytes. The image starts at ISP_APP_BASE.
+ *   CMD_EXT_SEC_BEGIN  : addr, len of the image, payload = nonce | verify type (word at offset 12)
+ *   CMD_EXT_SEC_WRITE  : as CMD_EXT_WRITE inside the image, the payload is decrypted in place by
+ *                        CRYPTO DMA before programming
+ *   CMD_EXT_SEC_VERIFY : payload = CRC32 (word) or AES-128-CMAC (16 bytes) of the plain image
+ * BEGIN erases only the first page of the image, which is kept in RAM and programmed only after
+ * a successful verify. The host must erase the other pages of the image with CMD_EXT_ERASE
+ * before the first SEC_WRITE, a write to a page not erased fails its read back. An interrupted
+ * or rejected update never leaves a bootable image: the loader stays in ISP mode while the
+ * first application page is blank. CRC32 only detects transfer errors, CMAC also rejects forged
+ * images. Production loaders should leave out the plain text commands.
+ */
+#ifndef ISP_SEC_MODE
+#ifdef ISP_APROM_LOADER
+#define ISP_SEC_MODE          1
+#else
+#define ISP_SEC_MODE          0
+#endif
+#endif
+
+#if ISP_SEC_MODE && !ISP_EXT_MODE
+#error "ISP_SEC_MODE needs ISP_EXT_MODE"
+#endif
+
+#define CMD_EXT_SEC_BEGIN     0x000000D6
+#define CMD_EXT_SEC_WRITE     0x000000D7
+#define CMD_EXT_SEC_VERIFY    0x000000D8
+
+#define SEC_VERIFY_CRC32      0
+#define SEC_VERIFY_CMAC       1
+
+/*
+ * Device AES-128 keys, as AES_SetKey(). There are no default keys: each product provisions its
+ * own random keys in isp_sec_keys.h, next to this file and kept out of version control:
+ *   #define ISP_SEC_ENC_KEY       {0x........, 0x........, 0x........, 0x........}
+ *   #define ISP_SEC_MAC_KEY       {0x........, 0x........, 0x........, 0x........}
+ * with the words of "od -An -tx4 -N16 /dev/urandom", run once per key. The host tool signs and
+ * encrypts with the same keys. Lock the chip so that the loader cannot be read back.
+ */
+#if ISP_SEC_MODE && !defined(ISP_SEC_ENC_KEY)
+#include "isp_sec_keys.h"                   /* Provisioned device keys, see above */
+#endif
+
+#if ISP_SEC_MODE && (!defined(ISP_SEC_ENC_KEY) || !defined(ISP_SEC_MAC_KEY))
+#error "ISP_SEC_MODE needs the provisioned ISP_SEC_ENC_KEY and ISP_SEC_MAC_KEY"
+#endif
+
 #define V6M_AIRCR_VECTKEY_DATA    0x05FA0000UL
 #define V6M_AIRCR_SYSRESETREQ     0x00000004UL
 
@@ -39,6 +177,8 @@ extern uint32_t GetApromSize(void);
 
 // isp_user.c
 extern int ParseCmd(unsigned char *buffer, uint8_t len);
+extern uint32_t ParseExtCmd(unsigned char *buffer);
+extern uint32_t g_u32ExtPayload, g_u32ExtWindow;
 extern uint32_t g_apromSize, g_dataFlashAddr, g_dataFlashSize;
 
 #ifdef __ICCARM__
@@ -55,6 +55,14 @@ int32_t main(void)
     UART_Init();
 
     CLK->AHBCLK0 |= CLK_AHBCLK0_ISPCKEN_Msk;
+#if ISP_EXT_MODE
+    /* CRC engine checks the extended protocol packets */
+    CLK->AHBCLK0 |= CLK_AHBCLK0_CRCCKEN_Msk;
+#endif
+#if ISP_SEC_MODE
+    /* CRYPTO engine decrypts and authenticates the secure update images */
+    CLK->AHBCLK0 |= CLK_AHBCLK0_CRPTCKEN_Msk;
+#endif
     FMC->ISPCTL |= (FMC_ISPCTL_ISPEN_Msk | FMC_ISPCTL_APUEN_Msk);
     g_apromSize = GetApromSize();
     GetDataFlashInfo(&g_dataFlashAddr, &g_dataFlashSize);
@@ -82,6 +90,18 @@ int32_t main(void)
 
         if (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk)
         {
+#if ISP_SEC_MODE
+            uint32_t u32Sp;
+
+            /* A secure update not verified leaves the first page blank, there is nothing to boot */
+            FMC_Read_User(ISP_APP_BASE, &u32Sp);
+
+            if (u32Sp == 0xFFFFFFFF)
+            {
+                goto _ISP;
+            }
+
+#endif
             goto _APROM;
         }
     }
@@ -90,18 +110,54 @@ _ISP:
 
     while (1)
     {
+#if ISP_EXT_MODE
+        if (g_u32ExtWindow)
+        {
+            uint8_t *pu8Pkt = GetPacket();
+            uint32_t u32AckLen;
+
+            if (pu8Pkt != NULL)
+            {
+                u32AckLen = ParseExtCmd(pu8Pkt);
+                ReleasePacket();
+                PutBuffer(response_buff, u32AckLen);
+
+                /* CMD_EXT_EXIT */
+                if (g_u32ExtWindow == 0)
+                {
+                    SetPacketMode(0, 0);
+                }
+            }
+
+            continue;
+        }
+#endif
+
         if (bUartDataReady == TRUE)
         {
             bUartDataReady = FALSE;
             ParseCmd(uart_rcvbuf, 64);
             PutString();
+#if ISP_EXT_MODE
+
+            /* CMD_EXT_NEGOTIATE accepted, the host sends extended packets after the response */
+            if (g_u32ExtWindow)
+            {
+                SetPacketMode(EXT_PKT_SIZE(g_u32ExtPayload), g_u32ExtWindow);
+            }
+#endif
         }
     }
 
 _APROM:
-    FMC_SetVectorAddr(FMC_APROM_BASE);
+    FMC_SetVectorAddr(ISP_APP_BASE);
+#ifdef ISP_APROM_LOADER
+    /* CPU reset only, a system reset would clear the vector page remap to the application */
+    SYS->IPRST0 = SYS_IPRST0_CPURST_Msk;
+#else
     FMC_SET_APROM_BOOT();
     NVIC_SystemReset();
+#endif
 
     /* Trap the CPU */
     while (1);
@@ -9,7 +9,11 @@
  * Copyright (C) 2017-2018 Nuvoton Technology Corp. All rights reserved.
  ******************************************************************************/
 
+#ifdef ISP_HOST_SIM
+#include "isp_sim.h"
+#else
 #include "NuMicro.h"
+#endif
 #include "isp_user.h"
 
 #define DetectPin                   PB12
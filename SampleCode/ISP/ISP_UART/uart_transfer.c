@@ -12,17 +12,26 @@
 /*!<Includes */
 #include <string.h>
 #include "NuMicro.h"
+#include "isp_user.h"
 #include "uart_transfer.h"
 
 #ifdef __ICCARM__
 #pragma data_alignment=4
-uint8_t uart_rcvbuf[MAX_PKT_SIZE] = {0};
+uint8_t uart_rcvbuf[MAX_RCV_SIZE] = {0};
 #else
-__attribute__((aligned(4))) uint8_t uart_rcvbuf[MAX_PKT_SIZE] = {0};
+__attribute__((aligned(4))) uint8_t uart_rcvbuf[MAX_RCV_SIZE] = {0};
 #endif
 
 uint8_t volatile bUartDataReady = 0;
-uint8_t volatile bufhead = 0;
+uint16_t volatile bufhead = 0;
+
+#if ISP_EXT_MODE
+/* Extended mode receives packets into a ring of slots, the legacy mode uses slot 0 only */
+static uint8_t volatile s_u8ExtMode = 0;
+static uint32_t volatile s_u32PktSize = MAX_PKT_SIZE;
+static uint32_t volatile s_u32SlotNum = 1;
+static uint32_t volatile s_u32RxCnt, s_u32RxDone;
+#endif
 
 
 /* please check "targetdev.h" for chip specifc define option */
@@ -30,6 +39,47 @@ uint8_t volatile bufhead = 0;
 /*---------------------------------------------------------------------------------------------------------*/
 /* INTSTS to handle UART Channel 0 interrupt event                                                            */
 /*---------------------------------------------------------------------------------------------------------*/
+#if ISP_EXT_MODE
+void UART0_IRQHandler(void)
+{
+    /*----- Determine interrupt source -----*/
+    uint32_t u32IntSrc = UART0->INTSTS;
+    uint32_t u32Free = ((s_u32RxCnt - s_u32RxDone) < s_u32SlotNum);
+    uint8_t *pu8Slot = &uart_rcvbuf[(s_u32RxCnt % s_u32SlotNum) * s_u32PktSize];
+    uint8_t u8Data;
+
+    if (u32IntSrc & 0x11)   /*RDA FIFO interrupt & RDA timeout interrupt*/
+    {
+        while (((UART0->FIFOSTS & UART_FIFOSTS_RXEMPTY_Msk) == 0) && (bufhead < s_u32PktSize))      /*RX fifo not empty*/
+        {
+            u8Data = UART0->DAT;
+
+            /* All slots in use: the host overran the window, drop the packet */
+            if (u32Free)
+            {
+                pu8Slot[bufhead] = u8Data;
+            }
+
+            bufhead++;
+        }
+    }
+
+    if (bufhead == s_u32PktSize)
+    {
+        if (u32Free && s_u8ExtMode)
+        {
+            s_u32RxCnt++;
+        }
+
+        bUartDataReady = TRUE;
+        bufhead = 0;
+    }
+    else if (u32IntSrc & 0x10)
+    {
+        bufhead = 0;
+    }
+}
+#else
 void UART0_IRQHandler(void)
 {
     /*----- Determine interrupt source -----*/
@@ -53,6 +103,7 @@ void UART0_IRQHandler(void)
         bufhead = 0;
     }
 }
+#endif
 #ifdef __ICCARM__
 #pragma data_alignment=4
 extern uint8_t response_buff[64];
@@ -60,18 +111,62 @@ extern uint8_t response_buff[64];
 extern __attribute__((aligned(4))) uint8_t response_buff[64];
 #endif
 
-void PutString(void)
+void PutBuffer(uint8_t *pu8Buf, uint32_t u32Len)
 {
     uint32_t i;
 
-    for (i = 0; i < MAX_PKT_SIZE; i++)
+    for (i = 0; i < u32Len; i++)
     {
         while ((UART0->FIFOSTS & UART_FIFOSTS_TXFULL_Msk));
 
-        UART0->DAT = response_buff[i];
+        UART0->DAT = pu8Buf[i];
+    }
+}
+
+void PutString(void)
+{
+    PutBuffer(response_buff, MAX_PKT_SIZE);
+}
+
+#if ISP_EXT_MODE
+/* Switch to u32SlotNum slots of u32PktSize bytes, or back to the legacy packet if u32SlotNum is 0 */
+void SetPacketMode(uint32_t u32PktSize, uint32_t u32SlotNum)
+{
+    NVIC_DisableIRQ(UART0_IRQn);
+    s_u8ExtMode = (u32SlotNum != 0);
+
+    if (u32SlotNum == 0)
+    {
+        u32PktSize = MAX_PKT_SIZE;
+        u32SlotNum = 1;
     }
+
+    s_u32PktSize = u32PktSize;
+    s_u32SlotNum = u32SlotNum;
+    s_u32RxCnt = 0;
+    s_u32RxDone = 0;
+    bufhead = 0;
+    bUartDataReady = FALSE;
+    NVIC_EnableIRQ(UART0_IRQn);
 }
 
+/* Return the oldest received extended packet, NULL if none */
+uint8_t *GetPacket(void)
+{
+    if (s_u32RxCnt == s_u32RxDone)
+    {
+        return NULL;
+    }
+
+    return &uart_rcvbuf[(s_u32RxDone % s_u32SlotNum) * s_u32PktSize];
+}
+
+void ReleasePacket(void)
+{
+    s_u32RxDone++;
+}
+#endif
+
 void UART_Init()
 {
     /*---------------------------------------------------------------------------------------------------------*/
@@ -16,16 +16,29 @@
 /* Define maximum packet size */
 #define MAX_PKT_SIZE            64
 
+/* Receive buffer, a window of extended packets */
+#if ISP_EXT_MODE
+#define MAX_RCV_SIZE            (EXT_MAX_WINDOW * EXT_PKT_SIZE(EXT_MAX_PAYLOAD))
+#else
+#define MAX_RCV_SIZE            MAX_PKT_SIZE
+#endif
+
 /*-------------------------------------------------------------*/
 
 extern uint8_t  uart_rcvbuf[];
 extern uint8_t volatile bUartDataReady;
-extern uint8_t volatile bufhead;
+extern uint16_t volatile bufhead;
 
 /*-------------------------------------------------------------*/
 void UART_Init(void);
 void UART0_IRQHandler(void);
 void PutString(void);
+void PutBuffer(uint8_t *pu8Buf, uint32_t u32Len);
+#if ISP_EXT_MODE
+void SetPacketMode(uint32_t u32PktSize, uint32_t u32SlotNum);
+uint8_t *GetPacket(void);
+void ReleasePacket(void);
+#endif
 
 #include "clk.h"
 ///*---------------------------------------------------------------------------------------------------------*/
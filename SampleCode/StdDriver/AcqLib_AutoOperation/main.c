@@ -0,0 +1,217 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Demonstrate an acquisition plan of the AcqLib library. Every 10 ms
+ *           TIMER0 triggers an I2C sensor read, a scan of 4 ADC channels and
+ *           an SPI frame while the chip stays in power-down. The CPU wakes up
+ *           once per batch of 10 records.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+#include "acqlib.h"
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Global variables                                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+#define PLAN_FREQ           100     /* Triggers per second */
+#define BATCH_LEN           10      /* Records per wake-up */
+#define BATCH_NUM           4       /* Batches per ring */
+
+#define SENSOR_ADDR         0x48    /* 7-bit I2C address of the sensor */
+#define SENSOR_REG          0x00    /* First register of the 6 bytes sample */
+#define SENSOR_LEN          6
+#define ADC_CH_MASK         (BIT0 | BIT1 | BIT2 | BIT3)
+#define ADC_CH_NUM          4
+#define SPI_FRAME_LEN       4       /* 8-bit words per SPI frame */
+#define SPI_CLK_FREQ        2000000
+
+#define STREAM_I2C          0
+#define STREAM_ADC          1
+#define STREAM_SPI          2
+
+static uint8_t s_au8I2CRing[BATCH_NUM * BATCH_LEN * SENSOR_LEN];
+static uint16_t s_au16AdcRing[BATCH_NUM * BATCH_LEN * ADC_CH_NUM];
+static uint8_t s_au8SpiRing[BATCH_NUM * BATCH_LEN * SPI_FRAME_LEN];
+
+static const ACQLIB_STREAM_T s_asStream[] =
+{
+    /* Source         Port   Addr         Cmd           CmdLen  RecordLen      Ring           BatchLen   BatchNum */
+    {ACQLIB_SRC_I2C,  I2C0,  SENSOR_ADDR, {SENSOR_REG}, 1,      SENSOR_LEN,    s_au8I2CRing,  BATCH_LEN, BATCH_NUM},
+    {ACQLIB_SRC_ADC,  ADC0,  ADC_CH_MASK, {0},          0,      0,             s_au16AdcRing, BATCH_LEN, BATCH_NUM},
+    {ACQLIB_SRC_SPI,  SPI0,  0,           {0},          0,      SPI_FRAME_LEN, s_au8SpiRing,  BATCH_LEN, BATCH_NUM},
+};
+
+static const ACQLIB_PLAN_T s_sPlan =
+{
+    TIMER0, PLAN_FREQ, s_asStream, sizeof(s_asStream) / sizeof(s_asStream[0])
+};
+
+static ACQLIB_T s_sAcq;
+
+void PDMA0_IRQHandler(void)
+{
+    PDMA_IRQHandler(PDMA0);
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC and LIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk | CLK_PWRCTL_LIRCEN_Msk);
+
+    /* Waiting for HIRC and LIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk | CLK_STATUS_LIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and cyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* TIMER0 keeps counting in power-down from LIRC */
+    CLK_SetModuleClock(TMR0_MODULE, CLK_CLKSEL1_TMR0SEL_LIRC, 0);
+
+    /* ADC clock source is 16 MHz from HIRC, set divider to 1 */
+    CLK_SetModuleClock(ADC0_MODULE, CLK_CLKSEL1_ADC0SEL_HIRC, CLK_CLKDIV_ADC0(1));
+
+    /* Select SPI0 clock source from HIRC */
+    CLK_SetModuleClock(SPI0_MODULE, CLK_CLKSEL2_SPI0SEL_HIRC, MODULE_NoMsk);
+
+    /* Enable module clocks */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(TMR0_MODULE);
+    CLK_EnableModuleClock(ADC0_MODULE);
+    CLK_EnableModuleClock(SPI0_MODULE);
+    CLK_EnableModuleClock(I2C0_MODULE);
+    CLK_EnableModuleClock(PDMA0_MODULE);
+    CLK_EnableModuleClock(GPA_MODULE);
+    CLK_EnableModuleClock(GPB_MODULE);
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+
+    /* PA.3 is SPI0_SS, PA.2 is SPI0_CLK, PA.1 is SPI0_MISO, PA.0 is SPI0_MOSI */
+    SYS->GPA_MFPL = (SYS->GPA_MFPL & ~(SYS_GPA_MFPL_PA3MFP_Msk | SYS_GPA_MFPL_PA2MFP_Msk |
+                                       SYS_GPA_MFPL_PA1MFP_Msk | SYS_GPA_MFPL_PA0MFP_Msk)) |
+                    (SYS_GPA_MFPL_PA3MFP_SPI0_SS | SYS_GPA_MFPL_PA2MFP_SPI0_CLK |
+                     SYS_GPA_MFPL_PA1MFP_SPI0_MISO | SYS_GPA_MFPL_PA0MFP_SPI0_MOSI);
+
+    /* PA.4 is I2C0_SDA, PA.5 is I2C0_SCL */
+    SYS->GPA_MFPL = (SYS->GPA_MFPL & ~(SYS_GPA_MFPL_PA4MFP_Msk | SYS_GPA_MFPL_PA5MFP_Msk)) |
+                    (SYS_GPA_MFPL_PA4MFP_I2C0_SDA | SYS_GPA_MFPL_PA5MFP_I2C0_SCL);
+
+    /* I2C pin enable schmitt trigger */
+    PA->SMTEN |= GPIO_SMTEN_SMTEN4_Msk | GPIO_SMTEN_SMTEN5_Msk;
+
+    /* PB.0 - PB.3 are ADC0_CH0 - ADC0_CH3 analog inputs */
+    GPIO_SetMode(PB, BIT0 | BIT1 | BIT2 | BIT3, GPIO_MODE_INPUT);
+    SYS->GPB_MFPL = (SYS->GPB_MFPL & ~(SYS_GPB_MFPL_PB0MFP_Msk | SYS_GPB_MFPL_PB1MFP_Msk |
+                                       SYS_GPB_MFPL_PB2MFP_Msk | SYS_GPB_MFPL_PB3MFP_Msk)) |
+                    (SYS_GPB_MFPL_PB0MFP_ADC0_CH0 | SYS_GPB_MFPL_PB1MFP_ADC0_CH1 |
+                     SYS_GPB_MFPL_PB2MFP_ADC0_CH2 | SYS_GPB_MFPL_PB3MFP_ADC0_CH3);
+
+    /* Disable the PB.0 - PB.3 digital input path to avoid the leakage current */
+    GPIO_DISABLE_DIGITAL_PATH(PB, BIT0 | BIT1 | BIT2 | BIT3);
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+/* Print the last record of a full batch of each stream */
+void PrintBatch(uint32_t u32Stream, void *pvBatch)
+{
+    const uint8_t *pu8Rec;
+    const uint16_t *pu16Rec;
+
+    if(u32Stream == STREAM_I2C)
+    {
+        pu8Rec = (const uint8_t *)pvBatch + (BATCH_LEN - 1) * SENSOR_LEN;
+        printf("  I2C : %02X %02X %02X %02X %02X %02X\n",
+               pu8Rec[0], pu8Rec[1], pu8Rec[2], pu8Rec[3], pu8Rec[4], pu8Rec[5]);
+    }
+    else if(u32Stream == STREAM_ADC)
+    {
+        pu16Rec = (const uint16_t *)pvBatch + (BATCH_LEN - 1) * ADC_CH_NUM;
+        printf("  ADC : %4d %4d %4d %4d\n", pu16Rec[0], pu16Rec[1], pu16Rec[2], pu16Rec[3]);
+    }
+    else
+    {
+        pu8Rec = (const uint8_t *)pvBatch + (BATCH_LEN - 1) * SPI_FRAME_LEN;
+        printf("  SPI : %02X %02X %02X %02X\n", pu8Rec[0], pu8Rec[1], pu8Rec[2], pu8Rec[3]);
+    }
+}
+
+int32_t main(void)
+{
+    uint32_t u32Stream, u32Wakeup = 0;
+    int32_t i32Ret;
+    void *pvBatch;
+
+    /* Init System, IP clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART to 115200-8n1 for print message */
+    UART_Open(UART0, 115200);
+
+    printf("+-------------------------------------------------------+\n");
+    printf("|      M2U51 Auto-operation Acquisition Sample Code     |\n");
+    printf("+-------------------------------------------------------+\n");
+    printf("Every %d ms: I2C 0x%02X reads %d bytes, ADC scans %d channels, SPI0 receives %d words.\n",
+           1000 / PLAN_FREQ, SENSOR_ADDR, SENSOR_LEN, ADC_CH_NUM, SPI_FRAME_LEN);
+    printf("CPU wakes up every %d records.\n\n", BATCH_LEN);
+
+    /* The peripherals are opened by the application, the library programs their automatic operation */
+    I2C_Open(I2C0, 100000);
+    SPI_Open(SPI0, SPI_MASTER, SPI_MODE_0, 8, SPI_CLK_FREQ);
+    SPI_EnableAutoSS(SPI0, SPI_SS, SPI_SS_ACTIVE_LOW);
+    ADC_POWER_ON(ADC0);
+
+    i32Ret = ACQLIB_Open(&s_sAcq, &s_sPlan);
+
+    if(i32Ret != 0)
+    {
+        printf("ACQLIB_Open failed (%d)\n", i32Ret);
+        while(1);
+    }
+
+    ACQLIB_Start(&s_sAcq);
+
+    while(1)
+    {
+        /* Check if all the debug messages are finished */
+        UART_WAIT_TX_EMPTY(UART0);
+
+        ACQLIB_PowerDown(&s_sAcq);
+
+        printf("Wake-up %u\n", (unsigned int)++u32Wakeup);
+
+        for(u32Stream = 0; u32Stream < s_sPlan.u32StreamNum; u32Stream++)
+        {
+            while((i32Ret = ACQLIB_GetBatch(&s_sAcq, u32Stream, &pvBatch)) != 0)
+            {
+                if(i32Ret == ACQLIB_ERR_OVERRUN)
+                {
+                    printf("  Stream %u overrun\n", (unsigned int)u32Stream);
+                    continue;
+                }
+
+                PrintBatch(u32Stream, pvBatch);
+                ACQLIB_ReleaseBatch(&s_sAcq, u32Stream);
+            }
+        }
+    }
+}
+
+/*** (C) COPYRIGHT 2025 Nuvoton Technology Corp. ***/
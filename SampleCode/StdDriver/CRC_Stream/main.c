@@ -0,0 +1,188 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Demonstrate the streaming CRC API. CRC_Update() on unaligned
+ *           buffers, CRC_UpdateDMA() on a large buffer and two CRC-32 streams
+ *           interleaved on the one CRC controller with context save/restore.
+ *           Every result is compared with a software reference.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+
+#define BUF_LEN             4096
+#define CRC32_ATTR          (CRC_WDATA_RVS | CRC_CHECKSUM_RVS | CRC_CHECKSUM_COM)
+
+static uint8_t s_au8Buf[BUF_LEN + 4];
+static volatile uint32_t s_u32DmaDone;
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set both PCLK0 and PCLK1 as HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART, CRC and PDMA clocks */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(CRC_MODULE);
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and CyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /*----------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                              */
+    /*----------------------------------------------------------------------*/
+    /* Set multi-function pins for UART0 RXD(PB.12) and TXD(PB.13) */
+    Uart0DefaultMPF();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+void PDMA0_IRQHandler(void)
+{
+    PDMA_IRQHandler(PDMA0);
+}
+
+static void DmaDone(void *pvUserData)
+{
+    (void)pvUserData;
+
+    s_u32DmaDone = 1;
+}
+
+/* Bitwise software reference of CRC-32 (reflected 0x04C11DB7) */
+static uint32_t RefCrc32(uint32_t u32Crc, const uint8_t *pu8Buf, uint32_t u32Len)
+{
+    uint32_t i;
+
+    u32Crc = ~u32Crc;
+
+    while(u32Len--)
+    {
+        u32Crc ^= *pu8Buf++;
+
+        for(i = 0; i < 8; i++)
+        {
+            u32Crc = (u32Crc >> 1) ^ ((u32Crc & 1) ? 0xEDB88320UL : 0);
+        }
+    }
+
+    return ~u32Crc;
+}
+
+static uint32_t Check(const char *pcName, uint32_t u32Crc, uint32_t u32Ref)
+{
+    printf("  %-36s 0x%08X / 0x%08X  %s\n", pcName, (unsigned int)u32Crc, (unsigned int)u32Ref,
+           (u32Crc == u32Ref) ? "PASS" : "FAIL");
+
+    return (u32Crc == u32Ref) ? 0 : 1;
+}
+
+int main(void)
+{
+    CRC_CONTEXT_T sCtxA, sCtxB;
+    uint32_t i, u32Ofs, u32Len, u32RefA, u32RefB, u32Fail = 0;
+    char acName[40];
+
+    /* Init System, peripheral clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART0 for printf */
+    UART_Open(UART0, 115200);
+
+    printf("\n\nCPU @ %d Hz\n", SystemCoreClock);
+    printf("+-----------------------------------------------------+\n");
+    printf("|    CRC Streaming API Sample Code                    |\n");
+    printf("+-----------------------------------------------------+\n\n");
+
+    for(i = 0; i < sizeof(s_au8Buf); i++)
+    {
+        s_au8Buf[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+
+    printf("  Case                                 CRC        / Reference\n");
+
+    /* a. Unaligned head and tail bytes, fed in two pieces */
+    for(u32Ofs = 0; u32Ofs < 4; u32Ofs++)
+    {
+        for(u32Len = 1; u32Len < 12; u32Len += 5)
+        {
+            CRC_Open(CRC_32, CRC32_ATTR, 0xFFFFFFFF, CRC_CPU_WDATA_32);
+            CRC_Update(&s_au8Buf[u32Ofs], u32Len);
+            CRC_Update(&s_au8Buf[u32Ofs + u32Len], 97);
+
+            sprintf(acName, "CRC_Update offset %u, split %u", (unsigned int)u32Ofs, (unsigned int)u32Len);
+            u32Fail += Check(acName, CRC_GetChecksum(), RefCrc32(0, &s_au8Buf[u32Ofs], u32Len + 97));
+        }
+    }
+
+    /* b. Large buffer by PDMA, blocking and asynchronous */
+    u32RefA = RefCrc32(0, &s_au8Buf[1], BUF_LEN);
+
+    CRC_Open(CRC_32, CRC32_ATTR, 0xFFFFFFFF, CRC_CPU_WDATA_32);
+    CRC_UpdateDMA(PDMA0, &s_au8Buf[1], BUF_LEN, NULL, NULL);
+    u32Fail += Check("CRC_UpdateDMA blocking", CRC_GetChecksum(), u32RefA);
+
+    NVIC_EnableIRQ(PDMA0_IRQn);
+    s_u32DmaDone = 0;
+    CRC_Open(CRC_32, CRC32_ATTR, 0xFFFFFFFF, CRC_CPU_WDATA_32);
+    CRC_UpdateDMA(PDMA0, &s_au8Buf[1], BUF_LEN, DmaDone, NULL);
+
+    /* The CPU is free while PDMA feeds the CRC controller */
+    while(s_u32DmaDone == 0);
+
+    u32Fail += Check("CRC_UpdateDMA asynchronous", CRC_GetChecksum(), u32RefA);
+
+    /* c. Two streams interleaved in 256 bytes pieces, e.g. a UART frame and a flash image */
+    CRC_Open(CRC_32, CRC32_ATTR, 0xFFFFFFFF, CRC_CPU_WDATA_32);
+    CRC_SaveContext(&sCtxA);
+    CRC_SaveContext(&sCtxB);
+    u32RefA = 0;
+    u32RefB = 0;
+
+    for(u32Ofs = 0; u32Ofs < BUF_LEN / 2; u32Ofs += 256)
+    {
+        CRC_RestoreContext(&sCtxA);
+        CRC_Update(&s_au8Buf[u32Ofs], 256);
+        CRC_SaveContext(&sCtxA);
+        u32RefA = RefCrc32(u32RefA, &s_au8Buf[u32Ofs], 256);
+
+        CRC_RestoreContext(&sCtxB);
+        CRC_UpdateDMA(PDMA0, &s_au8Buf[BUF_LEN / 2 + u32Ofs + 3], 256, NULL, NULL);
+        CRC_SaveContext(&sCtxB);
+        u32RefB = RefCrc32(u32RefB, &s_au8Buf[BUF_LEN / 2 + u32Ofs + 3], 256);
+    }
+
+    CRC_RestoreContext(&sCtxA);
+    u32Fail += Check("Stream A, save/restore", CRC_GetChecksum(), u32RefA);
+    CRC_RestoreContext(&sCtxB);
+    u32Fail += Check("Stream B, save/restore + PDMA", CRC_GetChecksum(), u32RefB);
+
+    printf("\n%u failed case(s)\n", (unsigned int)u32Fail);
+
+    /* Disable CRC function */
+    CLK_DisableModuleClock(CRC_MODULE);
+
+    while(1);
+}
+
+/*** (C) COPYRIGHT 2025 Nuvoton Technology Corp. ***/
@@ -0,0 +1,248 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Demonstrate the AES stream API. NIST SP 800-38A AES-128 vectors
+ *           are fed to AES_Update()/AES_Final() in odd-sized pieces, a 1 KB
+ *           CTR stream is encrypted by interrupt and two streams share the
+ *           AES engine.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+
+#define BUF_LEN             1024
+
+static const uint32_t s_au32Key[4] = {0x2b7e1516, 0x28aed2a6, 0xabf71588, 0x09cf4f3c};
+static const uint32_t s_au32IV[4] = {0x00010203, 0x04050607, 0x08090a0b, 0x0c0d0e0f};
+static const uint32_t s_au32Ctr[4] = {0xf0f1f2f3, 0xf4f5f6f7, 0xf8f9fafb, 0xfcfdfeff};
+
+static const uint8_t s_au8Plain[64] =
+{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+
+static const uint8_t s_au8CbcCipher[64] =
+{
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+    0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+    0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+    0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09, 0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7
+};
+
+static const uint8_t s_au8CfbCipher[64] =
+{
+    0x3b, 0x3f, 0xd9, 0x2e, 0xb7, 0x2d, 0xad, 0x20, 0x33, 0x34, 0x49, 0xf8, 0xe8, 0x3c, 0xfb, 0x4a,
+    0xc8, 0xa6, 0x45, 0x37, 0xa0, 0xb3, 0xa9, 0x3f, 0xcd, 0xe3, 0xcd, 0xad, 0x9f, 0x1c, 0xe5, 0x8b,
+    0x26, 0x75, 0x1f, 0x67, 0xa3, 0xcb, 0xb1, 0x40, 0xb1, 0x80, 0x8c, 0xf1, 0x87, 0xa4, 0xf4, 0xdf,
+    0xc0, 0x4b, 0x05, 0x35, 0x7c, 0x5d, 0x1c, 0x0e, 0xea, 0xc4, 0xc6, 0x6f, 0x9f, 0xf7, 0xf2, 0xe6
+};
+
+static const uint8_t s_au8OfbCipher[64] =
+{
+    0x3b, 0x3f, 0xd9, 0x2e, 0xb7, 0x2d, 0xad, 0x20, 0x33, 0x34, 0x49, 0xf8, 0xe8, 0x3c, 0xfb, 0x4a,
+    0x77, 0x89, 0x50, 0x8d, 0x16, 0x91, 0x8f, 0x03, 0xf5, 0x3c, 0x52, 0xda, 0xc5, 0x4e, 0xd8, 0x25,
+    0x97, 0x40, 0x05, 0x1e, 0x9c, 0x5f, 0xec, 0xf6, 0x43, 0x44, 0xf7, 0xa8, 0x22, 0x60, 0xed, 0xcc,
+    0x30, 0x4c, 0x65, 0x28, 0xf6, 0x59, 0xc7, 0x78, 0x66, 0xa5, 0x10, 0xd9, 0xc1, 0xd6, 0xae, 0x5e
+};
+
+static const uint8_t s_au8CtrCipher[64] =
+{
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+#ifdef __ICCARM__
+#pragma data_alignment=4
+static uint8_t s_au8Buf[BUF_LEN];
+#pragma data_alignment=4
+static uint8_t s_au8Out[BUF_LEN];
+#pragma data_alignment=4
+static uint8_t s_au8Ref[BUF_LEN];
+#else
+static uint8_t s_au8Buf[BUF_LEN] __attribute__((aligned(4)));
+static uint8_t s_au8Out[BUF_LEN] __attribute__((aligned(4)));
+static uint8_t s_au8Ref[BUF_LEN] __attribute__((aligned(4)));
+#endif
+
+static AES_CONTEXT_T s_sCtxA, s_sCtxB;
+static volatile uint32_t s_u32Done;
+static volatile int32_t s_i32Status;
+
+void CRPT_IRQHandler(void)
+{
+    AES_IRQHandler(CRPT);
+}
+
+static void AesDone(AES_CONTEXT_T *psCtx, int32_t i32Status, void *pvUserData)
+{
+    (void)psCtx;
+    (void)pvUserData;
+
+    s_i32Status = i32Status;
+    s_u32Done = 1;
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set both PCLK0 and PCLK1 as HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Enable CRPT clock */
+    CLK_EnableModuleClock(CRPT_MODULE);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and CyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /*----------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                              */
+    /*----------------------------------------------------------------------*/
+    /* Set multi-function pins for UART0 RXD(PB.12) and TXD(PB.13) */
+    Uart0DefaultMPF();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+/* Encrypt the 64 bytes vector in pieces of u32Piece bytes, the last call is AES_Final() */
+static uint32_t VectorTest(const char *pcName, uint32_t u32OpMode, const uint32_t au32IV[], const uint8_t au8Cipher[],
+                           uint32_t u32Piece)
+{
+    uint32_t u32Ofs, u32Len;
+    int32_t i32Ret;
+
+    memset(s_au8Out, 0, sizeof(s_au8Plain));
+    i32Ret = AES_Init(&s_sCtxA, 1, u32OpMode, AES_KEY_SIZE_128, s_au32Key, au32IV);
+
+    for(u32Ofs = 0; (i32Ret == AES_OK) && (u32Ofs < sizeof(s_au8Plain)); u32Ofs += u32Len)
+    {
+        u32Len = ((sizeof(s_au8Plain) - u32Ofs) > u32Piece) ? u32Piece : (sizeof(s_au8Plain) - u32Ofs);
+
+        if((u32Ofs + u32Len) < sizeof(s_au8Plain))
+        {
+            i32Ret = AES_Update(CRPT, &s_sCtxA, &s_au8Plain[u32Ofs], &s_au8Out[u32Ofs], u32Len, NULL, NULL);
+        }
+        else
+        {
+            i32Ret = AES_Final(CRPT, &s_sCtxA, &s_au8Plain[u32Ofs], &s_au8Out[u32Ofs], u32Len, NULL, NULL);
+        }
+    }
+
+    if(i32Ret == AES_OK)
+    {
+        i32Ret = (memcmp(s_au8Out, au8Cipher, sizeof(s_au8Plain)) == 0) ? 0 : -1;
+    }
+
+    printf("  %-4s pieces of %2u bytes  %s (%d)\n", pcName, (unsigned int)u32Piece, (i32Ret == 0) ? "PASS" : "FAIL", (int)i32Ret);
+
+    return (i32Ret == 0) ? 0 : 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Main Function                                                                                          */
+/*---------------------------------------------------------------------------------------------------------*/
+int32_t main(void)
+{
+    uint32_t i, u32Ofs, u32Fail = 0;
+    int32_t i32Ret;
+
+    /* Init System, IP clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART0 for printf */
+    UART_Open(UART0, 115200);
+
+    printf("\n\nCPU @ %d Hz\n", SystemCoreClock);
+    printf("+---------------------------------------+\n");
+    printf("|   Crypto AES Stream API Sample Code   |\n");
+    printf("+---------------------------------------+\n\n");
+
+    /* a. NIST SP 800-38A vectors, the stream modes continue inside a block between calls */
+    u32Fail += VectorTest("CBC", AES_MODE_CBC, s_au32IV, s_au8CbcCipher, 16);
+    u32Fail += VectorTest("CBC", AES_MODE_CBC, s_au32IV, s_au8CbcCipher, 48);
+    u32Fail += VectorTest("CFB", AES_MODE_CFB, s_au32IV, s_au8CfbCipher, 5);
+    u32Fail += VectorTest("CFB", AES_MODE_CFB, s_au32IV, s_au8CfbCipher, 27);
+    u32Fail += VectorTest("OFB", AES_MODE_OFB, s_au32IV, s_au8OfbCipher, 7);
+    u32Fail += VectorTest("CTR", AES_MODE_CTR, s_au32Ctr, s_au8CtrCipher, 5);
+    u32Fail += VectorTest("CTR", AES_MODE_CTR, s_au32Ctr, s_au8CtrCipher, 36);
+
+    /* b. 1 KB CTR stream by interrupt, the CPU is free during the DMA round */
+    for(i = 0; i < BUF_LEN; i++)
+    {
+        s_au8Buf[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    AES_Init(&s_sCtxA, 1, AES_MODE_CTR, AES_KEY_SIZE_128, s_au32Key, s_au32Ctr);
+    AES_Final(CRPT, &s_sCtxA, s_au8Buf, s_au8Ref, BUF_LEN, NULL, NULL);
+
+    NVIC_EnableIRQ(CRPT_IRQn);
+    s_u32Done = 0;
+    AES_Init(&s_sCtxA, 1, AES_MODE_CTR, AES_KEY_SIZE_128, s_au32Key, s_au32Ctr);
+    i32Ret = AES_Final(CRPT, &s_sCtxA, s_au8Buf, s_au8Out, BUF_LEN, AesDone, NULL);
+
+    if(i32Ret == AES_OK)
+    {
+        while(s_u32Done == 0);
+
+        i32Ret = s_i32Status;
+    }
+
+    if(i32Ret == AES_OK)
+    {
+        i32Ret = (memcmp(s_au8Out, s_au8Ref, BUF_LEN) == 0) ? 0 : -1;
+    }
+
+    printf("  CTR 1 KB by interrupt      %s (%d)\n", (i32Ret == 0) ? "PASS" : "FAIL", (int)i32Ret);
+    u32Fail += (i32Ret == 0) ? 0 : 1;
+
+    /* c. Two CTR streams interleaved in 100 bytes pieces, e.g. telemetry and a firmware blob */
+    AES_Init(&s_sCtxA, 1, AES_MODE_CTR, AES_KEY_SIZE_128, s_au32Key, s_au32Ctr);
+    AES_Init(&s_sCtxB, 1, AES_MODE_CTR, AES_KEY_SIZE_128, s_au32Key, s_au32Ctr);
+
+    for(u32Ofs = 0; u32Ofs < BUF_LEN / 2; u32Ofs += 100)
+    {
+        i = ((BUF_LEN / 2 - u32Ofs) > 100) ? 100 : (BUF_LEN / 2 - u32Ofs);
+        AES_Update(CRPT, &s_sCtxA, &s_au8Buf[u32Ofs], &s_au8Out[u32Ofs], i, NULL, NULL);
+        AES_Update(CRPT, &s_sCtxB, &s_au8Buf[u32Ofs], &s_au8Out[BUF_LEN / 2 + u32Ofs], i, NULL, NULL);
+    }
+
+    AES_Final(CRPT, &s_sCtxA, NULL, NULL, 0, NULL, NULL);
+    AES_Final(CRPT, &s_sCtxB, NULL, NULL, 0, NULL, NULL);
+
+    i32Ret = ((memcmp(s_au8Out, s_au8Ref, BUF_LEN / 2) == 0) &&
+              (memcmp(&s_au8Out[BUF_LEN / 2], s_au8Ref, BUF_LEN / 2) == 0)) ? 0 : -1;
+    printf("  CTR two interleaved streams %s\n", (i32Ret == 0) ? "PASS" : "FAIL");
+    u32Fail += (i32Ret == 0) ? 0 : 1;
+
+    printf("\n%u failed case(s)\n", (unsigned int)u32Fail);
+
+    while(1);
+}
+
+/*** (C) COPYRIGHT 2025 Nuvoton Technology Corp. ***/
@@ -0,0 +1,231 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Keep a boot counter and settings in a log-structured key/value
+ *           store on Data Flash. A value update programs a few words instead
+ *           of erasing a page, and pages are erased in rotation.
+ *
+ * @note
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+#include "kvlib.h"
+
+#define DATA_FLASH_KV_BASE      0x3F000         /* Last 4KB of APROM */
+#define DATA_FLASH_KV_PAGE_NUM  8
+#define KV_INDEX_SIZE           16              /* Power of two, larger than the number of keys */
+#define UPDATE_LOOP             200
+
+typedef struct
+{
+    uint32_t u32BaudRate;
+    uint8_t  au8Name[12];
+} SETTINGS_T;
+
+static KVLIB_T s_sKV;
+static KVLIB_IDX_T s_asKVIdx[KV_INDEX_SIZE];
+
+int IsDebugFifoEmpty(void);
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set both PCLK0 and PCLK1 as HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and CyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /*----------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                              */
+    /*----------------------------------------------------------------------*/
+    /* Set multi-function pins for UART0 RXD(PB.12) and TXD(PB.13) */
+    Uart0DefaultMPF();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+static int  set_data_flash_base(uint32_t u32DFBA)
+{
+    uint32_t   au32Config[2];
+
+    /* Read User Configuration 0 & 1 */
+    if (FMC_ReadConfig(au32Config, 2) < 0)
+    {
+        printf("\nRead User Config failed!\n");       /* Error message */
+        return -1;                     /* failed to read User Configuration */
+    }
+
+    /* Check if Data Flash is enabled (CONFIG0[0]) and is expected address (CONFIG1) */
+    if ((!(au32Config[0] & 0x1)) && (au32Config[1] == u32DFBA))
+        return 0;                      /* no need to modify User Configuration */
+
+    FMC_ENABLE_CFG_UPDATE();           /* Enable User Configuration update. */
+
+    /* Erase User Configuration */
+    FMC_Erase(FMC_CONFIG_BASE);
+
+    au32Config[0] &= ~0x1;             /* CONFIG0[0] = 0 (Enabled) */
+    au32Config[1] = u32DFBA;
+
+    /* Update User Configuration settings. */
+    if (FMC_WriteConfig(au32Config, 2) < 0)
+        return -1;
+
+    FMC_DISABLE_CFG_UPDATE();
+
+    printf("\nSet Data Flash base as 0x%x.\n", u32DFBA);
+
+    /* To check if all the debug messages are finished */
+    while(!IsDebugFifoEmpty());
+
+    /* Perform chip reset to make new User Config take effect */
+    SYS->IPRST0 = SYS_IPRST0_CHIPRST_Msk;
+
+    return 0;
+}
+
+void UART0_Init(void)
+{
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init UART                                                                                               */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Reset UART module */
+    SYS_ResetModule(UART0_RST);
+
+    /* Configure UART0 and set UART0 Baudrate */
+    UART_Open(UART0, 115200);
+}
+
+int main()
+{
+    uint32_t i, u32BootCount = 0, u32Counter;
+    int32_t i32Ret;
+    SETTINGS_T sSettings;
+
+    /* Init System, IP clock and multi-function I/O. */
+    SYS_Init();
+
+    /* Init UART0 for printf */
+    UART0_Init();
+
+    printf("\n\nCPU @ %d Hz\n", SystemCoreClock);
+    printf("+----------------------------------------+\n");
+    printf("|    M2U51 FMC Key/Value Store Sample    |\n");
+    printf("+----------------------------------------+\n");
+
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable FMC ISP function. Before using FMC function, it should unlock system register first. */
+    FMC_Open();
+
+    /* Enable Data Flash and set base address. */
+    if (set_data_flash_base(DATA_FLASH_KV_BASE) < 0)
+    {
+        printf("Failed to set Data Flash base address!\n");
+        goto lexit;
+    }
+
+    /* Mount the store: rebuild the RAM index and recover from a power loss */
+    i32Ret = KVLIB_Init(&s_sKV, FMC_ReadDataFlashBaseAddr(), DATA_FLASH_KV_PAGE_NUM, s_asKVIdx, KV_INDEX_SIZE);
+
+    if (i32Ret != 0)
+    {
+        printf("KVLIB_Init failed! (%d)\n", i32Ret);
+        goto lexit;
+    }
+
+    printf("  Keys in store ......................... [%u]\n", (unsigned int)s_sKV.u32Count);
+
+    /* Boot counter survives reset and power loss */
+    if (KVLIB_Get(&s_sKV, "boot", 4, &u32BootCount, sizeof(u32BootCount)) != (int32_t)sizeof(u32BootCount))
+        u32BootCount = 0;
+
+    u32BootCount++;
+
+    if (KVLIB_Set(&s_sKV, "boot", 4, &u32BootCount, sizeof(u32BootCount)) != 0)
+    {
+        printf("Failed to update boot counter!\n");
+        goto lexit;
+    }
+
+    printf("  Boot count ............................ [%u]\n", (unsigned int)u32BootCount);
+
+    /* Settings are written once, an unchanged value does not program flash */
+    if (KVLIB_Get(&s_sKV, "settings", 8, &sSettings, sizeof(sSettings)) < 0)
+    {
+        memset(&sSettings, 0, sizeof(sSettings));
+        sSettings.u32BaudRate = 115200;
+        strcpy((char *)sSettings.au8Name, "M2U51");
+
+        if (KVLIB_Set(&s_sKV, "settings", 8, &sSettings, sizeof(sSettings)) != 0)
+        {
+            printf("Failed to store settings!\n");
+            goto lexit;
+        }
+    }
+
+    printf("  Settings .............................. [%s, %u]\n", sSettings.au8Name, (unsigned int)sSettings.u32BaudRate);
+
+    /* Frequent updates of one field: the pages are garbage-collected in rotation */
+    printf("  Update a counter %d times ............ ", UPDATE_LOOP);
+
+    for (i = 0; i < UPDATE_LOOP; i++)
+    {
+        if (KVLIB_Set(&s_sKV, "counter", 7, &i, sizeof(i)) != 0)
+        {
+            printf("[FAIL]\n");
+            goto lexit;
+        }
+    }
+
+    if ((KVLIB_Get(&s_sKV, "counter", 7, &u32Counter, sizeof(u32Counter)) != (int32_t)sizeof(u32Counter)) ||
+            (u32Counter != UPDATE_LOOP - 1))
+    {
+        printf("[FAIL]\n");
+        goto lexit;
+    }
+
+    printf("[OK]\n");
+
+    KVLIB_Delete(&s_sKV, "counter", 7);
+
+    printf("  Head page %u, pages in use %u, keys %u\n",
+           (unsigned int)s_sKV.u32Head, (unsigned int)s_sKV.u32Used, (unsigned int)s_sKV.u32Count);
+    printf("\nPress reset to increase the boot count.\n");
+
+lexit:
+
+    /* Disable FMC ISP function */
+    FMC_Close();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+
+    printf("\nFMC Sample Code Completed.\n");
+
+    while (1);
+}
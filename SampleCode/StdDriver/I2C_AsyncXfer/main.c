@@ -0,0 +1,188 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief
+ *           Show how to queue I2C write-then-read transactions on the interrupt
+ *           driven transaction engine and compute while the bus is busy.
+ *           Needs to work with I2C_Slave sample code.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Global variables                                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+#define SLAVE_ADDR          0x15    /* I2C_Slave sample, 2 bytes register address */
+#define XFER_NUM            4
+#define XFER_LEN            16
+
+static I2C_XFER_T s_asXfer[XFER_NUM];
+static uint8_t s_aau8Reg[XFER_NUM][2];
+static uint8_t s_aau8RxBuf[XFER_NUM][XFER_LEN];
+static volatile uint32_t s_u32DoneCnt = 0;
+
+void I2C0_IRQHandler(void)
+{
+    I2C_XferIRQHandler(I2C0);
+}
+
+/* Called in I2C0 interrupt when a transaction completes */
+void XferDone(I2C_XFER_T *psXfer)
+{
+    (void)psXfer;
+    s_u32DoneCnt++;
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and cyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Enable I2C0 clock */
+    CLK_EnableModuleClock(I2C0_MODULE);
+
+    /* Enable GPIO clock */
+    CLK_EnableModuleClock(GPA_MODULE);
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+
+    /* Set I2C0 multi-function pins */
+    SYS->GPA_MFPL = (SYS->GPA_MFPL & ~(SYS_GPA_MFPL_PA4MFP_Msk | SYS_GPA_MFPL_PA5MFP_Msk)) |
+                    (SYS_GPA_MFPL_PA4MFP_I2C0_SDA | SYS_GPA_MFPL_PA5MFP_I2C0_SCL);
+
+    /* I2C pin enable schmitt trigger */
+    PA->SMTEN |= GPIO_SMTEN_SMTEN4_Msk | GPIO_SMTEN_SMTEN5_Msk;
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+void I2C0_Init(void)
+{
+    /* Open I2C module and set bus clock */
+    I2C_Open(I2C0, 100000);
+
+    /* Get I2C0 Bus Clock */
+    printf("I2C clock %d Hz\n", I2C_GetBusClockFreq(I2C0));
+}
+
+void I2C0_Close(void)
+{
+    /* Disable I2C0 interrupt and clear corresponding NVIC bit */
+    I2C_DisableInt(I2C0);
+    NVIC_DisableIRQ(I2C0_IRQn);
+
+    /* Disable I2C0 and close I2C0 clock */
+    I2C_Close(I2C0);
+    CLK_DisableModuleClock(I2C0_MODULE);
+
+}
+
+int32_t main(void)
+{
+    uint32_t i, j, u32Round, u32Work;
+
+    /* Init System, IP clock and multi-function I/O. */
+    SYS_Init();
+
+    /* Configure UART0: 115200, 8-bit word, no parity bit, 1 stop bit. */
+    UART_Open(UART0, 115200);
+
+    /*
+        This sample code sets I2C bus clock to 100kHz. Master queues 4 transactions, each writes a 2 bytes
+        register address and reads 16 bytes. The CPU computes until the completion callbacks are called.
+    */
+    printf("+--------------------------------------------------------+\n");
+    printf("| I2C Driver Sample Code for Asynchronous Transactions   |\n");
+    printf("| Needs to work with I2C_Slave sample code               |\n");
+    printf("|                                                        |\n");
+    printf("| I2C Master (I2C0) <---> I2C Slave(I2C0)                |\n");
+    printf("| !! This sample code requires two borads to test !!     |\n");
+    printf("+--------------------------------------------------------+\n");
+
+    printf("\n");
+
+    /* Init I2C0 */
+    I2C0_Init();
+    NVIC_EnableIRQ(I2C0_IRQn);
+
+    for(i = 0; i < XFER_NUM; i++)
+    {
+        s_aau8Reg[i][0] = 0x00;
+        s_aau8Reg[i][1] = (uint8_t)(i * XFER_LEN);
+
+        s_asXfer[i].u8SlaveAddr = SLAVE_ADDR;
+        s_asXfer[i].pu8TxBuf = s_aau8Reg[i];
+        s_asXfer[i].u32TxLen = 2;
+        s_asXfer[i].pu8RxBuf = s_aau8RxBuf[i];
+        s_asXfer[i].u32RxLen = XFER_LEN;
+        s_asXfer[i].pfnCallback = XferDone;
+    }
+
+    for(u32Round = 0; u32Round < 3; u32Round++)
+    {
+        s_u32DoneCnt = 0;
+
+        for(i = 0; i < XFER_NUM; i++)
+        {
+            if(I2C_XferSubmit(I2C0, &s_asXfer[i]) != I2C_OK)
+            {
+                printf("Submit transaction %d fail\n", i);
+                while(1);
+            }
+        }
+
+        /* The transactions run in I2C0 interrupt, the CPU is free for other work */
+        u32Work = 0;
+
+        while(s_u32DoneCnt < XFER_NUM)
+        {
+            u32Work++;
+        }
+
+        printf("Round %d: %d work loops while the bus was busy\n", u32Round, u32Work);
+
+        for(i = 0; i < XFER_NUM; i++)
+        {
+            printf("  Reg 0x%02X%02X status %d:", s_aau8Reg[i][0], s_aau8Reg[i][1], s_asXfer[i].i32Status);
+
+            for(j = 0; j < XFER_LEN; j++)
+            {
+                printf(" %02X", s_aau8RxBuf[i][j]);
+            }
+
+            printf("\n");
+        }
+    }
+
+    I2C0_Close();
+
+    while(1);
+}
+/*** (C) COPYRIGHT 2025 Nuvoton Technology Corp. ***/
@@ -0,0 +1,153 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Write and read a page of EEPROM 24LC64 with the I2C PDMA
+ *           functions. The CPU only handles START, address and STOP phases.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Global variables                                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+#define EEPROM_ADDR         0x50
+#define EEPROM_PAGE_SIZE    32      /* 24LC64 page write buffer */
+#define EEPROM_PAGE_NUM     4
+
+static uint8_t s_au8TxBuf[EEPROM_PAGE_SIZE];
+static uint8_t s_au8RxBuf[EEPROM_PAGE_SIZE * EEPROM_PAGE_NUM];
+
+void PDMA0_IRQHandler(void)
+{
+    /* The I2C PDMA functions get the payload completion from the channel callback */
+    PDMA_IRQHandler(PDMA0);
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and cyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Enable I2C0 clock */
+    CLK_EnableModuleClock(I2C0_MODULE);
+
+    /* Enable PDMA clock */
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    /* Enable GPIO clock */
+    CLK_EnableModuleClock(GPA_MODULE);
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+
+    /* Set I2C0 multi-function pins */
+    SYS->GPA_MFPL = (SYS->GPA_MFPL & ~(SYS_GPA_MFPL_PA4MFP_Msk | SYS_GPA_MFPL_PA5MFP_Msk)) |
+                    (SYS_GPA_MFPL_PA4MFP_I2C0_SDA | SYS_GPA_MFPL_PA5MFP_I2C0_SCL);
+
+    /* I2C pin enable schmitt trigger */
+    PA->SMTEN |= GPIO_SMTEN_SMTEN4_Msk | GPIO_SMTEN_SMTEN5_Msk;
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+void I2C0_Init(void)
+{
+    /* Open I2C0 and set clock to 100k */
+    I2C_Open(I2C0, 100000);
+
+    /* Get I2C0 Bus Clock */
+    printf("I2C clock %d Hz\n", I2C_GetBusClockFreq(I2C0));
+}
+
+
+int32_t main (void)
+{
+    uint32_t i, u32Page;
+
+    /* Init System, IP clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART to 115200-8n1 for print message */
+    UART_Open(UART0, 115200);
+
+    /*
+        This sample code sets I2C bus clock to 100kHz. Then, writes 4 pages of EEPROM 24LC64 and reads them
+        back in one transfer. The data bytes are moved by PDMA, and check if the read data is equal to the
+        programmed data.
+    */
+
+    printf("+-------------------------------------------------------+\n");
+    printf("|    I2C PDMA Driver Sample Code with EEPROM 24LC64     |\n");
+    printf("+-------------------------------------------------------+\n");
+
+    /* Init I2C0 to access EEPROM */
+    I2C0_Init();
+
+    /* The I2C functions request a free channel for each transfer */
+    NVIC_EnableIRQ(PDMA0_IRQn);
+
+    for (u32Page = 0; u32Page < EEPROM_PAGE_NUM; u32Page++)
+    {
+        for (i = 0; i < EEPROM_PAGE_SIZE; i++)
+        {
+            s_au8TxBuf[i] = (uint8_t)(u32Page * EEPROM_PAGE_SIZE + i + 3);
+        }
+
+        if (I2C_WriteMultiBytesTwoRegsPDMA(I2C0, PDMA0, EEPROM_ADDR,
+                                           (uint16_t)(u32Page * EEPROM_PAGE_SIZE), s_au8TxBuf, EEPROM_PAGE_SIZE) != EEPROM_PAGE_SIZE)
+        {
+            printf("I2C PDMA Page Write Failed, page %d, error %d\n", u32Page, g_I2C_i32ErrCode);
+            return -1;
+        }
+
+        /* Wait write operation complete */
+        CLK_SysTickDelay(10000);
+    }
+
+    if (I2C_ReadMultiBytesTwoRegsPDMA(I2C0, PDMA0, EEPROM_ADDR, 0x0000,
+                                      s_au8RxBuf, sizeof(s_au8RxBuf)) != sizeof(s_au8RxBuf))
+    {
+        printf("I2C PDMA Read Failed, error %d\n", g_I2C_i32ErrCode);
+        return -1;
+    }
+
+    /* Compare data */
+    for (i = 0; i < sizeof(s_au8RxBuf); i++)
+    {
+        if (s_au8RxBuf[i] != (uint8_t)(i + 3))
+        {
+            printf("I2C PDMA Write/Read Failed, R[%d] Data 0x%x\n", i, s_au8RxBuf[i]);
+            return -1;
+        }
+    }
+
+    printf("I2C PDMA Access EEPROM Test OK\n");
+
+    while(1);
+}
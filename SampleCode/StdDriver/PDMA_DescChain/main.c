@@ -0,0 +1,194 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief
+ *           Use the PDMA channel allocator, descriptor-chain builder and
+ *           channel callbacks to run two memory to memory chains concurrently.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+
+#define PDMA_TEST_LENGTH    64
+
+#ifdef __ICCARM__
+#pragma data_alignment=4
+uint8_t au8SrcArray[256];
+#pragma data_alignment=4
+uint8_t au8DestArray0[256];
+#pragma data_alignment=4
+uint8_t au8DestArray1[256];
+#pragma data_alignment=4
+uint8_t au8DestArray2[256];
+#else
+__attribute__((aligned(4))) uint8_t au8SrcArray[256];
+__attribute__((aligned(4))) uint8_t au8DestArray0[256];
+__attribute__((aligned(4))) uint8_t au8DestArray1[256];
+__attribute__((aligned(4))) uint8_t au8DestArray2[256];
+#endif
+
+/* Descriptors are word aligned members of DSCT_T */
+static DSCT_T s_asChainA[2];
+static DSCT_T s_asChainB[1];
+
+static volatile uint32_t s_u32DoneMask = 0;
+static volatile uint32_t s_u32AbortMask = 0;
+
+/**
+ * @brief       DMA IRQ
+ *
+ * @param       None
+ *
+ * @return      None
+ *
+ * @details     Dispatch PDMA events to the channel callbacks.
+ */
+void PDMA0_IRQHandler(void)
+{
+    PDMA_IRQHandler(PDMA0);
+}
+
+/* Channel callback shared by both chains, pvUserData holds the chain bit */
+static void ChainCallback(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    uint32_t u32Bit = (uint32_t)pvUserData;
+
+    (void)u32Ch;
+
+    if(u32Event & PDMA_EVT_ABORT)
+        s_u32AbortMask |= u32Bit;
+
+    if(u32Event & PDMA_EVT_TRANS_DONE)
+        s_u32DoneMask |= u32Bit;
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and cyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART module clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Enable PDMA clock source */
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+void UART0_Init(void)
+{
+    /* Configure UART0 and set UART0 baud rate */
+    UART_Open(UART0, 115200);
+}
+
+int main(void)
+{
+    int32_t i32ChA, i32ChB;
+    uint32_t i, u32Err = 0;
+
+    /* Init System, IP clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART for printf */
+    UART0_Init();
+
+    printf("\n\nCPU @ %dHz\n", SystemCoreClock);
+    printf("+-----------------------------------------------------------------------+ \n");
+    printf("|    PDMA Descriptor Chain and Channel Allocator Sample Code            | \n");
+    printf("+-----------------------------------------------------------------------+ \n");
+
+    for(i = 0; i < sizeof(au8SrcArray); i++)
+        au8SrcArray[i] = (uint8_t)i;
+
+    /*----------------------------------------------------------------------------------
+      Chain A: au8SrcArray -> au8DestArray0 -> au8DestArray1 (32-bit, burst)
+      Chain B: au8SrcArray -> au8DestArray2                 (8-bit, single)
+      Channel numbers are allocated at run time instead of being hard-coded.
+    ----------------------------------------------------------------------------------*/
+    i32ChA = PDMA_RequestChannel(PDMA0, 0);
+    i32ChB = PDMA_RequestChannel(PDMA0, 0);
+
+    if((i32ChA < 0) || (i32ChB < 0))
+    {
+        printf("No free PDMA channel!\n");
+        while(1);
+    }
+
+    printf("Chain A uses channel %d, chain B uses channel %d\n", i32ChA, i32ChB);
+
+    if((PDMA_DescInit(&s_asChainA[0], PDMA_WIDTH_32, (uint32_t)au8SrcArray, PDMA_SAR_INC,
+                      (uint32_t)au8DestArray0, PDMA_DAR_INC, PDMA_TEST_LENGTH, PDMA_REQ_BURST | PDMA_BURST_128) != 0) ||
+            (PDMA_DescInit(&s_asChainA[1], PDMA_WIDTH_32, (uint32_t)au8DestArray0, PDMA_SAR_INC,
+                           (uint32_t)au8DestArray1, PDMA_DAR_INC, PDMA_TEST_LENGTH, PDMA_REQ_BURST | PDMA_BURST_128) != 0) ||
+            (PDMA_DescLink(PDMA0, &s_asChainA[0], &s_asChainA[1], FALSE) != 0) ||
+            (PDMA_DescInit(&s_asChainB[0], PDMA_WIDTH_8, (uint32_t)au8SrcArray, PDMA_SAR_INC,
+                           (uint32_t)au8DestArray2, PDMA_DAR_INC, PDMA_TEST_LENGTH * 4, PDMA_REQ_SINGLE) != 0))
+    {
+        printf("Invalid descriptor!\n");
+        while(1);
+    }
+
+    /* The validation rejects a misaligned 32-bit transfer */
+    if(PDMA_DescInit(&s_asChainB[0], PDMA_WIDTH_32, (uint32_t)&au8SrcArray[1], PDMA_SAR_INC,
+                     (uint32_t)au8DestArray2, PDMA_DAR_INC, PDMA_TEST_LENGTH, PDMA_REQ_SINGLE) != PDMA_ERR_PARAM)
+        u32Err++;
+
+    /* Restore chain B after the negative test */
+    PDMA_DescInit(&s_asChainB[0], PDMA_WIDTH_8, (uint32_t)au8SrcArray, PDMA_SAR_INC,
+                  (uint32_t)au8DestArray2, PDMA_DAR_INC, PDMA_TEST_LENGTH * 4, PDMA_REQ_SINGLE);
+
+    PDMA_SetCallback(PDMA0, (uint32_t)i32ChA, ChainCallback, (void *)0x1);
+    PDMA_SetCallback(PDMA0, (uint32_t)i32ChB, ChainCallback, (void *)0x2);
+    NVIC_EnableIRQ(PDMA0_IRQn);
+
+    PDMA_StartChain(PDMA0, (uint32_t)i32ChA, PDMA_MEM, &s_asChainA[0]);
+    PDMA_StartChain(PDMA0, (uint32_t)i32ChB, PDMA_MEM, &s_asChainB[0]);
+
+    /* Waiting for both chains done */
+    while((s_u32DoneMask | s_u32AbortMask) != 0x3);
+
+    for(i = 0; i < PDMA_TEST_LENGTH * 4; i++)
+    {
+        if((au8DestArray1[i] != au8SrcArray[i]) || (au8DestArray2[i] != au8SrcArray[i]))
+            u32Err++;
+    }
+
+    if(s_u32AbortMask || u32Err)
+        printf("test fail, abort mask 0x%x, error %d\n", s_u32AbortMask, u32Err);
+    else
+        printf("test done...\n");
+
+    NVIC_DisableIRQ(PDMA0_IRQn);
+
+    /* Return the channels for other drivers */
+    PDMA_ReleaseChannel(PDMA0, (uint32_t)i32ChA);
+    PDMA_ReleaseChannel(PDMA0, (uint32_t)i32ChB);
+
+    while(1);
+}
@@ -0,0 +1,219 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Measure CPU and PDMA memory copy/set speed, find the crossover
+ *           point and use it as PDMA_Memcpy/PDMA_Memset CPU fallback threshold.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+
+#define BUF_SIZE    2048
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Global variables                                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+#ifdef __ICCARM__
+#pragma data_alignment=4
+uint8_t au8SrcArray[BUF_SIZE];
+#pragma data_alignment=4
+uint8_t au8DestArray[BUF_SIZE];
+#else
+__attribute__((aligned(4))) uint8_t au8SrcArray[BUF_SIZE];
+__attribute__((aligned(4))) uint8_t au8DestArray[BUF_SIZE];
+#endif
+
+static const uint32_t s_au32TestLen[] = {8, 16, 32, 48, 64, 96, 128, 192, 256, 512, 1024, 2048};
+
+uint32_t volatile g_u32IsTestOver = 0;
+
+/**
+ * @brief       DMA IRQ
+ *
+ * @param       None
+ *
+ * @return      None
+ *
+ * @details     Dispatch PDMA events to the channel callbacks.
+ */
+void PDMA0_IRQHandler(void)
+{
+    PDMA_IRQHandler(PDMA0);
+}
+
+static void MemCallback(uint32_t u32Ch, uint32_t u32Event, void *pvUserData)
+{
+    (void)u32Ch;
+    (void)pvUserData;
+
+    g_u32IsTestOver = (u32Event & PDMA_EVT_ABORT) ? 2 : 1;
+}
+
+/* SysTick runs from HCLK as a 24-bit down counter */
+static void SysTick_Start(void)
+{
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+static uint32_t SysTick_Elapsed(uint32_t u32Start)
+{
+    return (u32Start - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and cyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART module clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Enable PDMA clock source */
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+void UART0_Init()
+{
+
+    /* Configure UART0 and set UART0 baud rate */
+    UART_Open(UART0, 115200);
+}
+
+
+
+int main(void)
+{
+    int32_t i32Ch;
+    uint32_t i, u32Len, u32Start, u32Cpu, u32Dma, u32Crossover = 0, u32Err = 0;
+
+    /* Init System, IP clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART for printf */
+    UART0_Init();
+
+    printf("\n\nCPU @ %dHz\n", SystemCoreClock);
+    printf("+------------------------------------------------------+ \n");
+    printf("|    PDMA Memcpy/Memset Benchmark Sample Code          | \n");
+    printf("+------------------------------------------------------+ \n");
+
+    for(i = 0; i < BUF_SIZE; i++)
+        au8SrcArray[i] = (uint8_t)(i * 7 + 1);
+
+    i32Ch = PDMA_RequestChannel(PDMA0, 0);
+
+    if(i32Ch < 0)
+    {
+        printf("No free PDMA channel!\n");
+        while(1);
+    }
+
+    /* Force PDMA path while measuring */
+    PDMA_SetMemThreshold(0);
+    SysTick_Start();
+
+    /* CSV output: length, CPU cycles, PDMA cycles */
+    printf("len,cpu_memcpy,pdma_memcpy,cpu_memset,pdma_memset\n");
+
+    for(i = 0; i < sizeof(s_au32TestLen) / sizeof(s_au32TestLen[0]); i++)
+    {
+        u32Len = s_au32TestLen[i];
+
+        u32Start = SysTick->VAL;
+        memcpy(au8DestArray, au8SrcArray, u32Len);
+        u32Cpu = SysTick_Elapsed(u32Start);
+
+        memset(au8DestArray, 0, u32Len);
+
+        u32Start = SysTick->VAL;
+        PDMA_Memcpy(PDMA0, (uint32_t)i32Ch, au8DestArray, au8SrcArray, u32Len);
+        u32Dma = SysTick_Elapsed(u32Start);
+
+        if(memcmp(au8DestArray, au8SrcArray, u32Len) != 0)
+            u32Err++;
+
+        if((u32Crossover == 0) && (u32Dma < u32Cpu))
+            u32Crossover = u32Len;
+
+        printf("%u,%u,%u,", (unsigned int)u32Len, (unsigned int)u32Cpu, (unsigned int)u32Dma);
+
+        u32Start = SysTick->VAL;
+        memset(au8DestArray, 0x5A, u32Len);
+        u32Cpu = SysTick_Elapsed(u32Start);
+
+        u32Start = SysTick->VAL;
+        PDMA_Memset(PDMA0, (uint32_t)i32Ch, au8DestArray, 0xA5, u32Len);
+        u32Dma = SysTick_Elapsed(u32Start);
+
+        if((au8DestArray[0] != 0xA5) || (au8DestArray[u32Len - 1] != 0xA5))
+            u32Err++;
+
+        printf("%u,%u\n", (unsigned int)u32Cpu, (unsigned int)u32Dma);
+    }
+
+    /* Misaligned copy uses CPU head/tail bytes and a narrower PDMA width */
+    PDMA_Memcpy(PDMA0, (uint32_t)i32Ch, &au8DestArray[3], &au8SrcArray[1], 1000);
+
+    if(memcmp(&au8DestArray[3], &au8SrcArray[1], 1000) != 0)
+        u32Err++;
+
+    if(u32Crossover == 0)
+        u32Crossover = BUF_SIZE;
+
+    printf("PDMA is faster from %u bytes\n", (unsigned int)u32Crossover);
+    PDMA_SetMemThreshold(u32Crossover);
+
+    /* Asynchronous copy lets CPU continue while PDMA moves the data */
+    PDMA_SetCallback(PDMA0, (uint32_t)i32Ch, MemCallback, NULL);
+    NVIC_EnableIRQ(PDMA0_IRQn);
+    g_u32IsTestOver = 0;
+
+    if(PDMA_MemcpyAsync(PDMA0, (uint32_t)i32Ch, au8DestArray, au8SrcArray, BUF_SIZE) == 0)
+    {
+        while(g_u32IsTestOver == 0)
+            __WFI();
+    }
+
+    if((g_u32IsTestOver == 2) || (memcmp(au8DestArray, au8SrcArray, BUF_SIZE) != 0))
+        u32Err++;
+
+    NVIC_DisableIRQ(PDMA0_IRQn);
+    PDMA_ReleaseChannel(PDMA0, (uint32_t)i32Ch);
+
+    if(u32Err)
+        printf("test fail, error %u\n", (unsigned int)u32Err);
+    else
+        printf("test done...\n");
+
+    while(1);
+}
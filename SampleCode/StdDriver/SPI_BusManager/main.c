@@ -0,0 +1,200 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Demonstrate the SPI bus manager. A SPI flash on SPI0_SS (mode 0,
+ *           8-bit, 8 MHz) and a 16-bit device on GPIO chip select PB.4
+ *           (mode 3, 1 MHz) share SPI0. The main loop reads the flash JEDEC
+ *           ID while SysTick interrupt polls the 16-bit device, each
+ *           transaction switches the bus with 3 register writes.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+
+#define PDMA_THRESHOLD      16
+#define POLL_FREQ           1000    /* SysTick polls of the 16-bit device per second */
+
+/* Function prototype declaration */
+void SYS_Init(void);
+
+/* Global variable declaration */
+static SPI_DEV_T s_sFlash, s_sSensor;
+static SPI_BUS_XFER_T s_sIdXfer, s_sPollXfer;
+static const uint8_t s_au8IdCmd[4] = {0x9F, 0x00, 0x00, 0x00};
+static uint8_t s_au8Id[4];
+static const uint16_t s_au16PollCmd[2] = {0x8000, 0x0000};
+static uint16_t s_au16Poll[2];
+static volatile uint32_t s_u32IdDone, s_u32PollDone, s_u32PollBusy;
+
+void SPI0_IRQHandler(void)
+{
+    SPI_TransferIRQHandler(SPI0);
+}
+
+void PDMA0_IRQHandler(void)
+{
+    PDMA_IRQHandler(PDMA0);
+}
+
+static void PollDone(SPI_BUS_XFER_T *psXfer)
+{
+    if(psXfer->i32Status == SPI_XFER_OK)
+    {
+        s_u32PollDone++;
+    }
+}
+
+static void IdDone(SPI_BUS_XFER_T *psXfer)
+{
+    (void)psXfer;
+
+    s_u32IdDone = 1;
+}
+
+void SysTick_Handler(void)
+{
+    /* Queue from interrupt context, skip the poll if the previous one is still queued */
+    if(SPI_BusSubmit(&s_sPollXfer) != SPI_XFER_OK)
+    {
+        s_u32PollBusy++;
+    }
+}
+
+int main(void)
+{
+    uint32_t u32Round, u32Tick;
+
+    /* Init System, IP clock and multi-function I/O. */
+    SYS_Init();
+
+    /* Configure UART0: 115200, 8-bit word, no parity bit, 1 stop bit. */
+    UART_Open(UART0, 115200);
+
+    printf("\n\n");
+    printf("+--------------------------------------------------------------+\n");
+    printf("|                 SPI Bus Manager Sample Code                  |\n");
+    printf("+--------------------------------------------------------------+\n");
+    printf("\n");
+    printf("SPI0 devices:\n");
+    printf("    SPI flash  : SPI0_SS(PA.3), mode 0,  8-bit, 8 MHz\n");
+    printf("    16-bit dev : PB.4 (GPIO),   mode 3, 16-bit, 1 MHz\n\n");
+
+    /* Enable SPI0 once, the devices carry their own mode, width and clock */
+    SPI_Open(SPI0, SPI_MASTER, SPI_MODE_0, 8, 8000000);
+    SYS_ResetModule(PDMA0_RST);
+    if(SPI_TransferSetPDMA(SPI0, PDMA0, PDMA_THRESHOLD) != SPI_XFER_OK)
+    {
+        printf("No free PDMA channel, all transfers use the FIFO path\n");
+    }
+
+    GPIO_SetMode(PB, BIT4, GPIO_MODE_OUTPUT);
+
+    printf("Flash bus clock %u Hz\n",
+           (unsigned int)SPI_DevInit(&s_sFlash, SPI0, SPI_MODE_0, 8, 8000000, NULL, SPI_SS_ACTIVE_LOW));
+    printf("16-bit device bus clock %u Hz\n\n",
+           (unsigned int)SPI_DevInit(&s_sSensor, SPI0, SPI_MODE_3, 16, 1000000, &PB4, SPI_SS_ACTIVE_LOW));
+
+    s_sIdXfer.psDev = &s_sFlash;
+    s_sIdXfer.pvTxBuf = s_au8IdCmd;
+    s_sIdXfer.pvRxBuf = s_au8Id;
+    s_sIdXfer.u32Len = sizeof(s_au8IdCmd);
+    s_sIdXfer.pfnCallback = IdDone;
+
+    s_sPollXfer.psDev = &s_sSensor;
+    s_sPollXfer.pvTxBuf = s_au16PollCmd;
+    s_sPollXfer.pvRxBuf = s_au16Poll;
+    s_sPollXfer.u32Len = 2;
+    s_sPollXfer.pfnCallback = PollDone;
+
+    NVIC_EnableIRQ(SPI0_IRQn);
+    NVIC_EnableIRQ(PDMA0_IRQn);
+
+    SysTick_Config(SystemCoreClock / POLL_FREQ);
+
+    for(u32Round = 0; u32Round < 10; u32Round++)
+    {
+        /* Queue from thread context */
+        s_u32IdDone = 0;
+
+        if(SPI_BusSubmit(&s_sIdXfer) != SPI_XFER_OK)
+        {
+            printf("Submit failed\n");
+            break;
+        }
+
+        while(s_u32IdDone == 0);
+
+        printf("JEDEC ID %02X %02X %02X (%d), polls %u, skipped %u, last 0x%04X\n",
+               s_au8Id[1], s_au8Id[2], s_au8Id[3], (int)s_sIdXfer.i32Status,
+               (unsigned int)s_u32PollDone, (unsigned int)s_u32PollBusy, s_au16Poll[1]);
+
+        /* SysTick is the poll timer, wait for 100 of its periods */
+        u32Tick = s_u32PollDone + s_u32PollBusy;
+
+        while((s_u32PollDone + s_u32PollBusy - u32Tick) < 100);
+    }
+
+    SysTick->CTRL = 0;
+
+    while(SPI_BusIsBusy(SPI0));
+
+    printf("\nDone.\n");
+
+    while(1);
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set both PCLK0 and PCLK1 as HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and CyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Select SPI0 clock source from HIRC, the device clocks are divided from it */
+    CLK_SetModuleClock(SPI0_MODULE, CLK_CLKSEL2_SPI0SEL_HIRC, MODULE_NoMsk);
+
+    /* Enable UART, SPI0, PDMA0 and GPIO port B module clocks */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(SPI0_MODULE);
+    CLK_EnableModuleClock(PDMA0_MODULE);
+    CLK_EnableModuleClock(GPB_MODULE);
+
+    /*----------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                              */
+    /*----------------------------------------------------------------------*/
+    /* Set multi-function pins for UART0 RXD(PB.12) and TXD(PB.13) */
+    Uart0DefaultMPF();
+
+    /* PA.3 is SPI0_SS, PA.2 is SPI0_CLK, PA.1 is SPI0_MISO, PA.0 is SPI0_MOSI */
+    SYS->GPA_MFPL = (SYS->GPA_MFPL & ~(SYS_GPA_MFPL_PA3MFP_Msk | SYS_GPA_MFPL_PA2MFP_Msk |
+                                       SYS_GPA_MFPL_PA1MFP_Msk | SYS_GPA_MFPL_PA0MFP_Msk)) |
+                    (SYS_GPA_MFPL_PA3MFP_SPI0_SS | SYS_GPA_MFPL_PA2MFP_SPI0_CLK |
+                     SYS_GPA_MFPL_PA1MFP_SPI0_MISO | SYS_GPA_MFPL_PA0MFP_SPI0_MOSI);
+
+    /* PB.4 is the GPIO chip select of the 16-bit device */
+    SYS->GPB_MFPL = (SYS->GPB_MFPL & ~SYS_GPB_MFPL_PB4MFP_Msk) | SYS_GPB_MFPL_PB4MFP_GPIO;
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+/*** (C) COPYRIGHT 2025 Nuvoton Technology Corp. ***/
@@ -0,0 +1,208 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Demonstrate the SPI_Transfer() API. SPI0 is a master with MOSI and
+ *           MISO connected together. Short frames use the FIFO path, long
+ *           frames use PDMA, with 8, 16 and 32-bit data width, TX-only,
+ *           RX-only and asynchronous transfers.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+
+#define PDMA_THRESHOLD      16      /* Frames of at least 16 data units use PDMA */
+#define SPI_CLK_FREQ        2000000
+#define DATA_COUNT          64
+
+/* Function prototype declaration */
+void SYS_Init(void);
+
+/* Global variable declaration */
+static uint32_t s_au32TxBuf[DATA_COUNT];
+static uint32_t s_au32RxBuf[DATA_COUNT];
+static volatile uint32_t s_u32AsyncDone;
+static volatile int32_t s_i32AsyncStatus;
+
+void SPI0_IRQHandler(void)
+{
+    SPI_TransferIRQHandler(SPI0);
+}
+
+void PDMA0_IRQHandler(void)
+{
+    PDMA_IRQHandler(PDMA0);
+}
+
+static void AsyncDone(SPI_T *spi, int32_t i32Status, void *pvUserData)
+{
+    (void)spi;
+    (void)pvUserData;
+
+    s_i32AsyncStatus = i32Status;
+    s_u32AsyncDone = 1;
+}
+
+/* Run one loopback transfer of u32Len data units and compare the received data */
+static int32_t LoopTest(uint32_t u32Width, uint32_t u32Len, uint32_t u32Async)
+{
+    uint32_t u32Bytes = u32Len * ((u32Width == 32) ? 4 : ((u32Width == 16) ? 2 : 1));
+    uint32_t i;
+    int32_t i32Ret;
+
+    SPI_SET_DATA_WIDTH(SPI0, u32Width);
+
+    for(i = 0; i < DATA_COUNT; i++)
+    {
+        s_au32TxBuf[i] = 0x5A000000UL | (u32Width << 16) | (u32Len << 8) | i;
+    }
+
+    memset(s_au32RxBuf, 0, sizeof(s_au32RxBuf));
+
+    if(u32Async)
+    {
+        s_u32AsyncDone = 0;
+        i32Ret = SPI_TransferAsync(SPI0, s_au32TxBuf, s_au32RxBuf, u32Len, AsyncDone, NULL);
+
+        if(i32Ret == SPI_XFER_OK)
+        {
+            /* The CPU is free until the callback */
+            while(s_u32AsyncDone == 0);
+
+            i32Ret = s_i32AsyncStatus;
+        }
+    }
+    else
+    {
+        i32Ret = SPI_Transfer(SPI0, s_au32TxBuf, s_au32RxBuf, u32Len);
+    }
+
+    if(i32Ret != SPI_XFER_OK)
+    {
+        return i32Ret;
+    }
+
+    return (memcmp(s_au32TxBuf, s_au32RxBuf, u32Bytes) == 0) ? 0 : -1;
+}
+
+int main(void)
+{
+    static const uint32_t au32Width[] = {8, 16, 32};
+    static const uint32_t au32Len[] = {4, PDMA_THRESHOLD, DATA_COUNT};
+    uint32_t i, j, u32Async, u32Fail = 0;
+    int32_t i32Ret;
+
+    /* Init System, IP clock and multi-function I/O. */
+    SYS_Init();
+
+    /* Configure UART0: 115200, 8-bit word, no parity bit, 1 stop bit. */
+    UART_Open(UART0, 115200);
+
+    printf("\n\n");
+    printf("+--------------------------------------------------------------+\n");
+    printf("|                SPI Transfer API Sample Code                  |\n");
+    printf("+--------------------------------------------------------------+\n");
+    printf("\n");
+    printf("The I/O connection for loopback test:\n");
+    printf("    SPI0_MISO(PA.1) <--> SPI0_MOSI(PA.0)\n\n");
+    printf("Please press any key to start transmission ...\n");
+    getchar();
+
+    /* Configure as a master, clock idle low, 8-bit transaction, SPI clock rate = 2 MHz */
+    SPI_Open(SPI0, SPI_MASTER, SPI_MODE_0, 8, SPI_CLK_FREQ);
+    SPI_EnableAutoSS(SPI0, SPI_SS, SPI_SS_ACTIVE_LOW);
+
+    /* Frames shorter than PDMA_THRESHOLD data units use the FIFO path */
+    SYS_ResetModule(PDMA0_RST);
+    if(SPI_TransferSetPDMA(SPI0, PDMA0, PDMA_THRESHOLD) != SPI_XFER_OK)
+    {
+        printf("No free PDMA channel, all transfers use the FIFO path\n");
+    }
+
+    NVIC_EnableIRQ(SPI0_IRQn);
+    NVIC_EnableIRQ(PDMA0_IRQn);
+
+    printf("Width  Units  Path  Mode      Result\n");
+
+    for(u32Async = 0; u32Async < 2; u32Async++)
+    {
+        for(i = 0; i < sizeof(au32Width) / sizeof(au32Width[0]); i++)
+        {
+            for(j = 0; j < sizeof(au32Len) / sizeof(au32Len[0]); j++)
+            {
+                i32Ret = LoopTest(au32Width[i], au32Len[j], u32Async);
+
+                printf("%5u  %5u  %-4s  %-8s  %s (%d)\n", (unsigned int)au32Width[i], (unsigned int)au32Len[j],
+                       (au32Len[j] >= PDMA_THRESHOLD) ? "PDMA" : "FIFO", u32Async ? "async" : "blocking",
+                       (i32Ret == 0) ? "PASS" : "FAIL", (int)i32Ret);
+
+                if(i32Ret != 0)
+                {
+                    u32Fail++;
+                }
+            }
+        }
+    }
+
+    /* TX-only and RX-only transfers need no dummy buffer */
+    SPI_SET_DATA_WIDTH(SPI0, 8);
+    i32Ret = SPI_Transfer(SPI0, s_au32TxBuf, NULL, DATA_COUNT);
+    printf("TX-only %u bytes: %d\n", DATA_COUNT, (int)i32Ret);
+    i32Ret = SPI_Transfer(SPI0, NULL, s_au32RxBuf, DATA_COUNT);
+    printf("RX-only %u bytes: %d, first word 0x%08X\n", DATA_COUNT, (int)i32Ret, (unsigned int)s_au32RxBuf[0]);
+
+    printf("\n%u failed case(s)\n", (unsigned int)u32Fail);
+
+    SPI_Close(SPI0);
+
+    while(1);
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Waiting for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Switch the core clock to 40MHz from the MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set both PCLK0 and PCLK1 as HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock and CyclesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /* Switch UART0 clock source to HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /* Enable UART, SPI0 and PDMA0 module clocks */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(SPI0_MODULE);
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    /*----------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                              */
+    /*----------------------------------------------------------------------*/
+    /* Set multi-function pins for UART0 RXD(PB.12) and TXD(PB.13) */
+    Uart0DefaultMPF();
+
+    /* PA.3 is SPI0_SS, PA.2 is SPI0_CLK, PA.1 is SPI0_MISO, PA.0 is SPI0_MOSI */
+    SYS->GPA_MFPL = (SYS->GPA_MFPL & ~(SYS_GPA_MFPL_PA3MFP_Msk | SYS_GPA_MFPL_PA2MFP_Msk |
+                                       SYS_GPA_MFPL_PA1MFP_Msk | SYS_GPA_MFPL_PA0MFP_Msk)) |
+                    (SYS_GPA_MFPL_PA3MFP_SPI0_SS | SYS_GPA_MFPL_PA2MFP_SPI0_CLK |
+                     SYS_GPA_MFPL_PA1MFP_SPI0_MISO | SYS_GPA_MFPL_PA0MFP_SPI0_MOSI);
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+/*** (C) COPYRIGHT 2025 Nuvoton Technology Corp. ***/
@@ -0,0 +1,228 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief
+ *           Receive variable-length UART frames by PDMA circular buffer and
+ *           RX time-out idle-line detection.
+ *
+ * @note
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include "NuMicro.h"
+
+
+#define UART_RX_DMA_CH  0
+#define RXBUFSIZE       64      /* Must be multiple of UART_PDMA_RX_SEG_NUM */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Global variables                                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+static uint8_t s_au8RxBuf[RXBUFSIZE];
+static UART_PDMA_RX_T s_sUart1Rx;
+static volatile uint32_t s_u32FrameReady = 0;
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Define functions prototype                                                                              */
+/*---------------------------------------------------------------------------------------------------------*/
+int32_t main(void);
+void UART_PDMARxIdleTest(void);
+
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* ISR to handle UART Channel 0 interrupt event                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+void UART0_IRQHandler(void)
+{
+    /* Get UART0 Rx data and send the data to UART1 Tx */
+    if(UART_GET_INT_FLAG(UART0, UART_INTSTS_RDAIF_Msk))
+        UART_WRITE(UART1, UART_READ(UART0));
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* ISR to handle UART Channel 1 interrupt event                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+void UART1_IRQHandler(void)
+{
+    /* RX line idle: a frame has been completely received by PDMA */
+    if(UART_PDMARxIRQHandler(&s_sUart1Rx))
+        s_u32FrameReady = 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* UART PDMA circular receive with idle-line framing                                                       */
+/*---------------------------------------------------------------------------------------------------------*/
+void UART_PDMARxIdleTest(void)
+{
+    uint8_t *pu8Data;
+    uint32_t u32Len, i;
+    int32_t i32Exit = 0;
+
+    printf("+-----------------------------------------------------------+\n");
+    printf("|  UART PDMA Circular Receive Test                          |\n");
+    printf("+-----------------------------------------------------------+\n");
+    printf("|  Description :                                            |\n");
+    printf("|    UART0 input is forwarded to UART1 TX. UART1 RX data    |\n");
+    printf("|    is stored by PDMA and shown when the RX line is idle.  |\n");
+    printf("|    Please connect UART1_RXD(PB.2) <--> UART1_TXD(PB.3).   |\n");
+    printf("|    Paste a line or type any to test  (Press '0' to exit)  |\n");
+    printf("+-----------------------------------------------------------+\n");
+
+    /* Reset PDMA module */
+    SYS_ResetModule(PDMA0_RST);
+
+    if(UART_PDMARxStart(&s_sUart1Rx, UART1, PDMA, UART_RX_DMA_CH, s_au8RxBuf, RXBUFSIZE) != 0)
+    {
+        printf("UART PDMA receive start failed!\n");
+        return;
+    }
+
+    NVIC_EnableIRQ(UART1_IRQn);
+
+    /* Enable UART0 RDA interrupt to forward input to UART1 */
+    NVIC_EnableIRQ(UART0_IRQn);
+    UART_EnableInt(UART0, UART_INTEN_RDAIEN_Msk);
+
+    while(i32Exit == 0)
+    {
+        /* Sleep until the idle-line interrupt; PDMA stores data without waking CPU */
+        while(s_u32FrameReady == 0)
+            __WFI();
+
+        s_u32FrameReady = 0;
+
+        printf("Frame %u:", (unsigned int)s_sUart1Rx.u32FrameCount);
+
+        /* A frame can wrap the ring end, so it may take two spans */
+        while((u32Len = UART_PDMARxPeek(&s_sUart1Rx, &pu8Data)) != 0ul)
+        {
+            for(i = 0ul; i < u32Len; i++)
+            {
+                printf(" %c", pu8Data[i]);
+
+                if(pu8Data[i] == '0')
+                    i32Exit = 1;
+            }
+
+            UART_PDMARxConsume(&s_sUart1Rx, u32Len);
+        }
+
+        printf("\n");
+    }
+
+    UART_DisableInt(UART0, UART_INTEN_RDAIEN_Msk);
+    NVIC_DisableIRQ(UART0_IRQn);
+
+    UART_PDMARxStop(&s_sUart1Rx);
+    NVIC_DisableIRQ(UART1_IRQn);
+
+    printf("\nFIFO overrun %u\n", (unsigned int)s_sUart1Rx.u32FifoOverrun);
+    printf("\nUART Sample Demo End.\n");
+}
+
+void SYS_Init(void)
+{
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init System Clock                                                                                       */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable HIRC clock (Internal RC 16MHz) */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Wait for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Set core clock as 40MHz from MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Select IP clock source */
+    /* Select UART0 clock source is HIRC */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+    /* Select UART1 clock source is HIRC */
+    CLK_SetModuleClock(UART1_MODULE, CLK_CLKSEL2_UART1SEL_HIRC, CLK_CLKDIV_UART1(1));
+
+    /* Enable UART0 peripheral clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+    /* Enable UART1 peripheral clock */
+    CLK_EnableModuleClock(UART1_MODULE);
+    /* Enable PDMA module clock */
+    CLK_EnableModuleClock(PDMA0_MODULE);
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate PllClock, SystemCoreClock and CycylesPerUs automatically. */
+    SystemCoreClockUpdate();
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                                                                 */
+    /*---------------------------------------------------------------------------------------------------------*/
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+
+    /* Set PB multi-function pins for UART1 RXD(PB.2) and TXD(PB.3) */
+    SYS->GPB_MFPL = (SYS->GPB_MFPL & ~(SYS_GPB_MFPL_PB2MFP_Msk | SYS_GPB_MFPL_PB3MFP_Msk))    |       \
+                    (SYS_GPB_MFPL_PB2MFP_UART1_RXD | SYS_GPB_MFPL_PB3MFP_UART1_TXD);
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+void UART0_Init()
+{
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init UART                                                                                               */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Reset UART0 */
+    SYS_ResetModule(UART0_RST);
+
+    /* Configure UART0 and set UART0 baud rate */
+    UART_Open(UART0, 115200);
+}
+
+void UART1_Init()
+{
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init UART                                                                                               */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Reset UART1 */
+    SYS_ResetModule(UART1_RST);
+
+    /* Configure UART1 and set UART1 Baudrate */
+    UART_Open(UART1, 115200);
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Main Function                                                                                          */
+/*---------------------------------------------------------------------------------------------------------*/
+int32_t main(void)
+{
+    /* Init System, peripheral clock and multi-function I/O */
+    SYS_Init();
+
+    /* Init UART0 for printf */
+    UART0_Init();
+
+    /* Init UART1 for test */
+    UART1_Init();
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* SAMPLE CODE                                                                                             */
+    /*---------------------------------------------------------------------------------------------------------*/
+
+    printf("\n\nCPU @ %d Hz\n", SystemCoreClock);
+
+    printf("\nUART PDMA Circular Receive Sample Program\n");
+
+    /* UART sample function */
+    UART_PDMARxIdleTest();
+
+    while(1);
+}
@@ -0,0 +1,190 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief
+ *           Demonstrate interrupt-driven UART ring buffer with non-blocking read/write.
+ *
+ * @note
+ * SPDX-License-Identifier: Apache-2.0
+ * @copyright (C) 2025 Nuvoton Technology Corp. All rights reserved.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+
+#define TXBUFSIZE   256     /* Must be power of two */
+#define RXBUFSIZE   128     /* Must be power of two */
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Global variables                                                                                        */
+/*---------------------------------------------------------------------------------------------------------*/
+static uint8_t s_au8TxBuf[TXBUFSIZE];
+static uint8_t s_au8RxBuf[RXBUFSIZE];
+static UART_BUF_T s_sUart0Buf;
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* Define functions prototype                                                                              */
+/*---------------------------------------------------------------------------------------------------------*/
+int32_t main(void);
+void UART_RingBufferTest(void);
+
+
+void SYS_Init(void)
+{
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init System Clock                                                                                       */
+    /*---------------------------------------------------------------------------------------------------------*/
+
+    /* Enable HIRC clock (Internal RC 16MHz) */
+    CLK_EnableXtalRC(CLK_PWRCTL_HIRCEN_Msk);
+
+    /* Wait for HIRC clock ready */
+    CLK_WaitClockReady(CLK_STATUS_HIRCSTB_Msk);
+
+    /* Set core clock as 40MHz from MIRC */
+    CLK_SetCoreClock(FREQ_40MHZ);
+
+    /* Set PCLK0/PCLK1 to HCLK/2 */
+    CLK->PCLKDIV = (CLK_PCLKDIV_APB0DIV_DIV2 | CLK_PCLKDIV_APB1DIV_DIV2);
+
+    /* Enable UART module clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+
+    /* Select UART module clock source as HIRC and UART module clock divider as 1 */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL2_UART0SEL_HIRC, CLK_CLKDIV_UART0(1));
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                                                                 */
+    /*---------------------------------------------------------------------------------------------------------*/
+
+    /* Set PB multi-function pins for UART0 RXD=PB.12 and TXD=PB.13 */
+    Uart0DefaultMPF();
+}
+
+void UART0_Init()
+{
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init UART                                                                                               */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Reset UART0 */
+    SYS_ResetModule(UART0_RST);
+
+    /* Configure UART0 and set UART0 baud rate */
+    UART_Open(UART0, 115200);
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  Main Function                                                                                          */
+/*---------------------------------------------------------------------------------------------------------*/
+int32_t main(void)
+{
+
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Init System, peripheral clock and multi-function I/O */
+    SYS_Init();
+
+    /* Lock protected registers */
+    SYS_LockReg();
+
+    /* Init UART0 for printf and test */
+    UART0_Init();
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* SAMPLE CODE                                                                                             */
+    /*---------------------------------------------------------------------------------------------------------*/
+
+    printf("\n\nCPU @ %d Hz\n", SystemCoreClock);
+
+    printf("\nUART Ring Buffer Sample Program\n");
+
+    /* UART sample function */
+    UART_RingBufferTest();
+
+    while(1);
+
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/* ISR to handle UART Channel 0 interrupt event                                                            */
+/*---------------------------------------------------------------------------------------------------------*/
+void UART0_IRQHandler(void)
+{
+    UART_BufIRQHandler(&s_sUart0Buf);
+}
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*  UART Ring Buffer Test                                                                                  */
+/*---------------------------------------------------------------------------------------------------------*/
+void UART_RingBufferTest()
+{
+    uint8_t *pu8Data;
+    uint32_t u32Len, i;
+    int32_t i32Exit = 0;
+    char acLine[64];
+
+    printf("+-----------------------------------------------------------+\n");
+    printf("|  UART Ring Buffer Test                                    |\n");
+    printf("+-----------------------------------------------------------+\n");
+    printf("|  Description :                                            |\n");
+    printf("|    Input chars are echoed through the ring buffers while  |\n");
+    printf("|    CPU sleeps between UART interrupts.                    |\n");
+    printf("|    Please enter any to start     (Press '0' to exit)      |\n");
+    printf("+-----------------------------------------------------------+\n");
+
+    /* Wait printf data left UART0 before ring buffer owns the TX FIFO */
+    UART_WAIT_TX_EMPTY(UART0);
+
+    if(UART_BufInit(&s_sUart0Buf, UART0, s_au8TxBuf, TXBUFSIZE, s_au8RxBuf, RXBUFSIZE) != 0)
+    {
+        printf("Ring buffer init failed!\n");
+        return;
+    }
+
+    NVIC_EnableIRQ(UART0_IRQn);
+
+    while(i32Exit == 0)
+    {
+        /* Sleep until UART interrupt moves data between FIFO and rings */
+        __WFI();
+
+        /* Echo received data directly from the receive ring without copying */
+        while((u32Len = UART_PeekRx(&s_sUart0Buf, &pu8Data)) != 0ul)
+        {
+            for(i = 0ul; i < u32Len; i++)
+            {
+                if(pu8Data[i] == '0')
+                {
+                    i32Exit = 1;
+                }
+            }
+
+            u32Len = UART_WriteAsync(&s_sUart0Buf, pu8Data, u32Len);
+            UART_ConsumeRx(&s_sUart0Buf, u32Len);
+
+            if(u32Len == 0ul)
+            {
+                /* Transmit ring is full, wait THRE interrupt to drain it */
+                break;
+            }
+        }
+    }
+
+    sprintf(acLine, "\nRX overflow %u, TX overflow %u, FIFO overrun %u\n",
+            (unsigned int)s_sUart0Buf.u32RxOverflow,
+            (unsigned int)s_sUart0Buf.u32TxOverflow,
+            (unsigned int)s_sUart0Buf.u32FifoOverrun);
+    UART_WriteAsync(&s_sUart0Buf, (uint8_t *)acLine, strlen(acLine));
+
+    /* Wait all queued data is sent before returning TX FIFO to printf */
+    while(!UART_BUF_IS_TX_DONE(&s_sUart0Buf));
+    UART_WAIT_TX_EMPTY(UART0);
+
+    UART_BufClose(&s_sUart0Buf);
+    NVIC_DisableIRQ(UART0_IRQn);
+
+    printf("\nUART Sample Demo End.\n");
+}